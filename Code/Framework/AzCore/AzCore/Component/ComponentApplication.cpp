@@ -21,6 +21,8 @@
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
 
 #include <AzCore/Metrics/EventLoggerFactoryImpl.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
@@ -916,6 +918,8 @@ namespace AZ
 
         MergeSettingsToRegistry(*m_settingsRegistry);
 
+        ConfigureSystemAllocatorThreadCache();
+
         m_systemEntity = AZStd::make_unique<AZ::Entity>(SystemEntityId, "SystemEntity");
         CreateCommon();
         AZ_Assert(m_systemEntity, "SystemEntity failed to initialize!");
@@ -1095,6 +1099,17 @@ namespace AZ
         }
     }
 
+    //=========================================================================
+    // ConfigureSystemAllocatorThreadCache
+    //=========================================================================
+    void ComponentApplication::ConfigureSystemAllocatorThreadCache()
+    {
+        if (bool threadCacheEnabled{}; m_settingsRegistry->Get(threadCacheEnabled, SystemAllocator::ThreadCacheEnabledKey))
+        {
+            AllocatorInstance<SystemAllocator>::Get().SetThreadCacheEnabled(threadCacheEnabled);
+        }
+    }
+
     void ComponentApplication::MergeSharedSettings(
         SettingsRegistryInterface& registry,
         const AZ::SettingsRegistryInterface::Specializations& specializations,
@@ -1619,6 +1634,12 @@ namespace AZ
     {
         AZ_PROFILE_SCOPE(System, "Component application simulation tick");
 
+        {
+            // Release the transient allocations of the previous tick
+            AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:FrameArenaNextFrame");
+            static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get()).NextFrame();
+        }
+
         // Only record when the record metrics on tick callback is set
         if (m_recordMetricsOnTickCallback)
         {
@@ -313,6 +313,9 @@ namespace AZ
         /// Create the system allocator to track allocations
         void        ConfigureSystemAllocatorTracking();
 
+        /// Apply the system allocator thread cache setting of the settings registry, if it has one
+        void        ConfigureSystemAllocatorThreadCache();
+
         virtual void MergeSettingsToRegistry(SettingsRegistryInterface& registry);
 
         void MergeSharedSettings(
@@ -186,6 +186,16 @@ namespace AZ
          */
         using EventQueueMutexType = NullMutex;
 
+        /**
+         * Storage and dispatch policy for the event queue.
+         * Used only when #EnableEventQueue is true.
+         * By default, queued messages are stored in a single queue guarded by the #EventQueueMutexType.
+         * Buses that are heavily queued to from many threads can use AZ::EBusMultiProducerQueuePolicy
+         * (see EBusMultiProducerQueueTraits.h) so that producers don't serialize on the queue mutex.
+         */
+        template <bool IsEnabled, class Bus, class MutexType>
+        using EventQueuePolicy = EBusQueuePolicy<IsEnabled, Bus, MutexType>;
+
         /**
          * Enables custom logic to run when a handler connects or
          * disconnects from the EBus.
@@ -497,7 +507,7 @@ namespace AZ
         /**
          * Policy for the function queue.
          */
-        using QueuePolicy = EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
+        using QueuePolicy = typename Traits::template EventQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
 
         /**
          * Enables custom logic to run when a handler connects to
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    /**
+     * EBusMultiProducerQueuePolicy is an event queue policy for buses that are queued to from many threads at once.
+     *
+     * The default EBusQueuePolicy stores all queued messages in a single queue guarded by the EventQueueMutexType, so every
+     * QueueBroadcast / QueueEvent / QueueFunction call serializes on that mutex. This policy instead spreads queued messages
+     * over a fixed set of cache line aligned producer slots. Each producer thread is always mapped to the same slot, and
+     * pushes onto it with a single compare-and-swap, so producers never take a lock. ExecuteQueuedEvents detaches every slot
+     * and runs its messages in the order they were queued.
+     *
+     * Features:
+     *   - Queueing is lock-free and producers on different threads rarely touch the same cache line.
+     *   - Messages queued by a single thread are executed in the order they were queued.
+     *   - Messages queued while ExecuteQueuedEvents is running are executed on the next call, matching EBusQueuePolicy.
+     *
+     * Limitations:
+     *   - There is no ordering guarantee between messages queued by different threads.
+     *   - Each queued message is a separately allocated node, so single threaded queueing is slightly slower than EBusQueuePolicy.
+     *   - ExecuteQueuedEvents, ClearQueuedEvents and AllowFunctionQueuing(false) must not be called concurrently with each other.
+     *
+     * Usage:
+     *   To use the policy, inherit from EBusMultiProducerQueueTraits:
+     *      class MyBus : public AZ::EBusMultiProducerQueueTraits
+     *
+     *   Alternatively, you can directly define the queue policy in your traits:
+     *      static constexpr bool EnableEventQueue = true;
+     *
+     *      template <bool IsEnabled, class Bus, class MutexType>
+     *      using EventQueuePolicy = AZ::EBusMultiProducerQueuePolicy<IsEnabled, Bus, MutexType>;
+     */
+    template <bool IsEnabled, class Bus, class MutexType>
+    struct EBusMultiProducerQueuePolicy
+        : public EBusQueuePolicy<IsEnabled, Bus, MutexType>
+    {
+    };
+
+    template <class Bus, class MutexType>
+    struct EBusMultiProducerQueuePolicy<true, Bus, MutexType>
+    {
+        typedef AZStd::function<void()> BusMessageCall;
+
+        //! Number of producer slots. Threads are distributed over the slots by their thread id, so this bounds the number of
+        //! producers that can queue without sharing a slot.
+        static constexpr size_t ProducerSlotCount = 64;
+
+        EBusMultiProducerQueuePolicy() = default;
+        EBusMultiProducerQueuePolicy(const EBusMultiProducerQueuePolicy&) = delete;
+        EBusMultiProducerQueuePolicy& operator=(const EBusMultiProducerQueuePolicy&) = delete;
+
+        ~EBusMultiProducerQueuePolicy()
+        {
+            Clear();
+        }
+
+        void QueueMessage(BusMessageCall&& message)
+        {
+            typename Bus::AllocatorType allocator;
+            void* address = allocator.allocate(sizeof(MessageNode), alignof(MessageNode));
+            MessageNode* node = new (address) MessageNode{ AZStd::move(message), nullptr };
+
+            ProducerSlot& slot = m_slots[GetProducerSlotIndex()];
+            // Count the message before publishing it. Once the node is visible DetachSlot can take it and subtract it from the
+            // count, so counting afterwards could briefly wrap the count around.
+            slot.m_count.fetch_add(1, AZStd::memory_order_relaxed);
+            MessageNode* head = slot.m_head.load(AZStd::memory_order_relaxed);
+            do
+            {
+                node->m_next = head;
+            } while (!slot.m_head.compare_exchange_weak(head, node, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+        }
+
+        void Execute()
+        {
+            AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
+
+            // Detach all the slots before executing anything so that messages queued by the executed functions are deferred to
+            // the next call, the same as with the default queue policy.
+            MessageNode* detached[ProducerSlotCount];
+            for (size_t slotIndex = 0; slotIndex < ProducerSlotCount; ++slotIndex)
+            {
+                detached[slotIndex] = DetachSlot(m_slots[slotIndex]);
+            }
+
+            for (MessageNode* node : detached)
+            {
+                while (node)
+                {
+                    MessageNode* next = node->m_next;
+                    node->m_message();
+                    DestroyNode(node);
+                    node = next;
+                }
+            }
+        }
+
+        void Clear()
+        {
+            for (ProducerSlot& slot : m_slots)
+            {
+                MessageNode* node = DetachSlot(slot);
+                while (node)
+                {
+                    MessageNode* next = node->m_next;
+                    DestroyNode(node);
+                    node = next;
+                }
+            }
+        }
+
+        void SetActive(bool isActive)
+        {
+            m_isActive = isActive;
+            if (!m_isActive)
+            {
+                Clear();
+            }
+        };
+
+        bool IsActive()
+        {
+            return m_isActive;
+        }
+
+        //! Returns the number of queued messages. While producers are queueing this may include messages that are about to be
+        //! queued, but it never includes messages that were already executed or cleared.
+        size_t Count()
+        {
+            size_t count = 0;
+            for (const ProducerSlot& slot : m_slots)
+            {
+                count += slot.m_count.load(AZStd::memory_order_relaxed);
+            }
+            return count;
+        }
+
+        bool m_isActive = Bus::Traits::EventQueueingActiveByDefault;
+
+    private:
+        struct MessageNode
+        {
+            BusMessageCall m_message;
+            MessageNode* m_next;
+        };
+
+        // Slots are padded rather than aligned to a cache line so that the bus context doesn't become an over-aligned type
+        // for the storage policies that allocate it.
+        struct ProducerSlot
+        {
+            AZStd::atomic<MessageNode*> m_head{ nullptr };
+            AZStd::atomic<size_t> m_count{ 0 };
+            char m_padding[64 - sizeof(AZStd::atomic<MessageNode*>) - sizeof(AZStd::atomic<size_t>)];
+        };
+
+        static size_t GetProducerSlotIndex()
+        {
+            // The slot is derived from the thread id rather than a thread_local counter so that a thread maps to the same slot
+            // from every module, which is what keeps the per-producer ordering guarantee.
+            const size_t threadHash = AZStd::hash<AZStd::thread_id>{}(AZStd::this_thread::get_id());
+            // Thread ids are usually aligned addresses, so mix the bits before picking a slot.
+            return static_cast<size_t>((static_cast<AZ::u64>(threadHash) * 0x9E3779B97F4A7C15ull) >> 32) % ProducerSlotCount;
+        }
+
+        //! Takes ownership of every message in the slot and returns them as a list in the order they were queued.
+        static MessageNode* DetachSlot(ProducerSlot& slot)
+        {
+            MessageNode* node = slot.m_head.exchange(nullptr, AZStd::memory_order_acquire);
+            if (!node)
+            {
+                return nullptr;
+            }
+
+            // The slot is a stack, reverse it to restore the queueing order.
+            size_t count = 0;
+            MessageNode* reversed = nullptr;
+            while (node)
+            {
+                MessageNode* next = node->m_next;
+                node->m_next = reversed;
+                reversed = node;
+                node = next;
+                ++count;
+            }
+            slot.m_count.fetch_sub(count, AZStd::memory_order_relaxed);
+            return reversed;
+        }
+
+        static void DestroyNode(MessageNode* node)
+        {
+            node->~MessageNode();
+            typename Bus::AllocatorType allocator;
+            allocator.deallocate(node, sizeof(MessageNode), alignof(MessageNode));
+        }
+
+        ProducerSlot m_slots[ProducerSlotCount];
+    };
+
+    // The EBusTraits that can be inherited from to enable the event queue with the multi-producer queue policy.
+    // To inherit, use "class MyBus : public AZ::EBusMultiProducerQueueTraits"
+    struct EBusMultiProducerQueueTraits : EBusTraits
+    {
+        static constexpr bool EnableEventQueue = true;
+
+        template <bool IsEnabled, class Bus, class MutexType>
+        using EventQueuePolicy = AZ::EBusMultiProducerQueuePolicy<IsEnabled, Bus, MutexType>;
+    };
+
+} // namespace AZ
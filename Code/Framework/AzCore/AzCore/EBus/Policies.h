@@ -247,6 +247,12 @@ namespace AZ
         MessageQueueType            m_messages;
         MutexType                   m_messagesMutex;        ///< Used to control access to the m_messages. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
 
+        void QueueMessage(BusMessageCall&& message)
+        {
+            AZStd::scoped_lock lock(m_messagesMutex);
+            m_messages.push(AZStd::move(message));
+        }
+
         void Execute()
         {
             AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
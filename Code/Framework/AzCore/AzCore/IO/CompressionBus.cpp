@@ -22,6 +22,7 @@ namespace AZ::IO
         m_decompressor = AZStd::move(rhs.m_decompressor);
         m_archiveFilename = AZStd::move(rhs.m_archiveFilename);
         m_compressionTag = rhs.m_compressionTag;
+        m_dictionary = rhs.m_dictionary;
         m_offset = rhs.m_offset;
         m_compressedSize = rhs.m_compressedSize;
         m_uncompressedSize = rhs.m_uncompressedSize;
@@ -11,6 +11,7 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -49,6 +50,9 @@ namespace AZ
             DecompressionFunc m_decompressor;
             //< Tag that uniquely identifies the compressor responsible for decompressing the referenced data.
             CompressionTag m_compressionTag{ 0 };
+            //! Dictionary the file was compressed with, if any. The memory is owned by the archive and must outlive the read.
+            //! Decompressors that read parts of a file without going through m_decompressor need it to decompress the data.
+            AZStd::span<const AZStd::byte> m_dictionary;
             //! Offset into the archive file for the found file.
             size_t m_offset = 0;
             //! On disk size of the compressed file.
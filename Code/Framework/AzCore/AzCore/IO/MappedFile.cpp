@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/std/utility/move.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ::IO
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other)
+        : m_data(AZStd::exchange(other.m_data, nullptr))
+        , m_size(AZStd::exchange(other.m_size, 0))
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other)
+    {
+        if (this != &other)
+        {
+            Close();
+            m_data = AZStd::exchange(other.m_data, nullptr);
+            m_size = AZStd::exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+
+    bool MappedFile::Open(const char* filePath)
+    {
+        Close();
+
+        AZ::u64 size = 0;
+        const AZStd::byte* data = Platform::MapFile(filePath, size);
+        if (data == nullptr)
+        {
+            return false;
+        }
+
+        m_data = data;
+        m_size = size;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data != nullptr)
+        {
+            Platform::UnmapFile(m_data, m_size);
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+
+    bool MappedFile::IsOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    AZStd::span<const AZStd::byte> MappedFile::GetView() const
+    {
+        return { m_data, m_size };
+    }
+
+    AZStd::span<const AZStd::byte> MappedFile::GetView(AZ::u64 offset, AZ::u64 size) const
+    {
+        if (offset >= m_size)
+        {
+            return {};
+        }
+        return { m_data + offset, AZStd::min(size, m_size - offset) };
+    }
+
+    AZ::u64 MappedFile::GetSize() const
+    {
+        return m_size;
+    }
+} // namespace AZ::IO
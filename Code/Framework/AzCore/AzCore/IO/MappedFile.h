@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AZ::IO
+{
+    //! Read-only memory mapping of an entire file.
+    //! Reading from the mapping doesn't require any system calls and pages are shared with the OS file cache, which makes it
+    //! well suited for large files that are read in many small pieces, such as archives.
+    //! The file can't be modified or truncated while it's mapped. Accessing pages of a file that was truncated after mapping
+    //! raises a bus error on POSIX platforms.
+    class AZCORE_API MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other);
+        MappedFile& operator=(MappedFile&& other);
+
+        //! Maps the file at the native file path. Any previously mapped file is unmapped first.
+        //! @return True if the file was mapped. Empty files can't be mapped and return false.
+        bool Open(const char* filePath);
+        void Close();
+        bool IsOpen() const;
+
+        //! Returns a view of the entire mapped file.
+        AZStd::span<const AZStd::byte> GetView() const;
+        //! Returns a view of the bytes in the range [offset, offset + size). If the range extends past the end of the file,
+        //! the view is truncated to the end of the file. An empty view is returned if the offset is out of range.
+        AZStd::span<const AZStd::byte> GetView(AZ::u64 offset, AZ::u64 size) const;
+        AZ::u64 GetSize() const;
+
+    private:
+        const AZStd::byte* m_data{ nullptr };
+        AZ::u64 m_size{ 0 };
+    };
+
+    namespace Platform
+    {
+        //! Maps the file read-only and returns the start of the mapping, or null on failure. The file handle doesn't need to
+        //! remain open, the mapping keeps the file alive until it's unmapped.
+        const AZStd::byte* MapFile(const char* filePath, AZ::u64& size);
+        void UnmapFile(const AZStd::byte* data, AZ::u64 size);
+    } // namespace Platform
+} // namespace AZ::IO
@@ -8,11 +8,14 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace AZ::IO
@@ -46,7 +49,8 @@ namespace AZ::IO
         }
 
         auto stackEntry = AZStd::make_shared<BlockCache>(
-            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false);
+            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false,
+            m_readAheadBlocks, m_maxConcurrentPrefetches);
         stackEntry->SetNext(AZStd::move(parent));
         return stackEntry;
     }
@@ -62,14 +66,31 @@ namespace AZ::IO
                 ->Value("SizeAlignment", BlockSize::SizeAlignment);
 
             serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("CacheSizeMib", &BlockCacheConfig::m_cacheSizeMib)
-                ->Field("BlockSize", &BlockCacheConfig::m_blockSize);
+                ->Field("BlockSize", &BlockCacheConfig::m_blockSize)
+                ->Field("ReadAheadBlocks", &BlockCacheConfig::m_readAheadBlocks)
+                ->Field("MaxConcurrentPrefetches", &BlockCacheConfig::m_maxConcurrentPrefetches);
         }
     }
 
     static constexpr char CacheHitRateName[] = "Cache hit rate";
     static constexpr char CacheableName[] = "Cacheable";
+    static constexpr char PrefetchAccuracyName[] = "Prefetch accuracy";
+
+    //! Header of the sidecar file with an access trace. The header is followed by the file paths, each stored as
+    //! a u32 length followed by the characters, and then by the trace entries.
+    struct AccessTraceHeader
+    {
+        static constexpr u32 s_magic = 0x54414342; // "BCAT"
+        static constexpr u32 s_version = 1;
+
+        u32 m_magic{ s_magic };
+        u32 m_version{ s_version };
+        u32 m_blockSize{ 0 };
+        u32 m_fileCount{ 0 };
+        u32 m_entryCount{ 0 };
+    };
 
     void BlockCache::Section::Prefix(const Section& section)
     {
@@ -99,9 +120,12 @@ namespace AZ::IO
         m_blockOffset = 0; // Two merged sections do not support caching.
     }
 
-    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
+    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites,
+        u32 readAheadBlocks, u32 maxConcurrentPrefetches)
         : StreamStackEntry("Block cache")
         , m_alignment(alignment)
+        , m_readAheadBlocks(readAheadBlocks)
+        , m_maxConcurrentPrefetches(maxConcurrentPrefetches)
         , m_onlyEpilogWrites(onlyEpilogWrites)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
@@ -121,6 +145,11 @@ namespace AZ::IO
         m_cachedOffsets = AZStd::unique_ptr<u64[]>(new u64[m_numBlocks]);
         m_blockLastTouched = AZStd::unique_ptr<TimePoint[]>(new TimePoint[m_numBlocks]);
         m_inFlightRequests = AZStd::unique_ptr<FileRequest*[]>(new FileRequest*[m_numBlocks]);
+        m_unusedPrefetches = AZStd::unique_ptr<bool[]>(new bool[m_numBlocks]{});
+        if (m_readAheadBlocks > 0)
+        {
+            m_accessPatterns.reserve(s_maxTrackedFiles);
+        }
 
         ResetCache();
     }
@@ -156,6 +185,17 @@ namespace AZ::IO
                 {
                     Report(args);
                 }
+                else if constexpr (AZStd::is_same_v<Command, Requests::CustomData>)
+                {
+                    if (auto beginTrace = AZStd::any_cast<BlockCacheBeginAccessTrace>(&args.m_data); beginTrace != nullptr)
+                    {
+                        BeginAccessTrace(*beginTrace);
+                    }
+                    else if (args.m_data.template is<BlockCacheEndAccessTrace>())
+                    {
+                        EndAccessTrace();
+                    }
+                }
                 StreamStackEntry::QueueRequest(request);
             }
         }, request->GetCommand());
@@ -181,8 +221,9 @@ namespace AZ::IO
             }
             m_delayedSections.pop_front();
         }
+        bool prefetchIssued = ExecutePrefetches();
         bool nextResult = StreamStackEntry::ExecuteRequests();
-        return nextResult || delayedRequestProcessed;
+        return nextResult || delayedRequestProcessed || prefetchIssued;
     }
 
     void BlockCache::UpdateStatus(Status& status) const
@@ -285,6 +326,8 @@ namespace AZ::IO
             return;
         }
 
+        UpdateAccessPattern(data.m_path, fileLength, data.m_offset, data.m_size);
+
         if (prolog.m_used || epilog.m_used)
         {
             m_cacheableStat.PushSample(1.0);
@@ -292,11 +335,15 @@ namespace AZ::IO
         }
         else
         {
-            // Nothing to cache so simply forward the call to the next entry in the stack for direct reading.
             m_cacheableStat.PushSample(0.0);
             Statistic::PlotImmediate(m_name, CacheableName, m_cacheableStat.GetMostRecentSample());
-            m_next->QueueRequest(request);
-            return;
+            if (m_numUnusedPrefetches == 0)
+            {
+                // Nothing to cache so simply forward the call to the next entry in the stack for direct reading.
+                m_next->QueueRequest(request);
+                return;
+            }
+            // The request isn't cacheable, but the start of it may have been prefetched.
         }
 
         bool fullyCached = true;
@@ -336,6 +383,11 @@ namespace AZ::IO
             }
         }
 
+        if (main.m_used)
+        {
+            fullyCached = ReadMainFromCache(request, main, data.m_path) && fullyCached;
+        }
+
         if (main.m_used)
         {
             FileRequest* mainRequest = m_context->GetNewInternalRequest();
@@ -394,6 +446,18 @@ namespace AZ::IO
             m_name, "Available slots", CalculateAvailableRequestSlots(),
             "The total number of slots available to processing cache-able requests with. If this value is low more memory may need to be "
             "allocated to the cache so more slots are available."));
+        statistics.push_back(Statistic::CreatePercentage(
+            m_name, PrefetchAccuracyName, CalculatePrefetchAccuracyPercentage(),
+            "The percentage of prefetched blocks that were read from before they were evicted from the cache. Low values mean the "
+            "read-ahead is wasting bandwidth on data that isn't needed or that the cache is too small to hold on to the prefetched "
+            "blocks until they're requested."));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Prefetches issued", aznumeric_caster(m_numPrefetchesIssued),
+            "The total number of cache blocks that were read ahead of being requested, either because of a detected access pattern "
+            "or because they were part of a replayed access trace."));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Pending prefetches", aznumeric_caster(m_pendingPrefetches.size()),
+            "The number of cache blocks waiting for the cache to have spare room to be prefetched."));
 
         StreamStackEntry::CollectStatistics(statistics);
     }
@@ -408,6 +472,11 @@ namespace AZ::IO
         return m_cacheableStat.GetAverage();
     }
 
+    double BlockCache::CalculatePrefetchAccuracyPercentage() const
+    {
+        return m_prefetchAccuracyStat.GetAverage();
+    }
+
     s32 BlockCache::CalculateAvailableRequestSlots() const
     {
         return  aznumeric_cast<s32>(m_numBlocks) - m_numInFlightRequests - m_numMetaDataRetrievalInProgress -
@@ -429,6 +498,13 @@ namespace AZ::IO
 
     BlockCache::CacheResult BlockCache::ReadFromCache(FileRequest* request, Section& section, u32 cacheBlock)
     {
+        if (m_unusedPrefetches[cacheBlock])
+        {
+            // Prefetched blocks are never missed, so record them explicitly to keep them in the next access trace.
+            RecordAccess(m_cachedPaths[cacheBlock], section.m_readOffset, section.m_readSize);
+            UsePrefetchedBlock(cacheBlock, true);
+        }
+
         if (!IsCacheBlockInFlight(cacheBlock))
         {
             TouchBlock(cacheBlock);
@@ -458,6 +534,7 @@ namespace AZ::IO
         {
             m_hitRateStat.PushSample(0.0);
             Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+            RecordAccess(filePath, section.m_readOffset, section.m_readSize);
 
             section.m_parent = request;
             cacheLocation = RecycleOldestBlock(filePath, section.m_readOffset);
@@ -537,7 +614,8 @@ namespace AZ::IO
                 section.m_wait = nullptr;
             }
 
-            if (requestWasSuccessful)
+            // Prefetches don't have a section to copy to.
+            if (requestWasSuccessful && section.m_copySize > 0)
             {
                 memcpy(section.m_output, GetCacheBlockData(cacheBlockIndex) + section.m_blockOffset, section.m_copySize);
             }
@@ -679,6 +757,348 @@ namespace AZ::IO
         return true;
     }
 
+    bool BlockCache::ReadMainFromCache(FileRequest* request, Section& main, const RequestPath& filePath)
+    {
+        // The main section is normally read directly, but blocks at the start of it may have been prefetched. Only full blocks can
+        // be used, so stop at the first block that isn't cached and leave the remainder to be read from the file.
+        if (m_numUnusedPrefetches == 0 || !IStreamerTypes::IsAlignedTo(main.m_readOffset, m_blockSize))
+        {
+            return false;
+        }
+
+        bool readFromCache = true;
+        while (main.m_readSize >= m_blockSize)
+        {
+            u32 cacheLocation = FindInCache(filePath, main.m_readOffset);
+            if (cacheLocation == s_fileNotCached)
+            {
+                break;
+            }
+
+            Section block;
+            block.m_readOffset = main.m_readOffset;
+            block.m_readSize = m_blockSize;
+            block.m_output = main.m_output;
+            block.m_copySize = m_blockSize;
+            block.m_used = true;
+            readFromCache = (ReadFromCache(request, block, cacheLocation) == CacheResult::ReadFromCache) && readFromCache;
+
+            m_hitRateStat.PushSample(1.0);
+            Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+
+            main.m_readOffset += m_blockSize;
+            main.m_readSize -= m_blockSize;
+            main.m_output += m_blockSize;
+        }
+
+        main.m_used = main.m_readSize > 0;
+        return readFromCache && !main.m_used;
+    }
+
+    void BlockCache::UpdateAccessPattern(const RequestPath& filePath, u64 fileLength, u64 offset, u64 size)
+    {
+        if (m_readAheadBlocks == 0)
+        {
+            return;
+        }
+
+        TimePoint now = AZStd::chrono::steady_clock::now();
+        auto it = AZStd::find_if(m_accessPatterns.begin(), m_accessPatterns.end(),
+            [&filePath](const AccessPattern& entry)
+            {
+                return entry.m_path == filePath;
+            });
+        AccessPattern* pattern = it != m_accessPatterns.end() ? &*it : nullptr;
+        if (!pattern)
+        {
+            // Start tracking the file, replacing the file that hasn't been read from for the longest time if needed.
+            if (m_accessPatterns.size() < s_maxTrackedFiles)
+            {
+                pattern = &m_accessPatterns.emplace_back();
+            }
+            else
+            {
+                pattern = &m_accessPatterns[0];
+                for (AccessPattern& entry : m_accessPatterns)
+                {
+                    if (entry.m_lastAccess < pattern->m_lastAccess)
+                    {
+                        pattern = &entry;
+                    }
+                }
+                *pattern = AccessPattern{};
+            }
+            pattern->m_path = filePath;
+            pattern->m_lastAccess = now;
+            pattern->m_fileLength = fileLength;
+            pattern->m_lastOffset = offset;
+            pattern->m_lastSize = size;
+            return;
+        }
+
+        // A read is sequential if it starts where the previous read ended and strided if it starts at the same distance from the
+        // previous read as that read did from the one before it.
+        const bool isSequential = offset == pattern->m_lastOffset + pattern->m_lastSize;
+        const bool isStrided = offset > pattern->m_lastOffset && (offset - pattern->m_lastOffset) == pattern->m_stride;
+        pattern->m_confidence = (isSequential || isStrided) ? pattern->m_confidence + 1 : 0;
+        pattern->m_stride = offset > pattern->m_lastOffset ? offset - pattern->m_lastOffset : 0;
+        pattern->m_lastAccess = now;
+        pattern->m_fileLength = fileLength;
+        pattern->m_lastOffset = offset;
+        pattern->m_lastSize = size;
+
+        if (pattern->m_confidence >= s_minPatternConfidence)
+        {
+            QueuePrefetch(filePath, fileLength, isSequential ? offset + size : offset + pattern->m_stride, size);
+        }
+    }
+
+    void BlockCache::QueuePrefetch(const RequestPath& filePath, u64 fileLength, u64 offset, u64 size)
+    {
+        if (offset >= fileLength)
+        {
+            return;
+        }
+
+        const u64 blockSize = m_blockSize;
+        const u64 end = AZStd::min(offset + size, fileLength);
+        u64 blockOffset = AZ_SIZE_ALIGN_DOWN(offset, blockSize);
+        AZStd::fixed_vector<Prefetch, 16> blocks;
+        for (u32 i = 0; i < m_readAheadBlocks && blockOffset < end && blocks.size() < blocks.capacity(); ++i)
+        {
+            if (FindInCache(filePath, blockOffset) == s_fileNotCached)
+            {
+                blocks.push_back(Prefetch{ filePath, blockOffset, AZStd::min(fileLength - blockOffset, blockSize) });
+            }
+            blockOffset += blockSize;
+        }
+
+        // Predicted reads are needed sooner than blocks from a replayed access trace, so they're put at the front of the queue.
+        for (auto it = blocks.rbegin(); it != blocks.rend(); ++it)
+        {
+            m_pendingPrefetches.push_front(AZStd::move(*it));
+        }
+    }
+
+    bool BlockCache::ExecutePrefetches()
+    {
+        if (!m_next)
+        {
+            m_pendingPrefetches.clear();
+            return false;
+        }
+
+        // Prefetches are internal requests so they bypass the scheduler's ordering. To keep them from competing with requested
+        // reads they're only issued when no request is waiting for a cache block and at least half of the cache is available.
+        // The number of prefetched blocks that haven't been read yet is limited as well so they don't evict each other.
+        const s32 reservedSlots = aznumeric_cast<s32>(m_numBlocks / 2);
+        bool prefetchIssued = false;
+        while (!m_pendingPrefetches.empty() && m_delayedSections.empty() &&
+            m_numInFlightPrefetches < aznumeric_cast<s32>(m_maxConcurrentPrefetches) &&
+            aznumeric_cast<s32>(m_numUnusedPrefetches) < reservedSlots &&
+            CalculateAvailableRequestSlots() > reservedSlots)
+        {
+            Prefetch prefetch = AZStd::move(m_pendingPrefetches.front());
+            m_pendingPrefetches.pop_front();
+            if (FindInCache(prefetch.m_path, prefetch.m_offset) != s_fileNotCached)
+            {
+                continue;
+            }
+
+            u32 cacheLocation = RecycleOldestBlock(prefetch.m_path, prefetch.m_offset);
+            if (cacheLocation == s_fileNotCached)
+            {
+                m_pendingPrefetches.push_front(AZStd::move(prefetch));
+                break;
+            }
+
+            FileRequest* readRequest = m_context->GetNewInternalRequest();
+            readRequest->CreateRead(nullptr, GetCacheBlockData(cacheLocation), m_blockSize, prefetch.m_path, prefetch.m_offset,
+                prefetch.m_readSize);
+            readRequest->SetCompletionCallback([this](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    AZ_Assert(m_numInFlightPrefetches > 0, "More prefetches have completed in the Block Cache than were issued.");
+                    m_numInFlightPrefetches--;
+                    CompleteRead(request);
+                });
+
+            Section section;
+            section.m_readOffset = prefetch.m_offset;
+            section.m_readSize = prefetch.m_readSize;
+            section.m_cacheBlockIndex = cacheLocation;
+            section.m_used = true;
+
+            m_inFlightRequests[cacheLocation] = readRequest;
+            m_numInFlightRequests++;
+            m_unusedPrefetches[cacheLocation] = true;
+            m_numUnusedPrefetches++;
+            m_numInFlightPrefetches++;
+            m_numPrefetchesIssued++;
+
+            m_pendingRequests.emplace(readRequest, section);
+            m_next->QueueRequest(readRequest);
+            prefetchIssued = true;
+        }
+        return prefetchIssued;
+    }
+
+    void BlockCache::UsePrefetchedBlock(u32 index, bool wasUsed)
+    {
+        if (m_unusedPrefetches[index])
+        {
+            AZ_Assert(m_numUnusedPrefetches > 0, "Block cache has more unused prefetched blocks than were recorded.");
+            m_unusedPrefetches[index] = false;
+            m_numUnusedPrefetches--;
+
+            m_prefetchAccuracyStat.PushSample(wasUsed ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, PrefetchAccuracyName, m_prefetchAccuracyStat.GetMostRecentSample());
+        }
+    }
+
+    void BlockCache::BeginAccessTrace(const BlockCacheBeginAccessTrace& command)
+    {
+        if (!m_accessTracePath.empty())
+        {
+            EndAccessTrace();
+        }
+        m_accessTracePath = command.m_tracePath;
+
+        AZ::IO::FixedMaxPath tracePath(m_accessTracePath);
+        if (auto fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO != nullptr)
+        {
+            fileIO->ResolvePath(tracePath, m_accessTracePath);
+        }
+
+        // Reading the file directly, as going through the FileIOBase could route the read back to the streamer thread.
+        const AZ::IO::SystemFile::SizeType traceSize = AZ::IO::SystemFile::Length(tracePath.c_str());
+        if (traceSize < sizeof(AccessTraceHeader))
+        {
+            return;
+        }
+        AZStd::vector<u8> trace;
+        trace.resize_no_construct(traceSize);
+        if (AZ::IO::SystemFile::Read(tracePath.c_str(), trace.data(), traceSize) != traceSize)
+        {
+            return;
+        }
+
+        AccessTraceHeader header;
+        memcpy(&header, trace.data(), sizeof(header));
+        if (header.m_magic != AccessTraceHeader::s_magic || header.m_version != AccessTraceHeader::s_version)
+        {
+            AZ_Warning("Streamer", false, "Access trace '%s' for the BlockCache isn't a supported trace file.", tracePath.c_str());
+            return;
+        }
+        if (header.m_blockSize != m_blockSize)
+        {
+            // The recorded offsets can't be used as they're aligned to a different block size. The trace will be recorded again.
+            return;
+        }
+
+        size_t readOffset = sizeof(header);
+        AZStd::vector<RequestPath> files;
+        files.reserve(header.m_fileCount);
+        for (u32 i = 0; i < header.m_fileCount; ++i)
+        {
+            u32 pathLength;
+            if (readOffset + sizeof(pathLength) > trace.size())
+            {
+                break;
+            }
+            memcpy(&pathLength, trace.data() + readOffset, sizeof(pathLength));
+            readOffset += sizeof(pathLength);
+            if (readOffset + pathLength > trace.size())
+            {
+                break;
+            }
+            files.emplace_back(AZ::IO::PathView(AZStd::string_view(reinterpret_cast<const char*>(trace.data() + readOffset), pathLength)));
+            readOffset += pathLength;
+        }
+
+        const size_t entryCount = AZStd::min<size_t>(header.m_entryCount, (trace.size() - readOffset) / sizeof(AccessTraceEntry));
+        if (files.size() != header.m_fileCount || entryCount != header.m_entryCount)
+        {
+            AZ_Warning("Streamer", false, "Access trace '%s' for the BlockCache is truncated.", tracePath.c_str());
+        }
+        for (size_t i = 0; i < entryCount; ++i)
+        {
+            AccessTraceEntry entry;
+            memcpy(&entry, trace.data() + readOffset + i * sizeof(AccessTraceEntry), sizeof(AccessTraceEntry));
+            if (entry.m_pathIndex < files.size() && entry.m_readSize > 0 && entry.m_readSize <= m_blockSize &&
+                IStreamerTypes::IsAlignedTo(entry.m_offset, m_blockSize))
+            {
+                m_pendingPrefetches.push_back(Prefetch{ files[entry.m_pathIndex], entry.m_offset, entry.m_readSize });
+            }
+        }
+    }
+
+    void BlockCache::EndAccessTrace()
+    {
+        if (m_accessTracePath.empty())
+        {
+            return;
+        }
+
+        AZ::IO::FixedMaxPath tracePath(m_accessTracePath);
+        if (auto fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO != nullptr)
+        {
+            fileIO->ResolvePath(tracePath, m_accessTracePath);
+        }
+
+        AccessTraceHeader header;
+        header.m_blockSize = m_blockSize;
+        header.m_fileCount = aznumeric_caster(m_accessTraceFiles.size());
+        header.m_entryCount = aznumeric_caster(m_accessTraceEntries.size());
+
+        AZStd::vector<u8> trace;
+        trace.insert(trace.end(), reinterpret_cast<const u8*>(&header), reinterpret_cast<const u8*>(&header + 1));
+        for (const AZStd::string& file : m_accessTraceFiles)
+        {
+            const u32 pathLength = aznumeric_caster(file.size());
+            trace.insert(trace.end(), reinterpret_cast<const u8*>(&pathLength), reinterpret_cast<const u8*>(&pathLength + 1));
+            trace.insert(trace.end(), reinterpret_cast<const u8*>(file.data()), reinterpret_cast<const u8*>(file.data() + file.size()));
+        }
+        trace.insert(trace.end(), reinterpret_cast<const u8*>(m_accessTraceEntries.data()),
+            reinterpret_cast<const u8*>(m_accessTraceEntries.data() + m_accessTraceEntries.size()));
+
+        AZ::IO::SystemFile file;
+        if (file.Open(tracePath.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            [[maybe_unused]] AZ::IO::SystemFile::SizeType bytesWritten = file.Write(trace.data(), trace.size());
+            AZ_Warning("Streamer", bytesWritten == trace.size(), "Unable to write the full access trace for the BlockCache to '%s'.",
+                tracePath.c_str());
+            file.Close();
+        }
+        else
+        {
+            AZ_Warning("Streamer", false, "Unable to open '%s' to store the access trace for the BlockCache.", tracePath.c_str());
+        }
+
+        m_accessTracePath.clear();
+        m_accessTraceFiles.clear();
+        m_accessTraceFileIndices.clear();
+        m_accessTraceEntries.clear();
+    }
+
+    void BlockCache::RecordAccess(const RequestPath& filePath, u64 offset, u64 readSize)
+    {
+        if (m_accessTracePath.empty() || m_accessTraceEntries.size() >= s_maxAccessTraceEntries)
+        {
+            return;
+        }
+
+        // Store the path as it was requested so aliases are resolved again when the trace is replayed.
+        AZStd::string path(filePath.GetRelativePath().Native());
+        auto [fileIndex, inserted] = m_accessTraceFileIndices.emplace(AZStd::move(path), aznumeric_cast<u32>(m_accessTraceFiles.size()));
+        if (inserted)
+        {
+            m_accessTraceFiles.push_back(fileIndex->first);
+        }
+        m_accessTraceEntries.push_back(AccessTraceEntry{ fileIndex->second, aznumeric_cast<u32>(readSize), offset });
+    }
+
     u8* BlockCache::GetCacheBlockData(u32 index)
     {
         AZ_Assert(index < m_numBlocks, "Index for touch a cache entry in the BlockCache is out of bounds.");
@@ -710,6 +1130,7 @@ namespace AZ::IO
         if (!IsCacheBlockInFlight(oldestIndex))
         {
             // Recycle the block.
+            UsePrefetchedBlock(oldestIndex, false);
             m_cachedPaths[oldestIndex] = filePath;
             m_cachedOffsets[oldestIndex] = offset;
             TouchBlock(oldestIndex);
@@ -745,6 +1166,7 @@ namespace AZ::IO
     {
         AZ_Assert(index < m_numBlocks, "Index for resetting a cache entry in the BlockCache is out of bounds.");
 
+        UsePrefetchedBlock(index, false);
         m_cachedPaths[index].Clear();
         m_cachedOffsets[index] = 0;
         m_blockLastTouched[index] = TimePoint::min();
@@ -783,6 +1205,14 @@ namespace AZ::IO
             data.m_output.push_back(Statistic::CreateBoolean(
                 m_name, "Only epilog writes", m_onlyEpilogWrites,
                 "Whether or not only the epilog is considered or that both prolog and epilog are used for caching."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Read-ahead blocks", m_readAheadBlocks,
+                "The maximum number of blocks that are read ahead of a file once a sequential or strided access pattern is detected. "
+                "Read-ahead is disabled if this is zero."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max concurrent prefetches", m_maxConcurrentPrefetches,
+                "The maximum number of prefetch reads that can be in-flight at the same time. Higher values prefetch more aggressively "
+                "at the cost of bandwidth for requested reads."));
             data.m_output.push_back(Statistic::CreateReferenceString(
                 m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
                 "The name of the node that follows this node or none."));
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
@@ -17,11 +19,12 @@
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
 
 namespace AZ::IO
 {
-    class RequestPath;
     namespace Requests
     {
         struct ReadData;
@@ -55,13 +58,38 @@ namespace AZ::IO
         u32 m_cacheSizeMib{ 8 };
         //! The size of the individual blocks inside the cache.
         BlockSize m_blockSize{ BlockSize::MemoryAlignment };
+        //! The maximum number of blocks that are read ahead of a file once a sequential or strided access pattern is detected.
+        //! Set to zero to disable read-ahead.
+        u32 m_readAheadBlocks{ 4 };
+        //! The maximum number of prefetch requests that can be in-flight at the same time. Prefetches are only issued when the
+        //! cache has room to spare, so this limits how much of the bandwidth prefetching can take from requested reads.
+        u32 m_maxConcurrentPrefetches{ 2 };
+    };
+
+    //! Custom command for the BlockCache to start recording an access trace, for instance at the start of loading a level.
+    //! If a trace was recorded to the same path before, the blocks in it will be prefetched while the new trace is recorded.
+    //! Queue this with IStreamer::Custom.
+    struct BlockCacheBeginAccessTrace
+    {
+        AZ_TYPE_INFO(AZ::IO::BlockCacheBeginAccessTrace, "{6A0D35E4-91B7-4C0E-9E07-27E8D8B1C2F1}");
+
+        //! Path to the sidecar file the access trace is read from and written to. Aliases are supported.
+        AZ::IO::Path m_tracePath;
+    };
+
+    //! Custom command for the BlockCache to stop recording the active access trace and store it to its sidecar file.
+    //! Queue this with IStreamer::Custom.
+    struct BlockCacheEndAccessTrace
+    {
+        AZ_TYPE_INFO(AZ::IO::BlockCacheEndAccessTrace, "{C2B59A0E-4C3F-4F51-8B7A-5E3D1F0A9B64}");
     };
 
     class AZCORE_API BlockCache
         : public StreamStackEntry
     {
     public:
-        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites);
+        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites,
+            u32 readAheadBlocks = 0, u32 maxConcurrentPrefetches = 0);
         BlockCache(BlockCache&& rhs) = delete;
         BlockCache(const BlockCache& rhs) = delete;
         ~BlockCache() override;
@@ -85,10 +113,17 @@ namespace AZ::IO
 
         double CalculateHitRatePercentage() const;
         double CalculateCacheableRatePercentage() const;
+        double CalculatePrefetchAccuracyPercentage() const;
         s32 CalculateAvailableRequestSlots() const;
 
     protected:
         static constexpr u32 s_fileNotCached = static_cast<u32>(-1);
+        //! The number of files for which the access pattern is tracked at the same time.
+        static constexpr size_t s_maxTrackedFiles = 16;
+        //! The number of times an access pattern needs to repeat before it's used to read ahead.
+        static constexpr u32 s_minPatternConfidence = 2;
+        //! The maximum number of blocks that are recorded in a single access trace.
+        static constexpr size_t s_maxAccessTraceEntries = 64 * 1024;
 
         enum class CacheResult
         {
@@ -116,6 +151,34 @@ namespace AZ::IO
 
         using TimePoint = AZStd::chrono::steady_clock::time_point;
 
+        //! The recent access history of a file, used to detect sequential and strided reads.
+        struct AccessPattern
+        {
+            RequestPath m_path;
+            TimePoint m_lastAccess;
+            u64 m_fileLength{ 0 };
+            u64 m_lastOffset{ 0 };
+            u64 m_lastSize{ 0 };
+            u64 m_stride{ 0 }; //!< The distance between the start of the last two reads. Zero for sequential reads.
+            u32 m_confidence{ 0 }; //!< The number of times in a row the pattern has been repeated.
+        };
+
+        //! A cache block that's scheduled to be read before it's requested.
+        struct Prefetch
+        {
+            RequestPath m_path;
+            u64 m_offset{ 0 };
+            u64 m_readSize{ 0 };
+        };
+
+        //! A cache block that was missed while recording an access trace.
+        struct AccessTraceEntry
+        {
+            u32 m_pathIndex{ 0 };
+            u32 m_readSize{ 0 };
+            u64 m_offset{ 0 };
+        };
+
         void ReadFile(FileRequest* request, Requests::ReadData& data);
         void ContinueReadFile(FileRequest* request, u64 fileLength);
         CacheResult ReadFromCache(FileRequest* request, Section& section, const RequestPath& filePath);
@@ -124,6 +187,16 @@ namespace AZ::IO
         void CompleteRead(FileRequest& request);
         bool SplitRequest(Section& prolog, Section& main, Section& epilog, const RequestPath& filePath, u64 fileLength,
             u64 offset, u64 size, u8* buffer) const;
+        bool ReadMainFromCache(FileRequest* request, Section& main, const RequestPath& filePath);
+
+        void UpdateAccessPattern(const RequestPath& filePath, u64 fileLength, u64 offset, u64 size);
+        void QueuePrefetch(const RequestPath& filePath, u64 fileLength, u64 offset, u64 size);
+        bool ExecutePrefetches();
+        void UsePrefetchedBlock(u32 index, bool wasUsed);
+
+        void BeginAccessTrace(const BlockCacheBeginAccessTrace& command);
+        void EndAccessTrace();
+        void RecordAccess(const RequestPath& filePath, u64 offset, u64 readSize);
 
         u8* GetCacheBlockData(u32 index);
         void TouchBlock(u32 index);
@@ -140,8 +213,22 @@ namespace AZ::IO
         //! List of file sections that were delayed because the cache was full.
         AZStd::deque<Section> m_delayedSections;
 
+        //! Recent access history of the files that were most recently read from.
+        AZStd::vector<AccessPattern> m_accessPatterns;
+        //! Cache blocks that are waiting for the cache to have room to be prefetched.
+        AZStd::deque<Prefetch> m_pendingPrefetches;
+
+        //! The path the active access trace will be written to. Empty if no trace is being recorded.
+        AZ::IO::Path m_accessTracePath;
+        //! The paths of the files in the active access trace. Entries refer to these by index.
+        AZStd::vector<AZStd::string> m_accessTraceFiles;
+        AZStd::unordered_map<AZStd::string, u32> m_accessTraceFileIndices;
+        //! The cache blocks that were missed, in order, while the access trace was recorded.
+        AZStd::vector<AccessTraceEntry> m_accessTraceEntries;
+
         AZ::Statistics::RunningStatistic m_hitRateStat;
         AZ::Statistics::RunningStatistic m_cacheableStat;
+        AZ::Statistics::RunningStatistic m_prefetchAccuracyStat;
 
         u8* m_cache;
         u64 m_cacheSize;
@@ -157,6 +244,17 @@ namespace AZ::IO
         AZStd::unique_ptr<TimePoint[]> m_blockLastTouched; // Array of m_numBlocks size.
         //! The file request that's currently read data into the cache block. If null, the block has been read.
         AZStd::unique_ptr<FileRequest*[]> m_inFlightRequests; // Array of m_numbBlocks size.
+        //! Whether or not the cache block was filled by a prefetch and hasn't been read from yet.
+        AZStd::unique_ptr<bool[]> m_unusedPrefetches; // Array of m_numBlocks size.
+
+        //! The maximum number of blocks to read ahead of a detected access pattern.
+        u32 m_readAheadBlocks;
+        //! The maximum number of prefetch reads that can be in-flight at the same time.
+        u32 m_maxConcurrentPrefetches;
+        s32 m_numInFlightPrefetches{ 0 };
+        //! The number of cache blocks filled or being filled by a prefetch that haven't been read from yet.
+        u32 m_numUnusedPrefetches{ 0 };
+        size_t m_numPrefetchesIssued{ 0 };
 
         //! The number of requests waiting for meta data to be retrieved.
         s32 m_numMetaDataRetrievalInProgress{ 0 };
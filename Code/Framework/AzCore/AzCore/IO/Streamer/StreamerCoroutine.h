@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Task/TaskCoroutine.h>
+
+#if defined(AZ_TASK_COROUTINES_SUPPORTED)
+
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+
+namespace AZ::IO
+{
+    struct StreamerReadResult
+    {
+        IStreamerTypes::RequestStatus m_status = IStreamerTypes::RequestStatus::Failed;
+        void* m_buffer = nullptr;
+        u64 m_bytesRead = 0;
+    };
+
+    //! Awaitable that queues a read request on the streamer and continues the coroutine on a worker of the executor once the
+    //! request has completed. The streamer thread only submits the continuation, so no work is done on it.
+    class StreamerReadAwaitable final
+    {
+    public:
+        StreamerReadAwaitable(IStreamer& streamer, FileRequestPtr request, TaskExecutor& executor)
+            : m_streamer{ streamer }
+            , m_request{ AZStd::move(request) }
+            , m_executor{ executor }
+        {
+        }
+
+        StreamerReadAwaitable(const StreamerReadAwaitable&) = delete;
+        StreamerReadAwaitable& operator=(const StreamerReadAwaitable&) = delete;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_handle = handle;
+            m_streamer.SetRequestCompleteCallback(
+                m_request,
+                [this](FileRequestHandle request)
+                {
+                    m_result.m_status = m_streamer.GetRequestStatus(request);
+                    m_streamer.GetReadRequestResult(request, m_result.m_buffer, m_result.m_bytesRead);
+                    AZ::Internal::ResumeOnExecutor(m_executor, m_handle);
+                });
+            // The request can complete on the streamer thread before QueueRequest returns, so this must be the last use of this.
+            m_streamer.QueueRequest(m_request);
+        }
+
+        StreamerReadResult await_resume() const noexcept
+        {
+            return m_result;
+        }
+
+    private:
+        IStreamer& m_streamer;
+        FileRequestPtr m_request;
+        TaskExecutor& m_executor;
+        StreamerReadResult m_result;
+        std::coroutine_handle<> m_handle;
+    };
+
+    //! Creates a read request for the file, see IStreamer::Read for the description of the arguments. co_await the result to
+    //! queue the request and continue the coroutine on a worker of the executor once the read has completed.
+    inline StreamerReadAwaitable ReadAsync(
+        IStreamer& streamer,
+        AZStd::string_view relativePath,
+        void* outputBuffer,
+        size_t outputBufferSize,
+        size_t readSize,
+        IStreamerTypes::Deadline deadline = IStreamerTypes::s_noDeadline,
+        IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium,
+        size_t offset = 0,
+        TaskExecutor& executor = TaskExecutor::Instance())
+    {
+        return StreamerReadAwaitable{
+            streamer, streamer.Read(relativePath, outputBuffer, outputBufferSize, readSize, deadline, priority, offset), executor
+        };
+    }
+} // namespace AZ::IO
+
+#endif // defined(AZ_TASK_COROUTINES_SUPPORTED)
@@ -0,0 +1,937 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SoaMath.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/parallel/atomic.h>
+
+// The AVX2 kernels are compiled with function level target attributes, so that the rest of the engine can keep targeting the
+// baseline instruction set. They are only used after checking that the processor supports them.
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   define AZ_SOA_MATH_AVX2 1
+#   include <immintrin.h>
+#   if defined(AZ_COMPILER_MSVC)
+#       include <intrin.h>
+#       define AZ_SOA_MATH_TARGET_AVX2
+#   else
+#       define AZ_SOA_MATH_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#   endif
+#else
+#   define AZ_SOA_MATH_AVX2 0
+#endif
+
+namespace AZ::Soa
+{
+    namespace Internal
+    {
+        //! The kernel parameters are converted to plain floats up front, so the kernels don't depend on the math types.
+        struct TransformParams
+        {
+            explicit TransformParams(const Transform& transform)
+            {
+                const Matrix3x4 matrix = Matrix3x4::CreateFromTransform(transform);
+                for (int32_t row = 0; row < 3; ++row)
+                {
+                    for (int32_t col = 0; col < 4; ++col)
+                    {
+                        m_rows[row][col] = matrix.GetElement(row, col);
+                        m_absRows[row][col] = AZStd::abs(m_rows[row][col]);
+                    }
+                }
+            }
+
+            float m_rows[3][4];
+            float m_absRows[3][4];
+        };
+
+        struct FrustumParams
+        {
+            explicit FrustumParams(const Frustum& frustum)
+            {
+                for (int32_t planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const Vector4 plane = frustum.GetPlane(static_cast<Frustum::PlaneId>(planeId)).GetPlaneEquationCoefficients();
+                    for (int32_t i = 0; i < 4; ++i)
+                    {
+                        m_planes[planeId][i] = plane.GetElement(i);
+                    }
+                    for (int32_t axis = 0; axis < 3; ++axis)
+                    {
+                        m_positive[planeId][axis] = plane.GetElement(axis) > 0.0f;
+                        m_absNormals[planeId][axis] = AZStd::abs(plane.GetElement(axis));
+                    }
+                }
+            }
+
+            float m_planes[Frustum::PlaneId::MAX][4];
+            //! Whether the max corner of a box is the one furthest along the plane normal, for each axis.
+            bool m_positive[Frustum::PlaneId::MAX][3];
+            float m_absNormals[Frustum::PlaneId::MAX][3];
+        };
+
+        struct AabbParams
+        {
+            explicit AabbParams(const Aabb& aabb)
+            {
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    m_min[axis] = aabb.GetMin().GetElement(axis);
+                    m_max[axis] = aabb.GetMax().GetElement(axis);
+                }
+            }
+
+            float m_min[3];
+            float m_max[3];
+        };
+
+        struct SphereParams
+        {
+            explicit SphereParams(const Sphere& sphere)
+                : m_radiusSq(sphere.GetRadius() * sphere.GetRadius())
+            {
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    m_center[axis] = sphere.GetCenter().GetElement(axis);
+                }
+            }
+
+            float m_center[3];
+            float m_radiusSq;
+        };
+
+        struct RayParams
+        {
+            RayParams(const Vector3& origin, const Vector3& direction, float maxDistance)
+                : m_maxDistance(maxDistance)
+            {
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    const float directionElement = direction.GetElement(axis);
+                    m_origin[axis] = origin.GetElement(axis);
+                    // A ray parallel to a slab hits it only if the origin is between the planes of the slab
+                    m_parallel[axis] = directionElement == 0.0f;
+                    m_inverseDirection[axis] = m_parallel[axis] ? 0.0f : 1.0f / directionElement;
+                }
+            }
+
+            float m_origin[3];
+            float m_inverseDirection[3];
+            bool m_parallel[3];
+            float m_maxDistance;
+        };
+
+        // Kernels for the platform's 4 wide SIMD implementation. Blocks of 8 are processed in two halves.
+        namespace Simd128
+        {
+            using Vec4 = Simd::Vec4;
+
+            template<size_t Width>
+            static void TransformPoints(const TransformParams& params, const Vector3Array<Width>* points, Vector3Array<Width>* results, size_t blockCount)
+            {
+                Vec4::FloatType m[3][4];
+                for (int32_t row = 0; row < 3; ++row)
+                {
+                    for (int32_t col = 0; col < 4; ++col)
+                    {
+                        m[row][col] = Vec4::Splat(params.m_rows[row][col]);
+                    }
+                }
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    for (size_t offset = 0; offset < Width; offset += 4)
+                    {
+                        const Vec4::FloatType x = Vec4::LoadAligned(points[block].m_x + offset);
+                        const Vec4::FloatType y = Vec4::LoadAligned(points[block].m_y + offset);
+                        const Vec4::FloatType z = Vec4::LoadAligned(points[block].m_z + offset);
+                        Vec4::StoreAligned(results[block].m_x + offset, Vec4::Madd(m[0][0], x, Vec4::Madd(m[0][1], y, Vec4::Madd(m[0][2], z, m[0][3]))));
+                        Vec4::StoreAligned(results[block].m_y + offset, Vec4::Madd(m[1][0], x, Vec4::Madd(m[1][1], y, Vec4::Madd(m[1][2], z, m[1][3]))));
+                        Vec4::StoreAligned(results[block].m_z + offset, Vec4::Madd(m[2][0], x, Vec4::Madd(m[2][1], y, Vec4::Madd(m[2][2], z, m[2][3]))));
+                    }
+                }
+            }
+
+            template<size_t Width>
+            static void TransformAabbs(const TransformParams& params, const AabbArray<Width>* aabbs, AabbArray<Width>* results, size_t blockCount)
+            {
+                Vec4::FloatType m[3][4];
+                Vec4::FloatType absM[3][3];
+                for (int32_t row = 0; row < 3; ++row)
+                {
+                    for (int32_t col = 0; col < 4; ++col)
+                    {
+                        m[row][col] = Vec4::Splat(params.m_rows[row][col]);
+                    }
+                    for (int32_t col = 0; col < 3; ++col)
+                    {
+                        absM[row][col] = Vec4::Splat(params.m_absRows[row][col]);
+                    }
+                }
+                const Vec4::FloatType half = Vec4::Splat(0.5f);
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    for (size_t offset = 0; offset < Width; offset += 4)
+                    {
+                        // Transform the center, and project the extents onto the axes of the transformed box
+                        const Vec4::FloatType minX = Vec4::LoadAligned(aabbs[block].m_min.m_x + offset);
+                        const Vec4::FloatType minY = Vec4::LoadAligned(aabbs[block].m_min.m_y + offset);
+                        const Vec4::FloatType minZ = Vec4::LoadAligned(aabbs[block].m_min.m_z + offset);
+                        const Vec4::FloatType maxX = Vec4::LoadAligned(aabbs[block].m_max.m_x + offset);
+                        const Vec4::FloatType maxY = Vec4::LoadAligned(aabbs[block].m_max.m_y + offset);
+                        const Vec4::FloatType maxZ = Vec4::LoadAligned(aabbs[block].m_max.m_z + offset);
+
+                        const Vec4::FloatType centerX = Vec4::Mul(Vec4::Add(minX, maxX), half);
+                        const Vec4::FloatType centerY = Vec4::Mul(Vec4::Add(minY, maxY), half);
+                        const Vec4::FloatType centerZ = Vec4::Mul(Vec4::Add(minZ, maxZ), half);
+                        const Vec4::FloatType extentX = Vec4::Mul(Vec4::Sub(maxX, minX), half);
+                        const Vec4::FloatType extentY = Vec4::Mul(Vec4::Sub(maxY, minY), half);
+                        const Vec4::FloatType extentZ = Vec4::Mul(Vec4::Sub(maxZ, minZ), half);
+
+                        float* resultMin[3] = { results[block].m_min.m_x + offset, results[block].m_min.m_y + offset, results[block].m_min.m_z + offset };
+                        float* resultMax[3] = { results[block].m_max.m_x + offset, results[block].m_max.m_y + offset, results[block].m_max.m_z + offset };
+                        for (int32_t row = 0; row < 3; ++row)
+                        {
+                            const Vec4::FloatType center =
+                                Vec4::Madd(m[row][0], centerX, Vec4::Madd(m[row][1], centerY, Vec4::Madd(m[row][2], centerZ, m[row][3])));
+                            const Vec4::FloatType extent =
+                                Vec4::Madd(absM[row][0], extentX, Vec4::Madd(absM[row][1], extentY, Vec4::Mul(absM[row][2], extentZ)));
+                            Vec4::StoreAligned(resultMin[row], Vec4::Sub(center, extent));
+                            Vec4::StoreAligned(resultMax[row], Vec4::Add(center, extent));
+                        }
+                    }
+                }
+            }
+
+            template<size_t Width>
+            static void IntersectFrustumAabbs(const FrustumParams& params, const AabbArray<Width>* aabbs, size_t blockCount, IntersectResult* results)
+            {
+                Vec4::FloatType planes[Frustum::PlaneId::MAX][4];
+                for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    for (int32_t i = 0; i < 4; ++i)
+                    {
+                        planes[planeId][i] = Vec4::Splat(params.m_planes[planeId][i]);
+                    }
+                }
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    for (size_t offset = 0; offset < Width; offset += 4)
+                    {
+                        const Vec4::FloatType minimum[3] = { Vec4::LoadAligned(aabbs[block].m_min.m_x + offset),
+                                                             Vec4::LoadAligned(aabbs[block].m_min.m_y + offset),
+                                                             Vec4::LoadAligned(aabbs[block].m_min.m_z + offset) };
+                        const Vec4::FloatType maximum[3] = { Vec4::LoadAligned(aabbs[block].m_max.m_x + offset),
+                                                             Vec4::LoadAligned(aabbs[block].m_max.m_y + offset),
+                                                             Vec4::LoadAligned(aabbs[block].m_max.m_z + offset) };
+
+                        Vec4::FloatType exterior = Vec4::CmpLt(zero, zero);
+                        Vec4::FloatType interior = Vec4::CmpEq(zero, zero);
+                        for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                        {
+                            // The plane normal is the same for every box, so the corners furthest in front of and behind the
+                            // plane are selected once per plane instead of once per box
+                            const bool* positive = params.m_positive[planeId];
+                            const Vec4::FloatType furthestDistance = Vec4::Madd(planes[planeId][0], positive[0] ? maximum[0] : minimum[0],
+                                Vec4::Madd(planes[planeId][1], positive[1] ? maximum[1] : minimum[1],
+                                Vec4::Madd(planes[planeId][2], positive[2] ? maximum[2] : minimum[2], planes[planeId][3])));
+                            const Vec4::FloatType nearestDistance = Vec4::Madd(planes[planeId][0], positive[0] ? minimum[0] : maximum[0],
+                                Vec4::Madd(planes[planeId][1], positive[1] ? minimum[1] : maximum[1],
+                                Vec4::Madd(planes[planeId][2], positive[2] ? minimum[2] : maximum[2], planes[planeId][3])));
+                            exterior = Vec4::Or(exterior, Vec4::CmpLt(furthestDistance, zero));
+                            interior = Vec4::And(interior, Vec4::CmpGtEq(nearestDistance, zero));
+                        }
+
+                        alignas(16) int32_t exteriorMask[4];
+                        alignas(16) int32_t interiorMask[4];
+                        Vec4::StoreAligned(exteriorMask, Vec4::CastToInt(exterior));
+                        Vec4::StoreAligned(interiorMask, Vec4::CastToInt(interior));
+                        IntersectResult* blockResults = results + block * Width + offset;
+                        for (size_t i = 0; i < 4; ++i)
+                        {
+                            blockResults[i] = exteriorMask[i] ? IntersectResult::Exterior
+                                : (interiorMask[i] ? IntersectResult::Interior : IntersectResult::Overlaps);
+                        }
+                    }
+                }
+            }
+
+            template<size_t Width>
+            static size_t IntersectRayAabbs(const RayParams& params, const AabbArray<Width>* aabbs, size_t blockCount, float* hitDistances)
+            {
+                Vec4::FloatType origin[3];
+                Vec4::FloatType inverseDirection[3];
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    origin[axis] = Vec4::Splat(params.m_origin[axis]);
+                    inverseDirection[axis] = Vec4::Splat(params.m_inverseDirection[axis]);
+                }
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+                const Vec4::FloatType maxDistance = Vec4::Splat(params.m_maxDistance);
+                const Vec4::FloatType missDistance = Vec4::Splat(Constants::FloatMax);
+
+                size_t hitCount = 0;
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    const float* minimum[3] = { aabbs[block].m_min.m_x, aabbs[block].m_min.m_y, aabbs[block].m_min.m_z };
+                    const float* maximum[3] = { aabbs[block].m_max.m_x, aabbs[block].m_max.m_y, aabbs[block].m_max.m_z };
+                    for (size_t offset = 0; offset < Width; offset += 4)
+                    {
+                        Vec4::FloatType hit = Vec4::CmpEq(zero, zero);
+                        Vec4::FloatType entry = zero;
+                        Vec4::FloatType exit = maxDistance;
+                        for (int32_t axis = 0; axis < 3; ++axis)
+                        {
+                            const Vec4::FloatType slabMin = Vec4::LoadAligned(minimum[axis] + offset);
+                            const Vec4::FloatType slabMax = Vec4::LoadAligned(maximum[axis] + offset);
+                            if (params.m_parallel[axis])
+                            {
+                                hit = Vec4::And(hit, Vec4::And(Vec4::CmpLtEq(slabMin, origin[axis]), Vec4::CmpLtEq(origin[axis], slabMax)));
+                            }
+                            else
+                            {
+                                const Vec4::FloatType t0 = Vec4::Mul(Vec4::Sub(slabMin, origin[axis]), inverseDirection[axis]);
+                                const Vec4::FloatType t1 = Vec4::Mul(Vec4::Sub(slabMax, origin[axis]), inverseDirection[axis]);
+                                entry = Vec4::Max(entry, Vec4::Min(t0, t1));
+                                exit = Vec4::Min(exit, Vec4::Max(t0, t1));
+                            }
+                        }
+                        hit = Vec4::And(hit, Vec4::CmpLtEq(entry, exit));
+                        Vec4::StoreUnaligned(hitDistances + block * Width + offset, Vec4::Select(entry, missDistance, hit));
+
+                        alignas(16) int32_t hitMask[4];
+                        Vec4::StoreAligned(hitMask, Vec4::CastToInt(hit));
+                        hitCount += (hitMask[0] != 0) + (hitMask[1] != 0) + (hitMask[2] != 0) + (hitMask[3] != 0);
+                    }
+                }
+                return hitCount;
+            }
+
+            static uint32_t GetMask(Vec4::FloatArgType value)
+            {
+                alignas(16) int32_t elements[4];
+                Vec4::StoreAligned(elements, Vec4::CastToInt(value));
+                return (elements[0] != 0 ? 1u : 0u) | (elements[1] != 0 ? 2u : 0u) | (elements[2] != 0 ? 4u : 0u) | (elements[3] != 0 ? 8u : 0u);
+            }
+
+            template<size_t Width>
+            static void OverlapAabbs(const AabbParams& params, const AabbArray<Width>* aabbs, size_t blockCount, uint32_t* overlapMasks)
+            {
+                Vec4::FloatType queryMin[3];
+                Vec4::FloatType queryMax[3];
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    queryMin[axis] = Vec4::Splat(params.m_min[axis]);
+                    queryMax[axis] = Vec4::Splat(params.m_max[axis]);
+                }
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    const float* minimum[3] = { aabbs[block].m_min.m_x, aabbs[block].m_min.m_y, aabbs[block].m_min.m_z };
+                    const float* maximum[3] = { aabbs[block].m_max.m_x, aabbs[block].m_max.m_y, aabbs[block].m_max.m_z };
+                    uint32_t blockMask = 0;
+                    for (size_t offset = 0; offset < Width; offset += 4)
+                    {
+                        Vec4::FloatType overlap = Vec4::CmpEq(zero, zero);
+                        for (int32_t axis = 0; axis < 3; ++axis)
+                        {
+                            overlap = Vec4::And(overlap, Vec4::And(
+                                Vec4::CmpLtEq(queryMin[axis], Vec4::LoadAligned(maximum[axis] + offset)),
+                                Vec4::CmpGtEq(queryMax[axis], Vec4::LoadAligned(minimum[axis] + offset))));
+                        }
+                        blockMask |= GetMask(overlap) << offset;
+                    }
+                    overlapMasks[block] = blockMask;
+                }
+            }
+
+            template<size_t Width>
+            static void OverlapAabbs(const SphereParams& params, const AabbArray<Width>* aabbs, size_t blockCount, uint32_t* overlapMasks)
+            {
+                Vec4::FloatType center[3];
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    center[axis] = Vec4::Splat(params.m_center[axis]);
+                }
+                const Vec4::FloatType radiusSq = Vec4::Splat(params.m_radiusSq);
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    const float* minimum[3] = { aabbs[block].m_min.m_x, aabbs[block].m_min.m_y, aabbs[block].m_min.m_z };
+                    const float* maximum[3] = { aabbs[block].m_max.m_x, aabbs[block].m_max.m_y, aabbs[block].m_max.m_z };
+                    uint32_t blockMask = 0;
+                    for (size_t offset = 0; offset < Width; offset += 4)
+                    {
+                        // Distance from the center to the closest point in each box, as Aabb::GetDistanceSq
+                        Vec4::FloatType distanceSq = Vec4::ZeroFloat();
+                        for (int32_t axis = 0; axis < 3; ++axis)
+                        {
+                            const Vec4::FloatType closest = Vec4::Min(
+                                Vec4::Max(center[axis], Vec4::LoadAligned(minimum[axis] + offset)), Vec4::LoadAligned(maximum[axis] + offset));
+                            const Vec4::FloatType delta = Vec4::Sub(center[axis], closest);
+                            distanceSq = Vec4::Add(distanceSq, Vec4::Mul(delta, delta));
+                        }
+                        blockMask |= GetMask(Vec4::CmpLtEq(distanceSq, radiusSq)) << offset;
+                    }
+                    overlapMasks[block] = blockMask;
+                }
+            }
+
+            template<size_t Width>
+            static void OverlapAabbs(
+                const FrustumParams& params, const AabbArray<Width>* aabbs, size_t blockCount, uint32_t* overlapMasks, uint32_t* containedMasks)
+            {
+                Vec4::FloatType planes[Frustum::PlaneId::MAX][4];
+                Vec4::FloatType absNormals[Frustum::PlaneId::MAX][3];
+                for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    for (int32_t i = 0; i < 4; ++i)
+                    {
+                        planes[planeId][i] = Vec4::Splat(params.m_planes[planeId][i]);
+                    }
+                    for (int32_t axis = 0; axis < 3; ++axis)
+                    {
+                        absNormals[planeId][axis] = Vec4::Splat(params.m_absNormals[planeId][axis]);
+                    }
+                }
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+                const Vec4::FloatType half = Vec4::Splat(0.5f);
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    uint32_t blockOverlapMask = 0;
+                    uint32_t blockContainedMask = 0;
+                    for (size_t offset = 0; offset < Width; offset += 4)
+                    {
+                        const Vec4::FloatType minimum[3] = { Vec4::LoadAligned(aabbs[block].m_min.m_x + offset),
+                                                             Vec4::LoadAligned(aabbs[block].m_min.m_y + offset),
+                                                             Vec4::LoadAligned(aabbs[block].m_min.m_z + offset) };
+                        const Vec4::FloatType maximum[3] = { Vec4::LoadAligned(aabbs[block].m_max.m_x + offset),
+                                                             Vec4::LoadAligned(aabbs[block].m_max.m_y + offset),
+                                                             Vec4::LoadAligned(aabbs[block].m_max.m_z + offset) };
+
+                        // Same center and extents as ShapeIntersection::Overlaps, which avoids overflowing for boxes at FLT_MAX
+                        Vec4::FloatType center[3];
+                        Vec4::FloatType extents[3];
+                        for (int32_t axis = 0; axis < 3; ++axis)
+                        {
+                            center[axis] = Vec4::Mul(half, Vec4::Add(minimum[axis], maximum[axis]));
+                            extents[axis] = Vec4::Sub(Vec4::Mul(half, maximum[axis]), Vec4::Mul(half, minimum[axis]));
+                        }
+
+                        Vec4::FloatType overlap = Vec4::CmpEq(zero, zero);
+                        Vec4::FloatType contained = overlap;
+                        for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                        {
+                            const Vec4::FloatType distance = Vec4::Madd(planes[planeId][0], center[0],
+                                Vec4::Madd(planes[planeId][1], center[1], Vec4::Madd(planes[planeId][2], center[2], planes[planeId][3])));
+                            const Vec4::FloatType radius = Vec4::Madd(absNormals[planeId][0], extents[0],
+                                Vec4::Madd(absNormals[planeId][1], extents[1], Vec4::Mul(absNormals[planeId][2], extents[2])));
+                            overlap = Vec4::And(overlap, Vec4::CmpGt(Vec4::Add(distance, radius), zero));
+                            contained = Vec4::And(contained, Vec4::CmpGtEq(Vec4::Sub(distance, radius), zero));
+                        }
+                        blockOverlapMask |= GetMask(overlap) << offset;
+                        blockContainedMask |= GetMask(contained) << offset;
+                    }
+                    overlapMasks[block] = blockOverlapMask;
+                    if (containedMasks)
+                    {
+                        containedMasks[block] = blockContainedMask;
+                    }
+                }
+            }
+        } // namespace Simd128
+
+#if AZ_SOA_MATH_AVX2
+        // 8 wide kernels, one register per component of a Vector3Array8.
+        namespace Avx2
+        {
+            AZ_SOA_MATH_TARGET_AVX2 static void TransformPoints(
+                const TransformParams& params, const Vector3Array8* points, Vector3Array8* results, size_t blockCount)
+            {
+                __m256 m[3][4];
+                for (int32_t row = 0; row < 3; ++row)
+                {
+                    for (int32_t col = 0; col < 4; ++col)
+                    {
+                        m[row][col] = _mm256_set1_ps(params.m_rows[row][col]);
+                    }
+                }
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    const __m256 x = _mm256_load_ps(points[block].m_x);
+                    const __m256 y = _mm256_load_ps(points[block].m_y);
+                    const __m256 z = _mm256_load_ps(points[block].m_z);
+                    _mm256_store_ps(results[block].m_x, _mm256_fmadd_ps(m[0][0], x, _mm256_fmadd_ps(m[0][1], y, _mm256_fmadd_ps(m[0][2], z, m[0][3]))));
+                    _mm256_store_ps(results[block].m_y, _mm256_fmadd_ps(m[1][0], x, _mm256_fmadd_ps(m[1][1], y, _mm256_fmadd_ps(m[1][2], z, m[1][3]))));
+                    _mm256_store_ps(results[block].m_z, _mm256_fmadd_ps(m[2][0], x, _mm256_fmadd_ps(m[2][1], y, _mm256_fmadd_ps(m[2][2], z, m[2][3]))));
+                }
+            }
+
+            AZ_SOA_MATH_TARGET_AVX2 static void TransformAabbs(
+                const TransformParams& params, const AabbArray8* aabbs, AabbArray8* results, size_t blockCount)
+            {
+                __m256 m[3][4];
+                __m256 absM[3][3];
+                for (int32_t row = 0; row < 3; ++row)
+                {
+                    for (int32_t col = 0; col < 4; ++col)
+                    {
+                        m[row][col] = _mm256_set1_ps(params.m_rows[row][col]);
+                    }
+                    for (int32_t col = 0; col < 3; ++col)
+                    {
+                        absM[row][col] = _mm256_set1_ps(params.m_absRows[row][col]);
+                    }
+                }
+                const __m256 half = _mm256_set1_ps(0.5f);
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    const __m256 minX = _mm256_load_ps(aabbs[block].m_min.m_x);
+                    const __m256 minY = _mm256_load_ps(aabbs[block].m_min.m_y);
+                    const __m256 minZ = _mm256_load_ps(aabbs[block].m_min.m_z);
+                    const __m256 maxX = _mm256_load_ps(aabbs[block].m_max.m_x);
+                    const __m256 maxY = _mm256_load_ps(aabbs[block].m_max.m_y);
+                    const __m256 maxZ = _mm256_load_ps(aabbs[block].m_max.m_z);
+
+                    const __m256 centerX = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+                    const __m256 centerY = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+                    const __m256 centerZ = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+                    const __m256 extentX = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+                    const __m256 extentY = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+                    const __m256 extentZ = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+                    float* resultMin[3] = { results[block].m_min.m_x, results[block].m_min.m_y, results[block].m_min.m_z };
+                    float* resultMax[3] = { results[block].m_max.m_x, results[block].m_max.m_y, results[block].m_max.m_z };
+                    for (int32_t row = 0; row < 3; ++row)
+                    {
+                        const __m256 center =
+                            _mm256_fmadd_ps(m[row][0], centerX, _mm256_fmadd_ps(m[row][1], centerY, _mm256_fmadd_ps(m[row][2], centerZ, m[row][3])));
+                        const __m256 extent =
+                            _mm256_fmadd_ps(absM[row][0], extentX, _mm256_fmadd_ps(absM[row][1], extentY, _mm256_mul_ps(absM[row][2], extentZ)));
+                        _mm256_store_ps(resultMin[row], _mm256_sub_ps(center, extent));
+                        _mm256_store_ps(resultMax[row], _mm256_add_ps(center, extent));
+                    }
+                }
+            }
+
+            AZ_SOA_MATH_TARGET_AVX2 static void IntersectFrustumAabbs(
+                const FrustumParams& params, const AabbArray8* aabbs, size_t blockCount, IntersectResult* results)
+            {
+                __m256 planes[Frustum::PlaneId::MAX][4];
+                for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    for (int32_t i = 0; i < 4; ++i)
+                    {
+                        planes[planeId][i] = _mm256_set1_ps(params.m_planes[planeId][i]);
+                    }
+                }
+                const __m256 zero = _mm256_setzero_ps();
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    const __m256 minimum[3] = { _mm256_load_ps(aabbs[block].m_min.m_x), _mm256_load_ps(aabbs[block].m_min.m_y),
+                                                _mm256_load_ps(aabbs[block].m_min.m_z) };
+                    const __m256 maximum[3] = { _mm256_load_ps(aabbs[block].m_max.m_x), _mm256_load_ps(aabbs[block].m_max.m_y),
+                                                _mm256_load_ps(aabbs[block].m_max.m_z) };
+
+                    __m256 exterior = zero;
+                    __m256 interior = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+                    for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                    {
+                        const bool* positive = params.m_positive[planeId];
+                        const __m256 furthestDistance = _mm256_fmadd_ps(planes[planeId][0], positive[0] ? maximum[0] : minimum[0],
+                            _mm256_fmadd_ps(planes[planeId][1], positive[1] ? maximum[1] : minimum[1],
+                            _mm256_fmadd_ps(planes[planeId][2], positive[2] ? maximum[2] : minimum[2], planes[planeId][3])));
+                        const __m256 nearestDistance = _mm256_fmadd_ps(planes[planeId][0], positive[0] ? minimum[0] : maximum[0],
+                            _mm256_fmadd_ps(planes[planeId][1], positive[1] ? minimum[1] : maximum[1],
+                            _mm256_fmadd_ps(planes[planeId][2], positive[2] ? minimum[2] : maximum[2], planes[planeId][3])));
+                        exterior = _mm256_or_ps(exterior, _mm256_cmp_ps(furthestDistance, zero, _CMP_LT_OQ));
+                        interior = _mm256_and_ps(interior, _mm256_cmp_ps(nearestDistance, zero, _CMP_GE_OQ));
+                    }
+
+                    const int exteriorMask = _mm256_movemask_ps(exterior);
+                    const int interiorMask = _mm256_movemask_ps(interior);
+                    IntersectResult* blockResults = results + block * 8;
+                    for (int i = 0; i < 8; ++i)
+                    {
+                        blockResults[i] = (exteriorMask & (1 << i)) ? IntersectResult::Exterior
+                            : ((interiorMask & (1 << i)) ? IntersectResult::Interior : IntersectResult::Overlaps);
+                    }
+                }
+            }
+
+            AZ_SOA_MATH_TARGET_AVX2 static size_t IntersectRayAabbs(
+                const RayParams& params, const AabbArray8* aabbs, size_t blockCount, float* hitDistances)
+            {
+                __m256 origin[3];
+                __m256 inverseDirection[3];
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    origin[axis] = _mm256_set1_ps(params.m_origin[axis]);
+                    inverseDirection[axis] = _mm256_set1_ps(params.m_inverseDirection[axis]);
+                }
+                const __m256 zero = _mm256_setzero_ps();
+                const __m256 maxDistance = _mm256_set1_ps(params.m_maxDistance);
+                const __m256 missDistance = _mm256_set1_ps(Constants::FloatMax);
+
+                size_t hitCount = 0;
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    const float* minimum[3] = { aabbs[block].m_min.m_x, aabbs[block].m_min.m_y, aabbs[block].m_min.m_z };
+                    const float* maximum[3] = { aabbs[block].m_max.m_x, aabbs[block].m_max.m_y, aabbs[block].m_max.m_z };
+
+                    __m256 hit = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+                    __m256 entry = zero;
+                    __m256 exit = maxDistance;
+                    for (int32_t axis = 0; axis < 3; ++axis)
+                    {
+                        const __m256 slabMin = _mm256_load_ps(minimum[axis]);
+                        const __m256 slabMax = _mm256_load_ps(maximum[axis]);
+                        if (params.m_parallel[axis])
+                        {
+                            hit = _mm256_and_ps(
+                                hit,
+                                _mm256_and_ps(_mm256_cmp_ps(slabMin, origin[axis], _CMP_LE_OQ), _mm256_cmp_ps(origin[axis], slabMax, _CMP_LE_OQ)));
+                        }
+                        else
+                        {
+                            const __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(slabMin, origin[axis]), inverseDirection[axis]);
+                            const __m256 t1 = _mm256_mul_ps(_mm256_sub_ps(slabMax, origin[axis]), inverseDirection[axis]);
+                            entry = _mm256_max_ps(entry, _mm256_min_ps(t0, t1));
+                            exit = _mm256_min_ps(exit, _mm256_max_ps(t0, t1));
+                        }
+                    }
+                    hit = _mm256_and_ps(hit, _mm256_cmp_ps(entry, exit, _CMP_LE_OQ));
+                    _mm256_storeu_ps(hitDistances + block * 8, _mm256_blendv_ps(missDistance, entry, hit));
+                    hitCount += az_popcnt_u32(static_cast<uint32_t>(_mm256_movemask_ps(hit)));
+                }
+                return hitCount;
+            }
+
+            AZ_SOA_MATH_TARGET_AVX2 static void OverlapAabbs(
+                const AabbParams& params, const AabbArray8* aabbs, size_t blockCount, uint32_t* overlapMasks)
+            {
+                __m256 queryMin[3];
+                __m256 queryMax[3];
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    queryMin[axis] = _mm256_set1_ps(params.m_min[axis]);
+                    queryMax[axis] = _mm256_set1_ps(params.m_max[axis]);
+                }
+                const __m256 zero = _mm256_setzero_ps();
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    const float* minimum[3] = { aabbs[block].m_min.m_x, aabbs[block].m_min.m_y, aabbs[block].m_min.m_z };
+                    const float* maximum[3] = { aabbs[block].m_max.m_x, aabbs[block].m_max.m_y, aabbs[block].m_max.m_z };
+                    __m256 overlap = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+                    for (int32_t axis = 0; axis < 3; ++axis)
+                    {
+                        overlap = _mm256_and_ps(overlap, _mm256_and_ps(
+                            _mm256_cmp_ps(queryMin[axis], _mm256_load_ps(maximum[axis]), _CMP_LE_OQ),
+                            _mm256_cmp_ps(queryMax[axis], _mm256_load_ps(minimum[axis]), _CMP_GE_OQ)));
+                    }
+                    overlapMasks[block] = static_cast<uint32_t>(_mm256_movemask_ps(overlap));
+                }
+            }
+
+            AZ_SOA_MATH_TARGET_AVX2 static void OverlapAabbs(
+                const SphereParams& params, const AabbArray8* aabbs, size_t blockCount, uint32_t* overlapMasks)
+            {
+                __m256 center[3];
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    center[axis] = _mm256_set1_ps(params.m_center[axis]);
+                }
+                const __m256 radiusSq = _mm256_set1_ps(params.m_radiusSq);
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    const float* minimum[3] = { aabbs[block].m_min.m_x, aabbs[block].m_min.m_y, aabbs[block].m_min.m_z };
+                    const float* maximum[3] = { aabbs[block].m_max.m_x, aabbs[block].m_max.m_y, aabbs[block].m_max.m_z };
+                    __m256 distanceSq = _mm256_setzero_ps();
+                    for (int32_t axis = 0; axis < 3; ++axis)
+                    {
+                        const __m256 closest =
+                            _mm256_min_ps(_mm256_max_ps(center[axis], _mm256_load_ps(minimum[axis])), _mm256_load_ps(maximum[axis]));
+                        const __m256 delta = _mm256_sub_ps(center[axis], closest);
+                        distanceSq = _mm256_add_ps(distanceSq, _mm256_mul_ps(delta, delta));
+                    }
+                    overlapMasks[block] = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(distanceSq, radiusSq, _CMP_LE_OQ)));
+                }
+            }
+
+            AZ_SOA_MATH_TARGET_AVX2 static void OverlapAabbs(
+                const FrustumParams& params, const AabbArray8* aabbs, size_t blockCount, uint32_t* overlapMasks, uint32_t* containedMasks)
+            {
+                __m256 planes[Frustum::PlaneId::MAX][4];
+                __m256 absNormals[Frustum::PlaneId::MAX][3];
+                for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    for (int32_t i = 0; i < 4; ++i)
+                    {
+                        planes[planeId][i] = _mm256_set1_ps(params.m_planes[planeId][i]);
+                    }
+                    for (int32_t axis = 0; axis < 3; ++axis)
+                    {
+                        absNormals[planeId][axis] = _mm256_set1_ps(params.m_absNormals[planeId][axis]);
+                    }
+                }
+                const __m256 zero = _mm256_setzero_ps();
+                const __m256 half = _mm256_set1_ps(0.5f);
+
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    const float* minimum[3] = { aabbs[block].m_min.m_x, aabbs[block].m_min.m_y, aabbs[block].m_min.m_z };
+                    const float* maximum[3] = { aabbs[block].m_max.m_x, aabbs[block].m_max.m_y, aabbs[block].m_max.m_z };
+                    __m256 center[3];
+                    __m256 extents[3];
+                    for (int32_t axis = 0; axis < 3; ++axis)
+                    {
+                        const __m256 blockMin = _mm256_load_ps(minimum[axis]);
+                        const __m256 blockMax = _mm256_load_ps(maximum[axis]);
+                        center[axis] = _mm256_mul_ps(half, _mm256_add_ps(blockMin, blockMax));
+                        extents[axis] = _mm256_sub_ps(_mm256_mul_ps(half, blockMax), _mm256_mul_ps(half, blockMin));
+                    }
+
+                    __m256 overlap = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+                    __m256 contained = overlap;
+                    for (int32_t planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                    {
+                        const __m256 distance = _mm256_fmadd_ps(planes[planeId][0], center[0],
+                            _mm256_fmadd_ps(planes[planeId][1], center[1], _mm256_fmadd_ps(planes[planeId][2], center[2], planes[planeId][3])));
+                        const __m256 radius = _mm256_fmadd_ps(absNormals[planeId][0], extents[0],
+                            _mm256_fmadd_ps(absNormals[planeId][1], extents[1], _mm256_mul_ps(absNormals[planeId][2], extents[2])));
+                        overlap = _mm256_and_ps(overlap, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_GT_OQ));
+                        contained = _mm256_and_ps(contained, _mm256_cmp_ps(_mm256_sub_ps(distance, radius), zero, _CMP_GE_OQ));
+                    }
+                    overlapMasks[block] = static_cast<uint32_t>(_mm256_movemask_ps(overlap));
+                    if (containedMasks)
+                    {
+                        containedMasks[block] = static_cast<uint32_t>(_mm256_movemask_ps(contained));
+                    }
+                }
+            }
+        } // namespace Avx2
+#endif // AZ_SOA_MATH_AVX2
+
+        static bool IsAvx2Supported()
+        {
+#if AZ_SOA_MATH_AVX2
+#   if defined(AZ_COMPILER_MSVC)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7)
+            {
+                return false;
+            }
+            __cpuid(info, 1);
+            constexpr int FmaBit = 1 << 12;
+            constexpr int OsxsaveBit = 1 << 27;
+            constexpr int AvxBit = 1 << 28;
+            if ((info[2] & (FmaBit | OsxsaveBit | AvxBit)) != (FmaBit | OsxsaveBit | AvxBit))
+            {
+                return false;
+            }
+            // The OS must save the upper halves of the YMM registers on context switches
+            if ((_xgetbv(0) & 0x6) != 0x6)
+            {
+                return false;
+            }
+            __cpuidex(info, 7, 0);
+            constexpr int Avx2Bit = 1 << 5;
+            return (info[1] & Avx2Bit) != 0;
+#   else
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#   endif
+#else
+            return false;
+#endif
+        }
+
+        static AZStd::atomic<InstructionSet>& GetInstructionSetStorage()
+        {
+            static AZStd::atomic<InstructionSet> s_instructionSet{ IsAvx2Supported() ? InstructionSet::Avx2 : InstructionSet::Simd128 };
+            return s_instructionSet;
+        }
+
+        static bool UseAvx2()
+        {
+#if AZ_SOA_MATH_AVX2
+            return GetInstructionSetStorage().load(AZStd::memory_order_relaxed) == InstructionSet::Avx2;
+#else
+            return false;
+#endif
+        }
+    } // namespace Internal
+
+    InstructionSet GetInstructionSet()
+    {
+        return Internal::GetInstructionSetStorage().load(AZStd::memory_order_relaxed);
+    }
+
+    bool IsInstructionSetSupported(InstructionSet instructionSet)
+    {
+        switch (instructionSet)
+        {
+        case InstructionSet::Simd128:
+            return true;
+        case InstructionSet::Avx2:
+            return Internal::IsAvx2Supported();
+        }
+        return false;
+    }
+
+    bool SetInstructionSet(InstructionSet instructionSet)
+    {
+        if (!IsInstructionSetSupported(instructionSet))
+        {
+            return false;
+        }
+        Internal::GetInstructionSetStorage().store(instructionSet, AZStd::memory_order_relaxed);
+        return true;
+    }
+
+    void TransformPoints(const Transform& transform, const Vector3Array4* points, Vector3Array4* results, size_t blockCount)
+    {
+        Internal::Simd128::TransformPoints(Internal::TransformParams(transform), points, results, blockCount);
+    }
+
+    void TransformPoints(const Transform& transform, const Vector3Array8* points, Vector3Array8* results, size_t blockCount)
+    {
+        const Internal::TransformParams params(transform);
+#if AZ_SOA_MATH_AVX2
+        if (Internal::UseAvx2())
+        {
+            Internal::Avx2::TransformPoints(params, points, results, blockCount);
+            return;
+        }
+#endif
+        Internal::Simd128::TransformPoints(params, points, results, blockCount);
+    }
+
+    void TransformAabbs(const Transform& transform, const AabbArray4* aabbs, AabbArray4* results, size_t blockCount)
+    {
+        Internal::Simd128::TransformAabbs(Internal::TransformParams(transform), aabbs, results, blockCount);
+    }
+
+    void TransformAabbs(const Transform& transform, const AabbArray8* aabbs, AabbArray8* results, size_t blockCount)
+    {
+        const Internal::TransformParams params(transform);
+#if AZ_SOA_MATH_AVX2
+        if (Internal::UseAvx2())
+        {
+            Internal::Avx2::TransformAabbs(params, aabbs, results, blockCount);
+            return;
+        }
+#endif
+        Internal::Simd128::TransformAabbs(params, aabbs, results, blockCount);
+    }
+
+    void IntersectFrustumAabbs(const Frustum& frustum, const AabbArray4* aabbs, size_t blockCount, IntersectResult* results)
+    {
+        Internal::Simd128::IntersectFrustumAabbs(Internal::FrustumParams(frustum), aabbs, blockCount, results);
+    }
+
+    void IntersectFrustumAabbs(const Frustum& frustum, const AabbArray8* aabbs, size_t blockCount, IntersectResult* results)
+    {
+        const Internal::FrustumParams params(frustum);
+#if AZ_SOA_MATH_AVX2
+        if (Internal::UseAvx2())
+        {
+            Internal::Avx2::IntersectFrustumAabbs(params, aabbs, blockCount, results);
+            return;
+        }
+#endif
+        Internal::Simd128::IntersectFrustumAabbs(params, aabbs, blockCount, results);
+    }
+
+    size_t IntersectRayAabbs(
+        const Vector3& rayOrigin, const Vector3& rayDirection, float maxDistance, const AabbArray4* aabbs, size_t blockCount, float* hitDistances)
+    {
+        return Internal::Simd128::IntersectRayAabbs(Internal::RayParams(rayOrigin, rayDirection, maxDistance), aabbs, blockCount, hitDistances);
+    }
+
+    size_t IntersectRayAabbs(
+        const Vector3& rayOrigin, const Vector3& rayDirection, float maxDistance, const AabbArray8* aabbs, size_t blockCount, float* hitDistances)
+    {
+        const Internal::RayParams params(rayOrigin, rayDirection, maxDistance);
+#if AZ_SOA_MATH_AVX2
+        if (Internal::UseAvx2())
+        {
+            return Internal::Avx2::IntersectRayAabbs(params, aabbs, blockCount, hitDistances);
+        }
+#endif
+        return Internal::Simd128::IntersectRayAabbs(params, aabbs, blockCount, hitDistances);
+    }
+
+    void OverlapAabbs(const Aabb& aabb, const AabbArray4* aabbs, size_t blockCount, uint32_t* overlapMasks)
+    {
+        Internal::Simd128::OverlapAabbs(Internal::AabbParams(aabb), aabbs, blockCount, overlapMasks);
+    }
+
+    void OverlapAabbs(const Aabb& aabb, const AabbArray8* aabbs, size_t blockCount, uint32_t* overlapMasks)
+    {
+        const Internal::AabbParams params(aabb);
+#if AZ_SOA_MATH_AVX2
+        if (Internal::UseAvx2())
+        {
+            Internal::Avx2::OverlapAabbs(params, aabbs, blockCount, overlapMasks);
+            return;
+        }
+#endif
+        Internal::Simd128::OverlapAabbs(params, aabbs, blockCount, overlapMasks);
+    }
+
+    void OverlapAabbs(const Sphere& sphere, const AabbArray4* aabbs, size_t blockCount, uint32_t* overlapMasks)
+    {
+        Internal::Simd128::OverlapAabbs(Internal::SphereParams(sphere), aabbs, blockCount, overlapMasks);
+    }
+
+    void OverlapAabbs(const Sphere& sphere, const AabbArray8* aabbs, size_t blockCount, uint32_t* overlapMasks)
+    {
+        const Internal::SphereParams params(sphere);
+#if AZ_SOA_MATH_AVX2
+        if (Internal::UseAvx2())
+        {
+            Internal::Avx2::OverlapAabbs(params, aabbs, blockCount, overlapMasks);
+            return;
+        }
+#endif
+        Internal::Simd128::OverlapAabbs(params, aabbs, blockCount, overlapMasks);
+    }
+
+    void OverlapAabbs(const Frustum& frustum, const AabbArray4* aabbs, size_t blockCount, uint32_t* overlapMasks, uint32_t* containedMasks)
+    {
+        Internal::Simd128::OverlapAabbs(Internal::FrustumParams(frustum), aabbs, blockCount, overlapMasks, containedMasks);
+    }
+
+    void OverlapAabbs(const Frustum& frustum, const AabbArray8* aabbs, size_t blockCount, uint32_t* overlapMasks, uint32_t* containedMasks)
+    {
+        const Internal::FrustumParams params(frustum);
+#if AZ_SOA_MATH_AVX2
+        if (Internal::UseAvx2())
+        {
+            Internal::Avx2::OverlapAabbs(params, aabbs, blockCount, overlapMasks, containedMasks);
+            return;
+        }
+#endif
+        Internal::Simd128::OverlapAabbs(params, aabbs, blockCount, overlapMasks, containedMasks);
+    }
+} // namespace AZ::Soa
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Plane.h>
+#include <AzCore/Math/Vector3.h>
+
+namespace AZ
+{
+    class Frustum;
+    class Sphere;
+    class Transform;
+
+    //! A block of Width Vector3s stored as a structure of arrays, so that one SIMD register holds the same component of
+    //! several vectors. Use this for large arrays of points that are processed by the batched kernels in AZ::Soa.
+    template<size_t Width>
+    struct alignas(Width * sizeof(float)) Vector3Array
+    {
+        static_assert(Width == 4 || Width == 8, "Vector3Array only supports blocks of 4 or 8 elements");
+        static constexpr size_t ElementCount = Width;
+
+        static Vector3Array CreateSplat(const Vector3& value);
+
+        Vector3 GetElement(size_t index) const;
+        void SetElement(size_t index, const Vector3& value);
+
+        float m_x[Width];
+        float m_y[Width];
+        float m_z[Width];
+    };
+
+    using Vector3Array4 = Vector3Array<4>;
+    using Vector3Array8 = Vector3Array<8>;
+
+    //! A block of Width axis aligned bounding boxes stored as a structure of arrays.
+    template<size_t Width>
+    struct AabbArray
+    {
+        static constexpr size_t ElementCount = Width;
+
+        static AabbArray CreateSplat(const Aabb& value);
+
+        Aabb GetElement(size_t index) const;
+        void SetElement(size_t index, const Aabb& value);
+
+        Vector3Array<Width> m_min;
+        Vector3Array<Width> m_max;
+    };
+
+    using AabbArray4 = AabbArray<4>;
+    using AabbArray8 = AabbArray<8>;
+
+    //! Batched math kernels over arrays of SoA blocks.
+    //! The kernels always process whole blocks, so arrays that aren't a multiple of the block width must be padded. The
+    //! Pack functions pad the last block by repeating the last element, and the results for the padding can be ignored.
+    namespace Soa
+    {
+        //! The instruction set used by the batched kernels.
+        //! Simd128 uses the platform's 4 wide SIMD implementation (SSE, NEON or scalar), Avx2 processes 8 elements at a time and
+        //! is selected at runtime on x86 processors that support it.
+        enum class InstructionSet : uint8_t
+        {
+            Simd128,
+            Avx2
+        };
+
+        //! Returns the instruction set currently used by the kernels.
+        AZCORE_API InstructionSet GetInstructionSet();
+
+        //! Returns whether the instruction set is supported by the processor and was compiled in.
+        AZCORE_API bool IsInstructionSetSupported(InstructionSet instructionSet);
+
+        //! Overrides the instruction set used by the kernels, for testing and benchmarking.
+        //! @return False if the instruction set isn't supported, in which case the current one is kept.
+        AZCORE_API bool SetInstructionSet(InstructionSet instructionSet);
+
+        //! Returns the number of blocks of the given width needed to store elementCount elements.
+        template<size_t Width>
+        constexpr size_t GetBlockCount(size_t elementCount);
+
+        //! Converts elementCount vectors to SoA blocks. blocks must have room for GetBlockCount<Width>(elementCount) blocks.
+        template<size_t Width>
+        void Pack(const Vector3* values, size_t elementCount, Vector3Array<Width>* blocks);
+        //! Converts elementCount bounding boxes to SoA blocks. blocks must have room for GetBlockCount<Width>(elementCount) blocks.
+        template<size_t Width>
+        void Pack(const Aabb* values, size_t elementCount, AabbArray<Width>* blocks);
+
+        //! Converts the first elementCount elements stored in SoA blocks back to vectors.
+        template<size_t Width>
+        void Unpack(const Vector3Array<Width>* blocks, size_t elementCount, Vector3* values);
+        //! Converts the first elementCount elements stored in SoA blocks back to bounding boxes.
+        template<size_t Width>
+        void Unpack(const AabbArray<Width>* blocks, size_t elementCount, Aabb* values);
+
+        //! Transforms blockCount blocks of points. points and results may be the same array.
+        AZCORE_API void TransformPoints(const Transform& transform, const Vector3Array4* points, Vector3Array4* results, size_t blockCount);
+        AZCORE_API void TransformPoints(const Transform& transform, const Vector3Array8* points, Vector3Array8* results, size_t blockCount);
+
+        //! Computes the bounding boxes of blockCount blocks of transformed bounding boxes, with the same result as
+        //! Aabb::GetTransformedAabb. aabbs and results may be the same array.
+        AZCORE_API void TransformAabbs(const Transform& transform, const AabbArray4* aabbs, AabbArray4* results, size_t blockCount);
+        AZCORE_API void TransformAabbs(const Transform& transform, const AabbArray8* aabbs, AabbArray8* results, size_t blockCount);
+
+        //! Classifies blockCount blocks of bounding boxes against a frustum, with the same result as Frustum::IntersectAabb.
+        //! @param results Receives one result per element, blockCount * Width in total.
+        AZCORE_API void IntersectFrustumAabbs(const Frustum& frustum, const AabbArray4* aabbs, size_t blockCount, IntersectResult* results);
+        AZCORE_API void IntersectFrustumAabbs(const Frustum& frustum, const AabbArray8* aabbs, size_t blockCount, IntersectResult* results);
+
+        //! Intersects a ray with blockCount blocks of bounding boxes.
+        //! @param rayOrigin The origin of the ray.
+        //! @param rayDirection The direction of the ray, distances are measured in multiples of its length.
+        //! @param maxDistance Bounding boxes that the ray enters further than this distance are reported as misses.
+        //! @param hitDistances Receives one distance per element, blockCount * Width in total. The distance is 0 when the origin
+        //!        is inside the bounding box, and Constants::FloatMax when the ray misses the bounding box.
+        //! @return The number of bounding boxes hit by the ray.
+        AZCORE_API size_t IntersectRayAabbs(
+            const Vector3& rayOrigin, const Vector3& rayDirection, float maxDistance, const AabbArray4* aabbs, size_t blockCount, float* hitDistances);
+        AZCORE_API size_t IntersectRayAabbs(
+            const Vector3& rayOrigin, const Vector3& rayDirection, float maxDistance, const AabbArray8* aabbs, size_t blockCount, float* hitDistances);
+
+        //! Tests blockCount blocks of bounding boxes for overlap with a bounding box, a sphere or a frustum, with the same
+        //! results as ShapeIntersection::Overlaps.
+        //! @param overlapMasks Receives one mask per block, where bit i is set if element i of the block overlaps the volume.
+        //! @{
+        AZCORE_API void OverlapAabbs(const Aabb& aabb, const AabbArray4* aabbs, size_t blockCount, uint32_t* overlapMasks);
+        AZCORE_API void OverlapAabbs(const Aabb& aabb, const AabbArray8* aabbs, size_t blockCount, uint32_t* overlapMasks);
+        AZCORE_API void OverlapAabbs(const Sphere& sphere, const AabbArray4* aabbs, size_t blockCount, uint32_t* overlapMasks);
+        AZCORE_API void OverlapAabbs(const Sphere& sphere, const AabbArray8* aabbs, size_t blockCount, uint32_t* overlapMasks);
+        //! @}
+
+        //! @param containedMasks If not null, receives one mask per block of the bounding boxes that are fully inside the frustum,
+        //!        with the same results as ShapeIntersection::Contains.
+        //! @{
+        AZCORE_API void OverlapAabbs(
+            const Frustum& frustum, const AabbArray4* aabbs, size_t blockCount, uint32_t* overlapMasks, uint32_t* containedMasks = nullptr);
+        AZCORE_API void OverlapAabbs(
+            const Frustum& frustum, const AabbArray8* aabbs, size_t blockCount, uint32_t* overlapMasks, uint32_t* containedMasks = nullptr);
+        //! @}
+    } // namespace Soa
+} // namespace AZ
+
+#include <AzCore/Math/SoaMath.inl>
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    template<size_t Width>
+    AZ_MATH_INLINE Vector3Array<Width> Vector3Array<Width>::CreateSplat(const Vector3& value)
+    {
+        Vector3Array result;
+        for (size_t i = 0; i < Width; ++i)
+        {
+            result.SetElement(i, value);
+        }
+        return result;
+    }
+
+    template<size_t Width>
+    AZ_MATH_INLINE Vector3 Vector3Array<Width>::GetElement(size_t index) const
+    {
+        AZ_MATH_ASSERT(index < Width, "Invalid index for component access.\n");
+        return Vector3(m_x[index], m_y[index], m_z[index]);
+    }
+
+    template<size_t Width>
+    AZ_MATH_INLINE void Vector3Array<Width>::SetElement(size_t index, const Vector3& value)
+    {
+        AZ_MATH_ASSERT(index < Width, "Invalid index for component access.\n");
+        m_x[index] = value.GetX();
+        m_y[index] = value.GetY();
+        m_z[index] = value.GetZ();
+    }
+
+    template<size_t Width>
+    AZ_MATH_INLINE AabbArray<Width> AabbArray<Width>::CreateSplat(const Aabb& value)
+    {
+        AabbArray result;
+        result.m_min = Vector3Array<Width>::CreateSplat(value.GetMin());
+        result.m_max = Vector3Array<Width>::CreateSplat(value.GetMax());
+        return result;
+    }
+
+    template<size_t Width>
+    AZ_MATH_INLINE Aabb AabbArray<Width>::GetElement(size_t index) const
+    {
+        return Aabb::CreateFromMinMax(m_min.GetElement(index), m_max.GetElement(index));
+    }
+
+    template<size_t Width>
+    AZ_MATH_INLINE void AabbArray<Width>::SetElement(size_t index, const Aabb& value)
+    {
+        m_min.SetElement(index, value.GetMin());
+        m_max.SetElement(index, value.GetMax());
+    }
+
+    namespace Soa
+    {
+        template<size_t Width>
+        constexpr size_t GetBlockCount(size_t elementCount)
+        {
+            return (elementCount + Width - 1) / Width;
+        }
+
+        template<size_t Width>
+        AZ_MATH_INLINE void Pack(const Vector3* values, size_t elementCount, Vector3Array<Width>* blocks)
+        {
+            const size_t paddedCount = GetBlockCount<Width>(elementCount) * Width;
+            for (size_t i = 0; i < paddedCount; ++i)
+            {
+                blocks[i / Width].SetElement(i % Width, values[AZStd::min(i, elementCount - 1)]);
+            }
+        }
+
+        template<size_t Width>
+        AZ_MATH_INLINE void Pack(const Aabb* values, size_t elementCount, AabbArray<Width>* blocks)
+        {
+            const size_t paddedCount = GetBlockCount<Width>(elementCount) * Width;
+            for (size_t i = 0; i < paddedCount; ++i)
+            {
+                blocks[i / Width].SetElement(i % Width, values[AZStd::min(i, elementCount - 1)]);
+            }
+        }
+
+        template<size_t Width>
+        AZ_MATH_INLINE void Unpack(const Vector3Array<Width>* blocks, size_t elementCount, Vector3* values)
+        {
+            for (size_t i = 0; i < elementCount; ++i)
+            {
+                values[i] = blocks[i / Width].GetElement(i % Width);
+            }
+        }
+
+        template<size_t Width>
+        AZ_MATH_INLINE void Unpack(const AabbArray<Width>* blocks, size_t elementCount, Aabb* values)
+        {
+            for (size_t i = 0; i < elementCount; ++i)
+            {
+                values[i] = blocks[i / Width].GetElement(i % Width);
+            }
+        }
+    } // namespace Soa
+} // namespace AZ
@@ -14,6 +14,7 @@
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/Memory/ChildAllocatorSchema.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/IAllocator.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -726,10 +727,11 @@ namespace AZ
         size_t totalUsedBytes = 0;
         size_t totalReservedBytes = 0;
         size_t totalConsumedBytes = 0;
+        size_t totalPeakBytes = 0;
 
         memset(m_dumpInfo, 0, sizeof(m_dumpInfo));
 
-        AZ_Printf(AZ::Debug::NoWindow, "Index,Name,Used KiB,Reserved KiB,Consumed KiB,Parent Allocator\n");
+        AZ_Printf(AZ::Debug::NoWindow, "Index,Name,Used KiB,Reserved KiB,Consumed KiB,Parent Allocator,Peak KiB\n");
 
         for (int i = 0; i < m_numAllocators; i++)
         {
@@ -745,26 +747,42 @@ namespace AZ
                 auto parentAllocator = childAllocatorSchema->GetParentAllocator();
                 parentName = parentAllocator != nullptr ? parentAllocator->GetName() : "";
             }
+            size_t peakBytes = 0;
+            if (auto frameArenaAllocator = azrtti_cast<AZ::FrameArenaAllocator*>(allocator); frameArenaAllocator != nullptr)
+            {
+                reservedBytes = frameArenaAllocator->GetReservedBytes();
+                consumedBytes = reservedBytes;
+                peakBytes = frameArenaAllocator->GetPeakAllocatedBytes();
+            }
 
             totalUsedBytes += usedBytes;
             totalReservedBytes += reservedBytes;
             totalConsumedBytes += consumedBytes;
+            totalPeakBytes += peakBytes;
             m_dumpInfo[i].m_name = name;
             m_dumpInfo[i].m_used = usedBytes;
             m_dumpInfo[i].m_reserved = reservedBytes;
             m_dumpInfo[i].m_consumed = consumedBytes;
+            m_dumpInfo[i].m_peak = peakBytes;
             AZ_Printf(
                 AZ::Debug::NoWindow,
-                "%d,%s,%.2f,%.2f,%.2f,%s\n",
+                "%d,%s,%.2f,%.2f,%.2f,%s,%.2f\n",
                 i,
                 name,
                 usedBytes / 1024.0f,
                 reservedBytes / 1024.0f,
                 consumedBytes / 1024.0f,
-                parentName);
+                parentName,
+                peakBytes / 1024.0f);
         }
 
-        AZ_Printf(AZ::Debug::NoWindow, "-,Totals,%.2f,%.2f,%.2f,\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
+        AZ_Printf(
+            AZ::Debug::NoWindow,
+            "-,Totals,%.2f,%.2f,%.2f,,%.2f\n",
+            totalUsedBytes / 1024.0f,
+            totalReservedBytes / 1024.0f,
+            totalConsumedBytes / 1024.0f,
+            totalPeakBytes / 1024.0f);
         AZ_Printf(AZ::Debug::NoWindow, "%d allocators active\n", m_numAllocators);
     }
     void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacityBytes, AZStd::vector<AllocatorStats>* outStats)
@@ -790,7 +808,13 @@ namespace AZ
                     auto parentAllocator = childAllocatorSchema->GetParentAllocator();
                     parentName = parentAllocator != nullptr ? parentAllocator->GetName() : "";
                 }
-                outStats->emplace(outStats->end(), allocator->GetName(), parentName, allocator->NumAllocatedBytes(), allocator->Capacity());
+                AllocatorStats& stats =
+                    *outStats->emplace(outStats->end(), allocator->GetName(), parentName, allocator->NumAllocatedBytes(), allocator->Capacity());
+                if (auto frameArenaAllocator = azrtti_cast<AZ::FrameArenaAllocator*>(allocator); frameArenaAllocator != nullptr)
+                {
+                    stats.m_capacityBytes = frameArenaAllocator->GetReservedBytes();
+                    stats.m_peakAllocatedBytes = frameArenaAllocator->GetPeakAllocatedBytes();
+                }
             }
         }
     }
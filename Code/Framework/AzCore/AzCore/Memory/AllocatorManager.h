@@ -103,6 +103,7 @@ namespace AZ
             size_t m_used;
             size_t m_reserved;
             size_t m_consumed;
+            size_t m_peak;
         };
 
         struct AllocatorStats
@@ -118,6 +119,8 @@ namespace AZ
             AZStd::string m_parentName;
             size_t m_allocatedBytes;
             size_t m_capacityBytes;
+            //! Highest number of allocated bytes seen at a frame boundary, only reported by frame arena allocators.
+            size_t m_peakAllocatedBytes = 0;
         };
 
         void GetAllocatorStats(size_t& usedBytes, size_t& reservedBytes, AZStd::vector<AllocatorStats>* outStats = nullptr);
@@ -0,0 +1,458 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace FrameArenaAllocatorPrivate
+    {
+        // Guards the thread bindings against the destruction of the allocator they point to. Never destroyed, since threads
+        // can exit after the static destructors ran.
+        static AZStd::mutex& GetBindingMutex()
+        {
+            alignas(AZStd::mutex) static unsigned char s_mutexStorage[sizeof(AZStd::mutex)];
+            static AZStd::mutex* s_mutex = new (s_mutexStorage) AZStd::mutex();
+            return *s_mutex;
+        }
+
+        static char* AlignUp(char* address, size_t alignment)
+        {
+            return reinterpret_cast<char*>(AZ::SizeAlignUp(reinterpret_cast<size_t>(address), alignment));
+        }
+    } // namespace FrameArenaAllocatorPrivate
+
+    struct FrameArenaAllocator::Page
+    {
+        Page* m_next;
+        size_type m_dataSize;
+
+        char* GetData()
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+    };
+
+    struct FrameArenaAllocator::Region
+    {
+        //! Pages of the region, in the order they are used.
+        Page* m_pages = nullptr;
+        //! Page that is currently bumped, nullptr if nothing was allocated since the last reset.
+        Page* m_current = nullptr;
+        char* m_cursor = nullptr;
+        char* m_end = nullptr;
+        void* m_lastAllocation = nullptr;
+        //! Only written by the thread that owns the arena, read by the statistics.
+        AZStd::atomic<size_type> m_allocatedBytes{ 0 };
+    };
+
+    struct FrameArenaAllocator::ThreadArena
+    {
+        //! Set to nullptr when the allocator is destroyed while a thread is still bound to the arena.
+        FrameArenaAllocator* m_allocator = nullptr;
+        //! True while a thread is bound to the arena. Arenas of threads that exited are reused by new threads.
+        bool m_threadOwned = false;
+        //! Frame the regions were last reset for. Only written by the thread bound to the arena, or by NextFrame while no thread is.
+        AZStd::atomic<AZ::u64> m_frameIndex{ 0 };
+        //! Region 0 holds the single frame allocations, regions 1 and 2 are the two halves of the double buffer.
+        Region m_regions[RegionCount];
+    };
+
+    struct FrameArenaAllocator::ThreadArenaBinding
+    {
+        ~ThreadArenaBinding()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(FrameArenaAllocatorPrivate::GetBindingMutex());
+            Release();
+        }
+
+        //! Must be called with the binding mutex locked.
+        void Release()
+        {
+            if (m_arena)
+            {
+                if (m_arena->m_allocator)
+                {
+                    AZStd::lock_guard<AZStd::mutex> arenasLock(m_arena->m_allocator->m_arenasMutex);
+                    m_arena->m_threadOwned = false;
+                }
+                else
+                {
+                    // The allocator is gone and already freed the pages.
+                    m_arena->~ThreadArena();
+                    AZStd::stateless_allocator().deallocate(m_arena, sizeof(ThreadArena), alignof(ThreadArena));
+                }
+                m_arena = nullptr;
+            }
+        }
+
+        ThreadArena* m_arena = nullptr;
+    };
+
+    AZ_TYPE_INFO_WITH_NAME_IMPL(FrameArenaAllocator, "FrameArenaAllocator", "{5E0B6D0C-3B51-4B8E-9F4A-7A8B0F2C4D61}");
+    AZ_RTTI_NO_TYPE_INFO_IMPL(FrameArenaAllocator, AllocatorBase);
+
+    FrameArenaAllocator::FrameArenaAllocator()
+        : FrameArenaAllocator(DefaultPageSize)
+    {
+    }
+
+    FrameArenaAllocator::FrameArenaAllocator(size_type pageSize)
+        : m_pageSize(pageSize)
+    {
+        AZ_Assert(m_pageSize > sizeof(Page), "Frame arena page size %zu is too small", m_pageSize);
+        AllocatorInstance<OSAllocator>::Get();
+        PostCreate();
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+        PreDestroy();
+
+        AZStd::lock_guard<AZStd::mutex> bindingLock(FrameArenaAllocatorPrivate::GetBindingMutex());
+        AZStd::lock_guard<AZStd::mutex> arenasLock(m_arenasMutex);
+        for (ThreadArena* arena : m_arenas)
+        {
+            for (Region& region : arena->m_regions)
+            {
+                FreeRegionPages(region);
+            }
+
+            if (arena->m_threadOwned)
+            {
+                // The bound thread frees the arena when it exits
+                arena->m_allocator = nullptr;
+            }
+            else
+            {
+                arena->~ThreadArena();
+                AZStd::stateless_allocator().deallocate(arena, sizeof(ThreadArena), alignof(ThreadArena));
+            }
+        }
+        m_arenas.clear();
+    }
+
+    AllocatorDebugConfig FrameArenaAllocator::GetDebugConfig()
+    {
+        // Allocations are never individually freed, so recording them would only report leaks.
+        return AllocatorDebugConfig().ExcludeFromDebugging();
+    }
+
+    AllocateAddress FrameArenaAllocator::Allocate(size_type byteSize, size_type alignment, FrameArenaLifetime lifetime)
+    {
+        return AllocateFromRegion(GetRegion(GetThreadArena(), lifetime), byteSize, alignment);
+    }
+
+    AllocateAddress FrameArenaAllocator::allocate(size_type byteSize, size_type alignment)
+    {
+        return Allocate(byteSize, alignment, FrameArenaLifetime::SingleFrame);
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::deallocate(
+        [[maybe_unused]] pointer ptr, [[maybe_unused]] size_type byteSize, [[maybe_unused]] size_type alignment)
+    {
+        return 0;
+    }
+
+    AllocateAddress FrameArenaAllocator::reallocate(pointer ptr, size_type newSize, size_type newAlignment)
+    {
+        if (ptr == nullptr)
+        {
+            return allocate(newSize, newAlignment);
+        }
+
+        ThreadArena& arena = GetThreadArena();
+        for (Region& region : arena.m_regions)
+        {
+            if (region.m_lastAllocation != ptr)
+            {
+                continue;
+            }
+
+            char* start = static_cast<char*>(ptr);
+            const size_type oldSize = region.m_cursor - start;
+            const bool isAligned = FrameArenaAllocatorPrivate::AlignUp(start, AZStd::max<size_type>(newAlignment, 1)) == start;
+            if (isAligned && start + newSize <= region.m_end)
+            {
+                region.m_cursor = start + newSize;
+                region.m_allocatedBytes.store(
+                    region.m_allocatedBytes.load(AZStd::memory_order_relaxed) - oldSize + newSize, AZStd::memory_order_relaxed);
+                return AllocateAddress(ptr, newSize);
+            }
+
+            AllocateAddress newAddress = AllocateFromRegion(region, newSize, newAlignment);
+            if (newAddress)
+            {
+                memcpy(newAddress.GetAddress(), ptr, AZStd::min(oldSize, newSize));
+            }
+            return newAddress;
+        }
+
+        AZ_Assert(false, "FrameArenaAllocator can only reallocate the last allocation of the calling thread");
+        return AllocateAddress{};
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::get_allocated_size(
+        [[maybe_unused]] pointer ptr, [[maybe_unused]] size_type alignment) const
+    {
+        // Allocation sizes aren't stored
+        return 0;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::NumAllocatedBytes() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        size_type allocatedBytes = 0;
+        for (const ThreadArena* arena : m_arenas)
+        {
+            allocatedBytes += GetLiveBytes(*arena, frameIndex);
+        }
+        return allocatedBytes;
+    }
+
+    void FrameArenaAllocator::NextFrame()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_relaxed);
+        size_type allocatedBytes = 0;
+        for (const ThreadArena* arena : m_arenas)
+        {
+            allocatedBytes += GetLiveBytes(*arena, frameIndex);
+        }
+        m_lastFrameAllocatedBytes.store(allocatedBytes, AZStd::memory_order_relaxed);
+        if (allocatedBytes > m_peakAllocatedBytes.load(AZStd::memory_order_relaxed))
+        {
+            m_peakAllocatedBytes.store(allocatedBytes, AZStd::memory_order_relaxed);
+        }
+
+        // Threads reset their own regions on their next allocation, so the regions are never touched while their thread bumps
+        // them. Arenas without a thread can't be acquired while the arenas mutex is held, so they're reset right away.
+        m_frameIndex.store(frameIndex + 1, AZStd::memory_order_release);
+        for (ThreadArena* arena : m_arenas)
+        {
+            if (!arena->m_threadOwned)
+            {
+                SyncThreadArena(*arena, frameIndex + 1);
+            }
+        }
+    }
+
+    AZ::u64 FrameArenaAllocator::GetFrameIndex() const
+    {
+        return m_frameIndex.load(AZStd::memory_order_acquire);
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::GetPeakAllocatedBytes() const
+    {
+        return m_peakAllocatedBytes.load(AZStd::memory_order_relaxed);
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::GetLastFrameAllocatedBytes() const
+    {
+        return m_lastFrameAllocatedBytes.load(AZStd::memory_order_relaxed);
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::GetReservedBytes() const
+    {
+        return m_reservedBytes.load(AZStd::memory_order_relaxed);
+    }
+
+    FrameArenaAllocator::ThreadArena& FrameArenaAllocator::GetThreadArena()
+    {
+        static thread_local ThreadArenaBinding s_binding;
+        if (s_binding.m_arena == nullptr || s_binding.m_arena->m_allocator != this)
+        {
+            // First allocation of this thread, or the thread last allocated from another frame arena
+            AZStd::lock_guard<AZStd::mutex> bindingLock(FrameArenaAllocatorPrivate::GetBindingMutex());
+            s_binding.Release();
+            s_binding.m_arena = AcquireThreadArena();
+        }
+
+        ThreadArena& arena = *s_binding.m_arena;
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        if (arena.m_frameIndex.load(AZStd::memory_order_relaxed) != frameIndex)
+        {
+            SyncThreadArena(arena, frameIndex);
+        }
+        return arena;
+    }
+
+    void FrameArenaAllocator::SyncThreadArena(ThreadArena& arena, AZ::u64 frameIndex)
+    {
+        // The half of the double buffer that becomes current holds allocations from before the previous frame. The other half
+        // holds the allocations of the previous frame, unless the arena wasn't used in that frame either.
+        const AZ::u64 arenaFrameIndex = arena.m_frameIndex.load(AZStd::memory_order_relaxed);
+        ResetRegion(arena.m_regions[0]);
+        ResetRegion(arena.m_regions[1 + (frameIndex & 1)]);
+        if (frameIndex - arenaFrameIndex > 1)
+        {
+            ResetRegion(arena.m_regions[1 + ((frameIndex - 1) & 1)]);
+        }
+        arena.m_frameIndex.store(frameIndex, AZStd::memory_order_release);
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::GetLiveBytes(const ThreadArena& arena, AZ::u64 frameIndex)
+    {
+        // Arenas that weren't reset yet still count the bytes of released frames
+        const AZ::u64 arenaFrameIndex = arena.m_frameIndex.load(AZStd::memory_order_acquire);
+        if (arenaFrameIndex == frameIndex)
+        {
+            size_type allocatedBytes = 0;
+            for (const Region& region : arena.m_regions)
+            {
+                allocatedBytes += region.m_allocatedBytes.load(AZStd::memory_order_relaxed);
+            }
+            return allocatedBytes;
+        }
+        if (arenaFrameIndex + 1 == frameIndex)
+        {
+            return arena.m_regions[1 + (arenaFrameIndex & 1)].m_allocatedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return 0;
+    }
+
+    FrameArenaAllocator::ThreadArena* FrameArenaAllocator::AcquireThreadArena()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        for (ThreadArena* arena : m_arenas)
+        {
+            if (!arena->m_threadOwned)
+            {
+                arena->m_threadOwned = true;
+                return arena;
+            }
+        }
+
+        void* storage = AZStd::stateless_allocator().allocate(sizeof(ThreadArena), alignof(ThreadArena));
+        ThreadArena* arena = new (storage) ThreadArena();
+        arena->m_allocator = this;
+        arena->m_threadOwned = true;
+        arena->m_frameIndex.store(m_frameIndex.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        m_arenas.push_back(arena);
+        return arena;
+    }
+
+    FrameArenaAllocator::Region& FrameArenaAllocator::GetRegion(ThreadArena& arena, FrameArenaLifetime lifetime) const
+    {
+        if (lifetime == FrameArenaLifetime::SingleFrame)
+        {
+            return arena.m_regions[0];
+        }
+        return arena.m_regions[1 + (arena.m_frameIndex.load(AZStd::memory_order_relaxed) & 1)];
+    }
+
+    AllocateAddress FrameArenaAllocator::AllocateFromRegion(Region& region, size_type byteSize, size_type alignment)
+    {
+        alignment = AZStd::max<size_type>(alignment, 1);
+        char* start = FrameArenaAllocatorPrivate::AlignUp(region.m_cursor, alignment);
+        if (region.m_current == nullptr || start + byteSize > region.m_end)
+        {
+            // Move on to the next page that was retained from earlier frames, or insert a new one if it's too small
+            Page* next = region.m_current ? region.m_current->m_next : region.m_pages;
+            if (next == nullptr || next->m_dataSize < byteSize + alignment - 1)
+            {
+                Page* page = AllocatePage(byteSize + alignment - 1);
+                if (page == nullptr)
+                {
+                    return AllocateAddress{};
+                }
+                page->m_next = next;
+                if (region.m_current)
+                {
+                    region.m_current->m_next = page;
+                }
+                else
+                {
+                    region.m_pages = page;
+                }
+                next = page;
+            }
+
+            region.m_current = next;
+            region.m_cursor = next->GetData();
+            region.m_end = region.m_cursor + next->m_dataSize;
+            start = FrameArenaAllocatorPrivate::AlignUp(region.m_cursor, alignment);
+        }
+
+        char* end = start + byteSize;
+        region.m_allocatedBytes.store(
+            region.m_allocatedBytes.load(AZStd::memory_order_relaxed) + (end - region.m_cursor), AZStd::memory_order_relaxed);
+        region.m_cursor = end;
+        region.m_lastAllocation = start;
+        return AllocateAddress(start, byteSize);
+    }
+
+    FrameArenaAllocator::Page* FrameArenaAllocator::AllocatePage(size_type minDataSize)
+    {
+        const size_type pageSize = AZStd::max(m_pageSize, minDataSize + sizeof(Page));
+        void* memory = AllocatorInstance<OSAllocator>::Get().allocate(pageSize, alignof(max_align_t));
+        if (memory == nullptr)
+        {
+            OnOutOfMemory(pageSize, alignof(max_align_t));
+            return nullptr;
+        }
+        m_reservedBytes.fetch_add(pageSize, AZStd::memory_order_relaxed);
+        Page* page = new (memory) Page{ nullptr, pageSize - sizeof(Page) };
+        return page;
+    }
+
+    void FrameArenaAllocator::FreePage(Page* page)
+    {
+        const size_type pageSize = page->m_dataSize + sizeof(Page);
+        m_reservedBytes.fetch_sub(pageSize, AZStd::memory_order_relaxed);
+        AllocatorInstance<OSAllocator>::Get().deallocate(page, pageSize, alignof(max_align_t));
+    }
+
+    void FrameArenaAllocator::ResetRegion(Region& region)
+    {
+        // Keep the pages that were used in the frame being released, they're likely needed again by the next one
+        Page* unused = region.m_current ? region.m_current->m_next : region.m_pages;
+        if (region.m_current)
+        {
+            region.m_current->m_next = nullptr;
+        }
+        else
+        {
+            region.m_pages = nullptr;
+        }
+        while (unused)
+        {
+            Page* next = unused->m_next;
+            FreePage(unused);
+            unused = next;
+        }
+
+        region.m_current = nullptr;
+        region.m_cursor = nullptr;
+        region.m_end = nullptr;
+        region.m_lastAllocation = nullptr;
+        region.m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+    }
+
+    void FrameArenaAllocator::FreeRegionPages(Region& region)
+    {
+        Page* page = region.m_pages;
+        while (page)
+        {
+            Page* next = page->m_next;
+            FreePage(page);
+            page = next;
+        }
+        region.m_pages = nullptr;
+        region.m_current = nullptr;
+        region.m_cursor = nullptr;
+        region.m_end = nullptr;
+        region.m_lastAllocation = nullptr;
+        region.m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+    }
+} // namespace AZ
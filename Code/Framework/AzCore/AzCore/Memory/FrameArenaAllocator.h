@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/AllocatorInstance.h>
+#include <AzCore/std/allocator_stateless.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    //! How long an allocation from the FrameArenaAllocator stays valid.
+    enum class FrameArenaLifetime : uint8_t
+    {
+        //! Valid until the next call to FrameArenaAllocator::NextFrame.
+        SingleFrame,
+        //! Double buffered, valid until the second call to FrameArenaAllocator::NextFrame. Use this for data that is produced in
+        //! one frame and consumed in the next one.
+        TwoFrames
+    };
+
+    /**
+     * Frame arena allocator
+     * Linear allocator for transient data that is freed in bulk at frame boundaries. Every thread bumps a pointer in its own
+     * set of pages, so allocating never takes a lock and deallocate does nothing. All memory handed out for a lifetime is
+     * reclaimed at once by NextFrame, which ComponentApplication::Tick calls at the start of every tick.
+     *
+     * NextFrame only advances the frame index. Each thread resets its own regions on its first allocation in the new frame, so
+     * NextFrame can run while other threads allocate. Memory of a released frame must not be used anymore though, so only use
+     * the arena for data whose producers and consumers complete within the frame (or the next frame, for
+     * FrameArenaLifetime::TwoFrames).
+     *
+     * Pages are taken from the OSAllocator and retained across frames. After a reset each thread keeps as many pages as it
+     * used in the frame that was released, and frees the rest.
+     */
+    class AZCORE_API FrameArenaAllocator
+        : public AllocatorBase
+    {
+    public:
+        AZ_TYPE_INFO_WITH_NAME_DECL_API(AZCORE_API, FrameArenaAllocator);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        static constexpr size_type DefaultPageSize = 256 * 1024;
+
+        FrameArenaAllocator();
+        explicit FrameArenaAllocator(size_type pageSize);
+        ~FrameArenaAllocator() override;
+
+        //! Allocates memory that stays valid for the lifetime. Thread safe.
+        AllocateAddress Allocate(size_type byteSize, size_type alignment, FrameArenaLifetime lifetime);
+
+        //! Releases all the single frame allocations and the double buffered allocations made in the previous frame.
+        //! The memory of each thread is reclaimed by that thread the next time it allocates. Thread safe.
+        void NextFrame();
+
+        //! Number of times NextFrame has been called.
+        AZ::u64 GetFrameIndex() const;
+        //! Highest number of bytes in use by the arena when a frame was released.
+        size_type GetPeakAllocatedBytes() const;
+        //! Number of bytes that were in use when the last frame was released.
+        size_type GetLastFrameAllocatedBytes() const;
+        //! Number of bytes reserved from the OS for the arena pages.
+        size_type GetReservedBytes() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocatorDebugConfig GetDebugConfig() override;
+
+        //! Allocations through the IAllocator interface have FrameArenaLifetime::SingleFrame.
+        AllocateAddress allocate(size_type byteSize, size_type alignment) override;
+        //! Memory is only reclaimed by NextFrame, so this does nothing and returns 0.
+        size_type deallocate(pointer ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        //! Only the most recent allocation of the calling thread in the current frame can be reallocated. It's grown in place when
+        //! it fits in its page.
+        AllocateAddress reallocate(pointer ptr, size_type newSize, size_type newAlignment) override;
+        size_type get_allocated_size(pointer ptr, size_type alignment) const override;
+
+        size_type NumAllocatedBytes() const override;
+        //////////////////////////////////////////////////////////////////////////
+
+        AZ_DISABLE_COPY_MOVE(FrameArenaAllocator);
+
+    private:
+        struct Page;
+        struct Region;
+        struct ThreadArena;
+        struct ThreadArenaBinding;
+
+        static constexpr size_t RegionCount = 3;
+
+        ThreadArena& GetThreadArena();
+        ThreadArena* AcquireThreadArena();
+        void SyncThreadArena(ThreadArena& arena, AZ::u64 frameIndex);
+        static size_type GetLiveBytes(const ThreadArena& arena, AZ::u64 frameIndex);
+        Region& GetRegion(ThreadArena& arena, FrameArenaLifetime lifetime) const;
+        AllocateAddress AllocateFromRegion(Region& region, size_type byteSize, size_type alignment);
+        Page* AllocatePage(size_type minDataSize);
+        void FreePage(Page* page);
+        void ResetRegion(Region& region);
+        void FreeRegionPages(Region& region);
+
+        size_type m_pageSize;
+        AZStd::atomic<AZ::u64> m_frameIndex{ 0 };
+        AZStd::atomic<size_type> m_peakAllocatedBytes{ 0 };
+        AZStd::atomic<size_type> m_lastFrameAllocatedBytes{ 0 };
+        AZStd::atomic<size_type> m_reservedBytes{ 0 };
+
+        mutable AZStd::mutex m_arenasMutex;
+        AZStd::vector<ThreadArena*, AZStd::stateless_allocator> m_arenas;
+    };
+    AZ_TYPE_INFO_WITH_NAME_DECL_EXT_API(AZCORE_API, FrameArenaAllocator);
+
+    /**
+     * AZStd allocator that allocates from the FrameArenaAllocator singleton, for containers that only live for a frame
+     * (or two, see FrameArenaLifetime::TwoFrames). Deallocating does nothing, so containers that grow a lot leave their
+     * previous buffers in the arena until the frame is released; reserve up front where the size is known.
+     */
+    template<FrameArenaLifetime Lifetime = FrameArenaLifetime::SingleFrame>
+    class FrameArenaStdAllocator
+    {
+    public:
+        AZ_ALLOCATOR_DEFAULT_TRAITS
+
+        AZ_FORCE_INLINE pointer allocate(size_type byteSize, size_type alignment)
+        {
+            return GetArena().Allocate(byteSize, alignment, Lifetime);
+        }
+        AZ_FORCE_INLINE pointer reallocate(pointer ptr, size_type newSize, align_type newAlignment)
+        {
+            return GetArena().reallocate(ptr, newSize, newAlignment);
+        }
+        AZ_FORCE_INLINE void deallocate(pointer, size_type, size_type)
+        {
+        }
+        size_type max_size() const
+        {
+            return GetArena().max_size();
+        }
+        size_type get_allocated_size() const
+        {
+            return GetArena().NumAllocatedBytes();
+        }
+
+        AZ_FORCE_INLINE bool operator==(const FrameArenaStdAllocator&) const { return true; }
+        AZ_FORCE_INLINE bool operator!=(const FrameArenaStdAllocator&) const { return false; }
+
+    private:
+        static FrameArenaAllocator& GetArena()
+        {
+            return static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get());
+        }
+    };
+
+    using DoubleBufferedFrameArenaStdAllocator = FrameArenaStdAllocator<FrameArenaLifetime::TwoFrames>;
+} // namespace AZ
@@ -16,6 +16,8 @@
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/algorithm.h>
 
 #ifdef _DEBUG
 //#define DEBUG_PTR_IN_BUCKET_CHECK // enabled this when NOT sure if PTR in bucket marker check is successfully
@@ -337,6 +339,80 @@ namespace AZ
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+        // The thread cache keeps small blocks freed by a thread in per-bucket free lists owned by that thread, and serves the
+        // allocations of the thread from them without taking the bucket lock. Cached blocks are still allocated from the
+        // buckets' point of view. Caches are refilled from and drained to the buckets in batches, so the bucket lock is taken
+        // once per batch, and blocks freed on a different thread than the one that allocated them only cost a lock when
+        // the freeing thread's cache overflows.
+        struct thread_cache
+        {
+            free_link* mHead[NUM_BUCKETS] = {};
+            unsigned short mCount[NUM_BUCKETS] = {};
+            // Bytes of the blocks in the cache, and the part of them added to the allocator's mThreadCacheBytes
+            size_t mCachedBytes = 0;
+            size_t mPublishedBytes = 0;
+            // Cleared when the allocator is destroyed before the thread exits
+            AZStd::atomic<HpAllocator*> mOwner{ nullptr };
+            unsigned mDrainEpoch = 0;
+        };
+
+        // Per-thread list of the caches of the allocators used by the thread. Returns the cached blocks when the thread exits.
+        static constexpr size_t MAX_THREAD_CACHE_BINDINGS = 4;
+        struct thread_cache_bindings
+        {
+            ~thread_cache_bindings();
+
+            HpAllocator* mAllocators[MAX_THREAD_CACHE_BINDINGS] = {};
+            thread_cache* mCaches[MAX_THREAD_CACHE_BINDINGS] = {};
+            bool mDestroyed = false;
+        };
+
+        // Guards the cache lists of all allocators, and the ownership of caches between exiting threads and destroyed allocators
+        static AZStd::mutex& thread_cache_mutex();
+
+        // returns the cache of the calling thread, nullptr if the thread cache is disabled or not available
+        inline thread_cache* get_thread_cache()
+        {
+            if constexpr (DebugAllocatorEnable)
+            {
+                return nullptr;
+            }
+            else
+            {
+                if (!mThreadCacheEnabled.load(AZStd::memory_order_relaxed))
+                {
+                    return nullptr;
+                }
+                static thread_local thread_cache_bindings t_bindings;
+                for (size_t i = 0; i < MAX_THREAD_CACHE_BINDINGS; ++i)
+                {
+                    if (t_bindings.mAllocators[i] == this)
+                    {
+                        thread_cache* cache = t_bindings.mCaches[i];
+                        if (cache->mOwner.load(AZStd::memory_order_relaxed) != this)
+                        {
+                            // an earlier allocator at the same address was destroyed
+                            break;
+                        }
+                        if (cache->mDrainEpoch != mThreadCacheDrainEpoch.load(AZStd::memory_order_relaxed))
+                        {
+                            thread_cache_drain_all(*cache);
+                        }
+                        return cache;
+                    }
+                }
+                return create_thread_cache(t_bindings);
+            }
+        }
+
+        thread_cache* create_thread_cache(thread_cache_bindings& bindings);
+        AllocateAddress thread_cache_alloc(thread_cache& cache, unsigned bi);
+        size_type thread_cache_free(thread_cache& cache, void* ptr, unsigned bi);
+        bool thread_cache_refill(thread_cache& cache, unsigned bi);
+        void thread_cache_drain(thread_cache& cache, unsigned bi, unsigned count);
+        void thread_cache_drain_all(thread_cache& cache);
+        void thread_cache_publish(thread_cache& cache);
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -590,8 +666,17 @@ namespace AZ
         // threads through that lock
         size_t mTotalAllocatedSizeTree = 0;
         size_t mTotalCapacitySizeTree = 0;
+
+        AZStd::atomic<bool> mThreadCacheEnabled{ false };
+        unsigned short mThreadCacheCapacity[NUM_BUCKETS] = {};
+        // Incremented to request all threads to drain their cache on their next allocation or free
+        AZStd::atomic<unsigned> mThreadCacheDrainEpoch{ 0 };
+        // Caches of all threads using this allocator, guarded by thread_cache_mutex
+        AZStd::vector<thread_cache*, AZStd::stateless_allocator> mThreadCaches;
+        // Bytes held by the thread caches, as published by each cache when it is refilled or drained
+        AZStd::atomic<size_t> mThreadCacheBytes{ 0 };
     public:
-        HpAllocator();
+        explicit HpAllocator(const Descriptor& desc);
         ~HpAllocator() override;
 
         AllocateAddress allocate(size_type byteSize, align_type alignment = 1) override;
@@ -943,7 +1028,41 @@ namespace AZ
         // return the total number of allocated memory
         inline size_t allocated() const
         {
-            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+            // cached blocks are free from the user's point of view. Caches only publish their size when they are refilled or
+            // drained, so blocks moved between a cache and the user since then are off by at most the capacity of the cache.
+            // The counters are read without stopping the threads, so the cached bytes can briefly be ahead of the bucket bytes.
+            const size_t cachedBytes = mThreadCacheBytes.load(AZStd::memory_order_relaxed);
+            const size_t bucketBytes = mTotalAllocatedSizeBuckets;
+            return (bucketBytes > cachedBytes ? bucketBytes - cachedBytes : 0) + mTotalAllocatedSizeTree;
+        }
+
+        // request all threads to return their cached blocks to the buckets, and return the calling thread's cache right away
+        void request_thread_cache_drain()
+        {
+            ++mThreadCacheDrainEpoch;
+            if (thread_cache* cache = get_thread_cache(); cache)
+            {
+                thread_cache_drain_all(*cache);
+            }
+        }
+
+        // turn the thread caches on or off. Turning them off returns the calling thread's cache right away, the caches of
+        // other threads are returned when they exit, when the caches are turned back on, or when the allocator is destroyed
+        void set_thread_cache_enabled(bool enabled)
+        {
+            if constexpr (!DebugAllocatorEnable)
+            {
+                if (!enabled)
+                {
+                    request_thread_cache_drain();
+                }
+                mThreadCacheEnabled.store(enabled, AZStd::memory_order_relaxed);
+            }
+        }
+
+        bool is_thread_cache_enabled() const
+        {
+            return mThreadCacheEnabled.load(AZStd::memory_order_relaxed);
         }
 
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
@@ -1010,7 +1129,7 @@ namespace AZ
 
     //////////////////////////////////////////////////////////////////////////
     template<bool DebugAllocatorEnable>
-    HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::HpAllocator()
+    HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::HpAllocator(const Descriptor& desc)
         // We will use the os for direct allocations if memoryBlock == NULL
         // If m_systemChunkSize is specified, use that size for allocating tree blocks from the OS
         // m_treePageAlignment should be OS_VIRTUAL_PAGE_SIZE in all cases with this trait as we work
@@ -1027,6 +1146,17 @@ namespace AZ
         mTotalAllocatedSizeBuckets = 0;
         mTotalAllocatedSizeTree = 0;
 
+        if constexpr (!DebugAllocatorEnable)
+        {
+            mThreadCacheEnabled.store(desc.m_threadCacheEnabled, AZStd::memory_order_relaxed);
+            for (unsigned i = 0; i < NUM_BUCKETS; i++)
+            {
+                // always cache at least two blocks so that a refill or drain moves more than one block
+                const size_t capacity = desc.m_threadCacheBucketBytes / bucket_spacing_function_inverse(i);
+                mThreadCacheCapacity[i] = (unsigned short)AZStd::clamp<size_t>(capacity, 2, AZStd::numeric_limits<unsigned short>::max());
+            }
+        }
+
 #if AZ_TRAIT_OS_HAS_CRITICAL_SECTION_SPIN_COUNT
 #if defined(MULTITHREADED)
         // For some platforms we can use an actual spin lock, test and profile. We don't expect much contention there
@@ -1054,6 +1184,17 @@ namespace AZ
             check();
         }
 
+        {
+            // Return the blocks cached by the threads that still use this allocator. The caches themselves belong to the threads.
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+            for (thread_cache* cache : mThreadCaches)
+            {
+                thread_cache_drain_all(*cache);
+                cache->mOwner.store(nullptr, AZStd::memory_order_relaxed);
+            }
+            mThreadCaches.clear();
+        }
+
         purge();
 
         if constexpr (DebugAllocatorEnable)
@@ -1204,6 +1345,10 @@ namespace AZ
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = get_thread_cache(); cache)
+        {
+            return thread_cache_alloc(*cache, bi);
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1233,6 +1378,10 @@ namespace AZ
     AllocateAddress HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = get_thread_cache(); cache)
+        {
+            return thread_cache_alloc(*cache, bi);
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1255,6 +1404,223 @@ namespace AZ
         return AllocateAddress(mBuckets[bi].alloc(p), p->elem_size());
     }
 
+    template<bool DebugAllocatorEnable>
+    AZStd::mutex& HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_mutex()
+    {
+        // Never destroyed, threads can exit after the static destructors ran
+        alignas(AZStd::mutex) static unsigned char s_mutexStorage[sizeof(AZStd::mutex)];
+        static AZStd::mutex* s_mutex = new (s_mutexStorage) AZStd::mutex();
+        return *s_mutex;
+    }
+
+    template<bool DebugAllocatorEnable>
+    HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_bindings::~thread_cache_bindings()
+    {
+        // Allocations done by thread_local destructors that run after this one use the buckets directly
+        mDestroyed = true;
+        for (size_t i = 0; i < MAX_THREAD_CACHE_BINDINGS; ++i)
+        {
+            thread_cache* cache = mCaches[i];
+            if (!cache)
+            {
+                continue;
+            }
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+                if (HpAllocator* owner = cache->mOwner.load(AZStd::memory_order_relaxed); owner)
+                {
+                    owner->thread_cache_drain_all(*cache);
+                    auto it = AZStd::find(owner->mThreadCaches.begin(), owner->mThreadCaches.end(), cache);
+                    HPPA_ASSERT(it != owner->mThreadCaches.end());
+                    *it = owner->mThreadCaches.back();
+                    owner->mThreadCaches.pop_back();
+                }
+            }
+            cache->~thread_cache();
+            AZStd::stateless_allocator().deallocate(cache, sizeof(thread_cache), alignof(thread_cache));
+            mAllocators[i] = nullptr;
+            mCaches[i] = nullptr;
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::create_thread_cache(thread_cache_bindings& bindings) -> thread_cache*
+    {
+        if (bindings.mDestroyed)
+        {
+            return nullptr;
+        }
+
+        // Reuse a binding of this allocator or of a destroyed allocator, otherwise take an empty one
+        size_t slot = MAX_THREAD_CACHE_BINDINGS;
+        for (size_t i = 0; i < MAX_THREAD_CACHE_BINDINGS; ++i)
+        {
+            if (bindings.mAllocators[i] == this || (bindings.mCaches[i] && !bindings.mCaches[i]->mOwner.load(AZStd::memory_order_relaxed)))
+            {
+                slot = i;
+                break;
+            }
+            if (slot == MAX_THREAD_CACHE_BINDINGS && !bindings.mAllocators[i])
+            {
+                slot = i;
+            }
+        }
+        if (slot == MAX_THREAD_CACHE_BINDINGS)
+        {
+            // The thread uses too many allocators, the remaining ones go through the buckets directly
+            return nullptr;
+        }
+
+        thread_cache* cache = bindings.mCaches[slot];
+        if (cache)
+        {
+            // The owner of the cache was destroyed, nothing refers to it anymore
+            cache->~thread_cache();
+        }
+        else
+        {
+            cache = static_cast<thread_cache*>(AZStd::stateless_allocator().allocate(sizeof(thread_cache), alignof(thread_cache)));
+            if (!cache)
+            {
+                return nullptr;
+            }
+        }
+        new (cache) thread_cache();
+        cache->mOwner.store(this, AZStd::memory_order_relaxed);
+        cache->mDrainEpoch = mThreadCacheDrainEpoch.load(AZStd::memory_order_relaxed);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+            mThreadCaches.push_back(cache);
+        }
+        bindings.mAllocators[slot] = this;
+        bindings.mCaches[slot] = cache;
+        return cache;
+    }
+
+    template<bool DebugAllocatorEnable>
+    AllocateAddress HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_alloc(thread_cache& cache, unsigned bi)
+    {
+        free_link* head = cache.mHead[bi];
+        if (!head)
+        {
+            if (!thread_cache_refill(cache, bi))
+            {
+                return AllocateAddress{};
+            }
+            head = cache.mHead[bi];
+        }
+        cache.mHead[bi] = head->mNext;
+        --cache.mCount[bi];
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        cache.mCachedBytes -= elemSize;
+        return AllocateAddress{ head, elemSize };
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_free(thread_cache& cache, void* ptr, unsigned bi) -> size_type
+    {
+        if (cache.mCount[bi] >= mThreadCacheCapacity[bi])
+        {
+            thread_cache_drain(cache, bi, cache.mCount[bi] / 2);
+        }
+        free_link* link = static_cast<free_link*>(ptr);
+        link->mNext = cache.mHead[bi];
+        cache.mHead[bi] = link;
+        ++cache.mCount[bi];
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        cache.mCachedBytes += elemSize;
+        return elemSize;
+    }
+
+    template<bool DebugAllocatorEnable>
+    bool HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_refill(thread_cache& cache, unsigned bi)
+    {
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        const unsigned count = mThreadCacheCapacity[bi] / 2;
+        unsigned filled = 0;
+        {
+#ifdef MULTITHREADED
+#if defined(USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+#endif
+            for (; filled < count; ++filled)
+            {
+                page* p = mBuckets[bi].get_free_page();
+                if (!p)
+                {
+                    p = bucket_grow(elemSize, mBuckets[bi].marker());
+                    if (!p)
+                    {
+                        break;
+                    }
+                    mBuckets[bi].add_free_page(p);
+                }
+                free_link* link = static_cast<free_link*>(mBuckets[bi].alloc(p));
+                link->mNext = cache.mHead[bi];
+                cache.mHead[bi] = link;
+            }
+        }
+        mTotalAllocatedSizeBuckets += elemSize * filled;
+        cache.mCount[bi] = (unsigned short)(cache.mCount[bi] + filled);
+        cache.mCachedBytes += elemSize * filled;
+        thread_cache_publish(cache);
+        return filled != 0;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_drain(thread_cache& cache, unsigned bi, unsigned count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        {
+#ifdef MULTITHREADED
+#if defined(USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+#endif
+            free_link* link = cache.mHead[bi];
+            for (unsigned i = 0; i < count; ++i)
+            {
+                free_link* next = link->mNext;
+                mBuckets[bi].free(ptr_get_page(link), link);
+                link = next;
+            }
+            cache.mHead[bi] = link;
+        }
+        mTotalAllocatedSizeBuckets -= elemSize * count;
+        cache.mCount[bi] = (unsigned short)(cache.mCount[bi] - count);
+        cache.mCachedBytes -= elemSize * count;
+        thread_cache_publish(cache);
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_drain_all(thread_cache& cache)
+    {
+        cache.mDrainEpoch = mThreadCacheDrainEpoch.load(AZStd::memory_order_relaxed);
+        for (unsigned i = 0; i < NUM_BUCKETS; i++)
+        {
+            thread_cache_drain(cache, i, cache.mCount[i]);
+        }
+        // Blocks taken from the cache since it was last published leave nothing to drain, but still need to be accounted for
+        thread_cache_publish(cache);
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_publish(thread_cache& cache)
+    {
+        // The published bytes of every cache are part of the total, so the wrapping difference never takes it below zero
+        mThreadCacheBytes.fetch_add(cache.mCachedBytes - cache.mPublishedBytes, AZStd::memory_order_relaxed);
+        cache.mPublishedBytes = cache.mCachedBytes;
+    }
+
     template<bool DebugAllocatorEnable>
     AllocateAddress HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_realloc(void* ptr, size_t size)
     {
@@ -1303,6 +1669,10 @@ namespace AZ
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = get_thread_cache(); cache)
+        {
+            return thread_cache_free(*cache, ptr, bi);
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1325,6 +1695,10 @@ namespace AZ
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+        if (thread_cache* cache = get_thread_cache(); cache)
+        {
+            return thread_cache_free(*cache, ptr, bi);
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -2529,9 +2903,15 @@ namespace AZ
     //=========================================================================
     template<bool DebugAllocator>
     HphaSchemaBase<DebugAllocator>::HphaSchemaBase()
+        : HphaSchemaBase(Descriptor{})
+    {
+    }
+
+    template<bool DebugAllocator>
+    HphaSchemaBase<DebugAllocator>::HphaSchemaBase(const Descriptor& desc)
     {
         static_assert(sizeof(HpAllocator) <= sizeof(m_hpAllocatorBuffer), "Increase the m_hpAllocatorBuffer, it needs to be at least the sizeof(HpAllocator)");
-        m_allocator = new (&m_hpAllocatorBuffer) HpAllocator();
+        m_allocator = new (&m_hpAllocatorBuffer) HpAllocator(desc);
     }
 
     //=========================================================================
@@ -2601,9 +2981,28 @@ namespace AZ
     template<bool DebugAllocator>
     void HphaSchemaBase<DebugAllocator>::GarbageCollect()
     {
+        m_allocator->request_thread_cache_drain();
         m_allocator->purge();
     }
 
+    //=========================================================================
+    // SetThreadCacheEnabled
+    //=========================================================================
+    template<bool DebugAllocator>
+    void HphaSchemaBase<DebugAllocator>::SetThreadCacheEnabled(bool enabled)
+    {
+        m_allocator->set_thread_cache_enabled(enabled);
+    }
+
+    //=========================================================================
+    // IsThreadCacheEnabled
+    //=========================================================================
+    template<bool DebugAllocator>
+    bool HphaSchemaBase<DebugAllocator>::IsThreadCacheEnabled() const
+    {
+        return m_allocator->is_thread_cache_enabled();
+    }
+
     template<bool DebugAllocator>
     size_t HphaSchemaBase<DebugAllocator>::GetMemoryGuardSize()
     {
@@ -28,7 +28,22 @@ namespace AZ
         * provide arena (memory block) with pre-allocated memory.
         */
 
+        struct Descriptor
+        {
+            /// Keep small blocks freed by a thread in a per-thread cache, and serve small allocations of that thread from it
+            /// without taking the bucket lock. The cache is refilled from and drained to the shared buckets in batches.
+            /// Opt-in, since blocks held in the caches of other threads are not available to this one.
+            /// While enabled, NumAllocatedBytes counts cached blocks as free and only sees a cache change size when it is
+            /// refilled or drained, so it can be off by up to m_threadCacheBucketBytes per bucket and thread.
+            /// The debug schema ignores this, since it must see every allocation.
+            bool m_threadCacheEnabled = false;
+            /// Maximum number of bytes a thread keeps cached per bucket. When a bucket cache is full, half of it is
+            /// returned to the shared bucket.
+            size_t m_threadCacheBucketBytes = 4 * 1024;
+        };
+
         HphaSchemaBase();
+        explicit HphaSchemaBase(const Descriptor& desc);
         virtual ~HphaSchemaBase();
 
         AllocateAddress allocate(size_type byteSize, size_type alignment) override;
@@ -36,11 +51,19 @@ namespace AZ
         AllocateAddress reallocate(pointer ptr, size_type newSize, size_type newAlignment) override;
         size_type get_allocated_size(pointer ptr, align_type alignment = 1) const override;
 
+        /// Bytes allocated by the user. With the thread cache enabled this undercounts the bytes taken from the buckets,
+        /// see Descriptor::m_threadCacheEnabled.
         size_type       NumAllocatedBytes() const override;
 
         /// Return unused memory to the OS. Don't call this unless you really need free memory, it is slow.
+        /// This also requests every thread to return its cached blocks the next time it uses the allocator.
         void            GarbageCollect() override;
 
+        /// Turn the thread cache described by Descriptor::m_threadCacheEnabled on or off after construction.
+        /// Turning it off returns the calling thread's cached blocks right away; other threads return theirs when they exit.
+        void SetThreadCacheEnabled(bool enabled);
+        bool IsThreadCacheEnabled() const;
+
         static size_t GetMemoryGuardSize();
         static size_t GetFreeLinkSize();
 
@@ -113,6 +113,22 @@ namespace AZ
  #endif
     }
 
+    void SystemAllocator::SetThreadCacheEnabled([[maybe_unused]] bool enabled)
+    {
+#if (AZCORE_SYSTEM_ALLOCATOR != AZCORE_SYSTEM_ALLOCATOR_MALLOC)
+        static_cast<HphaSchema*>(m_subAllocator.get())->SetThreadCacheEnabled(enabled);
+#endif
+    }
+
+    bool SystemAllocator::IsThreadCacheEnabled() const
+    {
+#if (AZCORE_SYSTEM_ALLOCATOR == AZCORE_SYSTEM_ALLOCATOR_MALLOC)
+        return false;
+#else
+        return static_cast<const HphaSchema*>(m_subAllocator.get())->IsThreadCacheEnabled();
+#endif
+    }
+
 
     //=========================================================================
     // Allocate
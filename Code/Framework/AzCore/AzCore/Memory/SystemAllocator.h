@@ -10,6 +10,7 @@
 #include <AzCore/Memory/AllocatorBase.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
 
 namespace AZ
 {
@@ -53,6 +54,14 @@ namespace AZ
 
         //////////////////////////////////////////////////////////////////////////
 
+        //! Settings registry key of a bool that turns on the per-thread cache of small blocks, see HphaSchema::Descriptor.
+        //! The ComponentApplication applies it once its settings registry is merged.
+        static constexpr AZStd::string_view ThreadCacheEnabledKey = "/O3DE/Memory/SystemAllocator/ThreadCacheEnabled";
+
+        //! Turns the per-thread cache of small blocks on or off. Has no effect when the system allocator uses malloc.
+        void SetThreadCacheEnabled(bool enabled);
+        bool IsThreadCacheEnabled() const;
+
     protected:
         SystemAllocator(const SystemAllocator&);
         SystemAllocator& operator=(const SystemAllocator&);
@@ -7,11 +7,13 @@
  */
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Name/Internal/NameData.h>
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
 #include <cstring>
@@ -25,8 +27,167 @@ namespace AZ
         // Pointer which indicated that the NameDictonary associated with the AZ::Interface
         // was created by the Create function below
         static AZ::EnvironmentVariable<AZStd::unique_ptr<AZ::NameDictionary>> s_staticNameDictionary;
+
+        // Marks a lookup table slot whose entry was removed. Probing continues past it.
+        static Internal::NameData* const s_tombstone = reinterpret_cast<Internal::NameData*>(uintptr_t{ 1 });
+
+        static constexpr size_t MinLookupTableCapacity = 64;
+
+        // Number of released names kept until the readers are synchronized and their name data is deleted
+        static constexpr size_t ReleasedNameDataBatchSize = 64;
+
+        static size_t GetReaderSlotIndex(size_t slotCount)
+        {
+            static AZStd::atomic<uint32_t> s_nextSlot{ 0 };
+            static thread_local const size_t s_slot = s_nextSlot.fetch_add(1, AZStd::memory_order_relaxed);
+            return s_slot % slotCount;
+        }
     }
 
+    //! Open addressed table with linear probing, mapping hashes to name data. Readers probe it without locking, writers
+    //! replace slots with atomic stores while holding the dictionary mutex. The table is never resized in place: when it
+    //! fills up a new one is built and published, and the old one is freed after the readers have been synchronized.
+    struct NameDictionary::LookupTable
+    {
+        static LookupTable* Create(size_t capacity)
+        {
+            const size_t byteSize = sizeof(LookupTable) + capacity * sizeof(AZStd::atomic<Internal::NameData*>);
+            void* memory = AZ::AllocatorInstance<AZ::OSAllocator>::Get().allocate(byteSize, alignof(LookupTable));
+            LookupTable* table = new (memory) LookupTable();
+            table->m_capacity = capacity;
+            table->m_shift = 64 - static_cast<uint32_t>(az_ctz_u64(capacity));
+            for (size_t i = 0; i < capacity; ++i)
+            {
+                new (&table->GetSlots()[i]) AZStd::atomic<Internal::NameData*>(nullptr);
+            }
+            return table;
+        }
+
+        static void Destroy(LookupTable* table)
+        {
+            const size_t byteSize = sizeof(LookupTable) + table->m_capacity * sizeof(AZStd::atomic<Internal::NameData*>);
+            table->~LookupTable();
+            AZ::AllocatorInstance<AZ::OSAllocator>::Get().deallocate(table, byteSize, alignof(LookupTable));
+        }
+
+        AZStd::atomic<Internal::NameData*>* GetSlots()
+        {
+            return reinterpret_cast<AZStd::atomic<Internal::NameData*>*>(this + 1);
+        }
+
+        size_t GetHomeSlot(Name::Hash hash) const
+        {
+            // Fibonacci hashing, since hashes are sequential when the dictionary is limited to a few hash slots
+            return static_cast<size_t>((static_cast<AZ::u64>(hash) * 0x9E3779B97F4A7C15ull) >> m_shift);
+        }
+
+        Internal::NameData* Find(Name::Hash hash)
+        {
+            AZStd::atomic<Internal::NameData*>* slots = GetSlots();
+            const size_t mask = m_capacity - 1;
+            for (size_t index = GetHomeSlot(hash);; index = (index + 1) & mask)
+            {
+                Internal::NameData* nameData = slots[index].load(AZStd::memory_order_acquire);
+                if (nameData == nullptr)
+                {
+                    return nullptr;
+                }
+                if (nameData != NameDictionaryInternal::s_tombstone && nameData->GetHash() == hash)
+                {
+                    return nameData;
+                }
+            }
+        }
+
+        //! Returns false if the table is too full to take another entry.
+        bool Insert(Internal::NameData* nameData)
+        {
+            AZStd::atomic<Internal::NameData*>* slots = GetSlots();
+            const size_t mask = m_capacity - 1;
+            for (size_t index = GetHomeSlot(nameData->GetHash());; index = (index + 1) & mask)
+            {
+                Internal::NameData* current = slots[index].load(AZStd::memory_order_relaxed);
+                if (current == NameDictionaryInternal::s_tombstone)
+                {
+                    // The hash isn't in the table, the dictionary checked that, so the tombstone can be reused
+                    slots[index].store(nameData, AZStd::memory_order_release);
+                    ++m_liveCount;
+                    return true;
+                }
+                if (current == nullptr)
+                {
+                    // Keep at least half of the slots empty so that probing stays short and always terminates
+                    if ((m_usedCount + 1) * 2 > m_capacity)
+                    {
+                        return false;
+                    }
+                    slots[index].store(nameData, AZStd::memory_order_release);
+                    ++m_liveCount;
+                    ++m_usedCount;
+                    return true;
+                }
+            }
+        }
+
+        void Remove(Name::Hash hash)
+        {
+            AZStd::atomic<Internal::NameData*>* slots = GetSlots();
+            const size_t mask = m_capacity - 1;
+            for (size_t index = GetHomeSlot(hash);; index = (index + 1) & mask)
+            {
+                Internal::NameData* nameData = slots[index].load(AZStd::memory_order_relaxed);
+                if (nameData == nullptr)
+                {
+                    return;
+                }
+                if (nameData != NameDictionaryInternal::s_tombstone && nameData->GetHash() == hash)
+                {
+                    slots[index].store(NameDictionaryInternal::s_tombstone, AZStd::memory_order_release);
+                    --m_liveCount;
+                    return;
+                }
+            }
+        }
+
+        size_t m_capacity = 0;
+        uint32_t m_shift = 0;
+        //! Number of slots holding an entry. Only accessed by writers.
+        size_t m_liveCount = 0;
+        //! Number of slots holding an entry or a tombstone. Only accessed by writers.
+        size_t m_usedCount = 0;
+    };
+
+    class NameDictionary::ReaderScope
+    {
+    public:
+        explicit ReaderScope(const NameDictionary& dictionary)
+        {
+            ReaderSlot& slot = dictionary.m_readerSlots[NameDictionaryInternal::GetReaderSlotIndex(ReaderSlotCount)];
+            while (true)
+            {
+                const uint32_t epoch = dictionary.m_readerEpoch.load(AZStd::memory_order_seq_cst);
+                m_counter = &slot.m_activeReaders[epoch & 1];
+                m_counter->fetch_add(1, AZStd::memory_order_seq_cst);
+                // If the epoch flipped in between, the writer may not have seen this reader. Register again in the new epoch.
+                if (dictionary.m_readerEpoch.load(AZStd::memory_order_seq_cst) == epoch)
+                {
+                    break;
+                }
+                m_counter->fetch_sub(1, AZStd::memory_order_release);
+            }
+        }
+
+        ~ReaderScope()
+        {
+            m_counter->fetch_sub(1, AZStd::memory_order_release);
+        }
+
+        AZ_DISABLE_COPY_MOVE(ReaderScope);
+
+    private:
+        AZStd::atomic<uint32_t>* m_counter = nullptr;
+    };
+
     void NameDictionary::Create()
     {
         using namespace NameDictionaryInternal;
@@ -92,8 +253,9 @@ namespace AZ
         // This prevents our list head from being destroyed from a module that has shut down its AZ::Environment and
         // invalidating our list.
         m_deferredHead.m_linkedToDictionary = true;
+        m_lookupTable.store(LookupTable::Create(NameDictionaryInternal::MinLookupTableCapacity), AZStd::memory_order_release);
     }
-    
+
     NameDictionary::~NameDictionary()
     {
         // Unload deferred names
@@ -113,6 +275,7 @@ namespace AZ
 
             if (useCount == 0)
             {
+                RemoveFromLookupTable(i->first);
                 i = m_dictionary.erase(i);
                 delete nameData;
             }
@@ -125,25 +288,106 @@ namespace AZ
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
+
+        DeleteReleasedNameData();
+        LookupTable::Destroy(m_lookupTable.exchange(nullptr, AZStd::memory_order_acq_rel));
     }
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        ReaderScope readerScope(*this);
+        if (Internal::NameData* nameData = FindNameDataLockFree(hash); nameData != nullptr && TryAcquireNameData(nameData))
+        {
+            Name name(nameData);
+            // Name took its own reference
+            nameData->m_useCount.fetch_sub(1, AZStd::memory_order_relaxed);
+            return name;
+        }
+        return Name();
+    }
 
-        // The NameData m_useCount check is to avoid a multithread race condition
+    bool NameDictionary::TryAcquireNameData(Internal::NameData* nameData)
+    {
+        // Only take a reference while the use count is positive. This avoids a multithread race condition
         // where thread B is in NameData::release and reduces the m_useCount to 0
         // and this thread(thread A) construct a Name using that NameData pointer
         // causing the m_useCount to go back up to 1.
         // If thread A continues along and releases the NameData again, before thread B can run
         // the the m_useCount can be reduced to 0 and multiple threads can be in the
-        // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block
-        if (auto iter = m_dictionary.find(hash);
-            iter != m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
+        // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block.
+        // It also keeps the count from being raised after TryReleaseName claimed the entry by setting it to -1.
+        int32_t useCount = nameData->m_useCount.load(AZStd::memory_order_relaxed);
+        while (useCount > 0)
         {
-            return Name(iter->second.m_nameData);
+            if (nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1, AZStd::memory_order_acquire, AZStd::memory_order_relaxed))
+            {
+                return true;
+            }
         }
-        return Name();
+        return false;
+    }
+
+    Internal::NameData* NameDictionary::FindNameDataLockFree(Name::Hash hash) const
+    {
+        return m_lookupTable.load(AZStd::memory_order_acquire)->Find(hash);
+    }
+
+    void NameDictionary::AddToLookupTable(Internal::NameData* nameData)
+    {
+        LookupTable* table = m_lookupTable.load(AZStd::memory_order_relaxed);
+        if (table->Insert(nameData))
+        {
+            return;
+        }
+
+        // Build a table with room to grow from the live entries, which also drops the tombstones
+        size_t capacity = NameDictionaryInternal::MinLookupTableCapacity;
+        while (capacity < (table->m_liveCount + 1) * 4)
+        {
+            capacity *= 2;
+        }
+        LookupTable* newTable = LookupTable::Create(capacity);
+        for (auto& [hash, wrapper] : m_dictionary)
+        {
+            if (wrapper.m_nameData != nameData)
+            {
+                newTable->Insert(wrapper.m_nameData);
+            }
+        }
+        newTable->Insert(nameData);
+        m_lookupTable.store(newTable, AZStd::memory_order_release);
+
+        SynchronizeReaders();
+        LookupTable::Destroy(table);
+        // Name data released before the readers were synchronized can't be reached anymore either
+        DeleteReleasedNameData();
+    }
+
+    void NameDictionary::RemoveFromLookupTable(Name::Hash hash)
+    {
+        m_lookupTable.load(AZStd::memory_order_relaxed)->Remove(hash);
+    }
+
+    void NameDictionary::SynchronizeReaders()
+    {
+        const uint32_t previousEpoch = m_readerEpoch.fetch_add(1, AZStd::memory_order_seq_cst);
+        for (ReaderSlot& slot : m_readerSlots)
+        {
+            // Lookups are a handful of loads, so this only ever spins briefly
+            while (slot.m_activeReaders[previousEpoch & 1].load(AZStd::memory_order_acquire) != 0)
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+    }
+
+    void NameDictionary::DeleteReleasedNameData()
+    {
+        for (Internal::NameData* nameData : m_releasedNameData)
+        {
+            delete nameData;
+        }
+        m_releasedNameData.clear();
     }
 
     void NameDictionary::LoadLiteral(Name& nameLiteral)
@@ -226,13 +470,34 @@ namespace AZ
 
         Name::Hash hash = CalcHash(nameString);
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+        // If we find the same name, just return it. This path is faster than the loop below because the
+        // lookup doesn't lock, whereas the loop requires a unique_lock to modify the dictionary.
         {
-            return AZStd::move(name);
+            ReaderScope readerScope(*this);
+            for (Name::Hash probeHash = hash;; ++probeHash)
+            {
+                Internal::NameData* nameData = FindNameDataLockFree(probeHash);
+                if (nameData == nullptr)
+                {
+                    break;
+                }
+                if (nameData->GetName() == nameString)
+                {
+                    if (TryAcquireNameData(nameData))
+                    {
+                        Name name(nameData);
+                        nameData->m_useCount.fetch_sub(1, AZStd::memory_order_relaxed);
+                        return name;
+                    }
+                    break;
+                }
+                // Colliding names are stored at the following hashes, see the loop below. The flag is only set with the
+                // mutex locked, so a collision that isn't seen yet is handled by the locked path below.
+                if (!nameData->m_hashCollision.load(AZStd::memory_order_acquire))
+                {
+                    break;
+                }
+            }
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
@@ -246,10 +511,12 @@ namespace AZ
             if (iter == m_dictionary.end())
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
-                nameData->m_hashCollision = collisionDetected;
+                nameData->m_hashCollision.store(collisionDetected, AZStd::memory_order_release);
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
                 m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
-                return Name(nameData);
+                Name name(nameData);
+                AddToLookupTable(nameData);
+                return name;
             }
             // Found the desired entry, return it
             else if (iter->second.m_nameData->GetName() == nameString)
@@ -260,7 +527,8 @@ namespace AZ
             else
             {
                 collisionDetected = true;
-                iter->second.m_nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
+                // Make sure the existing entry is flagged as colliding too
+                iter->second.m_nameData->m_hashCollision.store(true, AZStd::memory_order_release);
                 ++hash;
                 iter = m_dictionary.find(hash);
             }
@@ -299,7 +567,7 @@ namespace AZ
 
         // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
         // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
+        if (nameData->m_hashCollision.load(AZStd::memory_order_relaxed))
         {
             return;
         }
@@ -311,8 +579,16 @@ namespace AZ
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
+            RemoveFromLookupTable(nameData->GetHash());
             m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // Lock-free lookups may still be reading the name data, so it's deleted once enough names were released
+            // to make waiting for the readers worthwhile
+            m_releasedNameData.push_back(nameData);
+            if (m_releasedNameData.size() >= NameDictionaryInternal::ReleasedNameDataBatchSize)
+            {
+                SynchronizeReaders();
+                DeleteReleasedNameData();
+            }
         }
 
         ReportStats();
@@ -9,8 +9,10 @@
 #pragma once
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -43,6 +45,10 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! Looking up existing names doesn't take a lock. Lookups go through an open addressed table of atomic
+    //! slots that mirrors the dictionary, and entries removed from it are only deleted once every lookup that
+    //! could still see them has finished. Adding and releasing names is serialized by a mutex.
     class AZCORE_API NameDictionary final
     {
     public:
@@ -112,6 +118,24 @@ namespace AZ
         //! Unloads the data with all deferred names registered using LoadDeferredName.
         void UnloadDeferredNames();
 
+        //! Takes a reference to name data found by a lock-free lookup, unless it's being released.
+        static bool TryAcquireNameData(Internal::NameData* nameData);
+        //! Finds name data by hash without locking. Must be called inside a ReaderScope.
+        Internal::NameData* FindNameDataLockFree(Name::Hash hash) const;
+
+        //! The following functions must be called with m_sharedMutex locked for writing.
+        void AddToLookupTable(Internal::NameData* nameData);
+        void RemoveFromLookupTable(Name::Hash hash);
+        //! Waits until all the lock-free lookups that started before the call have finished, after which memory that
+        //! was unlinked from the lookup table can be freed.
+        void SynchronizeReaders();
+        //! Deletes the name data released since the readers were last synchronized.
+        void DeleteReleasedNameData();
+
+        //! Marks the calling thread as doing a lock-free lookup for its lifetime.
+        class ReaderScope;
+        struct LookupTable;
+
         //! Wrapper structure around a NameData pointer
         //! Which sets the Internal::NameData::m_nameDictionary pointer to this name dictionary
         //! instance on construction and to nullptr on destruction
@@ -130,6 +154,25 @@ namespace AZ
         AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
         mutable AZStd::shared_mutex m_sharedMutex;
 
+        //! Lock-free index of m_dictionary used by FindName and MakeName. Only modified with m_sharedMutex locked.
+        AZStd::atomic<LookupTable*> m_lookupTable{ nullptr };
+
+        //! Readers register in one of two counters per slot, selected by the current reader epoch. SynchronizeReaders
+        //! flips the epoch and waits for the counters of the previous epoch to drain. The counters are spread over
+        //! padded slots so threads doing lookups at the same time rarely write to the same cache line.
+        struct ReaderSlot
+        {
+            AZStd::atomic<uint32_t> m_activeReaders[2] = {};
+            char m_padding[64 - 2 * sizeof(AZStd::atomic<uint32_t>)];
+        };
+        static constexpr size_t ReaderSlotCount = 16;
+        mutable ReaderSlot m_readerSlots[ReaderSlotCount];
+        mutable AZStd::atomic<uint32_t> m_readerEpoch{ 0 };
+
+        //! Name data removed from the dictionary that lock-free lookups may still be reading. It's deleted in batches, so
+        //! releasing names only waits for the readers once per batch. Only modified with m_sharedMutex locked for writing.
+        AZStd::vector<Internal::NameData*> m_releasedNameData;
+
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
         //! so we keep track of them here to ensure their name data gets correctly cleaned up
@@ -220,6 +220,13 @@ namespace AZ
         return context.Report(result, "Ignoring custom serialization during store");
     }
 
+    JsonSerializationResult::Result BaseJsonSerializer::LoadArrayElements(void* /*outputValue*/, const Uuid& /*outputValueTypeId*/,
+        ArrayElementReader& /*elements*/, JsonDeserializerContext& context)
+    {
+        return context.Report(JsonSerializationResult::Tasks::ReadField, JsonSerializationResult::Outcomes::Unsupported,
+            "Serializer doesn't support loading from an array element reader.");
+    }
+
     BaseJsonSerializer::OperationFlags BaseJsonSerializer::GetOperationsFlags() const
     {
         return OperationFlags::None;
@@ -172,8 +172,31 @@ namespace AZ
         {
             None = 0,                       //! No flags that control how the custom json serializer is used.
             ManualDefault = 1 << 0,         //! Even if an (explicit) default is found the custom json serializer will still be called.
-            InitializeNewInstance = 1 << 1  //! If set, the custom json serializer will be called with an explicit default if a new
+            InitializeNewInstance = 1 << 1, //! If set, the custom json serializer will be called with an explicit default if a new
                                             //! instance of its target type is created.
+            StreamArrayElements = 1 << 2    //! If set, the custom json serializer implements LoadArrayElements and can load json arrays
+                                            //! one element at a time while the json document is still being read.
+        };
+
+        //! Provides the elements of a json array one at a time. This allows serializers to load arrays without requiring the
+        //! entire array to be available as a json value, for instance while the json document is being streamed in.
+        class ArrayElementReader
+        {
+        public:
+            virtual ~ArrayElementReader() = default;
+
+            //! Returns true if there's at least one more element in the array that hasn't been loaded or skipped yet.
+            virtual bool HasNextElement() = 0;
+            //! Loads the next element in the array into the provided object. Only call this if HasNextElement returned true.
+            //! @param object Pointer to the object where the element will be loaded into.
+            //! @param typeId Type id of the object passed in.
+            //! @param context The context used during deserialization. Use the value passed in from LoadArrayElements.
+            //! @param flags Controls how the element is loaded, similar to the flags for ContinueLoading.
+            virtual JsonSerializationResult::ResultCode LoadNextElement(void* object, const Uuid& typeId,
+                JsonDeserializerContext& context, ContinuationFlags flags = ContinuationFlags::None) = 0;
+            //! Skips over all elements that haven't been loaded yet.
+            //! @return The number of elements that were skipped.
+            virtual size_t SkipRemainingElements() = 0;
         };
 
         virtual ~BaseJsonSerializer() = default;
@@ -191,6 +214,12 @@ namespace AZ
         virtual JsonSerializationResult::Result Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
             const Uuid& valueTypeId, JsonSerializerContext& context);
 
+        //! Loads the elements provided by the element reader into outputValue. This is called instead of Load when the
+        //! serializer returns OperationFlags::StreamArrayElements and the value to load from is a json array.
+        //! \note The default implementation doesn't support loading from an element reader.
+        virtual JsonSerializationResult::Result LoadArrayElements(void* outputValue, const Uuid& outputValueTypeId,
+            ArrayElementReader& elements, JsonDeserializerContext& context);
+
         //! Returns the operation flags which tells the Json Serialization how this custom json serializer can be used.
         virtual OperationFlags GetOperationsFlags() const;
 
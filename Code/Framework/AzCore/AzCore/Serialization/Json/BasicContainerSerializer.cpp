@@ -17,6 +17,41 @@ namespace AZ
 {
     AZ_CLASS_ALLOCATOR_IMPL(JsonBasicContainerSerializer, SystemAllocator);
 
+    //! Provides the elements of a json array value that's fully available in memory.
+    class JsonBasicContainerSerializer::ArrayValueReader final
+        : public ArrayElementReader
+    {
+    public:
+        ArrayValueReader(JsonBasicContainerSerializer& serializer, const rapidjson::Value& array)
+            : m_serializer(serializer)
+            , m_array(array)
+        {
+        }
+
+        bool HasNextElement() override
+        {
+            return m_index < m_array.Size();
+        }
+
+        JsonSerializationResult::ResultCode LoadNextElement(void* object, const Uuid& typeId,
+            JsonDeserializerContext& context, ContinuationFlags flags) override
+        {
+            return m_serializer.ContinueLoading(object, typeId, m_array[m_index++], context, flags);
+        }
+
+        size_t SkipRemainingElements() override
+        {
+            size_t skipped = m_array.Size() - m_index;
+            m_index = m_array.Size();
+            return skipped;
+        }
+
+    private:
+        JsonBasicContainerSerializer& m_serializer;
+        const rapidjson::Value& m_array;
+        rapidjson::SizeType m_index{ 0 };
+    };
+
     JsonSerializationResult::Result JsonBasicContainerSerializer::Load(void* outputValue, const Uuid& outputValueTypeId,
         const rapidjson::Value& inputValue, JsonDeserializerContext& context)
     {
@@ -28,7 +63,10 @@ namespace AZ
         switch (inputValue.GetType())
         {
         case rapidjson::kArrayType:
-            return LoadContainer(outputValue, outputValueTypeId, inputValue, context);
+        {
+            ArrayValueReader elements(*this, inputValue);
+            return LoadContainer(outputValue, outputValueTypeId, elements, context);
+        }
 
         case rapidjson::kObjectType:
             [[fallthrough]];
@@ -50,6 +88,18 @@ namespace AZ
         }
     }
 
+    JsonSerializationResult::Result JsonBasicContainerSerializer::LoadArrayElements(void* outputValue, const Uuid& outputValueTypeId,
+        ArrayElementReader& elements, JsonDeserializerContext& context)
+    {
+        AZ_Assert(outputValue, "Expected a valid pointer to load from json array.");
+        return LoadContainer(outputValue, outputValueTypeId, elements, context);
+    }
+
+    auto JsonBasicContainerSerializer::GetOperationsFlags() const -> OperationFlags
+    {
+        return OperationFlags::StreamArrayElements;
+    }
+
     bool JsonBasicContainerSerializer::ShouldClearContainer(const JsonDeserializerContext& context) const
     {
         return context.ShouldClearContainers();
@@ -144,7 +194,7 @@ namespace AZ
     }
 
     JsonSerializationResult::Result JsonBasicContainerSerializer::LoadContainer(void* outputValue, const Uuid& outputValueTypeId,
-        const rapidjson::Value& inputValue, JsonDeserializerContext& context)
+        ArrayElementReader& elements, JsonDeserializerContext& context)
     {
         namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
 
@@ -197,10 +247,10 @@ namespace AZ
             }
             retVal.Combine(result);
         }
-        rapidjson::SizeType arraySize = inputValue.Size();
-        for (rapidjson::SizeType i = 0; i < arraySize; ++i)
+        size_t arraySize = 0;
+        while (elements.HasNextElement())
         {
-            ScopedContextPath subPath(context, i);
+            ScopedContextPath subPath(context, arraySize);
 
             size_t expectedSize = container->Size(outputValue) + 1;
 
@@ -208,8 +258,10 @@ namespace AZ
             {
                 retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
                     "Unable to load more entries in basic container because it's full."));
+                arraySize += elements.SkipRemainingElements();
                 break;
             }
+            ++arraySize;
 
             void* elementAddress = container->ReserveElement(outputValue, classElement);
             if (!elementAddress)
@@ -222,7 +274,7 @@ namespace AZ
                 *reinterpret_cast<void**>(elementAddress) = nullptr;
             }
             
-            JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
+            JSR::ResultCode result = elements.LoadNextElement(elementAddress, classElement->m_typeId, context, flags);
             if (result.GetProcessing() == JSR::Processing::Halted)
             {
                 container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
@@ -248,7 +300,7 @@ namespace AZ
             } 
         }
 
-        if (!retVal.HasDoneWork() && inputValue.Empty())
+        if (!retVal.HasDoneWork() && arraySize == 0)
         {
             return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Success, "No values provided for basic container.");
         }
@@ -23,6 +23,9 @@ namespace AZ
             JsonDeserializerContext& context) override;
         JsonSerializationResult::Result Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
             const Uuid& valueTypeId, JsonSerializerContext& context) override;
+        JsonSerializationResult::Result LoadArrayElements(void* outputValue, const Uuid& outputValueTypeId,
+            ArrayElementReader& elements, JsonDeserializerContext& context) override;
+        OperationFlags GetOperationsFlags() const override;
 
     protected:
         //! When this function returns true then the container will be cleared before applying the data from the json document.
@@ -30,7 +33,9 @@ namespace AZ
         virtual bool ShouldClearContainer(const JsonDeserializerContext& context) const;
 
     private:
-        JsonSerializationResult::Result LoadContainer(void* outputValue, const Uuid& outputValueTypeId, const rapidjson::Value& inputValue,
+        class ArrayValueReader;
+
+        JsonSerializationResult::Result LoadContainer(void* outputValue, const Uuid& outputValueTypeId, ArrayElementReader& elements,
             JsonDeserializerContext& context);
     };
 } // namespace AZ
@@ -15,6 +15,11 @@
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
 namespace AZ
 {
     class BaseJsonSerializer;
@@ -177,6 +182,42 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the data from a stream containing a json document into the supplied object. The object is expected to be created before
+        //! calling load. Unlike Load the document isn't read into memory first, but the object is loaded while the document is being read.
+        //! Reflected classes, pointers that start with their "$type" and arrays for serializers that support streaming are loaded directly
+        //! from the stream, while all other values are read into a temporary json value first. This significantly reduces peak memory for
+        //! large documents. Document-based loaders such as the prefab loader and the settings registry still go through Load.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream to read the json document from, starting at its current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from a stream containing a json document into the supplied object. The object is expected to be created before
+        //! calling load. Unlike Load the document isn't read into memory first, but the object is loaded while the document is being read.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream to read the json document from, starting at its current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromStream(T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+        //! Loads the data from a stream containing a json document into the supplied object. The object is expected to be created before
+        //! calling load. Unlike Load the document isn't read into memory first, but the object is loaded while the document is being read.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream to read the json document from, starting at its current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            void* object, const Uuid& objectType, IO::GenericStream& stream,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from a stream containing a json document into the supplied object. The object is expected to be created before
+        //! calling load. Unlike Load the document isn't read into memory first, but the object is loaded while the document is being read.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream to read the json document from, starting at its current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -359,6 +400,20 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromStream(
+        T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings)
+    {
+        return LoadFromStream(&object, azrtti_typeid(object), stream, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromStream(
+        T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings)
+    {
+        return LoadFromStream(&object, azrtti_typeid(object), stream, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
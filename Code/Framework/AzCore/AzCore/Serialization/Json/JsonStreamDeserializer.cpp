@@ -0,0 +1,757 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonStreamDeserializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/Json/StackedString.h>
+
+namespace AZ
+{
+    //
+    // InputStream
+    //
+
+    JsonStreamDeserializer::InputStream::InputStream(IO::GenericStream& stream)
+        : m_stream(stream)
+    {
+        m_buffer.resize_no_construct(BufferSize);
+        m_current = m_buffer.data();
+        m_end = m_buffer.data();
+        Refill();
+    }
+
+    size_t JsonStreamDeserializer::InputStream::Tell() const
+    {
+        return m_bufferOffset + (m_current - m_buffer.data());
+    }
+
+    auto JsonStreamDeserializer::InputStream::PutBegin() -> Ch*
+    {
+        AZ_Assert(false, "Writing to a json input stream isn't supported.");
+        return nullptr;
+    }
+
+    void JsonStreamDeserializer::InputStream::Put(Ch)
+    {
+        AZ_Assert(false, "Writing to a json input stream isn't supported.");
+    }
+
+    void JsonStreamDeserializer::InputStream::Flush()
+    {
+        AZ_Assert(false, "Writing to a json input stream isn't supported.");
+    }
+
+    size_t JsonStreamDeserializer::InputStream::PutEnd(Ch*)
+    {
+        AZ_Assert(false, "Writing to a json input stream isn't supported.");
+        return 0;
+    }
+
+    void JsonStreamDeserializer::InputStream::Refill()
+    {
+        m_bufferOffset += m_end - m_buffer.data();
+        IO::SizeType bytesRead = m_stream.Read(m_buffer.size(), m_buffer.data());
+        m_current = m_buffer.data();
+        m_end = m_buffer.data() + bytesRead;
+    }
+
+
+    //
+    // Token
+    //
+
+    bool JsonStreamDeserializer::Token::Null()
+    {
+        m_type = TokenType::Null;
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::Bool(bool value)
+    {
+        m_type = value ? TokenType::True : TokenType::False;
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::Int(int value)
+    {
+        m_type = TokenType::Int;
+        m_int = value;
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::Uint(unsigned value)
+    {
+        m_type = TokenType::Uint;
+        m_uint = value;
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::Int64(int64_t value)
+    {
+        m_type = TokenType::Int64;
+        m_int64 = value;
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::Uint64(uint64_t value)
+    {
+        m_type = TokenType::Uint64;
+        m_uint64 = value;
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::Double(double value)
+    {
+        m_type = TokenType::Double;
+        m_double = value;
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::RawNumber(const char* value, rapidjson::SizeType length, bool copy)
+    {
+        // Only called when numbers are parsed as strings, which isn't enabled in the parse flags.
+        return String(value, length, copy);
+    }
+
+    bool JsonStreamDeserializer::Token::String(const char* value, rapidjson::SizeType length, bool)
+    {
+        // The string is only valid for the duration of this call so it needs to be copied.
+        m_type = TokenType::String;
+        m_string.assign(value, length);
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::StartObject()
+    {
+        m_type = TokenType::StartObject;
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::Key(const char* value, rapidjson::SizeType length, bool)
+    {
+        m_type = TokenType::Key;
+        m_string.assign(value, length);
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::EndObject(rapidjson::SizeType)
+    {
+        m_type = TokenType::EndObject;
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::StartArray()
+    {
+        m_type = TokenType::StartArray;
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Token::EndArray(rapidjson::SizeType)
+    {
+        m_type = TokenType::EndArray;
+        return true;
+    }
+
+
+    //
+    // ArrayReader
+    //
+
+    //! Provides the elements of the array at the current token to serializers as they're read from the stream.
+    class JsonStreamDeserializer::ArrayReader final
+        : public BaseJsonSerializer::ArrayElementReader
+    {
+    public:
+        explicit ArrayReader(JsonStreamDeserializer& deserializer)
+            : m_deserializer(deserializer)
+        {
+        }
+
+        bool HasNextElement() override
+        {
+            if (!m_hasElement && !m_isAtEnd)
+            {
+                if (m_deserializer.ReadToken() && m_deserializer.m_token.m_type != TokenType::EndArray)
+                {
+                    m_hasElement = true;
+                }
+                else
+                {
+                    m_isAtEnd = true;
+                }
+            }
+            return m_hasElement;
+        }
+
+        JsonSerializationResult::ResultCode LoadNextElement(void* object, const Uuid& typeId,
+            JsonDeserializerContext& context, BaseJsonSerializer::ContinuationFlags flags) override
+        {
+            AZ_Assert(m_hasElement, "LoadNextElement called on a json stream array without checking for an available element first.");
+            m_hasElement = false;
+            return m_deserializer.LoadElement(object, typeId, flags, context);
+        }
+
+        size_t SkipRemainingElements() override
+        {
+            size_t skipped = 0;
+            while (HasNextElement())
+            {
+                m_hasElement = false;
+                if (!m_deserializer.SkipValue())
+                {
+                    m_isAtEnd = true;
+                    break;
+                }
+                skipped++;
+            }
+            return skipped;
+        }
+
+    private:
+        JsonStreamDeserializer& m_deserializer;
+        bool m_hasElement{ false };
+        bool m_isAtEnd{ false };
+    };
+
+
+    //
+    // JsonStreamDeserializer
+    //
+
+    JsonStreamDeserializer::JsonStreamDeserializer(IO::GenericStream& stream)
+        : m_input(stream)
+    {
+        m_reader.IterativeParseInit();
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::Load(void* object, const Uuid& typeId, IO::GenericStream& stream,
+        JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        JsonStreamDeserializer deserializer(stream);
+        if (!deserializer.ReadToken())
+        {
+            return deserializer.ReportParseError(context);
+        }
+
+        ResultCode result = deserializer.LoadValue(object, typeId, false, JsonDeserializer::UseTypeDeserializer::Yes, context);
+        if (result.GetProcessing() != Processing::Halted && !deserializer.m_reader.IterativeParseComplete())
+        {
+            return deserializer.ReportParseError(context);
+        }
+        return result;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::LoadValue(void* object, const Uuid& typeId, bool isNewInstance,
+        JsonDeserializer::UseTypeDeserializer useCustom, JsonDeserializerContext& context)
+    {
+        // The order of the checks matches JsonDeserializer::Load. Anything that can't be loaded while reading is passed on to
+        // the JsonDeserializer, which will also take care of reporting any issues.
+        if (!object)
+        {
+            return LoadFromJsonValue(object, typeId, isNewInstance, useCustom, context);
+        }
+
+        if (BaseJsonSerializer* serializer
+            = (useCustom == JsonDeserializer::UseTypeDeserializer::Yes ? context.GetRegistrationContext()->GetSerializerForType(typeId) : nullptr))
+        {
+            return LoadWithSerializer(*serializer, object, typeId, isNewInstance, context);
+        }
+
+        const SerializeContext::ClassData* classData = context.GetSerializeContext()->FindClassData(typeId);
+        if (!classData)
+        {
+            return LoadFromJsonValue(object, typeId, isNewInstance, useCustom, context);
+        }
+
+        if (classData->m_azRtti && classData->m_azRtti->GetGenericTypeId() != typeId)
+        {
+            if (((classData->m_azRtti->GetTypeTraits() & (AZ::TypeTraits::is_signed | AZ::TypeTraits::is_unsigned)) != AZ::TypeTraits{0}) &&
+                context.GetSerializeContext()->GetUnderlyingTypeId(typeId) == classData->m_typeId)
+            {
+                return LoadFromJsonValue(object, typeId, isNewInstance, useCustom, context);
+            }
+
+            if (BaseJsonSerializer* serializer
+                = (useCustom == JsonDeserializer::UseTypeDeserializer::Yes)
+                    ? context.GetRegistrationContext()->GetSerializerForType(classData->m_azRtti->GetGenericTypeId())
+                    : nullptr)
+            {
+                return LoadWithSerializer(*serializer, object, typeId, isNewInstance, context);
+            }
+        }
+
+        bool isEnum = classData->m_azRtti && (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum;
+        if (m_token.m_type == TokenType::StartObject && !isEnum && !classData->m_container)
+        {
+            return LoadClass(object, *classData, context);
+        }
+        return LoadFromJsonValue(object, typeId, isNewInstance, useCustom, context);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::LoadElement(void* object, const Uuid& typeId,
+        BaseJsonSerializer::ContinuationFlags flags, JsonDeserializerContext& context)
+    {
+        using ContinuationFlags = BaseJsonSerializer::ContinuationFlags;
+
+        bool loadAsNewInstance = (flags & ContinuationFlags::LoadAsNewInstance) == ContinuationFlags::LoadAsNewInstance;
+        JsonDeserializer::UseTypeDeserializer useCustom = (flags & ContinuationFlags::IgnoreTypeSerializer) == ContinuationFlags::IgnoreTypeSerializer
+            ? JsonDeserializer::UseTypeDeserializer::No
+            : JsonDeserializer::UseTypeDeserializer::Yes;
+
+        return (flags & ContinuationFlags::ResolvePointer) == ContinuationFlags::ResolvePointer
+            ? LoadToPointer(object, typeId, useCustom, context)
+            : LoadValue(object, typeId, loadAsNewInstance, useCustom, context);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::LoadToPointer(void* object, const Uuid& typeId,
+        JsonDeserializer::UseTypeDeserializer useCustom, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        rapidjson::Document value;
+        if (m_token.m_type != TokenType::StartObject)
+        {
+            if (!ReadJsonValue(value, value.GetAllocator()))
+            {
+                return ReportParseError(context);
+            }
+            return JsonDeserializer::LoadToPointer(object, typeId, value, useCustom, context);
+        }
+
+        if (!ReadToken())
+        {
+            return ReportParseError(context);
+        }
+        value.SetObject();
+        if (m_token.m_type != TokenType::Key || m_token.m_string != JsonSerialization::TypeIdFieldIdentifier)
+        {
+            // The type is needed to create the instance to load into. If it's not the first member it can be stored anywhere in
+            // the object, so the whole object has to be read first.
+            if (!ReadJsonMembers(value, value.GetAllocator()))
+            {
+                return ReportParseError(context);
+            }
+            return JsonDeserializer::LoadToPointer(object, typeId, value, useCustom, context);
+        }
+
+        // The type is stored first, which is how the serializer stores it, so only the type has to be read to resolve the pointer.
+        rapidjson::Value typeValue;
+        if (!ReadToken() || !ReadJsonValue(typeValue, value.GetAllocator()))
+        {
+            return ReportParseError(context);
+        }
+        value.AddMember(rapidjson::StringRef(JsonSerialization::TypeIdFieldIdentifier), AZStd::move(typeValue), value.GetAllocator());
+        if (!ReadToken())
+        {
+            return ReportParseError(context);
+        }
+
+        const SerializeContext::ClassData* classData = context.GetSerializeContext()->FindClassData(typeId);
+        if (!classData || !classData->m_azRtti)
+        {
+            // Let the JsonDeserializer report the missing type information.
+            if (!ReadJsonMembers(value, value.GetAllocator()))
+            {
+                return ReportParseError(context);
+            }
+            return JsonDeserializer::LoadToPointer(object, typeId, value, useCustom, context);
+        }
+
+        void** objectPtr = reinterpret_cast<void**>(object);
+        bool isNull = *objectPtr == nullptr;
+        Uuid resolvedTypeId = typeId;
+        ResultCode status(Tasks::RetrieveInfo);
+        JsonDeserializer::ResolvePointerResult pointerResolution =
+            JsonDeserializer::ResolvePointer(objectPtr, resolvedTypeId, status, value, *classData->m_azRtti, context);
+        const SerializeContext::ClassData* resolvedClassData = pointerResolution == JsonDeserializer::ResolvePointerResult::FullyProcessed
+            ? nullptr
+            : context.GetSerializeContext()->FindClassData(resolvedTypeId);
+        if (!resolvedClassData)
+        {
+            if (!SkipMembers())
+            {
+                return ReportParseError(context);
+            }
+            return pointerResolution == JsonDeserializer::ResolvePointerResult::FullyProcessed
+                ? status
+                : context.Report(Tasks::RetrieveInfo, Outcomes::Unknown,
+                    AZStd::string::format("Failed to retrieve serialization information for pointer type %s.", typeId.ToString<AZStd::string>().c_str()));
+        }
+
+        if (IsLoadedAsClass(resolvedTypeId, *resolvedClassData, useCustom, context))
+        {
+            status = LoadClassMembers(*objectPtr, *resolvedClassData, context);
+        }
+        else
+        {
+            // Custom serializers, enums and containers need the rest of the object as a json value.
+            if (!ReadJsonMembers(value, value.GetAllocator()))
+            {
+                return ReportParseError(context);
+            }
+            status = JsonDeserializer::Load(*objectPtr, resolvedTypeId, value, true, useCustom, context);
+        }
+
+        *objectPtr = resolvedClassData->m_azRtti->Cast(*objectPtr, typeId);
+
+        if (isNull && (status.GetProcessing() == Processing::Halted || status.GetProcessing() == Processing::Altered))
+        {
+            // Same as the JsonDeserializer, undo creating the instance if loading into it failed.
+            AZ_Assert(resolvedClassData->m_factory,
+                "Expected class data to have a factory as it was previously used in the Json Stream Deserializer to create a new instance.");
+            resolvedClassData->m_factory->Destroy(*objectPtr);
+            *objectPtr = nullptr;
+        }
+        return status;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::LoadWithClassElement(void* object,
+        const SerializeContext::ClassElement& classElement, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (classElement.m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+        {
+            if (!classElement.m_azRtti)
+            {
+                if (!SkipValue())
+                {
+                    return ReportParseError(context);
+                }
+                return context.Report(Tasks::RetrieveInfo, Outcomes::Unknown,
+                    AZStd::string::format("Failed to retrieve rtti information for %s.", classElement.m_name));
+            }
+            return LoadToPointer(object, classElement.m_typeId, JsonDeserializer::UseTypeDeserializer::Yes, context);
+        }
+        else
+        {
+            return LoadValue(object, classElement.m_typeId, false, JsonDeserializer::UseTypeDeserializer::Yes, context);
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::LoadWithSerializer(BaseJsonSerializer& serializer, void* object,
+        const Uuid& typeId, bool isNewInstance, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (m_token.m_type == TokenType::StartArray &&
+            (serializer.GetOperationsFlags() & BaseJsonSerializer::OperationFlags::StreamArrayElements) ==
+                BaseJsonSerializer::OperationFlags::StreamArrayElements)
+        {
+            // Arrays are never explicit defaults, so there's no need for the default checks of the JsonDeserializer.
+            ArrayReader elements(*this);
+            ResultCode result = serializer.LoadArrayElements(object, typeId, elements, context);
+            if (result.GetProcessing() != Processing::Halted)
+            {
+                // Make sure the rest of the array is consumed in case the serializer stopped early.
+                elements.SkipRemainingElements();
+                if (m_reader.HasParseError())
+                {
+                    return ReportParseError(context);
+                }
+            }
+            return result;
+        }
+
+        rapidjson::Document value;
+        if (!ReadJsonValue(value, value.GetAllocator()))
+        {
+            return ReportParseError(context);
+        }
+        return JsonDeserializer::DeserializerDefaultCheck(&serializer, object, typeId, value, isNewInstance, context);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::LoadClass(void* object, const SerializeContext::ClassData& classData,
+        JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        AZ_Assert(context.GetRegistrationContext() && context.GetSerializeContext(), "Expected valid registration context and serialize context.");
+
+        if (!ReadToken())
+        {
+            return ReportParseError(context);
+        }
+        if (m_token.m_type == TokenType::EndObject)
+        {
+            return context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default.");
+        }
+        return LoadClassMembers(object, classData, context);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::LoadClassMembers(void* object,
+        const SerializeContext::ClassData& classData, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        // Compatibility with Reflection Serialize - it expects this callback after before into a C++ class.
+        if (classData.m_eventHandler)
+        {
+            classData.m_eventHandler->OnWriteBegin(object);
+        }
+
+        size_t numLoads = 0;
+        ResultCode retVal(Tasks::ReadField);
+        AZStd::string name;
+        while (m_token.m_type != TokenType::EndObject)
+        {
+            AZ_Assert(m_token.m_type == TokenType::Key, "Expected the json stream to provide a member name.");
+            name = m_token.m_string;
+            if (!ReadToken())
+            {
+                return ReportParseError(context);
+            }
+
+            if (name == JsonSerialization::TypeIdFieldIdentifier)
+            {
+                if (!SkipValue())
+                {
+                    return ReportParseError(context);
+                }
+            }
+            else
+            {
+                Crc32 nameCrc(name);
+                JsonDeserializer::ElementDataResult foundElementData =
+                    JsonDeserializer::FindElementByNameCrc(*context.GetSerializeContext(), object, classData, nameCrc);
+
+                ScopedContextPath subPath(context, name);
+                if (foundElementData.m_found)
+                {
+                    ResultCode result = LoadWithClassElement(foundElementData.m_data, *foundElementData.m_info, context);
+                    retVal.Combine(result);
+
+                    if (result.GetProcessing() == Processing::Halted)
+                    {
+                        return context.Report(result, "Loading of element has failed.");
+                    }
+                    else if (result.GetProcessing() != Processing::Altered)
+                    {
+                        numLoads++;
+                    }
+                }
+                else
+                {
+                    if (!SkipValue())
+                    {
+                        return ReportParseError(context);
+                    }
+                    retVal.Combine(context.Report(Tasks::ReadField, Outcomes::Skipped,
+                        "Skipping field as there's no matching variable in the target."));
+                }
+            }
+
+            if (!ReadToken())
+            {
+                return ReportParseError(context);
+            }
+        }
+
+        size_t elementCount = JsonDeserializer::CountElements(*context.GetSerializeContext(), classData);
+        if (elementCount > numLoads)
+        {
+            retVal.Combine(ResultCode(Tasks::ReadField, numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+        }
+
+        // Compatibility with Reflection Serialize - it expects this callback after reading into a C++ class.
+        if (classData.m_eventHandler)
+        {
+            classData.m_eventHandler->OnWriteEnd(object);
+        }
+
+        return retVal;
+    }
+
+    bool JsonStreamDeserializer::IsLoadedAsClass(const Uuid& typeId, const SerializeContext::ClassData& classData,
+        JsonDeserializer::UseTypeDeserializer useCustom, JsonDeserializerContext& context)
+    {
+        // Mirrors the checks in LoadValue.
+        const bool useSerializers = useCustom == JsonDeserializer::UseTypeDeserializer::Yes;
+        if (useSerializers && context.GetRegistrationContext()->GetSerializerForType(typeId))
+        {
+            return false;
+        }
+
+        if (classData.m_azRtti && classData.m_azRtti->GetGenericTypeId() != typeId)
+        {
+            if (((classData.m_azRtti->GetTypeTraits() & (AZ::TypeTraits::is_signed | AZ::TypeTraits::is_unsigned)) != AZ::TypeTraits{0}) &&
+                context.GetSerializeContext()->GetUnderlyingTypeId(typeId) == classData.m_typeId)
+            {
+                return false;
+            }
+            if (useSerializers && context.GetRegistrationContext()->GetSerializerForType(classData.m_azRtti->GetGenericTypeId()))
+            {
+                return false;
+            }
+        }
+
+        bool isEnum = classData.m_azRtti && (classData.m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum;
+        return !isEnum && !classData.m_container;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::LoadFromJsonValue(void* object, const Uuid& typeId, bool isNewInstance,
+        JsonDeserializer::UseTypeDeserializer useCustom, JsonDeserializerContext& context)
+    {
+        rapidjson::Document value;
+        if (!ReadJsonValue(value, value.GetAllocator()))
+        {
+            return ReportParseError(context);
+        }
+        return JsonDeserializer::Load(object, typeId, value, isNewInstance, useCustom, context);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::ReportParseError(JsonDeserializerContext& context) const
+    {
+        using namespace JsonSerializationResult;
+
+        if (m_reader.HasParseError())
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("Failed to parse json stream at offset %zu: %s", m_reader.GetErrorOffset(),
+                    rapidjson::GetParseError_En(m_reader.GetParseErrorCode())));
+        }
+        return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+            AZStd::string::format("Unexpected end of json stream at offset %zu.", m_input.Tell()));
+    }
+
+    bool JsonStreamDeserializer::ReadToken()
+    {
+        m_token.m_type = TokenType::None;
+        if (m_reader.IterativeParseComplete())
+        {
+            return false;
+        }
+        return m_reader.IterativeParseNext<ParseFlags>(m_input, m_token) && m_token.m_type != TokenType::None;
+    }
+
+    bool JsonStreamDeserializer::ReadJsonValue(rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator)
+    {
+        switch (m_token.m_type)
+        {
+        case TokenType::Null:
+            value.SetNull();
+            return true;
+        case TokenType::False:
+            value.SetBool(false);
+            return true;
+        case TokenType::True:
+            value.SetBool(true);
+            return true;
+        case TokenType::Int:
+            value.SetInt(m_token.m_int);
+            return true;
+        case TokenType::Uint:
+            value.SetUint(m_token.m_uint);
+            return true;
+        case TokenType::Int64:
+            value.SetInt64(m_token.m_int64);
+            return true;
+        case TokenType::Uint64:
+            value.SetUint64(m_token.m_uint64);
+            return true;
+        case TokenType::Double:
+            value.SetDouble(m_token.m_double);
+            return true;
+        case TokenType::String:
+            value.SetString(m_token.m_string.c_str(), aznumeric_cast<rapidjson::SizeType>(m_token.m_string.size()), allocator);
+            return true;
+        case TokenType::StartObject:
+            value.SetObject();
+            return ReadToken() && ReadJsonMembers(value, allocator);
+        case TokenType::StartArray:
+            value.SetArray();
+            while (ReadToken())
+            {
+                if (m_token.m_type == TokenType::EndArray)
+                {
+                    return true;
+                }
+                rapidjson::Value element;
+                if (!ReadJsonValue(element, allocator))
+                {
+                    return false;
+                }
+                value.PushBack(element, allocator);
+            }
+            return false;
+        default:
+            return false;
+        }
+    }
+
+    bool JsonStreamDeserializer::ReadJsonMembers(rapidjson::Value& object, rapidjson::Document::AllocatorType& allocator)
+    {
+        while (m_token.m_type != TokenType::EndObject)
+        {
+            if (m_token.m_type != TokenType::Key)
+            {
+                return false;
+            }
+            rapidjson::Value name(m_token.m_string.c_str(), aznumeric_cast<rapidjson::SizeType>(m_token.m_string.size()), allocator);
+            rapidjson::Value member;
+            if (!ReadToken() || !ReadJsonValue(member, allocator))
+            {
+                return false;
+            }
+            object.AddMember(name, member, allocator);
+            if (!ReadToken())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool JsonStreamDeserializer::SkipMembers()
+    {
+        while (m_token.m_type != TokenType::EndObject)
+        {
+            if (m_token.m_type != TokenType::Key || !ReadToken() || !SkipValue() || !ReadToken())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool JsonStreamDeserializer::SkipValue()
+    {
+        if (m_token.m_type != TokenType::StartObject && m_token.m_type != TokenType::StartArray)
+        {
+            return m_token.m_type != TokenType::None;
+        }
+
+        size_t depth = 1;
+        while (ReadToken())
+        {
+            switch (m_token.m_type)
+            {
+            case TokenType::StartObject:
+            case TokenType::StartArray:
+                depth++;
+                break;
+            case TokenType::EndObject:
+            case TokenType::EndArray:
+                if (--depth == 0)
+                {
+                    return true;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        return false;
+    }
+} // namespace AZ
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
+namespace AZ
+{
+    //! Loads json documents directly from a stream without first parsing the entire document into a rapidjson::Document.
+    //! The document is read with a pull parser and reflected classes, arrays for serializers that have
+    //! OperationFlags::StreamArrayElements set and pointers to reflected classes that store their $type as the first member are
+    //! loaded while the document is being read. Enums, values for all other custom serializers and pointers without a leading
+    //! $type may need random access to their json value, so those values are read into a (small) json document first and passed
+    //! on to the JsonDeserializer. This limits the memory overhead to the largest of these values rather than the entire document.
+    //! This is only used by callers of JsonSerialization::LoadFromStream. Loaders that need the json document itself, such as
+    //! the prefab loader which patches it and the settings registry which merges it, keep reading the full document.
+    class AZCORE_API JsonStreamDeserializer final
+    {
+        friend class JsonSerialization;
+
+    private:
+        //! Buffered adapter that exposes an AZ::IO::GenericStream as a rapidjson input stream.
+        class InputStream
+        {
+        public:
+            using Ch = char;
+
+            explicit InputStream(IO::GenericStream& stream);
+
+            Ch Peek() const
+            {
+                return m_current != m_end ? *m_current : '\0';
+            }
+            Ch Take()
+            {
+                if (m_current == m_end)
+                {
+                    return '\0';
+                }
+                Ch result = *m_current++;
+                if (m_current == m_end)
+                {
+                    Refill();
+                }
+                return result;
+            }
+            size_t Tell() const;
+
+            // Writing functions required by rapidjson, but not supported by this stream.
+            Ch* PutBegin();
+            void Put(Ch);
+            void Flush();
+            size_t PutEnd(Ch*);
+
+        private:
+            void Refill();
+
+            static constexpr size_t BufferSize = 64 * 1024;
+
+            IO::GenericStream& m_stream;
+            AZStd::vector<Ch> m_buffer;
+            const Ch* m_current{ nullptr };
+            const Ch* m_end{ nullptr };
+            size_t m_bufferOffset{ 0 };
+        };
+
+        enum class TokenType : u8
+        {
+            None,
+            Null,
+            False,
+            True,
+            Int,
+            Uint,
+            Int64,
+            Uint64,
+            Double,
+            String,
+            Key,
+            StartObject,
+            EndObject,
+            StartArray,
+            EndArray
+        };
+
+        //! The last token read from the json document. This also acts as the handler for the rapidjson reader.
+        struct Token
+        {
+            bool Null();
+            bool Bool(bool value);
+            bool Int(int value);
+            bool Uint(unsigned value);
+            bool Int64(int64_t value);
+            bool Uint64(uint64_t value);
+            bool Double(double value);
+            bool RawNumber(const char* value, rapidjson::SizeType length, bool copy);
+            bool String(const char* value, rapidjson::SizeType length, bool copy);
+            bool StartObject();
+            bool Key(const char* value, rapidjson::SizeType length, bool copy);
+            bool EndObject(rapidjson::SizeType memberCount);
+            bool StartArray();
+            bool EndArray(rapidjson::SizeType elementCount);
+
+            AZStd::string m_string;
+            union
+            {
+                int m_int;
+                unsigned m_uint;
+                int64_t m_int64;
+                uint64_t m_uint64;
+                double m_double;
+            };
+            TokenType m_type{ TokenType::None };
+        };
+
+        class ArrayReader;
+
+        JsonStreamDeserializer(IO::GenericStream& stream);
+
+        static JsonSerializationResult::ResultCode Load(void* object, const Uuid& typeId, IO::GenericStream& stream,
+            JsonDeserializerContext& context);
+
+        //! Loads the value that starts at the current token. On return the last token of the value is the current token.
+        JsonSerializationResult::ResultCode LoadValue(void* object, const Uuid& typeId, bool isNewInstance,
+            JsonDeserializer::UseTypeDeserializer useCustom, JsonDeserializerContext& context);
+
+        //! Loads an array element that starts at the current token, using the same flags as BaseJsonSerializer::ContinueLoading.
+        JsonSerializationResult::ResultCode LoadElement(void* object, const Uuid& typeId, BaseJsonSerializer::ContinuationFlags flags,
+            JsonDeserializerContext& context);
+
+        JsonSerializationResult::ResultCode LoadToPointer(void* object, const Uuid& typeId,
+            JsonDeserializer::UseTypeDeserializer useCustom, JsonDeserializerContext& context);
+
+        JsonSerializationResult::ResultCode LoadWithClassElement(void* object, const SerializeContext::ClassElement& classElement,
+            JsonDeserializerContext& context);
+
+        JsonSerializationResult::ResultCode LoadWithSerializer(BaseJsonSerializer& serializer, void* object, const Uuid& typeId,
+            bool isNewInstance, JsonDeserializerContext& context);
+
+        JsonSerializationResult::ResultCode LoadClass(void* object, const SerializeContext::ClassData& classData,
+            JsonDeserializerContext& context);
+        //! Loads the members of a class, starting at the member name that is the current token.
+        JsonSerializationResult::ResultCode LoadClassMembers(void* object, const SerializeContext::ClassData& classData,
+            JsonDeserializerContext& context);
+
+        //! Returns true if a json object for the type is loaded member by member through LoadClass.
+        static bool IsLoadedAsClass(const Uuid& typeId, const SerializeContext::ClassData& classData,
+            JsonDeserializer::UseTypeDeserializer useCustom, JsonDeserializerContext& context);
+
+        //! Reads the value that starts at the current token into a json document and loads it through the JsonDeserializer.
+        JsonSerializationResult::ResultCode LoadFromJsonValue(void* object, const Uuid& typeId, bool isNewInstance,
+            JsonDeserializer::UseTypeDeserializer useCustom, JsonDeserializerContext& context);
+
+        JsonSerializationResult::ResultCode ReportParseError(JsonDeserializerContext& context) const;
+
+        //! Moves to the next token in the json document. Returns false if the document has been fully read or has an error.
+        bool ReadToken();
+        //! Reads the value that starts at the current token into the provided json value.
+        bool ReadJsonValue(rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator);
+        //! Reads the members of an object into the provided json object, starting at the member name that is the current token.
+        bool ReadJsonMembers(rapidjson::Value& object, rapidjson::Document::AllocatorType& allocator);
+        //! Moves past the value that starts at the current token.
+        bool SkipValue();
+        //! Moves past the remaining members of an object, starting at the member name that is the current token.
+        bool SkipMembers();
+
+        static constexpr unsigned ParseFlags = rapidjson::kParseCommentsFlag;
+
+        InputStream m_input;
+        rapidjson::Reader m_reader;
+        Token m_token;
+    };
+} // namespace AZ
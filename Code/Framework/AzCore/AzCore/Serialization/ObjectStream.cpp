@@ -132,10 +132,20 @@ namespace AZ
             /// Starts the operation
             bool Start();
 
-            bool LoadClass(IO::GenericStream& stream, SerializeContext::DataElementNode& convertedClassElement, const SerializeContext::ClassData* parentClassInfo, void* parentClassPtr, int flags);
+            /// Tracks the load plan of the class whose elements are read by LoadClass
+            struct LoadPlanState
+            {
+                const SerializeContext::ObjectStreamLoadPlan* m_plan = nullptr;
+                const SerializeContext::ObjectStreamLoadPlan::Field* m_field = nullptr; ///< Field of the last read element, nullptr if it used the regular lookups
+                size_t m_cursor = 0;
+            };
+
+            bool LoadClass(IO::GenericStream& stream, SerializeContext::DataElementNode& convertedClassElement, const SerializeContext::ClassData* parentClassInfo, void* parentClassPtr, int flags,
+                const SerializeContext::ObjectStreamLoadPlan* loadPlan = nullptr);
 
             // returns true if an element was found at the requested level
-            bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement);
+            bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement,
+                LoadPlanState* loadPlanState = nullptr);
             // used during load to skip the rest of the element including any subelements
             void SkipElement();
 
@@ -391,9 +401,11 @@ namespace AZ
         // LoadClass
         // [4/25/2012]
         //=========================================================================
-        bool ObjectStreamImpl::LoadClass(IO::GenericStream& stream, SerializeContext::DataElementNode& convertedClassElement, const SerializeContext::ClassData* parentClassInfo, void* parentClassPtr, int flags)
+        bool ObjectStreamImpl::LoadClass(IO::GenericStream& stream, SerializeContext::DataElementNode& convertedClassElement, const SerializeContext::ClassData* parentClassInfo, void* parentClassPtr, int flags,
+            const SerializeContext::ObjectStreamLoadPlan* loadPlan)
         {
             bool result = true;
+            LoadPlanState loadPlanState{ loadPlan };
 
             SerializeContext::DataElement element;
 
@@ -439,7 +451,7 @@ namespace AZ
                 }
                 else // read from the stream
                 {
-                    if (!ReadElement(*m_sc, classData, element, parentClassInfo, nextLevel, parentClassInfo == nullptr))
+                    if (!ReadElement(*m_sc, classData, element, parentClassInfo, nextLevel, parentClassInfo == nullptr, &loadPlanState))
                     {
                         // we have reached the end of this branch, so exit the loop
                         break;
@@ -480,6 +492,9 @@ namespace AZ
                     isConvertedData = true;
                 }
 
+                // The load plan only describes elements which are read unmodified from the stream
+                const SerializeContext::ObjectStreamLoadPlan::Field* loadPlanField = isConvertedData ? nullptr : loadPlanState.m_field;
+
                 // If classData is NULL then we failed to find a registration for this element
                 // It may be simply stale data that's safe to drop or someone forgot to register
                 // this type. If the class is deprecated, but was not converted, then our only choice
@@ -619,6 +634,11 @@ namespace AZ
                         dynamicElementMetadata.m_typeId = fieldContainer->m_typeId;
                         classElement = &dynamicElementMetadata;
                     }
+                    else if (loadPlanField && loadPlanField->m_classElement)
+                    {
+                        // The load plan already matched the element to a member of the same type
+                        classElement = loadPlanField->m_classElement;
+                    }
                     else
                     {
                         for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
@@ -790,7 +810,17 @@ namespace AZ
                     classData->m_eventHandler->OnWriteBegin(dataAddress);
                 }
 
-                if (const auto* genericTypeInfo = m_sc->FindGenericClassInfo(element.m_id); genericTypeInfo && genericTypeInfo->GetGenericTypeId() == GetAssetClassId())
+                bool isAssetReference = false;
+                if (loadPlanField)
+                {
+                    isAssetReference = loadPlanField->m_isAssetReference;
+                }
+                else if (const auto* genericTypeInfo = m_sc->FindGenericClassInfo(element.m_id))
+                {
+                    isAssetReference = genericTypeInfo->GetGenericTypeId() == GetAssetClassId();
+                }
+
+                if (isAssetReference)
                 {
                     AZ_Assert(dataAddress, "Reference field address is invalid");
                     AZ_Assert(classData->m_serializer, "Asset references should always have a serializer defined");
@@ -844,8 +874,16 @@ namespace AZ
                     classData->m_container->ClearElements(dataAddress, m_sc);
                 }
 
+                // Child elements of a binary stream which was written with the reflected version of the class
+                // are resolved with the load plan of the class
+                const SerializeContext::ObjectStreamLoadPlan* childLoadPlan = nullptr;
+                if (GetType() == ST_BINARY && !isConvertedData && convertedClassElement.m_classData == nullptr && element.m_version == classData->m_version)
+                {
+                    childLoadPlan = m_sc->FindObjectStreamLoadPlan(classData);
+                }
+
                 // Read child nodes
-                result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                result = LoadClass(stream, *convertedNode, classData, dataAddress, flags, childLoadPlan) && result;
 
                 if (classContainer)
                 {
@@ -1032,7 +1070,8 @@ namespace AZ
         // [4/19/2012]
         //=========================================================================
         bool
-        ObjectStreamImpl::ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement)
+        ObjectStreamImpl::ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement,
+            LoadPlanState* loadPlanState)
         {
             AZ_Assert(element.m_stream != nullptr, "You must provide a stream to store the values!");
             element.m_version = 0;
@@ -1044,6 +1083,10 @@ namespace AZ
             element.m_id = AZ::Uuid::CreateNull();
 
             cd = nullptr;
+            if (loadPlanState)
+            {
+                loadPlanState->m_field = nullptr;
+            }
 
             if (GetType() == ST_XML)
             {
@@ -1351,14 +1394,28 @@ namespace AZ
 
                 element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
 
-                // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd && ShouldLookUpSpecializedTypeId(element))
+                // Use the class data resolved by the load plan of the parent class, which was found with the same lookups as below
+                if (loadPlanState && loadPlanState->m_plan && ShouldLookUpSpecializedTypeId(element))
                 {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                    loadPlanState->m_field = loadPlanState->m_plan->FindField(element.m_nameCrc, element.m_id, loadPlanState->m_cursor);
+                }
+
+                if (loadPlanState && loadPlanState->m_field)
+                {
+                    cd = loadPlanState->m_field->m_classData;
+                    element.m_id = loadPlanState->m_field->m_specializedTypeId;
+                }
+                else
+                {
+                    // find the registered class data
+                    cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                    if (cd && ShouldLookUpSpecializedTypeId(element))
                     {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                        if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                        {
+                            element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        }
                     }
                 }
 
@@ -550,6 +550,7 @@ namespace AZ
 
     auto SerializeContext::RegisterType(const AZ::TypeId& typeId, AZ::Serialize::ClassData&& classData, CreateAnyFunc createAnyFunc) -> ClassBuilder
     {
+        ClearObjectStreamLoadPlans();
         auto [typeToClassIter, inserted] = m_uuidMap.try_emplace(typeId, AZStd::move(classData));
         m_classNameToUuid.emplace(AZ::Crc32(typeToClassIter->second.m_name), typeId);
         m_uuidAnyCreationMap.emplace(typeId, createAnyFunc);
@@ -590,6 +591,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::ClassDeprecate(const char* name, const AZ::Uuid& typeUuid, VersionConverter converter)
     {
+        ClearObjectStreamLoadPlans();
         if (IsRemovingReflection())
         {
             m_uuidMap.erase(typeUuid);
@@ -734,6 +736,115 @@ namespace AZ
         return nullptr;
     }
 
+    //=========================================================================
+    // ObjectStreamLoadPlan
+    //=========================================================================
+    auto SerializeContext::ObjectStreamLoadPlan::FindField(u32 nameCrc, const Uuid& typeId, size_t& cursor) const -> const Field*
+    {
+        const size_t fieldCount = m_fields.size();
+        for (size_t i = 0; i < fieldCount; ++i)
+        {
+            const size_t fieldIndex = (cursor + i) % fieldCount;
+            const Field& field = m_fields[fieldIndex];
+            if (field.m_nameCrc == nameCrc && field.m_typeId == typeId)
+            {
+                cursor = fieldIndex + 1;
+                return &field;
+            }
+        }
+        return nullptr;
+    }
+
+    auto SerializeContext::FindObjectStreamLoadPlan(const ClassData* classData) const -> const ObjectStreamLoadPlan*
+    {
+        if (classData == nullptr || (classData->m_elements.empty() && classData->m_container == nullptr))
+        {
+            return nullptr;
+        }
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_objectStreamLoadPlanMutex);
+            if (auto planIt = m_objectStreamLoadPlans.find(classData); planIt != m_objectStreamLoadPlans.end())
+            {
+                return planIt->second.get();
+            }
+        }
+
+        // The plan is created outside of the lock as it queries the reflection of every element.
+        // If another thread created a plan for the class in the meantime, that plan is kept.
+        AZStd::unique_ptr<ObjectStreamLoadPlan> plan = CreateObjectStreamLoadPlan(classData);
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_objectStreamLoadPlanMutex);
+        auto [planIt, inserted] = m_objectStreamLoadPlans.try_emplace(classData, AZStd::move(plan));
+        return planIt->second.get();
+    }
+
+    auto SerializeContext::CreateObjectStreamLoadPlan(const ClassData* classData) const -> AZStd::unique_ptr<ObjectStreamLoadPlan>
+    {
+        auto plan = AZStd::make_unique<ObjectStreamLoadPlan>();
+
+        // Performs the same lookups as the ObjectStream does for every loaded element
+        auto AddField = [this, classData, &plan](const Uuid& typeId, u32 nameCrc, const ClassElement* classElement)
+        {
+            const ClassData* elementClassData = FindClassData(typeId, classData, nameCrc);
+            if (elementClassData == nullptr)
+            {
+                return;
+            }
+
+            ObjectStreamLoadPlan::Field& field = plan->m_fields.emplace_back();
+            field.m_typeId = typeId;
+            field.m_specializedTypeId = typeId;
+            if (GenericClassInfo* genericClassInfo = FindGenericClassInfo(elementClassData->m_typeId))
+            {
+                field.m_specializedTypeId = genericClassInfo->GetSpecializedTypeId();
+            }
+            if (const GenericClassInfo* genericClassInfo = FindGenericClassInfo(field.m_specializedTypeId))
+            {
+                field.m_isAssetReference = genericClassInfo->GetGenericTypeId() == GetAssetClassId();
+            }
+            field.m_classData = elementClassData;
+            field.m_nameCrc = nameCrc;
+            // The member can only be used directly if the loaded element matches its type without a conversion
+            if (classElement && (field.m_specializedTypeId == classElement->m_typeId))
+            {
+                field.m_classElement = classElement;
+            }
+        };
+
+        if (classData->m_container)
+        {
+            classData->m_container->EnumTypes([&AddField](const Uuid& elementClassId, const ClassElement* genericClassElement)
+            {
+                AddField(elementClassId, genericClassElement->m_nameCrc, nullptr);
+                return true;
+            });
+        }
+        else
+        {
+            for (size_t i = 0; i < classData->m_elements.size(); ++i)
+            {
+                const ClassElement& classElement = classData->m_elements[i];
+                // The ObjectStream matches elements to the first member with the same name
+                auto isSameName = [&classElement](const ClassElement& previousElement)
+                {
+                    return previousElement.m_nameCrc == classElement.m_nameCrc;
+                };
+                if (AZStd::none_of(classData->m_elements.begin(), classData->m_elements.begin() + i, isSameName))
+                {
+                    AddField(classElement.m_typeId, classElement.m_nameCrc, &classElement);
+                }
+            }
+        }
+
+        return plan;
+    }
+
+    void SerializeContext::ClearObjectStreamLoadPlans()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_objectStreamLoadPlanMutex);
+        m_objectStreamLoadPlans.clear();
+    }
+
     AZ::TypeId SerializeContext::GetUnderlyingTypeId(const TypeId& enumTypeId) const
     {
         auto enumToUnderlyingTypeIdIter = m_enumTypeIdToUnderlyingTypeIdMap.find(enumTypeId);
@@ -747,6 +858,7 @@ namespace AZ
             return;
         }
 
+        ClearObjectStreamLoadPlans();
         if (IsRemovingReflection())
         {
             RemoveGenericClassInfo(genericClassInfo);
@@ -889,6 +1001,8 @@ namespace AZ
         IRttiHelper* rttiHelper, CreateAnyFunc createAnyFunc,
         CreateAnyActionHandler createAnyActionHandlerFunc) -> ClassBuilder
     {
+        ClearObjectStreamLoadPlans();
+
         // Add any the deprecated type names to the deprecated type name to type id map
         auto AddDeprecatedNames = [this, &typeUuid = classTypeId](AZStd::string_view deprecatedName)
         {
@@ -2037,6 +2151,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        ClearObjectStreamLoadPlans();
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
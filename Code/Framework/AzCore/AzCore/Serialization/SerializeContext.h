@@ -28,6 +28,8 @@
 #include <AzCore/std/typetraits/is_base_of.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <AzCore/std/functional.h>
 
@@ -385,6 +387,35 @@ namespace AZ
         /// Find GenericClassData data based on the supplied class ID
         GenericClassInfo* FindGenericClassInfo(const Uuid& classId) const;
 
+        /**
+         * Lookups of the class data for the elements of a class, resolved ahead of time from the reflected class.
+         * The ObjectStream uses the plan while loading binary streams whose element version matches the reflected version
+         * of the class, which replaces the class data, generic class info and member lookups per loaded element.
+         * Elements which aren't part of the plan, such as pointers to derived types, use the regular lookups.
+         */
+        struct ObjectStreamLoadPlan
+        {
+            struct Field
+            {
+                Uuid m_typeId; ///< Type id the element is stored with in the stream.
+                Uuid m_specializedTypeId; ///< Type id of the element after the generic class info lookup.
+                const ClassData* m_classData = nullptr;
+                const ClassElement* m_classElement = nullptr; ///< Member the element is loaded into. Null for container elements.
+                u32 m_nameCrc = 0;
+                bool m_isAssetReference = false;
+            };
+
+            /// Returns the field for the element name and type or nullptr if the element isn't part of the plan.
+            /// The search starts at the cursor, which is moved past the found field, as elements are stored in reflection order.
+            const Field* FindField(u32 nameCrc, const Uuid& typeId, size_t& cursor) const;
+
+            AZStd::vector<Field> m_fields;
+        };
+
+        /// Returns the load plan for the class, which is created on first use and kept until the reflection changes.
+        /// Returns nullptr for classes without reflected elements.
+        const ObjectStreamLoadPlan* FindObjectStreamLoadPlan(const ClassData* classData) const;
+
         /// Creates an AZStd::any based on the provided class Uuid, or returns an empty AZStd::any if no class data is found or the class is virtual
         AZStd::any CreateAny(const Uuid& classId);
 
@@ -432,6 +463,10 @@ namespace AZ
         void RemoveClassData(ClassData* classData);
         /// Removes the GenericClassInfo from the GenericClassInfoMap
         void RemoveGenericClassInfo(GenericClassInfo* genericClassInfo);
+        /// Discards the ObjectStream load plans, which are invalidated by any change to the reflected classes
+        void ClearObjectStreamLoadPlans();
+        /// Resolves the class data of every element of the class
+        AZStd::unique_ptr<ObjectStreamLoadPlan> CreateObjectStreamLoadPlan(const ClassData* classData) const;
 
         /// Adds class data, including base class element data
         template<class T, class BaseClass>
@@ -681,6 +716,9 @@ namespace AZ
         class GlobalGenericClassInfo;
         AZStd::unordered_set<GlobalGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
 
+        mutable AZStd::shared_mutex m_objectStreamLoadPlanMutex;
+        mutable AZStd::unordered_map<const ClassData*, AZStd::unique_ptr<ObjectStreamLoadPlan>> m_objectStreamLoadPlans; ///< Load plans created on demand by FindObjectStreamLoadPlan
+
         friend AZCORE_API GlobalGenericClassInfo& GetGlobalSerializeContextModule();
     };
     AZ_TYPE_INFO_WITH_NAME_DECL_EXT_API(AZCORE_API, SerializeContext);
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define AZ_TASK_COROUTINES_SUPPORTED 1
+#endif
+
+#if defined(AZ_TASK_COROUTINES_SUPPORTED)
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/utils.h>
+
+#include <coroutine>
+
+// Coroutine support for the task system.
+//
+// A function returning an AZ::TaskCoroutine can co_await other task coroutines, task graphs (see AZ::SubmitAndAwait),
+// streamer reads (see AzCore/IO/Streamer/StreamerCoroutine.h) and AZ::TaskYield. While suspended the coroutine doesn't
+// occupy a thread, and it is always resumed on a worker of the TaskExecutor it was started on. This replaces chains of
+// completion callbacks and the TaskGraphEvent::Wait calls that would otherwise block a thread at the edges of a graph.
+//
+// Example:
+//
+//   AZ::TaskCoroutine<AZ::u64> LoadAndProcess(AZ::TaskGraph& processGraph)
+//   {
+//       auto result = co_await AZ::IO::ReadAsync(*AZ::Interface<AZ::IO::IStreamer>::Get(), path, buffer, size, size);
+//       co_await AZ::SubmitAndAwait(processGraph);
+//       co_return result.m_bytesRead;
+//   }
+//
+//   LoadAndProcess(graph).Start(); // or Wait() from a thread that isn't a task worker
+
+namespace AZ
+{
+    template<typename T = void>
+    class TaskCoroutine;
+
+    namespace Internal
+    {
+        inline constexpr TaskDescriptor TaskCoroutineResumeDescriptor{ "Resume task coroutine", "Coroutines" };
+
+        //! Resumes the coroutine on a worker of the executor.
+        inline void ResumeOnExecutor(TaskExecutor& executor, std::coroutine_handle<> handle)
+        {
+            executor.SubmitTask(TaskCoroutineResumeDescriptor, [handle]() { handle.resume(); });
+        }
+
+        class TaskCoroutinePromiseBase
+        {
+        public:
+            // Coroutine frames are allocated from the system allocator instead of the global operator new
+            static void* operator new(size_t size)
+            {
+                return AllocatorInstance<SystemAllocator>::Get().allocate(size, alignof(max_align_t));
+            }
+
+            static void operator delete(void* address)
+            {
+                AllocatorInstance<SystemAllocator>::Get().deallocate(address);
+            }
+
+            // Task coroutines are lazy, they only start running once they are awaited, started or waited on
+            std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            struct FinalAwaiter
+            {
+                bool await_ready() noexcept
+                {
+                    return false;
+                }
+
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    TaskCoroutinePromiseBase& promise = handle.promise();
+                    if (promise.m_continuation)
+                    {
+                        // Continue the awaiting coroutine on this thread without growing the stack
+                        return promise.m_continuation;
+                    }
+                    if (promise.m_detached)
+                    {
+                        handle.destroy();
+                    }
+                    else if (AZStd::binary_semaphore* completion = promise.m_completion; completion)
+                    {
+                        // The waiting thread destroys the frame as soon as the semaphore is released, so it can't be touched
+                        // past this point.
+                        completion->release();
+                    }
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() noexcept
+                {
+                }
+            };
+
+            FinalAwaiter final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() noexcept
+            {
+                AZ_Assert(false, "Unhandled exception in a task coroutine.");
+            }
+
+            std::coroutine_handle<> m_continuation;
+            AZStd::binary_semaphore* m_completion = nullptr;
+            bool m_detached = false;
+        };
+
+        template<typename T>
+        class TaskCoroutinePromise : public TaskCoroutinePromiseBase
+        {
+        public:
+            TaskCoroutine<T> get_return_object() noexcept;
+
+            template<typename U>
+            void return_value(U&& value)
+            {
+                m_value.emplace(AZStd::forward<U>(value));
+            }
+
+            T TakeValue()
+            {
+                return AZStd::move(*m_value);
+            }
+
+        private:
+            AZStd::optional<T> m_value;
+        };
+
+        template<>
+        class TaskCoroutinePromise<void> : public TaskCoroutinePromiseBase
+        {
+        public:
+            TaskCoroutine<void> get_return_object() noexcept;
+
+            void return_void() noexcept
+            {
+            }
+
+            void TakeValue()
+            {
+            }
+        };
+    } // namespace Internal
+
+    //! Return type of task coroutines. The coroutine doesn't run until it is co_awaited from another task coroutine, or
+    //! started with Start or Wait.
+    template<typename T>
+    class [[nodiscard]] TaskCoroutine final
+    {
+    public:
+        using promise_type = Internal::TaskCoroutinePromise<T>;
+        using HandleType = std::coroutine_handle<promise_type>;
+
+        TaskCoroutine() = default;
+
+        explicit TaskCoroutine(HandleType handle)
+            : m_handle{ handle }
+        {
+        }
+
+        TaskCoroutine(TaskCoroutine&& other) noexcept
+            : m_handle{ AZStd::exchange(other.m_handle, nullptr) }
+        {
+        }
+
+        TaskCoroutine& operator=(TaskCoroutine&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Destroy();
+                m_handle = AZStd::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        TaskCoroutine(const TaskCoroutine&) = delete;
+        TaskCoroutine& operator=(const TaskCoroutine&) = delete;
+
+        ~TaskCoroutine()
+        {
+            Destroy();
+        }
+
+        bool IsValid() const
+        {
+            return static_cast<bool>(m_handle);
+        }
+
+        //! Runs the coroutine on a worker of the executor without waiting for it. The coroutine frees itself when it completes,
+        //! and its return value is discarded.
+        void Start(TaskExecutor& executor = TaskExecutor::Instance()) &&
+        {
+            AZ_Assert(m_handle, "Starting an empty task coroutine.");
+            m_handle.promise().m_detached = true;
+            Internal::ResumeOnExecutor(executor, AZStd::exchange(m_handle, nullptr));
+        }
+
+        //! Runs the coroutine on a worker of the executor and blocks until it completes. Like TaskGraphEvent::Wait, this must
+        //! not be called from a task; co_await the coroutine instead.
+        T Wait(TaskExecutor& executor = TaskExecutor::Instance()) &&
+        {
+            AZ_Assert(m_handle, "Waiting on an empty task coroutine.");
+            AZ_Assert(!executor.IsWorkerThread(), "Waiting on a task coroutine from inside a task is unsupported.");
+            AZStd::binary_semaphore completion;
+            m_handle.promise().m_completion = &completion;
+            Internal::ResumeOnExecutor(executor, m_handle);
+            completion.acquire();
+            return m_handle.promise().TakeValue();
+        }
+
+        //! Awaiting a task coroutine runs it on the awaiting thread until its first suspension, and the awaiting coroutine is
+        //! continued on whichever worker the awaited coroutine completes on.
+        auto operator co_await() && noexcept
+        {
+            struct Awaiter
+            {
+                bool await_ready() noexcept
+                {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+                {
+                    m_handle.promise().m_continuation = awaiting;
+                    return m_handle;
+                }
+
+                T await_resume()
+                {
+                    return m_handle.promise().TakeValue();
+                }
+
+                HandleType m_handle;
+            };
+            AZ_Assert(m_handle, "Awaiting an empty task coroutine.");
+            return Awaiter{ m_handle };
+        }
+
+    private:
+        void Destroy()
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+                m_handle = nullptr;
+            }
+        }
+
+        HandleType m_handle;
+    };
+
+    //! Awaitable that suspends the coroutine and continues it on a worker of the executor. Awaiting it moves a coroutine onto
+    //! the task threads, and gives queued tasks a chance to run between the iterations of a long running coroutine.
+    class TaskYieldAwaitable final
+    {
+    public:
+        explicit TaskYieldAwaitable(TaskExecutor& executor)
+            : m_executor{ executor }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            Internal::ResumeOnExecutor(m_executor, handle);
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        TaskExecutor& m_executor;
+    };
+
+    // Not named Yield since windows.h defines a Yield() macro.
+    inline TaskYieldAwaitable TaskYield(TaskExecutor& executor = TaskExecutor::Instance())
+    {
+        return TaskYieldAwaitable{ executor };
+    }
+
+    //! Awaitable that submits a task graph and continues the coroutine on a worker once the graph has completed.
+    class TaskGraphAwaitable final
+    {
+    public:
+        TaskGraphAwaitable(TaskGraph& graph, TaskExecutor& executor)
+            : m_graph{ graph }
+            , m_executor{ executor }
+            , m_event{ "TaskGraphAwaitable", &TaskGraphAwaitable::OnGraphCompleted, this }
+        {
+        }
+
+        TaskGraphAwaitable(const TaskGraphAwaitable&) = delete;
+        TaskGraphAwaitable& operator=(const TaskGraphAwaitable&) = delete;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_handle = handle;
+            // The graph can complete on another thread before SubmitOnExecutor returns, so this must be the last use of this.
+            m_graph.SubmitOnExecutor(m_executor, &m_event);
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        static void OnGraphCompleted(void* userData)
+        {
+            auto* awaitable = static_cast<TaskGraphAwaitable*>(userData);
+            // Resume in a separate task rather than inline, since the graph is still releasing its tasks on this thread.
+            Internal::ResumeOnExecutor(awaitable->m_executor, awaitable->m_handle);
+        }
+
+        TaskGraph& m_graph;
+        TaskExecutor& m_executor;
+        TaskGraphEvent m_event;
+        std::coroutine_handle<> m_handle;
+    };
+
+    //! Submits the graph on the executor. co_await the result to continue the coroutine once the graph has completed.
+    inline TaskGraphAwaitable SubmitAndAwait(TaskGraph& graph, TaskExecutor& executor = TaskExecutor::Instance())
+    {
+        return TaskGraphAwaitable{ graph, executor };
+    }
+
+    namespace Internal
+    {
+        template<typename T>
+        TaskCoroutine<T> TaskCoroutinePromise<T>::get_return_object() noexcept
+        {
+            return TaskCoroutine<T>{ std::coroutine_handle<TaskCoroutinePromise<T>>::from_promise(*this) };
+        }
+
+        inline TaskCoroutine<void> TaskCoroutinePromise<void>::get_return_object() noexcept
+        {
+            return TaskCoroutine<void>{ std::coroutine_handle<TaskCoroutinePromise<void>>::from_promise(*this) };
+        }
+    } // namespace Internal
+} // namespace AZ
+
+#endif // defined(AZ_TASK_COROUTINES_SUPPORTED)
@@ -18,6 +18,7 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/Module/Environment.h>
+#include <AzCore/Threading/ThreadUtils.h>
 
 #include <random>
 
@@ -202,17 +203,16 @@ namespace AZ
         public:
             static thread_local TaskWorker* t_worker;
 
-            void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
+            void Spawn(::AZ::TaskExecutor& executor, uint32_t id, uint32_t domain, AZStd::semaphore& initSemaphore, int cpuId)
             {
                 m_executor = &executor;
+                m_index = id;
+                m_domain = domain;
 
                 m_threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
                 desc.m_name = m_threadName.c_str();
-                if (affinitize)
-                {
-                    desc.m_cpuId = 1 << id;
-                }
+                desc.m_cpuId = cpuId;
                 m_active.store(true, AZStd::memory_order_release);
 
                 m_thread = AZStd::thread{ desc,
@@ -254,6 +254,12 @@ namespace AZ
                 m_semaphore.release();
             }
 
+            // Used by other workers to steal queued work
+            Task* TryDequeue()
+            {
+                return m_queue.TryDequeue();
+            }
+
             const char* GetThreadName() {return m_threadName.c_str();}
 
         private:
@@ -268,10 +274,20 @@ namespace AZ
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
+                    Task* task = NextTask();
                     while (task)
                     {
                         task->Invoke();
+
+                        // Tasks submitted through TaskExecutor::SubmitTask have no graph and are owned by the worker
+                        if (task->m_graph == nullptr)
+                        {
+                            delete task;
+                            m_executor->ReleaseGraph();
+                            task = NextTask();
+                            continue;
+                        }
+
                         // Decrement counts for all task successors
                         for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
                         {
@@ -288,11 +304,21 @@ namespace AZ
                             m_executor->ReleaseGraph();
                         }
 
-                        task = m_queue.TryDequeue();
+                        task = NextTask();
                     }
                 }
             }
 
+            Task* NextTask()
+            {
+                Task* task = m_queue.TryDequeue();
+                if (!task && m_executor->m_topologyAware)
+                {
+                    task = m_executor->StealTask(*this);
+                }
+                return task;
+            }
+
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
@@ -301,6 +327,10 @@ namespace AZ
             ::AZ::TaskExecutor* m_executor;
             TaskQueue m_queue;
             AZStd::string m_threadName;
+            uint32_t m_index = 0;
+            uint32_t m_domain = 0;
+            // Round robin counter for tasks submitted from this worker to its own domain. Only accessed by the worker thread.
+            uint32_t m_localSubmission = 0;
             friend class ::AZ::TaskExecutor;
         };
 
@@ -371,19 +401,29 @@ namespace AZ
     }
 
     TaskExecutor::TaskExecutor(uint32_t threadCount)
+        : TaskExecutor(TaskExecutorDesc{ threadCount })
+    {
+    }
+
+    TaskExecutor::TaskExecutor(const TaskExecutorDesc& desc)
         : m_eventTracker(this)
     {
-        // TODO: Configure thread count + affinity based on configuration
-        m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
+        m_threadCount = desc.m_threadCount == 0 ? AZStd::thread::hardware_concurrency() : desc.m_threadCount;
+
+        AZStd::vector<int> workerCpus;
+        AssignWorkerDomains(desc, workerCpus);
 
         m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
 
         AZStd::semaphore initSemaphore;
 
-        for (uint32_t i = 0; i != m_threadCount; ++i)
+        for (uint32_t domain = 0; domain != GetWorkerDomainCount(); ++domain)
         {
-            new (m_workers + i) Internal::TaskWorker{};
-            m_workers[i].Spawn(*this, i, initSemaphore, false);
+            for (uint32_t i = m_domainFirstWorker[domain]; i != m_domainFirstWorker[domain + 1]; ++i)
+            {
+                new (m_workers + i) Internal::TaskWorker{};
+                m_workers[i].Spawn(*this, i, domain, initSemaphore, workerCpus[i]);
+            }
         }
 
         for (size_t i = 0; i != m_threadCount; ++i)
@@ -394,6 +434,12 @@ namespace AZ
 
     TaskExecutor::~TaskExecutor()
     {
+        // Let outstanding graphs and single tasks run to completion, tasks still queued when the workers stop would be leaked
+        while (m_graphsRemaining.load() != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+
         for (size_t i = 0; i != m_threadCount; ++i)
         {
             m_workers[i].Join();
@@ -403,6 +449,86 @@ namespace AZ
         azfree(m_workers);
     }
 
+    void TaskExecutor::AssignWorkerDomains(const TaskExecutorDesc& desc, AZStd::vector<int>& workerCpus)
+    {
+        // By default all workers share a single domain and are free to run on any CPU
+        workerCpus.assign(m_threadCount, AZStd::thread_desc{}.m_cpuId);
+        m_domainFirstWorker = { 0, m_threadCount };
+        m_topologyAware = false;
+
+        if (!desc.m_topologyAware)
+        {
+            return;
+        }
+
+        const AZStd::vector<Threading::CpuDomain> cpuDomains = Threading::QueryCpuDomains();
+        size_t cpuCount = 0;
+        for (const Threading::CpuDomain& cpuDomain : cpuDomains)
+        {
+            cpuCount += cpuDomain.m_logicalCpus.size();
+        }
+        if (cpuCount == 0)
+        {
+            AZ_Warning("TaskExecutor", false, "The CPU topology isn't available on this platform, topology awareness is disabled.");
+            return;
+        }
+
+        // Split the workers over the domains in proportion to the number of CPUs of each domain. Domains that don't
+        // receive any worker are dropped.
+        m_domainFirstWorker.clear();
+        size_t cpusBefore = 0;
+        for (const Threading::CpuDomain& cpuDomain : cpuDomains)
+        {
+            const uint32_t firstWorker = static_cast<uint32_t>(cpusBefore * m_threadCount / cpuCount);
+            cpusBefore += cpuDomain.m_logicalCpus.size();
+            const uint32_t endWorker = static_cast<uint32_t>(cpusBefore * m_threadCount / cpuCount);
+            if (endWorker == firstWorker)
+            {
+                continue;
+            }
+
+            m_domainFirstWorker.push_back(firstWorker);
+            if (desc.m_pinWorkerThreads)
+            {
+                // The topology is only queried on platforms where thread_desc::m_cpuId is a logical CPU index
+                for (uint32_t worker = firstWorker; worker != endWorker; ++worker)
+                {
+                    const size_t cpuIndex = (worker - firstWorker) % cpuDomain.m_logicalCpus.size();
+                    workerCpus[worker] = static_cast<int>(cpuDomain.m_logicalCpus[cpuIndex]);
+                }
+            }
+        }
+        m_domainFirstWorker.push_back(m_threadCount);
+        m_topologyAware = true;
+    }
+
+    Internal::Task* TaskExecutor::StealTask(Internal::TaskWorker& thief)
+    {
+        // Domains are ordered by NUMA node, so visiting them in order starting from the thief's own domain tries the
+        // domains sharing its node before the remote ones.
+        const uint32_t domainCount = GetWorkerDomainCount();
+        for (uint32_t domainOffset = 0; domainOffset != domainCount; ++domainOffset)
+        {
+            const uint32_t domain = (thief.m_domain + domainOffset) % domainCount;
+            const uint32_t firstWorker = m_domainFirstWorker[domain];
+            const uint32_t workerCount = m_domainFirstWorker[domain + 1] - firstWorker;
+            for (uint32_t workerOffset = 1; workerOffset <= workerCount; ++workerOffset)
+            {
+                const uint32_t victim = firstWorker + (thief.m_index + workerOffset) % workerCount;
+                if (victim == thief.m_index)
+                {
+                    continue;
+                }
+
+                if (Internal::Task* task = m_workers[victim].TryDequeue())
+                {
+                    return task;
+                }
+            }
+        }
+        return nullptr;
+    }
+
     Internal::TaskWorker* TaskExecutor::GetTaskWorker()
     {
         if (Internal::TaskWorker::t_worker && Internal::TaskWorker::t_worker->m_executor == this)
@@ -451,6 +577,25 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
+        if (m_topologyAware)
+        {
+            // Tasks unlocked by a worker are kept in its domain, since their inputs are likely still in the domain's cache
+            if (Internal::TaskWorker* worker = GetTaskWorker(); worker)
+            {
+                const uint32_t firstWorker = m_domainFirstWorker[worker->m_domain];
+                const uint32_t workerCount = m_domainFirstWorker[worker->m_domain + 1] - firstWorker;
+                for (uint32_t attempt = 0; attempt != workerCount; ++attempt)
+                {
+                    const uint32_t nextWorker = firstWorker + (++worker->m_localSubmission % workerCount);
+                    if (m_workers[nextWorker].Enabled())
+                    {
+                        m_workers[nextWorker].Enqueue(&task);
+                        return;
+                    }
+                }
+            }
+        }
+
         // TODO: Something more sophisticated is likely needed here.
         // First, we are completely ignoring affinity.
         // Second, some heuristics on core availability will help distribute work more effectively
@@ -116,6 +116,20 @@ namespace AZ
         class TaskWorker;
     } // namespace Internal
 
+    struct TaskExecutorDesc
+    {
+        // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
+        uint32_t m_threadCount = 0;
+
+        // Groups the workers into domains of CPUs sharing a NUMA node and last level cache (see AZ::Threading::QueryCpuDomains).
+        // Tasks submitted from a worker are kept in its domain, and workers that run out of work steal from workers of
+        // their own domain before stealing from remote domains. Ignored on platforms where the CPU topology isn't available.
+        bool m_topologyAware = false;
+
+        // Pins each worker to a logical CPU of its domain. Only used when m_topologyAware is set.
+        bool m_pinWorkerThreads = false;
+    };
+
     class AZCORE_API TaskExecutor final
     {
     public:
@@ -128,14 +142,36 @@ namespace AZ
 
         // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
         explicit TaskExecutor(uint32_t threadCount = 0);
+        explicit TaskExecutor(const TaskExecutorDesc& desc);
         ~TaskExecutor();
 
+        uint32_t GetWorkerCount() const { return m_threadCount; }
+
+        // Workers are grouped in contiguous ranges per domain. Without topology awareness all workers share a single domain.
+        uint32_t GetWorkerDomainCount() const { return static_cast<uint32_t>(m_domainFirstWorker.size() - 1); }
+        uint32_t GetWorkerDomainFirstWorker(uint32_t domain) const { return m_domainFirstWorker[domain]; }
+        uint32_t GetWorkerDomainWorkerCount(uint32_t domain) const { return m_domainFirstWorker[domain + 1] - m_domainFirstWorker[domain]; }
+        bool IsTopologyAware() const { return m_topologyAware; }
+
+        // Returns true when called from one of this executor's worker threads
+        bool IsWorkerThread() { return GetTaskWorker() != nullptr; }
+
         // Submit a task graph for execution. Waitable task graphs cannot enqueue work on the task thread
         // that is currently active
         void Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event);
 
         void Submit(Internal::Task& task);
 
+        // Submit a single task that isn't part of a task graph. The task is deleted once it has run, so this is
+        // cheaper than building a detached TaskGraph for one-off work such as resuming a suspended coroutine.
+        template<typename Lambda>
+        void SubmitTask(const TaskDescriptor& descriptor, Lambda&& lambda)
+        {
+            // Single tasks are tracked like graphs, so the executor waits for them before shutting down
+            ++m_graphsRemaining;
+            Submit(*aznew Internal::Task(descriptor, AZStd::forward<Lambda>(lambda)));
+        }
+
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
     private:
@@ -147,10 +183,20 @@ namespace AZ
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
+        // Assigns the workers to CPU domains, filling m_domainFirstWorker and the CPU each worker is pinned to (-1 for none)
+        void AssignWorkerDomains(const TaskExecutorDesc& desc, AZStd::vector<int>& workerCpus);
+
+        // Dequeues a task from another worker, preferring the workers of the thief's own domain
+        Internal::Task* StealTask(Internal::TaskWorker& thief);
+
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
+        bool m_topologyAware = false;
+        // Index of the first worker of each domain, followed by the total worker count
+        AZStd::vector<uint32_t> m_domainFirstWorker;
         AZStd::atomic<uint32_t> m_lastSubmission;
-        AZStd::atomic<uint64_t> m_graphsRemaining;
+        // Number of submitted graphs and single tasks that haven't completed yet
+        AZStd::atomic<uint64_t> m_graphsRemaining{ 0 };
 
         // Implement basic CompiledTaskGraph event breadcrumbs to help debug
         // https://github.com/o3de/o3de/issues/12015
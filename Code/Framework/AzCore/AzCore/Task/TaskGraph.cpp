@@ -55,7 +55,14 @@ namespace AZ
             // validate no one incremented the wait count and mark signalling state
             if (m_waitCount.compare_exchange_strong(expectedValue, -1))
             {
+                // A waiter may destroy the event as soon as the semaphore is released
+                SignalCallback callback = m_callback;
+                void* callbackUserData = m_callbackUserData;
                 m_semaphore.release();
+                if (callback)
+                {
+                    callback(callbackUserData);
+                }
             }
         }
     }
@@ -108,13 +115,19 @@ namespace AZ
 
     void TaskGraph::Submit(TaskGraphEvent* waitEvent)
     {
+        SubmitOnExecutor(TaskExecutor::Instance(), waitEvent);
+    }
+
+    void TaskGraph::SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent)
+    {
+        Internal::CompiledTaskGraphTracker& eventTracker = executor.GetEventTracker();
+
         // If this is a new empty task graph (and not a retained taskgraph that was previously run),
         // return immediately
         if (IsEmpty() && !m_compiledTaskGraph)
         {
             if (waitEvent)
             {
-                Internal::CompiledTaskGraphTracker& eventTracker = TaskExecutor::Instance().GetEventTracker();
                 // TaskGraphEvent asserts if it has a wait count of 0, increment it before signaling.
                 waitEvent->IncWaitCount();
                 eventTracker.WriteEventInfo(nullptr, Internal::CTGEvent::Signalled, "TaskGraph::Submit empty graph");
@@ -122,29 +135,24 @@ namespace AZ
             }
             return;
         }
-        SubmitOnExecutor(TaskExecutor::Instance(), waitEvent);
-    }
 
-    void TaskGraph::SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent)
-    {
-        Internal::CompiledTaskGraphTracker& eventTracker = executor.GetEventTracker();
         if (!m_compiledTaskGraph)
         {
             m_compiledTaskGraph = aznew CompiledTaskGraph(AZStd::move(m_tasks), m_links, m_linkCount, m_retained ? this : nullptr, m_label);
             eventTracker.WriteEventInfo(m_compiledTaskGraph, Internal::CTGEvent::Allocated, "SubmitOnExecutor");
         }
 
-        m_compiledTaskGraph->m_waitEvent = waitEvent;
-        uint32_t taskCount = aznumeric_cast<uint32_t>(m_compiledTaskGraph->m_tasks.size());
-        m_compiledTaskGraph->m_remaining = taskCount + (m_retained ? 1 : 0);
+        CompiledTaskGraph* compiledTaskGraph = m_compiledTaskGraph;
+        compiledTaskGraph->m_waitEvent = waitEvent;
+        uint32_t taskCount = aznumeric_cast<uint32_t>(compiledTaskGraph->m_tasks.size());
+        compiledTaskGraph->m_remaining = taskCount + (m_retained ? 1 : 0);
         for (uint32_t i = 0; i != taskCount; ++i)
         {
-            m_compiledTaskGraph->m_tasks[i].Init();
+            compiledTaskGraph->m_tasks[i].Init();
         }
 
-        eventTracker.WriteEventInfo(m_compiledTaskGraph, Internal::CTGEvent::Submitted, "SubmitOnExecutor");
-        executor.Submit(*m_compiledTaskGraph, waitEvent);
-
+        // Finish all bookkeeping on this graph before handing the compiled graph to the executor. The graph can complete and signal
+        // the wait event on another thread before Submit returns, and whoever waits on that event may then destroy this graph.
         if (m_retained)
         {
             m_submitted = true;
@@ -154,5 +162,8 @@ namespace AZ
             m_compiledTaskGraph = nullptr;
             Reset();
         }
+
+        eventTracker.WriteEventInfo(compiledTaskGraph, Internal::CTGEvent::Submitted, "SubmitOnExecutor");
+        executor.Submit(*compiledTaskGraph, waitEvent);
     }
 }
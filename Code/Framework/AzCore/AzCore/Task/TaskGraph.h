@@ -76,6 +76,12 @@ namespace AZ
     public:
         // ! The supplied string label is expected to be a string literal or otherwise outlive the lifetime of this TG event.
         explicit TaskGraphEvent(const char* label);
+
+        // The callback is invoked with the user data on the thread that signals the event, after the event is signaled.
+        // It lets code running inside a task be notified of completion without blocking in Wait, and must not block itself.
+        using SignalCallback = void (*)(void* userData);
+        TaskGraphEvent(const char* label, SignalCallback callback, void* userData);
+
         bool IsSignaled();
         void Wait();
 
@@ -90,6 +96,8 @@ namespace AZ
         AZStd::binary_semaphore m_semaphore;
         AZStd::atomic_int       m_waitCount = 0;
         TaskExecutor*           m_executor = nullptr;
+        SignalCallback          m_callback = nullptr;
+        void*                   m_callbackUserData = nullptr;
         [[maybe_unused]] const char* m_label = nullptr;
     };
 
@@ -33,6 +33,13 @@ namespace AZ
     {
     }
 
+    inline TaskGraphEvent::TaskGraphEvent(const char* label, SignalCallback callback, void* userData)
+        : m_callback{ callback }
+        , m_callbackUserData{ userData }
+        , m_label{ label }
+    {
+    }
+
     inline bool TaskGraphEvent::IsSignaled()
     {
         return m_semaphore.try_acquire_for(AZStd::chrono::milliseconds{ 0 });
@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Threading/ThreadUtils.h>
 
  // PERFORMANCE NOTE & TODO
@@ -32,6 +33,27 @@ static constexpr AZ::Crc32 TaskExecutorServiceCrc = AZ_CRC_CE("TaskExecutorServi
 
 namespace AZ
 {
+    // Settings registry keys used to configure the task executor
+    static constexpr AZStd::string_view TaskGraphTopologyAwareKey = "/O3DE/TaskGraph/TopologyAware";
+    static constexpr AZStd::string_view TaskGraphPinWorkerThreadsKey = "/O3DE/TaskGraph/PinWorkerThreads";
+    // Settings registry key under which the worker grouping chosen by the executor is published
+    static constexpr AZStd::string_view TaskGraphWorkerDomainsKey = "/O3DE/TaskGraph/Runtime/WorkerDomains";
+
+    static void PublishWorkerDomains(SettingsRegistryInterface& settingsRegistry, const TaskExecutor& executor)
+    {
+        settingsRegistry.Remove(TaskGraphWorkerDomainsKey);
+        for (uint32_t domain = 0; domain != executor.GetWorkerDomainCount(); ++domain)
+        {
+            using FixedValueString = SettingsRegistryInterface::FixedValueString;
+            settingsRegistry.Set(
+                FixedValueString::format("%.*s/%u/FirstWorker", AZ_STRING_ARG(TaskGraphWorkerDomainsKey), domain),
+                static_cast<AZ::u64>(executor.GetWorkerDomainFirstWorker(domain)));
+            settingsRegistry.Set(
+                FixedValueString::format("%.*s/%u/WorkerCount", AZ_STRING_ARG(TaskGraphWorkerDomainsKey), domain),
+                static_cast<AZ::u64>(executor.GetWorkerDomainWorkerCount(domain)));
+        }
+    }
+
     void TaskGraphSystemComponent::Activate()
     {
         AZ_Assert(m_taskExecutor == nullptr, "Error multiple activation of the TaskGraphSystemComponent");
@@ -54,9 +76,23 @@ namespace AZ
                 cl_taskGraphThreadsConcurrencyRatio, cl_taskGraphThreadsMinNumber, cl_taskGraphThreadsMaxNumber,
                 cl_taskGraphThreadsNumReserved);
         #endif // (AZ_TRAIT_THREAD_NUM_TASK_GRAPH_WORKER_THREADS)
+            TaskExecutorDesc executorDesc;
+            executorDesc.m_threadCount = numberOfWorkerThreads;
+            auto settingsRegistry = SettingsRegistry::Get();
+            if (settingsRegistry)
+            {
+                settingsRegistry->Get(executorDesc.m_topologyAware, TaskGraphTopologyAwareKey);
+                settingsRegistry->Get(executorDesc.m_pinWorkerThreads, TaskGraphPinWorkerThreadsKey);
+            }
+
             Interface<TaskGraphActiveInterface>::Register(this); // small window that another thread can try to use taskgraph between this line and the set instance.
-            m_taskExecutor = aznew TaskExecutor(numberOfWorkerThreads);
+            m_taskExecutor = aznew TaskExecutor(executorDesc);
             TaskExecutor::SetInstance(m_taskExecutor);
+
+            if (settingsRegistry)
+            {
+                PublishWorkerDomains(*settingsRegistry, *m_taskExecutor);
+            }
         }
     }
 
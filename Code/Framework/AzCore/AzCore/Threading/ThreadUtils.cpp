@@ -9,9 +9,30 @@
 #include <AzCore/Threading/ThreadUtils.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/StringFunc/StringFunc.h>
 
 namespace AZ::Threading
 {
+    static bool ParseCpuIndex(AZStd::string_view text, uint32_t& index)
+    {
+        if (text.empty())
+        {
+            return false;
+        }
+
+        index = 0;
+        for (char digit : text)
+        {
+            if (digit < '0' || digit > '9')
+            {
+                return false;
+            }
+            index = index * 10 + static_cast<uint32_t>(digit - '0');
+        }
+        return true;
+    }
+
     uint32_t CalcNumWorkerThreads(float workerThreadsRatio, uint32_t minNumWorkerThreads, uint32_t maxNumWorkerThreads, uint32_t reservedNumThreads)
     {
         const uint32_t maxHardwareThreads = AZStd::thread::hardware_concurrency();
@@ -22,4 +43,48 @@ namespace AZ::Threading
         const uint32_t numWorkerThreads = AZ::GetMax<uint32_t>(minNumWorkerThreads, requestedWorkerThreadsRounded);
         return numWorkerThreads;
     }
+
+    AZStd::vector<uint32_t> ParseCpuList(AZStd::string_view cpuList)
+    {
+        AZStd::vector<uint32_t> cpus;
+        bool isValid = true;
+        AZ::StringFunc::TokenizeVisitor(
+            cpuList,
+            [&cpus, &isValid](AZStd::string_view range)
+            {
+                range = AZ::StringFunc::StripEnds(range, " \t\n");
+                if (range.empty() || !isValid)
+                {
+                    return;
+                }
+
+                AZStd::string_view first = range;
+                AZStd::string_view last = range;
+                if (const size_t separator = range.find('-'); separator != AZStd::string_view::npos)
+                {
+                    first = range.substr(0, separator);
+                    last = range.substr(separator + 1);
+                }
+
+                uint32_t firstCpu = 0;
+                uint32_t lastCpu = 0;
+                if (!ParseCpuIndex(first, firstCpu) || !ParseCpuIndex(last, lastCpu) || lastCpu < firstCpu)
+                {
+                    isValid = false;
+                    return;
+                }
+
+                for (uint32_t cpu = firstCpu; cpu <= lastCpu; ++cpu)
+                {
+                    cpus.push_back(cpu);
+                }
+            },
+            ',');
+
+        if (!isValid)
+        {
+            cpus.clear();
+        }
+        return cpus;
+    }
 };
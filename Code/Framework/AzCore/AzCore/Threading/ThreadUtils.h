@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
 
 namespace AZ::Threading
 {
@@ -20,4 +22,23 @@ namespace AZ::Threading
     //! @param reservedNumThreads number of hardware threads to reserve for O3DE system threads. Value clamped to num_hardware_threads.
     //! @return number of worker threads for the calling system to allocate
     AZCORE_API uint32_t CalcNumWorkerThreads(float workerThreadsRatio, uint32_t minNumWorkerThreads, uint32_t maxNumWorkerThreads, uint32_t reservedNumThreads);
+
+    //! A group of logical CPUs that share a NUMA node and a last level cache.
+    //! Threads running on CPUs of the same domain can exchange data without crossing a socket or cache boundary.
+    struct CpuDomain
+    {
+        //! NUMA node the CPUs of this domain belong to.
+        uint32_t m_numaNode = 0;
+        //! Logical CPU indices of this domain, in ascending order.
+        AZStd::vector<uint32_t> m_logicalCpus;
+    };
+
+    //! Queries the CPU domains of the logical CPUs the process is allowed to run on.
+    //! Domains are ordered by NUMA node, so neighboring domains are closer to each other than distant ones.
+    //! @return the list of domains, or an empty list if the topology can't be queried on this platform.
+    AZCORE_API AZStd::vector<CpuDomain> QueryCpuDomains();
+
+    //! Parses a CPU list in the format used by Linux sysfs, for instance "0-3,8,10-11".
+    //! @return the CPU indices in the order they appear in the list, or an empty list if the list is malformed.
+    AZCORE_API AZStd::vector<uint32_t> ParseCpuList(AZStd::string_view cpuList);
 };
@@ -132,6 +132,7 @@ set(FILES
     EBus/BusImpl.h
     EBus/EBus.h
     EBus/EBusEnvironment.cpp
+    EBus/EBusMultiProducerQueueTraits.h
     EBus/EBusSharedDispatchTraits.h
     EBus/Environment.h
     EBus/Event.h
@@ -180,6 +181,8 @@ set(FILES
     IO/IStreamerTypes.cpp
     IO/GenericStreams.cpp
     IO/GenericStreams.h
+    IO/MappedFile.cpp
+    IO/MappedFile.h
     IO/OpenMode.h
     IO/OpenMode.cpp
     IO/Path/Path.cpp
@@ -222,6 +225,7 @@ set(FILES
     IO/Streamer/StreamerContext.cpp
     IO/Streamer/StreamerComponent.cpp
     IO/Streamer/StreamerComponent.h
+    IO/Streamer/StreamerCoroutine.h
     IO/Streamer/StreamStackEntry.h
     IO/Streamer/StreamStackEntry.cpp
     IPC/SharedMemory.cpp
@@ -373,6 +377,9 @@ set(FILES
     Math/ShapeIntersection.cpp
     Math/ShapeIntersection.h
     Math/ShapeIntersection.inl
+    Math/SoaMath.cpp
+    Math/SoaMath.h
+    Math/SoaMath.inl
     Math/SimdMath.h
     Math/SimdMathVec1.h
     Math/SimdMathVec2.h
@@ -429,6 +436,8 @@ set(FILES
     Memory/ChildAllocatorSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
     Memory/IAllocator.h
@@ -623,6 +632,8 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamDeserializer.h
+    Serialization/Json/JsonStreamDeserializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
@@ -707,6 +718,7 @@ set(FILES
     Task/Internal/Task.inl
     Task/Internal/Task.h
     Task/Internal/TaskConfig.h
+    Task/TaskCoroutine.h
     Task/TaskDescriptor.h
     Task/TaskExecutor.cpp
     Task/TaskExecutor.h
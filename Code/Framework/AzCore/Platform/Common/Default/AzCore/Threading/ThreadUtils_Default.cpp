@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Threading/ThreadUtils.h>
+
+namespace AZ::Threading
+{
+    AZStd::vector<CpuDomain> QueryCpuDomains()
+    {
+        // The CPU topology isn't queried on this platform.
+        return {};
+    }
+} // namespace AZ::Threading
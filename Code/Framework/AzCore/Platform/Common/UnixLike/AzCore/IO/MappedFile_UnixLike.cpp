@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO::Platform
+{
+    const AZStd::byte* MapFile(const char* filePath, AZ::u64& size)
+    {
+        int fileDescriptor = ::open(filePath, O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0)
+        {
+            return nullptr;
+        }
+
+        struct stat fileStat;
+        void* data = MAP_FAILED;
+        if (::fstat(fileDescriptor, &fileStat) == 0 && fileStat.st_size > 0)
+        {
+            size = static_cast<AZ::u64>(fileStat.st_size);
+            data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        }
+        // The mapping keeps a reference to the file, so the descriptor is no longer needed.
+        ::close(fileDescriptor);
+
+        return data != MAP_FAILED ? reinterpret_cast<const AZStd::byte*>(data) : nullptr;
+    }
+
+    void UnmapFile(const AZStd::byte* data, AZ::u64 size)
+    {
+        ::munmap(const_cast<AZStd::byte*>(data), size);
+    }
+} // namespace AZ::IO::Platform
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO::Platform
+{
+    const AZStd::byte* MapFile(const char* filePath, AZ::u64& size)
+    {
+        AZStd::fixed_wstring<MaxPathLength> filePathW;
+        if (!AZStd::to_wstring(filePathW, filePath))
+        {
+            return nullptr;
+        }
+
+        HANDLE fileHandle = ::CreateFileW(filePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+
+        void* data = nullptr;
+        LARGE_INTEGER fileSize;
+        if (::GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0)
+        {
+            HANDLE mappingHandle = ::CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mappingHandle != nullptr)
+            {
+                data = ::MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+                // The view keeps the mapping object alive, so the handle can be closed right away.
+                ::CloseHandle(mappingHandle);
+            }
+            size = static_cast<AZ::u64>(fileSize.QuadPart);
+        }
+        ::CloseHandle(fileHandle);
+
+        return reinterpret_cast<const AZStd::byte*>(data);
+    }
+
+    void UnmapFile(const AZStd::byte* data, [[maybe_unused]] AZ::u64 size)
+    {
+        ::UnmapViewOfFile(data);
+    }
+} // namespace AZ::IO::Platform
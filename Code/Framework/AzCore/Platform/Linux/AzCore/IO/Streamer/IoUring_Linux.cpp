@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/std/algorithm.h>
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// The system call numbers are shared by all architectures, but older C libraries don't define them.
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register 427
+#endif
+
+namespace AZ::IO
+{
+    namespace IoUringInternal
+    {
+        static int Setup(u32 entries, io_uring_params* params)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        static int Enter(int ringFd, u32 toSubmit, u32 minComplete, u32 flags)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        static int Register(int ringFd, u32 opcode, const void* arg, u32 argCount)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_register, ringFd, opcode, arg, argCount));
+        }
+
+        static bool ProbeSupport()
+        {
+            io_uring_params params{};
+            int ringFd = Setup(2, &params);
+            if (ringFd < 0)
+            {
+                // Typically ENOSYS on kernels older than 5.1, or EPERM when blocked by a seccomp filter or sysctl.
+                return false;
+            }
+
+            constexpr u32 MaxProbeOps = 256;
+            alignas(io_uring_probe) u8 probeBuffer[sizeof(io_uring_probe) + MaxProbeOps * sizeof(io_uring_probe_op)]{};
+            auto probe = reinterpret_cast<io_uring_probe*>(probeBuffer);
+            bool isSupported = (params.features & IORING_FEAT_NODROP) != 0 &&
+                Register(ringFd, IORING_REGISTER_PROBE, probe, MaxProbeOps) == 0;
+            if (isSupported)
+            {
+                for (u8 opcode : { IORING_OP_READ, IORING_OP_READ_FIXED, IORING_OP_ASYNC_CANCEL })
+                {
+                    isSupported = isSupported && opcode <= probe->last_op && (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED) != 0;
+                }
+            }
+            ::close(ringFd);
+            return isSupported;
+        }
+    } // namespace IoUringInternal
+
+    IoUring::~IoUring()
+    {
+        Shutdown();
+    }
+
+    bool IoUring::IsSupported()
+    {
+        static const bool isSupported = IoUringInternal::ProbeSupport();
+        return isSupported;
+    }
+
+    bool IoUring::Initialize(u32 queueDepth)
+    {
+        AZ_Assert(!IsInitialized(), "IoUring has already been initialized.");
+
+        io_uring_params params{};
+        m_ringFd = IoUringInternal::Setup(queueDepth, &params);
+        if (m_ringFd < 0)
+        {
+            m_ringFd = -1;
+            return false;
+        }
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = m_completionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+        }
+
+        void* submissionRing =
+            ::mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+        if (submissionRing == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_submissionRing = submissionRing;
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            void* completionRing =
+                ::mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+            if (completionRing == MAP_FAILED)
+            {
+                Shutdown();
+                return false;
+            }
+            m_completionRing = completionRing;
+        }
+
+        void* submissionEntries = ::mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+        m_submissionEntryCount = params.sq_entries;
+
+        u8* submissionRingBytes = reinterpret_cast<u8*>(m_submissionRing);
+        m_submissionHead = reinterpret_cast<u32*>(submissionRingBytes + params.sq_off.head);
+        m_submissionTail = reinterpret_cast<u32*>(submissionRingBytes + params.sq_off.tail);
+        m_submissionMask = *reinterpret_cast<u32*>(submissionRingBytes + params.sq_off.ring_mask);
+        // Entries are always used in ring order, so the indirection array maps every slot to the entry with the same index.
+        u32* submissionArray = reinterpret_cast<u32*>(submissionRingBytes + params.sq_off.array);
+        for (u32 i = 0; i < params.sq_entries; ++i)
+        {
+            submissionArray[i] = i;
+        }
+        m_localSubmissionTail = *m_submissionTail;
+        m_unsubmittedCount = 0;
+
+        u8* completionRingBytes = reinterpret_cast<u8*>(m_completionRing);
+        m_completionHead = reinterpret_cast<u32*>(completionRingBytes + params.cq_off.head);
+        m_completionTail = reinterpret_cast<u32*>(completionRingBytes + params.cq_off.tail);
+        m_completionMask = *reinterpret_cast<u32*>(completionRingBytes + params.cq_off.ring_mask);
+        m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionRingBytes + params.cq_off.cqes);
+
+        return true;
+    }
+
+    void IoUring::Shutdown()
+    {
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntryCount * sizeof(io_uring_sqe));
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            ::munmap(m_completionRing, m_completionRingSize);
+        }
+        if (m_submissionRing)
+        {
+            ::munmap(m_submissionRing, m_submissionRingSize);
+        }
+        if (m_ringFd >= 0)
+        {
+            // Closing the ring cancels any reads that are still in flight and unregisters buffers and events.
+            ::close(m_ringFd);
+        }
+
+        m_submissionRing = nullptr;
+        m_completionRing = nullptr;
+        m_submissionEntries = nullptr;
+        m_completionEntries = nullptr;
+        m_submissionRingSize = 0;
+        m_completionRingSize = 0;
+        m_submissionHead = nullptr;
+        m_submissionTail = nullptr;
+        m_completionHead = nullptr;
+        m_completionTail = nullptr;
+        m_submissionMask = 0;
+        m_completionMask = 0;
+        m_submissionEntryCount = 0;
+        m_localSubmissionTail = 0;
+        m_unsubmittedCount = 0;
+        m_ringFd = -1;
+    }
+
+    bool IoUring::IsInitialized() const
+    {
+        return m_ringFd >= 0;
+    }
+
+    bool IoUring::RegisterBuffers(const iovec* buffers, u32 count)
+    {
+        return IoUringInternal::Register(m_ringFd, IORING_REGISTER_BUFFERS, buffers, count) == 0;
+    }
+
+    bool IoUring::RegisterEventFd(int eventFd)
+    {
+        return IoUringInternal::Register(m_ringFd, IORING_REGISTER_EVENTFD, &eventFd, 1) == 0;
+    }
+
+    io_uring_sqe* IoUring::GetSubmissionEntry()
+    {
+        const u32 head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        if (m_localSubmissionTail - head >= m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+        io_uring_sqe* entry = &m_submissionEntries[m_localSubmissionTail & m_submissionMask];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        ++m_localSubmissionTail;
+        return entry;
+    }
+
+    int IoUring::Submit()
+    {
+        // Publish the new entries to the kernel before entering, so they're visible once it reads the tail.
+        m_unsubmittedCount += m_localSubmissionTail - *m_submissionTail;
+        __atomic_store_n(m_submissionTail, m_localSubmissionTail, __ATOMIC_RELEASE);
+        if (m_unsubmittedCount == 0)
+        {
+            return 0;
+        }
+
+        int result;
+        do
+        {
+            result = IoUringInternal::Enter(m_ringFd, m_unsubmittedCount, 0, 0);
+        } while (result < 0 && errno == EINTR);
+
+        if (result < 0)
+        {
+            // Entries that couldn't be submitted, for instance due to EAGAIN or EBUSY, are submitted on the next call.
+            return -errno;
+        }
+        m_unsubmittedCount -= static_cast<u32>(result);
+        return result;
+    }
+
+    const io_uring_cqe* IoUring::PeekCompletion() const
+    {
+        const u32 head = *m_completionHead;
+        const u32 tail = __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE);
+        return head != tail ? &m_completionEntries[head & m_completionMask] : nullptr;
+    }
+
+    void IoUring::PopCompletion()
+    {
+        // Release so the kernel doesn't overwrite the entry before it has been read.
+        __atomic_store_n(m_completionHead, *m_completionHead + 1, __ATOMIC_RELEASE);
+    }
+
+    u32 IoUring::GetQueueDepth() const
+    {
+        return m_submissionEntryCount;
+    }
+} // namespace AZ::IO
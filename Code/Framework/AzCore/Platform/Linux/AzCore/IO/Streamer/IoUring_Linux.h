@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct iovec;
+
+namespace AZ::IO
+{
+    //! Minimal wrapper around a Linux io_uring instance. The system calls are used directly so no additional libraries
+    //! are needed. The queues are not thread safe and are expected to be used from the Streamer thread only.
+    class IoUring
+    {
+    public:
+        IoUring() = default;
+        ~IoUring();
+
+        AZ_DISABLE_COPY_MOVE(IoUring);
+
+        //! Checks if the kernel supports io_uring and all the operations the Streamer uses. The result is cached.
+        static bool IsSupported();
+
+        //! Creates the io_uring instance.
+        //! @param queueDepth The number of submission queue entries. The kernel rounds this up to a power of 2.
+        //! @return True if the instance was created, otherwise false with errno describing the error.
+        bool Initialize(u32 queueDepth);
+        void Shutdown();
+        bool IsInitialized() const;
+
+        //! Registers buffers with the kernel so they can be used by fixed reads, which saves mapping the pages for every read.
+        bool RegisterBuffers(const iovec* buffers, u32 count);
+        //! Registers an eventfd that's signaled whenever a completion is posted.
+        bool RegisterEventFd(int eventFd);
+
+        //! Returns the next cleared submission queue entry or null if the submission queue is full.
+        io_uring_sqe* GetSubmissionEntry();
+        //! Hands all entries retrieved since the last call to the kernel.
+        //! @return The number of submitted entries or a negative errno.
+        int Submit();
+        //! Returns the oldest completion or null if there are no completions. Call PopCompletion once it's processed.
+        const io_uring_cqe* PeekCompletion() const;
+        void PopCompletion();
+
+        //! The number of submission queue entries, after rounding by the kernel.
+        u32 GetQueueDepth() const;
+
+    private:
+        void* m_submissionRing{ nullptr };
+        void* m_completionRing{ nullptr };
+        io_uring_sqe* m_submissionEntries{ nullptr };
+        io_uring_cqe* m_completionEntries{ nullptr };
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        u32 m_submissionMask{ 0 };
+        u32 m_completionMask{ 0 };
+        u32 m_submissionEntryCount{ 0 };
+
+        //! Tail of the entries retrieved through GetSubmissionEntry which haven't been published to the kernel yet.
+        u32 m_localSubmissionTail{ 0 };
+        //! Number of entries that have been published to the kernel but not yet submitted through io_uring_enter.
+        u32 m_unsubmittedCount{ 0 };
+        int m_ringFd{ -1 };
+    };
+} // namespace AZ::IO
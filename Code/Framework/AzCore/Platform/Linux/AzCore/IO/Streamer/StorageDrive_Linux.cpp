@@ -0,0 +1,1223 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableDirectReads(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize,
+        size_t logicalSectorSize, u32 queueDepth, s32 overCommit, u32 registeredBufferCount, size_t registeredBufferSize,
+        ConstructionOptions options)
+        : StreamStackEntry("Storage drive (io_uring)")
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_maxFileHandles(maxFileHandles)
+        , m_queueDepth(queueDepth)
+        , m_registeredBufferCount(registeredBufferCount)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 32;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received queue depth of 0 for %s. Picking a depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        // The registered buffers are only used for direct reads, so they need to be a multiple of the sector size.
+        m_registeredBufferSize = AZ_SIZE_ALIGN_UP(registeredBufferSize, m_physicalSectorSize);
+        if (!m_constructionOptions.m_enableDirectReads || m_registeredBufferSize == 0)
+        {
+            m_registeredBufferCount = 0;
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        // Shut down the ring first so the kernel no longer references the registered buffers or file descriptors.
+        m_ring.Shutdown();
+        for (int file : m_fileCache_handles)
+        {
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+        }
+        if (m_registeredBufferMemory)
+        {
+            azfree(m_registeredBufferMemory, AZ::SystemAllocator);
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::IsSupported()
+    {
+        return IoUring::IsSupported();
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<Requests::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<Requests::ReadRequestData>(request->GetCommand());
+
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        // Queue as many reads as there are free slots so they're all handed to the kernel with a single submission.
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (!ReadRequest(request))
+            {
+                break;
+            }
+            m_pendingReadRequests.pop_front();
+            hasWorked = true;
+        }
+
+        if (m_pendingReadRequests.empty() && !m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit(
+                [this, request](auto&& args)
+                {
+                    using Command = AZStd::decay_t<decltype(args)>;
+                    if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+                    {
+                        FileExistsRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+                    {
+                        FileMetaDataRetrievalRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else
+                    {
+                        AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                        return false;
+                    }
+                },
+                request->GetCommand()) || hasWorked;
+        }
+
+        SubmitReads();
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::steady_clock::time_point earliestSlot = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<Requests::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                AZStd::chrono::steady_clock::time_point endTime =
+                    read.m_startTime + Statistic::TimeValue(aznumeric_cast<u64>((readCommand->m_size * totalReadTime) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::steady_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileExistsTimeAverage = m_getFileExistsTimeAverage.CalculateAverage();
+                startTime += getFileExistsTimeAverage;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                AZStd::chrono::microseconds getFileExistsTimeAverage = m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+                startTime += getFileExistsTimeAverage;
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    AZStd::chrono::microseconds fileOpenCloseTimeAverage = m_fileOpenCloseTimeAverage.CalculateAverage();
+                    startTime += fileOpenCloseTimeAverage;
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += Statistic::TimeValue(aznumeric_cast<u64>((readSize * totalReadTime) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::steady_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData> ||
+                          AZStd::is_same_v<Command, Requests::CompressedReadData> ||
+                          AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+            }
+        }, request->GetCommand());
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    bool StorageDriveLinux::InitializeIo()
+    {
+        if (!m_ring.Initialize(m_queueDepth))
+        {
+            AZ_Error("StorageDriveLinux", false, "Failed to create io_uring with a queue depth of %u for %s. (Error: %s)\n",
+                m_queueDepth, m_name.c_str(), strerror(errno));
+            return false;
+        }
+
+        // Signal the Streamer thread whenever a read completes so it doesn't have to poll while it has nothing else to do.
+        if (!m_ring.RegisterEventFd(m_context->GetStreamerThreadSynchronizer().GetWakeUpEvent()))
+        {
+            AZ_Error("StorageDriveLinux", false, "Failed to register the Streamer wake up event with io_uring for %s. (Error: %s)\n",
+                m_name.c_str(), strerror(errno));
+            m_ring.Shutdown();
+            return false;
+        }
+
+        if (m_registeredBufferCount > 0)
+        {
+            m_registeredBufferMemory = azmalloc(m_registeredBufferCount * m_registeredBufferSize, m_physicalSectorSize, AZ::SystemAllocator);
+
+            AZStd::vector<iovec> buffers;
+            buffers.resize_no_construct(m_registeredBufferCount);
+            for (u32 i = 0; i < m_registeredBufferCount; ++i)
+            {
+                buffers[i].iov_base = GetRegisteredBuffer(i);
+                buffers[i].iov_len = m_registeredBufferSize;
+            }
+
+            if (m_ring.RegisterBuffers(buffers.data(), m_registeredBufferCount))
+            {
+                // Stored in reverse so buffers are handed out from the start of the allocation.
+                m_registeredBuffers_free.reserve(m_registeredBufferCount);
+                for (u32 i = m_registeredBufferCount; i > 0; --i)
+                {
+                    m_registeredBuffers_free.push_back(i - 1);
+                }
+            }
+            else
+            {
+                // Typically caused by a low limit on locked memory. Reads will still work, but unaligned reads will need
+                // temporary allocations.
+                AZ_Warning("StorageDriveLinux", false, "Failed to register %u buffers of %zu bytes with io_uring for %s. (Error: %s)\n",
+                    m_registeredBufferCount, m_registeredBufferSize, m_name.c_str(), strerror(errno));
+                azfree(m_registeredBufferMemory, AZ::SystemAllocator);
+                m_registeredBufferMemory = nullptr;
+                m_registeredBufferCount = 0;
+            }
+        }
+        return true;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data)
+        -> OpenFileResult
+    {
+        int file = -1;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file >= 0, "Found the file '%s' in cache, but file handle is invalid.\n", data.m_path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            bool directReads = m_constructionOptions.m_enableDirectReads;
+
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                file = ::open(data.m_path.GetAbsolutePathCStr(), O_RDONLY | O_CLOEXEC | (directReads ? O_DIRECT : 0));
+                if (file < 0 && directReads && errno == EINVAL)
+                {
+                    // Some file systems, such as tmpfs, don't support direct reads so fall back to reading through the page cache.
+                    directReads = false;
+                    file = ::open(data.m_path.GetAbsolutePathCStr(), O_RDONLY | O_CLOEXEC);
+                }
+
+                if (file < 0)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                if (m_fileCache_handles[cacheIndex] >= 0)
+                {
+                    ::close(m_fileCache_handles[cacheIndex]);
+                }
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_directReads[cacheIndex] = directReads;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::now();
+        fileHandle = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::steady_clock::time_point::min());
+            m_fileCache_paths.resize(m_maxFileHandles);
+            m_fileCache_handles.resize(m_maxFileHandles, -1);
+            m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+            m_fileCache_directReads.resize(m_maxFileHandles, false);
+
+            m_readSlots_readInfo.resize(m_queueDepth);
+            m_readSlots_active.resize(m_queueDepth);
+
+            InitializeIo();
+            m_cachesInitialized = true;
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        return ReadRequest(request, readSlot);
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request, size_t readSlot)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_ring.IsInitialized())
+        {
+            // Creating io_uring failed, which has already been reported, so there's no way to service this request.
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+            return true;
+        }
+
+        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = -1;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        io_uring_sqe* entry = m_ring.GetSubmissionEntry();
+        if (!entry)
+        {
+            // The kernel hasn't consumed the previously submitted entries yet, so try again later.
+            return false;
+        }
+
+        u32 readSize = aznumeric_cast<u32>(data->m_size);
+        u64 readOffs = data->m_offset;
+        void* output = data->m_output;
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+
+        if (m_fileCache_directReads[fileCacheSlot])
+        {
+            // Check alignment of the file read information: size, offset, and address.
+            // If any are unaligned to the sector sizes, make adjustments and read into an aligned buffer.
+            // See StorageDriveWin::ReadRequest for a detailed description of the adjustments.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+
+            // Align the offset down to next lowest sector and store the difference so only the requested data is copied back.
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = aznumeric_cast<u32>(data->m_size + offsetCorrection);
+            }
+
+            // If there's enough room in the output buffer, read a bit more to avoid needing a temporary buffer.
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u32 alignedReadSize = aznumeric_caster(AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize));
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = aznumeric_cast<u32>(AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize));
+                if (readSize <= m_registeredBufferSize && !m_registeredBuffers_free.empty())
+                {
+                    readInfo.m_registeredBufferIndex = m_registeredBuffers_free.back();
+                    m_registeredBuffers_free.pop_back();
+                    output = GetRegisteredBuffer(readInfo.m_registeredBufferIndex);
+                }
+                else
+                {
+                    readInfo.m_sectorAlignedOutput = azmalloc(readSize, m_physicalSectorSize, AZ::SystemAllocator);
+                    output = readInfo.m_sectorAlignedOutput;
+                }
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        if (readInfo.m_registeredBufferIndex != InvalidRegisteredBufferIndex)
+        {
+            entry->opcode = IORING_OP_READ_FIXED;
+            entry->buf_index = aznumeric_cast<u16>(readInfo.m_registeredBufferIndex);
+        }
+        else
+        {
+            entry->opcode = IORING_OP_READ;
+        }
+        entry->fd = file;
+        entry->addr = reinterpret_cast<u64>(output);
+        entry->len = readSize;
+        entry->off = readOffs;
+        entry->user_data = readSlot;
+        m_queuedSubmissions++;
+
+        auto now = AZStd::chrono::steady_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        readInfo.m_startTime = now;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any active reads and ask the kernel to cancel them.
+        bool hasQueuedCancels = false;
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+            if (m_readSlots_active[readSlot] && readInfo.m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                if (readInfo.m_cancelRequested)
+                {
+                    continue;
+                }
+
+                // If there's no room to queue the cancel the read will complete as normal, which is still a valid result.
+                if (io_uring_sqe* entry = m_ring.GetSubmissionEntry(); entry != nullptr)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = CancelUserData;
+                    readInfo.m_cancelRequested = true;
+                    hasQueuedCancels = true;
+                }
+            }
+        }
+
+        if (hasQueuedCancels)
+        {
+            SubmitReads();
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        size_t cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileInfo;
+        if (::stat(fileExists.m_path.GetAbsolutePathCStr(), &fileInfo) == 0)
+        {
+            if (S_ISREG(fileInfo.st_mode))
+            {
+                cacheIndex = GetNextMetaDataCacheSlot();
+                m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+                m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileInfo.st_size);
+                fileExists.m_found = true;
+            }
+            // Directories and other non-file entries are reported as not found.
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<Requests::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileInfo;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] >= 0,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePath());
+            if (::fstat(m_fileCache_handles[cacheIndex], &fileInfo) != 0)
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+        }
+        else if (::stat(command.m_path.GetAbsolutePathCStr(), &fileInfo) != 0 || !S_ISREG(fileInfo.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(fileInfo.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileInfo.st_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::CloseFile(size_t cacheIndex)
+    {
+        if (m_fileCache_handles[cacheIndex] >= 0)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+            ::close(m_fileCache_handles[cacheIndex]);
+            m_fileCache_handles[cacheIndex] = -1;
+        }
+        m_fileCache_activeReads[cacheIndex] = 0;
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+        m_fileCache_paths[cacheIndex].Clear();
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                CloseFile(cacheIndex);
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                CloseFile(cacheIndex);
+            }
+
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    void StorageDriveLinux::SubmitReads()
+    {
+        if (!m_ring.IsInitialized())
+        {
+            return;
+        }
+
+        if (m_queuedSubmissions > 0)
+        {
+            m_submitBatchSizeAverage.PushEntry(m_queuedSubmissions);
+            m_queuedSubmissions = 0;
+        }
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::SubmitReads %s", m_name.c_str());
+        int result = m_ring.Submit();
+        // EAGAIN and EBUSY mean the kernel is temporarily out of resources. The remaining entries will be submitted on the next
+        // call, which happens at the latest when one of the in-flight reads completes.
+        AZ_Error("StorageDriveLinux", result >= 0 || result == -EAGAIN || result == -EBUSY,
+            "Failed to submit reads to io_uring for %s. (Error: %s)\n", m_name.c_str(), strerror(-result));
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (!m_ring.IsInitialized())
+        {
+            return false;
+        }
+
+        bool hasWorked = false;
+        while (const io_uring_cqe* completion = m_ring.PeekCompletion())
+        {
+            const u64 userData = completion->user_data;
+            const s32 result = completion->res;
+            m_ring.PopCompletion();
+
+            // The results of cancel operations aren't needed as the canceled read will report its own completion.
+            if (userData != CancelUserData)
+            {
+                AZ_Assert(userData < m_readSlots_active.size() && m_readSlots_active[userData],
+                    "io_uring returned a completion for read slot %zu which isn't active.", aznumeric_cast<size_t>(userData));
+                hasWorked = true;
+                FinalizeSingleRequest(aznumeric_cast<size_t>(userData), result);
+            }
+        }
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, s32 result)
+    {
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+
+        // A read that's interrupted because it was canceled while already running reports EINTR instead of ECANCELED.
+        const bool isCanceled = result == -ECANCELED || (fileReadInfo.m_cancelRequested && result == -EINTR);
+        const bool encounteredError = result < 0 && !isCanceled;
+        AZ_Error("StorageDriveLinux", !encounteredError, "Async file read operation completed with error: %s\n", strerror(-result));
+        const size_t numBytesTransferred = result > 0 ? aznumeric_cast<size_t>(result) : 0;
+
+        m_activeReads_ByteCount += numBytesTransferred;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::steady_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        const bool isSuccess = !encounteredError && !isCanceled &&
+            (fileReadInfo.m_copyBackOffset + readCommand->m_size <= numBytesTransferred);
+
+        if (isSuccess)
+        {
+            u8* alignedOutput = fileReadInfo.m_registeredBufferIndex != InvalidRegisteredBufferIndex
+                ? GetRegisteredBuffer(fileReadInfo.m_registeredBufferIndex)
+                : reinterpret_cast<u8*>(fileReadInfo.m_sectorAlignedOutput);
+            if (alignedOutput)
+            {
+                ::memcpy(readCommand->m_output, alignedOutput + fileReadInfo.m_copyBackOffset, readCommand->m_size);
+            }
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        ReleaseReadBuffer(fileReadInfo);
+
+        // There's now a slot available to queue the next request, if there is one.
+        if (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (ReadRequest(request, readSlot))
+            {
+                m_pendingReadRequests.pop_front();
+            }
+        }
+    }
+
+    void StorageDriveLinux::ReleaseReadBuffer(FileReadInformation& readInfo)
+    {
+        if (readInfo.m_sectorAlignedOutput)
+        {
+            azfree(readInfo.m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        if (readInfo.m_registeredBufferIndex != InvalidRegisteredBufferIndex)
+        {
+            m_registeredBuffers_free.push_back(readInfo.m_registeredBufferIndex);
+        }
+        readInfo = FileReadInformation{};
+    }
+
+    u8* StorageDriveLinux::GetRegisteredBuffer(u32 index) const
+    {
+        return reinterpret_cast<u8*>(m_registeredBufferMemory) + index * m_registeredBufferSize;
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::steady_clock::time_point oldest = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateBytesPerSecond(m_name, "Read Speed", totalBytesRead / totalReadTimeSec,
+                "The average read speed in megabytes per second this drive achieved. This is the maximum achievable speed for reading from "
+                "disk. If this is lower than expected it may indicate that the queue depth is too low to saturate the drive, other "
+                "applications are using the same drive or direct reads are disabled and the page cache is under pressure."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "File Open & Close", m_fileOpenCloseTimeAverage.CalculateAverage(), m_fileOpenCloseTimeAverage.GetMinimum(),
+                m_fileOpenCloseTimeAverage.GetMaximum(),
+                "The average amount of time needed to open and close file handles. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file exists", m_getFileExistsTimeAverage.CalculateAverage(),
+                m_getFileExistsTimeAverage.GetMinimum(), m_getFileExistsTimeAverage.GetMaximum(),
+                "The average amount of time needed to check if a file exists. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file meta data", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage(),
+                m_getFileMetaDataRetrievalTimeAverage.GetMinimum(), m_getFileMetaDataRetrievalTimeAverage.GetMaximum(),
+                "The average amount of time in microseconds needed to retrieve file information. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            if (m_submitBatchSizeAverage.GetNumRecorded() > 0)
+            {
+                statistics.push_back(Statistic::CreateFloatRange(
+                    m_name, "Submission batch size", m_submitBatchSizeAverage.CalculateAverage(),
+                    aznumeric_cast<double>(m_submitBatchSizeAverage.GetMinimum()),
+                    aznumeric_cast<double>(m_submitBatchSizeAverage.GetMaximum()),
+                    "The average number of reads that were handed to the kernel with a single system call. Higher numbers mean less "
+                    "overhead per read. If this is close to 1 while there are many reads pending, the scheduler may not be providing "
+                    "requests fast enough."));
+            }
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots(),
+                "The total number of available slots to queue requests on. The lower this number, the more active this node is. A small "
+                "number is ideal as it means there are a few requests available for immediate processing next once a request "
+                "completes. If this is value is often negative then increasing the over-commit value, but keep in mind that too many "
+                "over-committed reduces the ability of scheduler to order requests."));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage(), m_fileSwitchPercentageStat.GetMinimum(),
+                m_fileSwitchPercentageStat.GetMaximum(),
+                "The percentage of file requests that required switching to a different file. When running from loose file this should be "
+                "close to 100% as that would indicate mostly full file reads. When running from archives this should be as close to 0 as "
+                "possible as that would indicate efficiently running from archives."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, SeeksName, m_seekPercentageStat.GetAverage(), m_seekPercentageStat.GetMinimum(), m_seekPercentageStat.GetMaximum(),
+                "The percentage of file reads that required seeking within a file. For loose files this should be lose to zero to indicate "
+                "no partial file reads. For archives this value is typically high, which is not a problem, but lower values indicate more "
+                "efficient scheduling and archive layout which will result in better hardware cache utilization."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage(), m_directReadsPercentageStat.GetMinimum(),
+                m_directReadsPercentageStat.GetMaximum(),
+                "The percentage of reads that did not require any additional aligning. If this number isn't close to 100 percent "
+                "performance will suffer as data needs to be read into registered or temporary buffers and copied. The best way to "
+                "avoid this is by adding a block cache and/or read splitter in front of this node."));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max file handles", m_maxFileHandles,
+                "The maximum number of file handles this drive node will cache. Increasing this will allow files that are read "
+                "multiple times to be processed faster. It's recommended to have this set to at least the largest number of archives "
+                "that can be in use at the same time."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max meta data cache", m_metaDataCache_paths.size(),
+                "The maximum number of meta data like file sizes this drive node will cache."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Physical sector size", m_physicalSectorSize,
+                "The sector size used by the hardware. For optimal performance memory alignment and read sizes need to be multiples of "
+                "this value."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Logical sector size", m_logicalSectorSize,
+                "The sector size used by the operating system. This is typically the same or smaller than the physical sector size. If "
+                "the physical sector size alignment can't be met, this is the next best size to align to."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Queue depth", m_queueDepth, "The maximum number of reads that are in flight at the same time."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Overcommit", m_overCommit,
+                "The number of additional requests this node will accept. Higher numbers means that drives don't have to wait for the "
+                "scheduler to provide new request to process and the next request can immediately start reading. If this value is too "
+                "high though it will negatively impact the scheduler's ability to order and prioritize requests, which can lead to "
+                "poorer hardware and software cache performance and slower cancellations, among others."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Registered buffers", m_registeredBufferCount,
+                "The number of buffers registered with the kernel that are used to read unaligned requests without allocating."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Registered buffer size", m_registeredBufferSize,
+                "The size of each registered buffer. Unaligned reads larger than this will allocate a temporary buffer."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Has seek penalty", m_constructionOptions.m_hasSeekPenalty,
+                "Whether or not the hardware has a penalty for seeking. This refers to drives that need to physically position a read "
+                "head to retrieve data, which can cause additional seek times for non-consecutive reads. This does not refer to seeks "
+                "impacting hardware cache performance."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Direct reads enabled", m_constructionOptions.m_enableDirectReads,
+                "Whether or not this drive bypasses the operating system's page cache. Reading through the page cache is beneficial "
+                "when reading the same file frequently, which happens during development. Direct reads typically are faster when "
+                "reading the initial file and don't evict other data from the page cache, which is optimal for released games."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Minimal reporting", m_constructionOptions.m_minimalReporting,
+                "Whether or not this node only reports issues or reports all information."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        case IStreamerTypes::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] >= 0)
+                    {
+                        data.m_output.push_back(
+                            Statistic::CreatePersistentString(m_name, "File lock", m_fileCache_paths[i].GetRelativePath().Native()));
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ::IO::Requests
+{
+    struct ReadData;
+    struct ReportData;
+}
+
+namespace AZ::IO
+{
+    //! Storage drive for Linux that uses io_uring to keep multiple reads in flight from the Streamer thread.
+    //! Reads that are queued in the same tick are submitted to the kernel with a single system call and the Streamer thread is
+    //! woken up through the context's wake up event when reads complete.
+    class AZCORE_API StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct AZCORE_API ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Open files with O_DIRECT to bypass the page cache. This results in faster reads the first time a file is read
+            //! and avoids evicting other data from the page cache, but files that are read repeatedly can't be serviced from the
+            //! cache. Direct reads have alignment restrictions, so for the most optimal performance align read buffers to the
+            //! physicalSectorSize. Files on file systems that don't support O_DIRECT automatically fall back to buffered reads.
+            u8 m_enableDirectReads : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntries The maximum number of files to keep meta data, such as the file size, to cache. This
+        //!     needs to be a power of 2.
+        //! @param physicalSectorSize The sector size used by the device. When direct reads are used the output buffer needs to
+        //!     be aligned to this value.
+        //! @param logicalSectorSize The sector size used by the operating system. When direct reads are used the file offset
+        //!     and read size need to be aligned to this value.
+        //! @param queueDepth The maximum number of reads that are kept in flight.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. A negative value will under-commit.
+        //! @param registeredBufferCount The number of sector aligned buffers that are registered with the kernel and used for
+        //!     direct reads into unaligned memory. Reads that don't fit in a registered buffer use a temporary allocation.
+        //! @param registeredBufferSize The size of each of the registered buffers.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize,
+            u32 queueDepth, s32 overCommit, u32 registeredBufferCount, size_t registeredBufferSize, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        //! Returns true if the kernel supports the io_uring features this drive requires. If not, the generic StorageDrive
+        //! should be used instead.
+        static bool IsSupported();
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr u32 InvalidRegisteredBufferIndex = std::numeric_limits<u32>::max();
+        //! User data for cancel operations, which is never a valid read slot.
+        inline static constexpr u64 CancelUserData = std::numeric_limits<u64>::max();
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr }; // Internally allocated buffer that is sector aligned.
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            u32 m_registeredBufferIndex{ InvalidRegisteredBufferIndex };
+            bool m_cancelRequested{ false };
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        bool InitializeIo();
+        OpenFileResult OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::steady_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void CloseFile(size_t cacheIndex);
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        void SubmitReads();
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, s32 result);
+        void ReleaseReadBuffer(FileReadInformation& readInfo);
+        u8* GetRegisteredBuffer(u32 index) const;
+
+        void Report(const Requests::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_submitBatchSizeAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::steady_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        IoUring m_ring;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::steady_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        //! Whether the file was opened with O_DIRECT, which can fail on file systems without support for it.
+        AZStd::vector<bool> m_fileCache_directReads;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        //! A single sector aligned allocation that's split into the registered buffers.
+        void* m_registeredBufferMemory{ nullptr };
+        AZStd::vector<u32> m_registeredBuffers_free;
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_registeredBufferSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        u32 m_registeredBufferCount{ 0 };
+        u32 m_queuedSubmissions{ 0 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/std/string/fixed_string.h>
+
+namespace AZ::IO
+{
+    static bool ReadBlockDeviceValue(const char* device, const char* attribute, size_t& value)
+    {
+        AZStd::fixed_string<256> path = AZStd::fixed_string<256>::format("/sys/block/%s/%s", device, attribute);
+        FILE* file = ::fopen(path.c_str(), "r");
+        if (!file)
+        {
+            return false;
+        }
+        unsigned long long result = 0;
+        bool success = ::fscanf(file, "%llu", &result) == 1;
+        ::fclose(file);
+        value = aznumeric_cast<size_t>(result);
+        return success;
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool reportHardware)
+    {
+        DIR* blockDevices = ::opendir("/sys/block");
+        if (!blockDevices)
+        {
+            return false;
+        }
+
+        LinuxHardwareInformation linuxInfo;
+        linuxInfo.m_hasSeekPenalty = false;
+        size_t maxPhysicalSectorSize = 0;
+        size_t maxLogicalSectorSize = 0;
+        while (dirent* entry = ::readdir(blockDevices))
+        {
+            const char* device = entry->d_name;
+            if (device[0] == '.')
+            {
+                continue;
+            }
+
+            // Only devices backed by hardware have a device link. This skips virtual devices such as loop and zram devices.
+            AZStd::fixed_string<256> devicePath = AZStd::fixed_string<256>::format("/sys/block/%s/device", device);
+            if (::access(devicePath.c_str(), F_OK) != 0)
+            {
+                continue;
+            }
+
+            size_t physicalSectorSize = 0;
+            size_t logicalSectorSize = 0;
+            size_t rotational = 1;
+            if (!ReadBlockDeviceValue(device, "queue/physical_block_size", physicalSectorSize) ||
+                !ReadBlockDeviceValue(device, "queue/logical_block_size", logicalSectorSize))
+            {
+                continue;
+            }
+            ReadBlockDeviceValue(device, "queue/rotational", rotational);
+
+            maxPhysicalSectorSize = AZStd::max(maxPhysicalSectorSize, physicalSectorSize);
+            maxLogicalSectorSize = AZStd::max(maxLogicalSectorSize, logicalSectorSize);
+            linuxInfo.m_hasSeekPenalty = linuxInfo.m_hasSeekPenalty || rotational != 0;
+
+            if (reportHardware)
+            {
+                AZ_Printf("Streamer", "Block device '%s' found.\n", device);
+                AZ_Printf("Streamer", "    Physical sector size: %zu\n", physicalSectorSize);
+                AZ_Printf("Streamer", "    Logical sector size: %zu\n", logicalSectorSize);
+                AZ_Printf("Streamer", "    Has seek penalty: %s\n", rotational != 0 ? "Yes" : "No");
+            }
+        }
+        ::closedir(blockDevices);
+
+        if (maxPhysicalSectorSize == 0 || maxLogicalSectorSize == 0 ||
+            !IStreamerTypes::IsPowerOf2(maxPhysicalSectorSize) || !IStreamerTypes::IsPowerOf2(maxLogicalSectorSize))
+        {
+            return false;
+        }
+
+        long pageSize = ::sysconf(_SC_PAGESIZE);
+        hardwareInfo.m_maxPageSize = pageSize > 0 ? aznumeric_cast<size_t>(pageSize) : 4096;
+        // The transfer limit reported by the block layer (max_sectors_kb) is typically several megabytes, which is
+        // too large for the block cache and read splitter to be effective, so keep the common default instead.
+        hardwareInfo.m_maxTransfer = 512_kib;
+        hardwareInfo.m_maxPhysicalSectorSize = maxPhysicalSectorSize;
+        hardwareInfo.m_maxLogicalSectorSize = maxLogicalSectorSize;
+        hardwareInfo.m_platformData = linuxInfo;
+        hardwareInfo.m_profile = "Generic";
+        return true;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, [[maybe_unused]] bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
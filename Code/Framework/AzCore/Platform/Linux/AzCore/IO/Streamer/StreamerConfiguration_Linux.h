@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+
+namespace AZ::IO
+{
+    //! Additional hardware information collected from sysfs that's stored in HardwareInformation::m_platformData.
+    struct AZCORE_API LinuxHardwareInformation
+    {
+        AZ_TYPE_INFO(AZ::IO::LinuxHardwareInformation, "{5C0B1E4A-7D2F-4E83-9B6A-2F1C8D3E0A57}");
+
+        //! True if any of the physical block devices is a rotational drive.
+        bool m_hasSeekPenalty{ true };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_wakeUpEvent = ::eventfd(0, EFD_CLOEXEC);
+        AZ_Assert(m_wakeUpEvent != -1, "Failed to create the wake up event for the IO Scheduler (Error: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_wakeUpEvent != -1)
+        {
+            ::close(m_wakeUpEvent);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        // Reading blocks until the counter is non-zero and then resets it.
+        uint64_t count = 0;
+        while (::read(m_wakeUpEvent, &count, sizeof(count)) < 0 && errno == EINTR)
+        {
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        const uint64_t increment = 1;
+        [[maybe_unused]] ssize_t result = ::write(m_wakeUpEvent, &increment, sizeof(increment));
+        AZ_Assert(result == sizeof(increment), "Failed to signal the wake up event for the IO Scheduler (Error: %i).", errno);
+    }
+
+    int StreamerContextThreadSync::GetWakeUpEvent() const
+    {
+        return m_wakeUpEvent;
+    }
+} // namespace AZ::Platform
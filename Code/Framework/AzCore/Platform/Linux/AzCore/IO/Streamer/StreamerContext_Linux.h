@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    class StreamerContextThreadSync
+    {
+    public:
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Returns the eventfd the Streamer thread waits on while suspended. Asynchronous IO can signal this event when
+        //! work completes, for instance by registering it with an io_uring instance, to wake up the Streamer thread.
+        int GetWakeUpEvent() const;
+
+    private:
+        //! Counter that's incremented by wake up calls and completed IO. Suspend blocks until it's non-zero and resets it,
+        //! so wake up calls made while the thread was awake are never lost.
+        int m_wakeUpEvent{ -1 };
+    };
+
+} // namespace AZ::Platform
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Threading/ThreadUtils.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+
+#include <sched.h>
+#include <stdio.h>
+
+namespace AZ::Threading
+{
+    namespace Platform
+    {
+        //! Reads the first line of a sysfs file. Returns an empty string if the file doesn't exist.
+        static AZStd::string ReadSysfsLine(const char* path)
+        {
+            AZStd::string line;
+            if (FILE* file = fopen(path, "r"); file != nullptr)
+            {
+                char buffer[4096];
+                if (fgets(buffer, sizeof(buffer), file) != nullptr)
+                {
+                    line = buffer;
+                }
+                fclose(file);
+            }
+            return line;
+        }
+
+        static AZStd::vector<uint32_t> ReadSysfsCpuList(const char* path)
+        {
+            return ParseCpuList(ReadSysfsLine(path));
+        }
+    } // namespace Platform
+
+    AZStd::vector<CpuDomain> QueryCpuDomains()
+    {
+        // Only consider the CPUs the process is allowed to run on, which can be a subset of the machine in containers.
+        cpu_set_t allowedCpus;
+        CPU_ZERO(&allowedCpus);
+        if (sched_getaffinity(0, sizeof(allowedCpus), &allowedCpus) != 0)
+        {
+            return {};
+        }
+        auto isAllowed = [&allowedCpus](uint32_t cpu)
+        {
+            return cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowedCpus);
+        };
+
+        // Collect the CPUs per NUMA node. Kernels built without NUMA support don't expose the node directory, in which
+        // case all online CPUs are treated as a single node.
+        AZStd::vector<AZStd::pair<uint32_t, AZStd::vector<uint32_t>>> nodes;
+        for (uint32_t node : Platform::ReadSysfsCpuList("/sys/devices/system/node/online"))
+        {
+            AZStd::string path = AZStd::string::format("/sys/devices/system/node/node%u/cpulist", node);
+            AZStd::vector<uint32_t> cpus = Platform::ReadSysfsCpuList(path.c_str());
+            if (!cpus.empty())
+            {
+                nodes.emplace_back(node, AZStd::move(cpus));
+            }
+        }
+        if (nodes.empty())
+        {
+            AZStd::vector<uint32_t> cpus = Platform::ReadSysfsCpuList("/sys/devices/system/cpu/online");
+            if (cpus.empty())
+            {
+                return {};
+            }
+            nodes.emplace_back(0, AZStd::move(cpus));
+        }
+
+        // Split each node further by the last level cache the CPUs share, since on chiplet designs a single node can
+        // contain several L3 caches.
+        AZStd::vector<CpuDomain> domains;
+        for (auto& [node, cpus] : nodes)
+        {
+            AZStd::unordered_map<AZStd::string, size_t> domainByCacheList;
+            for (uint32_t cpu : cpus)
+            {
+                if (!isAllowed(cpu))
+                {
+                    continue;
+                }
+
+                AZStd::string path = AZStd::string::format("/sys/devices/system/cpu/cpu%u/cache/index3/shared_cpu_list", cpu);
+                AZStd::string cacheList = Platform::ReadSysfsLine(path.c_str());
+
+                auto [domainIt, inserted] = domainByCacheList.emplace(AZStd::move(cacheList), domains.size());
+                if (inserted)
+                {
+                    CpuDomain& domain = domains.emplace_back();
+                    domain.m_numaNode = node;
+                }
+                domains[domainIt->second].m_logicalCpus.push_back(cpu);
+            }
+        }
+
+        for (CpuDomain& domain : domains)
+        {
+            AZStd::sort(domain.m_logicalCpus.begin(), domain.m_logicalCpus.end());
+        }
+        return domains;
+    }
+} // namespace AZ::Threading
@@ -35,6 +35,7 @@ set(FILES
     AzCore/Debug/StackTracer_Windows.cpp
     ../Common/WinAPI/AzCore/Debug/Trace_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/AnsiTerminalUtils_WinAPI.cpp
+    ../Common/WinAPI/AzCore/IO/MappedFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/FileIO_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.h
@@ -78,6 +79,7 @@ set(FILES
     AzCore/std/time_Windows.cpp
     ../Common/WinAPI/AzCore/Utils/Utils_WinAPI.cpp
     AzCore/Utils/Utils_Windows.cpp
+    ../Common/Default/AzCore/Threading/ThreadUtils_Default.cpp
     AzCore/Debug/Profiler_Platform.inl
     ../Common/WinAPI/AzCore/Debug/Profiler_WinAPI.inl
 )
@@ -23,9 +23,12 @@
 
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Memory/IAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <AzCore/std/parallel/containers/concurrent_unordered_set.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AZTestShared/Utils/Utils.h>
 #include <AzTest/Utils.h>
 
@@ -81,6 +84,60 @@ namespace UnitTest
         //////////////////////////////////////////////////////////////////////////
     }
 
+    TEST_F(Components, Create_SystemAllocatorThreadCacheSetting_IsAppliedToSystemAllocator)
+    {
+        auto& systemAllocator = AllocatorInstance<SystemAllocator>::Get();
+        const bool threadCacheWasEnabled = systemAllocator.IsThreadCacheEnabled();
+        // The thread cache can't be turned on when the system allocator uses malloc
+        systemAllocator.SetThreadCacheEnabled(true);
+        const bool threadCacheSupported = systemAllocator.IsThreadCacheEnabled();
+        systemAllocator.SetThreadCacheEnabled(false);
+
+        {
+            AZ::ComponentApplicationSettings componentAppSettings;
+            componentAppSettings.m_setregBootstrapJson = R"({ "O3DE": { "Memory": { "SystemAllocator": { "ThreadCacheEnabled": true } } } })";
+            ComponentApplication app(componentAppSettings);
+
+            ComponentApplication::Descriptor appDesc;
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            app.Create(appDesc, startupParameters);
+
+            bool threadCacheSetting = false;
+            ASSERT_NE(nullptr, AZ::SettingsRegistry::Get());
+            ASSERT_TRUE(AZ::SettingsRegistry::Get()->Get(threadCacheSetting, SystemAllocator::ThreadCacheEnabledKey));
+            EXPECT_TRUE(threadCacheSetting);
+            EXPECT_EQ(threadCacheSupported, systemAllocator.IsThreadCacheEnabled());
+
+            // Allocate and free through the thread caches
+            AZStd::thread threads[4];
+            for (AZStd::thread& thread : threads)
+            {
+                thread = AZStd::thread(
+                    [&systemAllocator]()
+                    {
+                        void* allocations[64];
+                        for (void*& allocation : allocations)
+                        {
+                            allocation = systemAllocator.Allocate(32, 0);
+                        }
+                        for (void* allocation : allocations)
+                        {
+                            systemAllocator.DeAllocate(allocation, 32);
+                        }
+                    });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            app.Destroy();
+        }
+
+        systemAllocator.SetThreadCacheEnabled(threadCacheWasEnabled);
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Some component message bus, this is not really part of the component framework
     // but this is way components are suppose to communicate... using the EBus
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/EBus/EBusMultiProducerQueueTraits.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <gtest/gtest.h>
+
+namespace UnitTest
+{
+    // Test EBus that uses the EBusMultiProducerQueuePolicy.
+    class MultiProducerQueueNotifications : public AZ::EBusMultiProducerQueueTraits
+    {
+    public:
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+
+        virtual void OnValue(uint32_t producer, uint32_t sequence) = 0;
+    };
+    using MultiProducerQueueNotificationBus = AZ::EBus<MultiProducerQueueNotifications>;
+
+    class MultiProducerQueueHandler : public MultiProducerQueueNotificationBus::Handler
+    {
+    public:
+        MultiProducerQueueHandler()
+        {
+            MultiProducerQueueNotificationBus::Handler::BusConnect();
+        }
+
+        ~MultiProducerQueueHandler() override
+        {
+            MultiProducerQueueNotificationBus::Handler::BusDisconnect();
+        }
+
+        void OnValue(uint32_t producer, uint32_t sequence) override
+        {
+            m_received.emplace_back(producer, sequence);
+        }
+
+        AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_received;
+    };
+
+    class EBusMultiProducerQueueTestFixture
+        : public LeakDetectionFixture
+    {
+    public:
+        void TearDown() override
+        {
+            MultiProducerQueueNotificationBus::ClearQueuedEvents();
+            LeakDetectionFixture::TearDown();
+        }
+    };
+
+    TEST_F(EBusMultiProducerQueueTestFixture, QueuedEventsFromOneThread_ExecuteInQueueOrder)
+    {
+        MultiProducerQueueHandler handler;
+
+        constexpr uint32_t EventCount = 100;
+        for (uint32_t sequence = 0; sequence < EventCount; ++sequence)
+        {
+            MultiProducerQueueNotificationBus::QueueBroadcast(&MultiProducerQueueNotificationBus::Events::OnValue, 0, sequence);
+        }
+        EXPECT_EQ(EventCount, MultiProducerQueueNotificationBus::QueuedEventCount());
+        EXPECT_TRUE(handler.m_received.empty());
+
+        MultiProducerQueueNotificationBus::ExecuteQueuedEvents();
+
+        ASSERT_EQ(EventCount, handler.m_received.size());
+        for (uint32_t sequence = 0; sequence < EventCount; ++sequence)
+        {
+            EXPECT_EQ(sequence, handler.m_received[sequence].second);
+        }
+        EXPECT_EQ(0, MultiProducerQueueNotificationBus::QueuedEventCount());
+    }
+
+    TEST_F(EBusMultiProducerQueueTestFixture, QueuedEventsFromManyThreads_PreserveOrderPerProducer)
+    {
+        MultiProducerQueueHandler handler;
+
+        constexpr uint32_t ThreadCount = 8;
+        constexpr uint32_t EventsPerThread = 1000;
+        AZStd::thread threads[ThreadCount];
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread(
+                [threadIndex]()
+                {
+                    for (uint32_t sequence = 0; sequence < EventsPerThread; ++sequence)
+                    {
+                        MultiProducerQueueNotificationBus::QueueBroadcast(
+                            &MultiProducerQueueNotificationBus::Events::OnValue, threadIndex, sequence);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_EQ(ThreadCount * EventsPerThread, MultiProducerQueueNotificationBus::QueuedEventCount());
+
+        MultiProducerQueueNotificationBus::ExecuteQueuedEvents();
+
+        ASSERT_EQ(ThreadCount * EventsPerThread, handler.m_received.size());
+        uint32_t nextSequence[ThreadCount] = {};
+        for (const auto& received : handler.m_received)
+        {
+            ASSERT_LT(received.first, ThreadCount);
+            EXPECT_EQ(nextSequence[received.first], received.second);
+            nextSequence[received.first] = received.second + 1;
+        }
+    }
+
+    TEST_F(EBusMultiProducerQueueTestFixture, QueuedEventCountWhileQueueingAndExecuting_NeverExceedsQueuedEvents)
+    {
+        MultiProducerQueueHandler handler;
+
+        constexpr uint32_t ThreadCount = 8;
+        constexpr uint32_t EventsPerThread = 2000;
+        constexpr size_t TotalEventCount = ThreadCount * EventsPerThread;
+        AZStd::atomic<uint32_t> finishedThreads{ 0 };
+        AZStd::thread threads[ThreadCount];
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread(
+                [threadIndex, &finishedThreads]()
+                {
+                    for (uint32_t sequence = 0; sequence < EventsPerThread; ++sequence)
+                    {
+                        MultiProducerQueueNotificationBus::QueueBroadcast(
+                            &MultiProducerQueueNotificationBus::Events::OnValue, threadIndex, sequence);
+                    }
+                    finishedThreads.fetch_add(1);
+                });
+        }
+
+        // Drain the queue while the producers are still queueing. A count that is taken between a message being published and
+        // being counted would wrap around and show up as a huge number of queued events.
+        size_t maxCount = 0;
+        while (finishedThreads.load() < ThreadCount)
+        {
+            MultiProducerQueueNotificationBus::ExecuteQueuedEvents();
+            maxCount = AZStd::max(maxCount, MultiProducerQueueNotificationBus::QueuedEventCount());
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        MultiProducerQueueNotificationBus::ExecuteQueuedEvents();
+
+        EXPECT_LE(maxCount, TotalEventCount);
+        EXPECT_EQ(0, MultiProducerQueueNotificationBus::QueuedEventCount());
+        EXPECT_EQ(TotalEventCount, handler.m_received.size());
+    }
+
+    TEST_F(EBusMultiProducerQueueTestFixture, EventsQueuedDuringExecute_AreDeferredToNextExecute)
+    {
+        MultiProducerQueueHandler handler;
+
+        MultiProducerQueueNotificationBus::QueueFunction(
+            []()
+            {
+                MultiProducerQueueNotificationBus::QueueBroadcast(&MultiProducerQueueNotificationBus::Events::OnValue, 0, 1);
+            });
+
+        MultiProducerQueueNotificationBus::ExecuteQueuedEvents();
+        EXPECT_TRUE(handler.m_received.empty());
+        EXPECT_EQ(1, MultiProducerQueueNotificationBus::QueuedEventCount());
+
+        MultiProducerQueueNotificationBus::ExecuteQueuedEvents();
+        EXPECT_EQ(1, handler.m_received.size());
+    }
+
+    TEST_F(EBusMultiProducerQueueTestFixture, ClearAndDisallowQueuing_DiscardQueuedEvents)
+    {
+        MultiProducerQueueHandler handler;
+
+        MultiProducerQueueNotificationBus::QueueBroadcast(&MultiProducerQueueNotificationBus::Events::OnValue, 0, 0);
+        MultiProducerQueueNotificationBus::ClearQueuedEvents();
+        EXPECT_EQ(0, MultiProducerQueueNotificationBus::QueuedEventCount());
+
+        MultiProducerQueueNotificationBus::QueueBroadcast(&MultiProducerQueueNotificationBus::Events::OnValue, 0, 1);
+        MultiProducerQueueNotificationBus::AllowFunctionQueuing(false);
+        EXPECT_EQ(0, MultiProducerQueueNotificationBus::QueuedEventCount());
+        MultiProducerQueueNotificationBus::AllowFunctionQueuing(true);
+
+        MultiProducerQueueNotificationBus::ExecuteQueuedEvents();
+        EXPECT_TRUE(handler.m_received.empty());
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Bus using the default event queue, which serializes producers on the event queue mutex.
+    class MutexQueueBenchmarkNotifications : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr bool EnableEventQueue = true;
+        using MutexType = AZStd::mutex;
+
+        virtual void OnEvent(int32_t) = 0;
+    };
+    using MutexQueueBenchmarkBus = AZ::EBus<MutexQueueBenchmarkNotifications>;
+
+    // Bus using the lock-free multi-producer event queue.
+    class MultiProducerQueueBenchmarkNotifications : public AZ::EBusMultiProducerQueueTraits
+    {
+    public:
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        using MutexType = AZStd::mutex;
+
+        virtual void OnEvent(int32_t) = 0;
+    };
+    using MultiProducerQueueBenchmarkBus = AZ::EBus<MultiProducerQueueBenchmarkNotifications>;
+
+    // Every thread queues events onto the same bus as fast as possible.
+    template<typename Bus>
+    static void BM_EBus_ContendedQueueBroadcast(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Bus::QueueBroadcast(&Bus::Events::OnEvent, 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+
+        // All threads have left the timed loop at this point.
+        if (state.thread_index() == 0)
+        {
+            Bus::ClearQueuedEvents();
+        }
+    }
+
+    // Producers queue events while thread 0 drains the queue, which is how a bus is used across a frame.
+    template<typename Bus>
+    static void BM_EBus_ContendedQueueAndExecute(::benchmark::State& state)
+    {
+        constexpr int64_t ExecuteInterval = 64;
+        int64_t queued = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Bus::QueueBroadcast(&Bus::Events::OnEvent, 1);
+            if (state.thread_index() == 0 && (++queued % ExecuteInterval) == 0)
+            {
+                Bus::ExecuteQueuedEvents();
+            }
+        }
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0)
+        {
+            Bus::ClearQueuedEvents();
+        }
+    }
+
+    static void ContendedQueueSettings(::benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark
+            ->Unit(::benchmark::kNanosecond)
+            ->ThreadRange(1, 64)
+            ->Iterations(20000)
+            ->UseRealTime();
+    }
+
+    BENCHMARK_TEMPLATE(BM_EBus_ContendedQueueBroadcast, MutexQueueBenchmarkBus)->Apply(&ContendedQueueSettings);
+    BENCHMARK_TEMPLATE(BM_EBus_ContendedQueueBroadcast, MultiProducerQueueBenchmarkBus)->Apply(&ContendedQueueSettings);
+    BENCHMARK_TEMPLATE(BM_EBus_ContendedQueueAndExecute, MutexQueueBenchmarkBus)->Apply(&ContendedQueueSettings);
+    BENCHMARK_TEMPLATE(BM_EBus_ContendedQueueAndExecute, MultiProducerQueueBenchmarkBus)->Apply(&ContendedQueueSettings);
+} // namespace Benchmark
+
+#endif // defined(HAVE_BENCHMARK)
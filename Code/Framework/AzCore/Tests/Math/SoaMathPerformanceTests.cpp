@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SoaMath.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Compares the batched SoA kernels with the equivalent loops over the AoS math types, using the same data as
+    // FrustumPerformanceTests.cpp and TransformPerformanceTests.cpp. The argument selects the instruction set of the kernels.
+    class BM_MathSoa
+        : public benchmark::Fixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_instructionSet = static_cast<AZ::Soa::InstructionSet>(state.range(0));
+            m_previousInstructionSet = AZ::Soa::GetInstructionSet();
+            m_instructionSetSupported = AZ::Soa::SetInstructionSet(m_instructionSet);
+
+            m_frustum = AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 10.0f, 90.0f));
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif;
+
+            const AZ::Quaternion rotation = AZ::Quaternion(unif(rng), unif(rng), unif(rng), unif(rng)).GetNormalized();
+            m_transform = AZ::Transform::CreateFromQuaternionAndTranslation(rotation, AZ::Vector3(unif(rng), unif(rng), unif(rng)));
+
+            m_points.resize(ElementCount);
+            m_aabbs.resize(ElementCount);
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                m_points[i] = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 100.0f;
+                const AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 100.0f;
+                const AZ::Vector3 aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 10.0f + aabbMin;
+                m_aabbs[i] = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMax);
+            }
+
+            m_pointBlocks.resize(AZ::Soa::GetBlockCount<8>(ElementCount));
+            m_aabbBlocks.resize(AZ::Soa::GetBlockCount<8>(ElementCount));
+            AZ::Soa::Pack(m_points.data(), ElementCount, m_pointBlocks.data());
+            AZ::Soa::Pack(m_aabbs.data(), ElementCount, m_aabbBlocks.data());
+        }
+
+    public:
+        static constexpr size_t ElementCount = 1000;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void TearDown(const benchmark::State&) override
+        {
+            AZ::Soa::SetInstructionSet(m_previousInstructionSet);
+        }
+        void TearDown(benchmark::State&) override
+        {
+            AZ::Soa::SetInstructionSet(m_previousInstructionSet);
+        }
+
+        bool SkipIfUnsupported(benchmark::State& state)
+        {
+            if (!m_instructionSetSupported)
+            {
+                state.SkipWithError("Instruction set isn't supported on this processor");
+                return true;
+            }
+            return false;
+        }
+
+        AZ::Soa::InstructionSet m_instructionSet = AZ::Soa::InstructionSet::Simd128;
+        AZ::Soa::InstructionSet m_previousInstructionSet = AZ::Soa::InstructionSet::Simd128;
+        bool m_instructionSetSupported = false;
+
+        AZ::Frustum m_frustum;
+        AZ::Transform m_transform;
+        std::vector<AZ::Vector3> m_points;
+        std::vector<AZ::Aabb> m_aabbs;
+        std::vector<AZ::Vector3Array8> m_pointBlocks;
+        std::vector<AZ::AabbArray8> m_aabbBlocks;
+    };
+
+    BENCHMARK_DEFINE_F(BM_MathSoa, TransformPoint)(benchmark::State& state)
+    {
+        std::vector<AZ::Vector3> results(ElementCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                results[i] = m_transform.TransformPoint(m_points[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+    BENCHMARK_REGISTER_F(BM_MathSoa, TransformPoint)->Arg(0);
+
+    BENCHMARK_DEFINE_F(BM_MathSoa, TransformPointsBatched)(benchmark::State& state)
+    {
+        if (SkipIfUnsupported(state))
+        {
+            return;
+        }
+
+        std::vector<AZ::Vector3Array8> results(m_pointBlocks.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Soa::TransformPoints(m_transform, m_pointBlocks.data(), results.data(), m_pointBlocks.size());
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+    BENCHMARK_REGISTER_F(BM_MathSoa, TransformPointsBatched)
+        ->Arg(static_cast<int64_t>(AZ::Soa::InstructionSet::Simd128))
+        ->Arg(static_cast<int64_t>(AZ::Soa::InstructionSet::Avx2));
+
+    BENCHMARK_DEFINE_F(BM_MathSoa, TransformAabb)(benchmark::State& state)
+    {
+        std::vector<AZ::Aabb> results(ElementCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                results[i] = m_aabbs[i].GetTransformedAabb(m_transform);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+    BENCHMARK_REGISTER_F(BM_MathSoa, TransformAabb)->Arg(0);
+
+    BENCHMARK_DEFINE_F(BM_MathSoa, TransformAabbsBatched)(benchmark::State& state)
+    {
+        if (SkipIfUnsupported(state))
+        {
+            return;
+        }
+
+        std::vector<AZ::AabbArray8> results(m_aabbBlocks.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Soa::TransformAabbs(m_transform, m_aabbBlocks.data(), results.data(), m_aabbBlocks.size());
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+    BENCHMARK_REGISTER_F(BM_MathSoa, TransformAabbsBatched)
+        ->Arg(static_cast<int64_t>(AZ::Soa::InstructionSet::Simd128))
+        ->Arg(static_cast<int64_t>(AZ::Soa::InstructionSet::Avx2));
+
+    BENCHMARK_DEFINE_F(BM_MathSoa, FrustumAabbIntersect)(benchmark::State& state)
+    {
+        std::vector<AZ::IntersectResult> results(ElementCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                results[i] = m_frustum.IntersectAabb(m_aabbs[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+    BENCHMARK_REGISTER_F(BM_MathSoa, FrustumAabbIntersect)->Arg(0);
+
+    BENCHMARK_DEFINE_F(BM_MathSoa, FrustumAabbIntersectBatched)(benchmark::State& state)
+    {
+        if (SkipIfUnsupported(state))
+        {
+            return;
+        }
+
+        std::vector<AZ::IntersectResult> results(m_aabbBlocks.size() * AZ::AabbArray8::ElementCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Soa::IntersectFrustumAabbs(m_frustum, m_aabbBlocks.data(), m_aabbBlocks.size(), results.data());
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+    BENCHMARK_REGISTER_F(BM_MathSoa, FrustumAabbIntersectBatched)
+        ->Arg(static_cast<int64_t>(AZ::Soa::InstructionSet::Simd128))
+        ->Arg(static_cast<int64_t>(AZ::Soa::InstructionSet::Avx2));
+
+    BENCHMARK_DEFINE_F(BM_MathSoa, RayAabbIntersectBatched)(benchmark::State& state)
+    {
+        if (SkipIfUnsupported(state))
+        {
+            return;
+        }
+
+        const AZ::Vector3 rayOrigin = AZ::Vector3::CreateZero();
+        const AZ::Vector3 rayDirection(100.0f, 100.0f, 100.0f);
+        std::vector<float> hitDistances(m_aabbBlocks.size() * AZ::AabbArray8::ElementCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const size_t hitCount = AZ::Soa::IntersectRayAabbs(
+                rayOrigin, rayDirection, 1.0f, m_aabbBlocks.data(), m_aabbBlocks.size(), hitDistances.data());
+            benchmark::DoNotOptimize(hitCount);
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+    BENCHMARK_REGISTER_F(BM_MathSoa, RayAabbIntersectBatched)
+        ->Arg(static_cast<int64_t>(AZ::Soa::InstructionSet::Simd128))
+        ->Arg(static_cast<int64_t>(AZ::Soa::InstructionSet::Avx2));
+}
+
+#endif
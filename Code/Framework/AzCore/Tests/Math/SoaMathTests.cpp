@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SoaMath.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+#include <random>
+
+namespace UnitTest
+{
+    // Runs the batched kernels with every instruction set supported by the processor, and compares the results with the
+    // functions on the math types.
+    class MATH_SoaMath
+        : public ::testing::TestWithParam<AZ::Soa::InstructionSet>
+    {
+    protected:
+        // Not a multiple of the block width, so the padding is exercised
+        static constexpr size_t ElementCount = 1001;
+
+        void SetUp() override
+        {
+            m_previousInstructionSet = AZ::Soa::GetInstructionSet();
+            if (!AZ::Soa::SetInstructionSet(GetParam()))
+            {
+                GTEST_SKIP() << "Instruction set isn't supported on this processor";
+            }
+
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+            std::uniform_real_distribution<float> extent(0.1f, 10.0f);
+            m_points.resize(ElementCount);
+            m_aabbs.resize(ElementCount);
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                m_points[i] = AZ::Vector3(position(rng), position(rng), position(rng));
+                const AZ::Vector3 minimum(position(rng), position(rng), position(rng));
+                m_aabbs[i] = AZ::Aabb::CreateFromMinMax(minimum, minimum + AZ::Vector3(extent(rng), extent(rng), extent(rng)));
+            }
+        }
+
+        void TearDown() override
+        {
+            AZ::Soa::SetInstructionSet(m_previousInstructionSet);
+        }
+
+        AZ::Transform CreateTestTransform() const
+        {
+            AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion(0.3f, 0.2f, 0.1f, 0.9f).GetNormalized(), AZ::Vector3(1.0f, 2.0f, 3.0f));
+            transform.SetUniformScale(1.5f);
+            return transform;
+        }
+
+        template<size_t Width>
+        AZStd::vector<AZ::AabbArray<Width>> PackAabbs() const
+        {
+            AZStd::vector<AZ::AabbArray<Width>> blocks(AZ::Soa::GetBlockCount<Width>(ElementCount));
+            AZ::Soa::Pack(m_aabbs.data(), ElementCount, blocks.data());
+            return blocks;
+        }
+
+        AZStd::vector<AZ::Vector3> m_points;
+        AZStd::vector<AZ::Aabb> m_aabbs;
+        AZ::Soa::InstructionSet m_previousInstructionSet = AZ::Soa::InstructionSet::Simd128;
+    };
+
+    TEST_P(MATH_SoaMath, PackUnpack_RoundTrips)
+    {
+        AZStd::vector<AZ::Vector3Array8> blocks(AZ::Soa::GetBlockCount<8>(ElementCount));
+        AZ::Soa::Pack(m_points.data(), ElementCount, blocks.data());
+        EXPECT_EQ(blocks.back().GetElement(7), m_points.back());
+
+        AZStd::vector<AZ::Vector3> unpacked(ElementCount);
+        AZ::Soa::Unpack(blocks.data(), ElementCount, unpacked.data());
+        EXPECT_EQ(m_points, unpacked);
+    }
+
+    TEST_P(MATH_SoaMath, TransformPoints_MatchesTransformPoint)
+    {
+        const AZ::Transform transform = CreateTestTransform();
+
+        AZStd::vector<AZ::Vector3Array8> blocks(AZ::Soa::GetBlockCount<8>(ElementCount));
+        AZ::Soa::Pack(m_points.data(), ElementCount, blocks.data());
+        AZ::Soa::TransformPoints(transform, blocks.data(), blocks.data(), blocks.size());
+
+        AZStd::vector<AZ::Vector3Array4> blocks4(AZ::Soa::GetBlockCount<4>(ElementCount));
+        AZ::Soa::Pack(m_points.data(), ElementCount, blocks4.data());
+        AZ::Soa::TransformPoints(transform, blocks4.data(), blocks4.data(), blocks4.size());
+
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const AZ::Vector3 expected = transform.TransformPoint(m_points[i]);
+            EXPECT_THAT(blocks[i / 8].GetElement(i % 8), IsClose(expected));
+            EXPECT_THAT(blocks4[i / 4].GetElement(i % 4), IsClose(expected));
+        }
+    }
+
+    TEST_P(MATH_SoaMath, TransformAabbs_MatchesGetTransformedAabb)
+    {
+        const AZ::Transform transform = CreateTestTransform();
+
+        const AZStd::vector<AZ::AabbArray8> blocks = PackAabbs<8>();
+        AZStd::vector<AZ::AabbArray8> results(blocks.size());
+        AZ::Soa::TransformAabbs(transform, blocks.data(), results.data(), blocks.size());
+
+        AZStd::vector<AZ::AabbArray4> blocks4 = PackAabbs<4>();
+        AZ::Soa::TransformAabbs(transform, blocks4.data(), blocks4.data(), blocks4.size());
+
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const AZ::Aabb expected = m_aabbs[i].GetTransformedAabb(transform);
+            EXPECT_THAT(results[i / 8].GetElement(i % 8), IsCloseTolerance(expected, 1e-3f));
+            EXPECT_THAT(blocks4[i / 4].GetElement(i % 4), IsCloseTolerance(expected, 1e-3f));
+        }
+    }
+
+    TEST_P(MATH_SoaMath, IntersectFrustumAabbs_MatchesFrustumIntersectAabb)
+    {
+        const AZ::Frustum frustum(AZ::ViewFrustumAttributes(
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(0.5f), AZ::Vector3(-5.0f, -10.0f, 0.0f)),
+            1.5f, 1.2f, 1.0f, 60.0f));
+
+        const AZStd::vector<AZ::AabbArray8> blocks = PackAabbs<8>();
+        AZStd::vector<AZ::IntersectResult> results(blocks.size() * 8);
+        AZ::Soa::IntersectFrustumAabbs(frustum, blocks.data(), blocks.size(), results.data());
+
+        const AZStd::vector<AZ::AabbArray4> blocks4 = PackAabbs<4>();
+        AZStd::vector<AZ::IntersectResult> results4(blocks4.size() * 4);
+        AZ::Soa::IntersectFrustumAabbs(frustum, blocks4.data(), blocks4.size(), results4.data());
+
+        size_t resultCounts[3] = {};
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            const AZ::IntersectResult expected = frustum.IntersectAabb(m_aabbs[i]);
+            EXPECT_EQ(expected, results[i]);
+            EXPECT_EQ(expected, results4[i]);
+            ++resultCounts[static_cast<size_t>(expected)];
+        }
+
+        // Make sure the test data covers every classification
+        EXPECT_GT(resultCounts[static_cast<size_t>(AZ::IntersectResult::Interior)], 0);
+        EXPECT_GT(resultCounts[static_cast<size_t>(AZ::IntersectResult::Overlaps)], 0);
+        EXPECT_GT(resultCounts[static_cast<size_t>(AZ::IntersectResult::Exterior)], 0);
+    }
+
+    TEST_P(MATH_SoaMath, IntersectRayAabbs_MatchesSlabTest)
+    {
+        const AZStd::vector<AZ::AabbArray8> blocks = PackAabbs<8>();
+        const AZStd::vector<AZ::AabbArray4> blocks4 = PackAabbs<4>();
+        AZStd::vector<float> hitDistances(blocks.size() * 8);
+        AZStd::vector<float> hitDistances4(blocks4.size() * 4);
+
+        // Each ray is aimed through the center of one of the bounding boxes. The last ray is parallel to the xy plane, which
+        // has to be handled separately by the kernels.
+        const AZ::Vector3 rayOrigins[] = { AZ::Vector3(-60.0f, 0.0f, 0.0f), AZ::Vector3(10.0f, -5.0f, 20.0f), AZ::Vector3(3.0f, 3.0f, 3.0f) };
+        const size_t targetIndices[] = { 10, 500, 1000 };
+        constexpr float MaxDistance = 1.0f;
+        for (size_t ray = 0; ray < AZ_ARRAY_SIZE(rayOrigins); ++ray)
+        {
+            AZ::Vector3 origin = rayOrigins[ray];
+            const AZ::Vector3 target = m_aabbs[targetIndices[ray]].GetCenter();
+            if (ray == AZ_ARRAY_SIZE(rayOrigins) - 1)
+            {
+                origin.SetZ(target.GetZ());
+            }
+            const AZ::Vector3 direction = (target - origin) * 1.5f;
+            const size_t hitCount = AZ::Soa::IntersectRayAabbs(origin, direction, MaxDistance, blocks.data(), blocks.size(), hitDistances.data());
+            AZ::Soa::IntersectRayAabbs(origin, direction, MaxDistance, blocks4.data(), blocks4.size(), hitDistances4.data());
+
+            size_t expectedHitCount = 0;
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                float entry = 0.0f;
+                float exit = MaxDistance;
+                bool hit = true;
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    const float minimum = m_aabbs[i].GetMin().GetElement(axis);
+                    const float maximum = m_aabbs[i].GetMax().GetElement(axis);
+                    if (direction.GetElement(axis) == 0.0f)
+                    {
+                        hit = hit && minimum <= origin.GetElement(axis) && origin.GetElement(axis) <= maximum;
+                        continue;
+                    }
+                    const float t0 = (minimum - origin.GetElement(axis)) / direction.GetElement(axis);
+                    const float t1 = (maximum - origin.GetElement(axis)) / direction.GetElement(axis);
+                    entry = AZ::GetMax(entry, AZ::GetMin(t0, t1));
+                    exit = AZ::GetMin(exit, AZ::GetMax(t0, t1));
+                }
+                hit = hit && entry <= exit;
+
+                if (hit)
+                {
+                    ++expectedHitCount;
+                    EXPECT_NEAR(entry, hitDistances[i], 1e-5f);
+                    EXPECT_NEAR(entry, hitDistances4[i], 1e-5f);
+                }
+                else
+                {
+                    EXPECT_EQ(AZ::Constants::FloatMax, hitDistances[i]);
+                    EXPECT_EQ(AZ::Constants::FloatMax, hitDistances4[i]);
+                }
+            }
+            EXPECT_GT(expectedHitCount, 0);
+
+            // The padding repeats the last bounding box
+            const size_t paddingCount = blocks.size() * 8 - ElementCount;
+            EXPECT_EQ(expectedHitCount + (hitDistances[ElementCount - 1] != AZ::Constants::FloatMax ? paddingCount : 0), hitCount);
+        }
+    }
+
+    TEST_P(MATH_SoaMath, OverlapAabbs_MatchesShapeIntersection)
+    {
+        const AZStd::vector<AZ::AabbArray8> blocks = PackAabbs<8>();
+        const AZStd::vector<AZ::AabbArray4> blocks4 = PackAabbs<4>();
+        AZStd::vector<uint32_t> masks(blocks.size());
+        AZStd::vector<uint32_t> masks4(blocks4.size());
+        AZStd::vector<uint32_t> containedMasks(blocks.size());
+        AZStd::vector<uint32_t> containedMasks4(blocks4.size());
+
+        auto checkMasks = [&](auto&& expectedOverlap, auto&& expectedContained)
+        {
+            size_t overlapCount = 0;
+            size_t containedCount = 0;
+            for (size_t i = 0; i < ElementCount; ++i)
+            {
+                const bool overlaps = expectedOverlap(m_aabbs[i]);
+                EXPECT_EQ(overlaps, (masks[i / 8] & (1u << (i % 8))) != 0);
+                EXPECT_EQ(overlaps, (masks4[i / 4] & (1u << (i % 4))) != 0);
+                overlapCount += overlaps;
+
+                const bool contained = expectedContained(m_aabbs[i]);
+                EXPECT_EQ(contained, (containedMasks[i / 8] & (1u << (i % 8))) != 0);
+                EXPECT_EQ(contained, (containedMasks4[i / 4] & (1u << (i % 4))) != 0);
+                containedCount += contained;
+            }
+            // Make sure the test data covers both results
+            EXPECT_GT(overlapCount, 0);
+            EXPECT_LT(overlapCount, ElementCount);
+            return containedCount;
+        };
+
+        const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-20.0f, -10.0f, -30.0f), AZ::Vector3(5.0f, 25.0f, 10.0f));
+        AZ::Soa::OverlapAabbs(aabb, blocks.data(), blocks.size(), masks.data());
+        AZ::Soa::OverlapAabbs(aabb, blocks4.data(), blocks4.size(), masks4.data());
+        checkMasks(
+            [&aabb](const AZ::Aabb& element) { return AZ::ShapeIntersection::Overlaps(aabb, element); },
+            [](const AZ::Aabb&) { return false; });
+
+        const AZ::Sphere sphere(AZ::Vector3(10.0f, -5.0f, 3.0f), 25.0f);
+        AZ::Soa::OverlapAabbs(sphere, blocks.data(), blocks.size(), masks.data());
+        AZ::Soa::OverlapAabbs(sphere, blocks4.data(), blocks4.size(), masks4.data());
+        checkMasks(
+            [&sphere](const AZ::Aabb& element) { return AZ::ShapeIntersection::Overlaps(sphere, element); },
+            [](const AZ::Aabb&) { return false; });
+
+        const AZ::Frustum frustum(AZ::ViewFrustumAttributes(
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(0.5f), AZ::Vector3(-5.0f, -10.0f, 0.0f)),
+            1.5f, 1.2f, 1.0f, 60.0f));
+        AZ::Soa::OverlapAabbs(frustum, blocks.data(), blocks.size(), masks.data(), containedMasks.data());
+        AZ::Soa::OverlapAabbs(frustum, blocks4.data(), blocks4.size(), masks4.data(), containedMasks4.data());
+        const size_t containedCount = checkMasks(
+            [&frustum](const AZ::Aabb& element) { return AZ::ShapeIntersection::Overlaps(frustum, element); },
+            [&frustum](const AZ::Aabb& element) { return AZ::ShapeIntersection::Contains(frustum, element); });
+        EXPECT_GT(containedCount, 0);
+    }
+
+    INSTANTIATE_TEST_SUITE_P(
+        MATH_SoaMath,
+        MATH_SoaMath,
+        ::testing::Values(AZ::Soa::InstructionSet::Simd128, AZ::Soa::InstructionSet::Avx2),
+        [](const ::testing::TestParamInfo<AZ::Soa::InstructionSet>& info)
+        {
+            return info.param == AZ::Soa::InstructionSet::Avx2 ? "Avx2" : "Simd128";
+        });
+} // namespace UnitTest
@@ -18,6 +18,9 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Utils/Utils.h>
 
 #include <benchmark/benchmark.h>
@@ -47,6 +50,24 @@ namespace Benchmark
         AZ_TYPE_INFO(HphaSchemaAllocator, "{6563AB4B-A68E-4499-8C98-D61D640D1F7F}");
     };
 
+    // HphaSchema with the opt-in per-thread cache enabled, to compare against the default schema in the threaded benchmarks
+    class HphaSchemaThreadCache : public AZ::HphaSchema
+    {
+    public:
+        AZ_TYPE_INFO(HphaSchemaThreadCache, "{5C0E8D35-7A1B-4B5E-9F0A-2E6C4D7B8A91}");
+
+        HphaSchemaThreadCache()
+            : AZ::HphaSchema(Descriptor{ /*m_threadCacheEnabled*/ true })
+        {
+        }
+    };
+
+    class HphaSchemaThreadCacheAllocator : public AZ::SimpleSchemaAllocator<HphaSchemaThreadCache>
+    {
+    public:
+        AZ_TYPE_INFO(HphaSchemaThreadCacheAllocator, "{0F5E2B7C-3D41-4C8A-B6E9-71A2D58C3F04}");
+    };
+
     // For the SystemAllocator we inherit so we have a different stack. The SystemAllocator is used globally so we dont want
     // to get that data affecting the benchmark
     class TestSystemAllocator : public AZ::SystemAllocator
@@ -250,6 +271,93 @@ namespace Benchmark
         }
     };
 
+    // Threads are paired, the even thread of a pair allocates small blocks and passes them to the odd thread, which frees them.
+    // This is the pattern of work queues and events passed between threads, where blocks are freed by a thread that didn't
+    // allocate them.
+    template <typename TAllocator>
+    class CrossThreadFreeBenchmarkFixture
+        : public AllocatorBenchmarkFixture<TAllocator>
+    {
+        using base = AllocatorBenchmarkFixture<TAllocator>;
+
+        // Single producer, single consumer ring buffer of allocations
+        struct Channel
+        {
+            static constexpr size_t Capacity = 1024;
+            AZStd::array<void*, Capacity> m_allocations;
+            AZStd::atomic<size_t> m_head{ 0 };
+            AZStd::atomic<size_t> m_tail{ 0 };
+        };
+
+    protected:
+        void internalSetUp(const ::benchmark::State& state) override
+        {
+            base::internalSetUp(state);
+            if (state.thread_index() == 0)
+            {
+                m_channels.resize(state.threads() / 2);
+                for (auto& channel : m_channels)
+                {
+                    channel = AZStd::make_unique<Channel>();
+                }
+            }
+        }
+
+        void internalTearDown(const ::benchmark::State& state) override
+        {
+            if (state.thread_index() == 0)
+            {
+                m_channels.clear();
+                m_channels.shrink_to_fit();
+            }
+            base::internalTearDown(state);
+        }
+
+    public:
+        void Benchmark(benchmark::State& state)
+        {
+            const AllocationSizeArray& allocationArray = s_allocationSizes[SMALL];
+            const size_t numberOfAllocations = state.range(0);
+            const bool isProducer = (state.thread_index() % 2) == 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                // Looked up after the benchmark started, when thread 0 is done setting up the channels
+                Channel& channel = *m_channels[state.thread_index() / 2];
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    const size_t allocationSize = allocationArray[allocationIndex % allocationArray.size()];
+                    if (isProducer)
+                    {
+                        void* allocation = this->GetAllocator().allocate(allocationSize, 16);
+                        const size_t tail = channel.m_tail.load(AZStd::memory_order_relaxed);
+                        while (tail - channel.m_head.load(AZStd::memory_order_acquire) == Channel::Capacity)
+                        {
+                            AZStd::this_thread::yield();
+                        }
+                        channel.m_allocations[tail % Channel::Capacity] = allocation;
+                        channel.m_tail.store(tail + 1, AZStd::memory_order_release);
+                    }
+                    else
+                    {
+                        // Allocations are consumed in the order they were produced, so the size matches the allocation index
+                        const size_t head = channel.m_head.load(AZStd::memory_order_relaxed);
+                        while (channel.m_tail.load(AZStd::memory_order_acquire) == head)
+                        {
+                            AZStd::this_thread::yield();
+                        }
+                        void* allocation = channel.m_allocations[head % Channel::Capacity];
+                        channel.m_head.store(head + 1, AZStd::memory_order_release);
+                        this->GetAllocator().deallocate(allocation, allocationSize, 16);
+                    }
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * numberOfAllocations);
+        }
+
+    private:
+        AZStd::vector<AZStd::unique_ptr<Channel>> m_channels;
+    };
+
     template<typename TAllocator>
     class RecordedAllocationBenchmarkFixture : public ::benchmark::Fixture
     {
@@ -447,6 +555,11 @@ namespace Benchmark
         b->Arg(100);
     }
 
+    static void CrossThreadRunRanges(benchmark::internal::Benchmark* b)
+    {
+        b->Arg(1000);
+    }
+
     // Test under and over-subscription of threads vs the amount of CPUs available
     static const unsigned int MaxThreadRange = 2 * AZStd::thread::hardware_concurrency();
 
@@ -468,8 +581,13 @@ namespace Benchmark
         BM_REGISTER_SIZE_FIXTURES(AllocationBenchmarkFixture, TESTNAME, ALLOCATORTYPE); \
         BM_REGISTER_SIZE_FIXTURES(DeAllocationBenchmarkFixture, TESTNAME, ALLOCATORTYPE); \
         BM_REGISTER_TEMPLATE(RecordedAllocationBenchmarkFixture, TESTNAME, ALLOCATORTYPE)->Apply(RecordedRunRanges); \
+        BM_REGISTER_CROSS_THREAD_FIXTURE(TESTNAME, ALLOCATORTYPE); \
     }
 
+    // Producer/consumer pairs, so the thread count is always even
+#define BM_REGISTER_CROSS_THREAD_FIXTURE(TESTNAME, ALLOCATORTYPE) \
+    BM_REGISTER_TEMPLATE(CrossThreadFreeBenchmarkFixture, TESTNAME##_CROSS_THREAD_FREE, ALLOCATORTYPE)->DenseThreadRange(2, MaxThreadRange, 2)->Apply(CrossThreadRunRanges)
+
     /// Warm up benchmark used to prepare the OS for allocations. Most OS keep allocations for a process somehow
     /// reserved. So the first allocations run always get a bigger impact in a process. This warm up allocator runs
     /// all the benchmarks and is just used for the the next allocators to report more consistent results.
@@ -479,9 +597,15 @@ namespace Benchmark
     BM_REGISTER_ALLOCATOR(HphaSchemaAllocator, HphaSchemaAllocator);
     BM_REGISTER_ALLOCATOR(SystemAllocator, TestSystemAllocator);
 
+    namespace BM_HphaSchemaThreadCacheAllocator
+    {
+        BM_REGISTER_CROSS_THREAD_FIXTURE(HphaSchemaThreadCacheAllocator, HphaSchemaThreadCacheAllocator);
+    }
+
     //BM_REGISTER_SCHEMA(PoolSchema); // Requires special alignment requests while allocating
     // BM_REGISTER_ALLOCATOR(OSAllocator, OSAllocator); // Requires special treatment to initialize since it will be already initialized, maybe creating a different instance?
 
+#undef BM_REGISTER_CROSS_THREAD_FIXTURE
 #undef BM_REGISTER_ALLOCATOR
 #undef BM_REGISTER_SIZE_FIXTURES
 #undef BM_REGISTER_TEMPLATE
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTestFixture
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(FrameArenaAllocatorTestFixture, Allocate_ReturnsAlignedNonOverlappingMemory)
+    {
+        AZ::FrameArenaAllocator arena(4 * 1024);
+
+        constexpr size_t AllocationCount = 256;
+        AZStd::vector<AZStd::pair<char*, size_t>> allocations;
+        for (size_t i = 0; i < AllocationCount; ++i)
+        {
+            const size_t size = 1 + (i * 37) % 300;
+            const size_t alignment = size_t(1) << (i % 7);
+            char* address = static_cast<char*>(arena.allocate(size, alignment));
+            ASSERT_NE(nullptr, address);
+            EXPECT_EQ(0, reinterpret_cast<uintptr_t>(address) % alignment);
+            memset(address, static_cast<int>(i), size);
+            allocations.emplace_back(address, size);
+        }
+
+        for (size_t i = 0; i < AllocationCount; ++i)
+        {
+            const auto& [address, size] = allocations[i];
+            for (size_t byte = 0; byte < size; ++byte)
+            {
+                ASSERT_EQ(static_cast<char>(i), address[byte]);
+            }
+        }
+        EXPECT_GE(arena.NumAllocatedBytes(), AllocationCount);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, NextFrame_ReleasesSingleFrameAllocationsAndTracksPeak)
+    {
+        AZ::FrameArenaAllocator arena(4 * 1024);
+
+        void* first = arena.allocate(512, 16);
+        arena.allocate(10 * 1024, 16); // larger than a page
+        const size_t allocatedBytes = arena.NumAllocatedBytes();
+        EXPECT_GE(allocatedBytes, 512 + 10 * 1024);
+
+        arena.NextFrame();
+        EXPECT_EQ(1, arena.GetFrameIndex());
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+        EXPECT_EQ(allocatedBytes, arena.GetLastFrameAllocatedBytes());
+        EXPECT_EQ(allocatedBytes, arena.GetPeakAllocatedBytes());
+
+        // The pages used in the previous frame are reused
+        const size_t reservedBytes = arena.GetReservedBytes();
+        EXPECT_EQ(first, arena.allocate(512, 16));
+        EXPECT_EQ(reservedBytes, arena.GetReservedBytes());
+
+        arena.NextFrame();
+        EXPECT_EQ(allocatedBytes, arena.GetPeakAllocatedBytes());
+        EXPECT_LT(arena.GetLastFrameAllocatedBytes(), allocatedBytes);
+
+        // Pages that weren't used in the released frame are returned once the thread allocates in the new frame
+        EXPECT_EQ(reservedBytes, arena.GetReservedBytes());
+        arena.allocate(16, 16);
+        EXPECT_LT(arena.GetReservedBytes(), reservedBytes);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, TwoFrameAllocations_SurviveOneNextFrame)
+    {
+        AZ::FrameArenaAllocator arena(4 * 1024);
+
+        auto* value = static_cast<AZ::u32*>(arena.Allocate(sizeof(AZ::u32), alignof(AZ::u32), AZ::FrameArenaLifetime::TwoFrames).GetAddress());
+        *value = 0xC0FFEE;
+        const size_t twoFrameBytes = arena.NumAllocatedBytes();
+
+        arena.NextFrame();
+        EXPECT_EQ(twoFrameBytes, arena.NumAllocatedBytes());
+        // Allocations of the new frame go to the other half of the double buffer
+        auto* nextValue = static_cast<AZ::u32*>(arena.Allocate(sizeof(AZ::u32), alignof(AZ::u32), AZ::FrameArenaLifetime::TwoFrames).GetAddress());
+        *nextValue = 0;
+        EXPECT_EQ(0xC0FFEE, *value);
+
+        arena.NextFrame();
+        EXPECT_EQ(twoFrameBytes, arena.NumAllocatedBytes());
+        arena.NextFrame();
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Reallocate_LastAllocation_GrowsInPlace)
+    {
+        AZ::FrameArenaAllocator arena(4 * 1024);
+
+        char* address = static_cast<char*>(arena.allocate(64, 8));
+        memset(address, 7, 64);
+        EXPECT_EQ(address, arena.reallocate(address, 128, 8).GetAddress());
+        EXPECT_EQ(128, arena.NumAllocatedBytes());
+
+        // Doesn't fit in the page anymore, so it's moved and the content copied
+        char* moved = static_cast<char*>(arena.reallocate(address, 8 * 1024, 8).GetAddress());
+        ASSERT_NE(nullptr, moved);
+        EXPECT_NE(address, moved);
+        for (size_t byte = 0; byte < 64; ++byte)
+        {
+            ASSERT_EQ(7, moved[byte]);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ThreadsAllocatingConcurrently_UseSeparateRegions)
+    {
+        AZ::FrameArenaAllocator arena(4 * 1024);
+
+        constexpr size_t ThreadCount = 8;
+        constexpr size_t AllocationsPerThread = 1000;
+        constexpr size_t AllocationSize = 32;
+        AZStd::thread threads[ThreadCount];
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread(
+                [&arena, threadIndex]()
+                {
+                    AZStd::vector<AZ::u64*> values;
+                    for (size_t i = 0; i < AllocationsPerThread; ++i)
+                    {
+                        auto* value = static_cast<AZ::u64*>(arena.allocate(AllocationSize, alignof(AZ::u64)).GetAddress());
+                        *value = (threadIndex << 32) | i;
+                        values.push_back(value);
+                    }
+                    for (size_t i = 0; i < AllocationsPerThread; ++i)
+                    {
+                        EXPECT_EQ((threadIndex << 32) | i, *values[i]);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(ThreadCount * AllocationsPerThread * AllocationSize, arena.NumAllocatedBytes());
+        arena.NextFrame();
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, NextFrameWhileThreadsAllocate_ThreadsReleaseTheirOwnRegions)
+    {
+        AZ::FrameArenaAllocator arena(4 * 1024);
+
+        constexpr size_t ThreadCount = 4;
+        constexpr size_t AllocationsPerThread = 20000;
+        constexpr size_t ValuesPerAllocation = 8;
+        AZStd::atomic<size_t> finishedThreads{ 0 };
+        AZStd::thread threads[ThreadCount];
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread(
+                [&arena, &finishedThreads, threadIndex]()
+                {
+                    for (size_t i = 0; i < AllocationsPerThread; ++i)
+                    {
+                        // Releasing the frame must not reset the region this thread is writing to
+                        auto* values = static_cast<AZ::u64*>(
+                            arena.allocate(ValuesPerAllocation * sizeof(AZ::u64), alignof(AZ::u64)).GetAddress());
+                        ASSERT_NE(nullptr, values);
+                        for (size_t value = 0; value < ValuesPerAllocation; ++value)
+                        {
+                            values[value] = (threadIndex << 32) | i;
+                        }
+                        for (size_t value = 0; value < ValuesPerAllocation; ++value)
+                        {
+                            ASSERT_EQ((threadIndex << 32) | i, values[value]);
+                        }
+                    }
+                    ++finishedThreads;
+                });
+        }
+
+        do
+        {
+            arena.NextFrame();
+            AZStd::this_thread::yield();
+        } while (finishedThreads < ThreadCount);
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        arena.NextFrame();
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, StdAllocator_ContainerAllocatesFromArenaSingleton)
+    {
+        auto& arena = static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get());
+        arena.NextFrame();
+        arena.NextFrame();
+        const size_t allocatedBytes = arena.NumAllocatedBytes();
+
+        {
+            AZStd::vector<int, AZ::FrameArenaStdAllocator<>> values;
+            values.reserve(100);
+            for (int i = 0; i < 100; ++i)
+            {
+                values.push_back(i);
+            }
+            EXPECT_EQ(99, values.back());
+        }
+        EXPECT_GE(arena.NumAllocatedBytes(), allocatedBytes + 100 * sizeof(int));
+
+        // Release everything again, so the arena reports the same number of allocated bytes as before the test
+        arena.NextFrame();
+        arena.NextFrame();
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Builds a few transient vectors per frame and throws them away, the way per-tick scratch data is used.
+    template<typename Allocator, typename ResetFrame>
+    static void RunTransientFrames(::benchmark::State& state, ResetFrame&& resetFrame)
+    {
+        constexpr size_t ListsPerFrame = 16;
+        const size_t elementsPerList = static_cast<size_t>(state.range(0)) / ListsPerFrame;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t list = 0; list < ListsPerFrame; ++list)
+            {
+                AZStd::vector<AZ::u64, Allocator> values;
+                values.reserve(elementsPerList);
+                for (size_t i = 0; i < elementsPerList; ++i)
+                {
+                    values.push_back(i);
+                }
+                ::benchmark::DoNotOptimize(values.data());
+            }
+            resetFrame();
+        }
+        state.SetItemsProcessed(state.iterations() * ListsPerFrame);
+    }
+
+    static void BM_TransientFrame_SystemAllocator(::benchmark::State& state)
+    {
+        RunTransientFrames<AZ::AZStdAlloc<AZ::SystemAllocator>>(state, []() {});
+    }
+
+    static void BM_TransientFrame_FrameArenaAllocator(::benchmark::State& state)
+    {
+        auto& arena = static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get());
+        RunTransientFrames<AZ::FrameArenaStdAllocator<>>(state, [&arena]() { arena.NextFrame(); });
+    }
+
+    // Single threaded, to compare the cost of the allocators without contention.
+    BENCHMARK(BM_TransientFrame_SystemAllocator)->RangeMultiplier(8)->Range(64, 32768);
+    BENCHMARK(BM_TransientFrame_FrameArenaAllocator)->RangeMultiplier(8)->Range(64, 32768);
+} // namespace Benchmark
+
+#endif // defined(HAVE_BENCHMARK)
@@ -9,6 +9,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -27,6 +28,30 @@ namespace UnitTest
         ~HphaSchema_TestAllocator() override = default;
     };
 
+    class HphaSchemaThreadCache : public AZ::HphaSchema
+    {
+    public:
+        AZ_TYPE_INFO(HphaSchemaThreadCache, "{3B8E61F2-94D7-4A0C-8E25-C71F0A6D49B3}");
+
+        HphaSchemaThreadCache()
+            : AZ::HphaSchema(Descriptor{ /*m_threadCacheEnabled*/ true })
+        {
+        }
+    };
+
+    class HphaSchemaThreadCache_TestAllocator : public AZ::SimpleSchemaAllocator<HphaSchemaThreadCache>
+    {
+    public:
+        AZ_TYPE_INFO(HphaSchemaThreadCache_TestAllocator, "{D05A7C3E-1F68-4B92-A4E7-5C38B9F1026D}");
+
+        HphaSchemaThreadCache_TestAllocator()
+        {
+            Create();
+        }
+
+        ~HphaSchemaThreadCache_TestAllocator() override = default;
+    };
+
     static const size_t s_kiloByte = 1024;
     static const size_t s_megaByte = s_kiloByte * s_kiloByte;
     using AllocationSizeArray = AZStd::array<size_t, 10>;
@@ -102,4 +127,73 @@ namespace UnitTest
     INSTANTIATE_TEST_SUITE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    using HphaSchemaThreadCacheTestFixture = LeakDetectionFixture;
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, FreeOnAnotherThread_CachedBlocksAreNotReportedAsAllocated)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchemaThreadCache_TestAllocator>::Get();
+        const size_t allocatedBytesBefore = allocator.NumAllocatedBytes();
+
+        constexpr size_t NumberOfAllocations = 1000;
+        AZStd::vector<void*, AZ::OSStdAllocator> allocations;
+        for (size_t i = 0; i < NumberOfAllocations; ++i)
+        {
+            allocations.emplace_back(allocator.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0));
+            ASSERT_NE(nullptr, allocations.back());
+        }
+        EXPECT_LT(allocatedBytesBefore, allocator.NumAllocatedBytes());
+
+        // The freeing thread keeps part of the blocks in its cache, and returns them to the buckets when it exits
+        AZStd::thread consumer(
+            [&allocator, &allocations]()
+            {
+                for (size_t i = 0; i < NumberOfAllocations; ++i)
+                {
+                    allocator.DeAllocate(allocations[i], s_smallAllocationSizes[i % s_smallAllocationSizes.size()]);
+                }
+            });
+        consumer.join();
+        EXPECT_EQ(allocatedBytesBefore, allocator.NumAllocatedBytes());
+
+        // Blocks served from and returned to the cache of this thread
+        void* allocation = allocator.Allocate(16, 0);
+        ASSERT_NE(nullptr, allocation);
+        allocator.DeAllocate(allocation, 16);
+        allocator.GarbageCollect();
+        EXPECT_EQ(allocatedBytesBefore, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, SetThreadCacheEnabled_TurnedOffAfterUse_CachedBlocksAreReturned)
+    {
+        AZ::HphaSchema schema;
+        EXPECT_FALSE(schema.IsThreadCacheEnabled());
+        schema.SetThreadCacheEnabled(true);
+        EXPECT_TRUE(schema.IsThreadCacheEnabled());
+        const size_t allocatedBytesBefore = schema.NumAllocatedBytes();
+
+        // Fill the cache of this thread by freeing blocks of the same bucket
+        constexpr size_t NumberOfAllocations = 100;
+        AZStd::vector<void*, AZ::OSStdAllocator> allocations;
+        for (size_t i = 0; i < NumberOfAllocations; ++i)
+        {
+            allocations.emplace_back(schema.allocate(16, 0));
+            ASSERT_NE(nullptr, allocations.back());
+        }
+        for (void* allocation : allocations)
+        {
+            schema.deallocate(allocation, 16);
+        }
+
+        schema.SetThreadCacheEnabled(false);
+        EXPECT_FALSE(schema.IsThreadCacheEnabled());
+        EXPECT_EQ(allocatedBytesBefore, schema.NumAllocatedBytes());
+
+        // Blocks now go straight to the buckets
+        void* allocation = schema.allocate(16, 0);
+        ASSERT_NE(nullptr, allocation);
+        EXPECT_LT(allocatedBytesBefore, schema.NumAllocatedBytes());
+        schema.deallocate(allocation, 16);
+        EXPECT_EQ(allocatedBytesBefore, schema.NumAllocatedBytes());
+    }
 }
@@ -193,4 +193,121 @@ namespace AZ::NameBenchmarks
         state.SetItemsProcessed(state.iterations() * state.range(0));
     }
     BENCHMARK_REGISTER_F(NameBenchmarkFixture, NameLiteralCreateAndDestroy)->Arg(10)->Arg(100)->Arg(1000);
+
+    // Fixture for benchmarks that run on several threads. The dictionary is only alive between the SetUp and TearDown of
+    // thread 0, so the other threads must not hold names outside of the timed loop, whose start and end synchronize all
+    // the threads. Thread 0 keeps a pool of shared names alive for the whole run instead.
+    class ConcurrentNameBenchmarkFixture : public NameBenchmarkFixture
+    {
+    public:
+        static constexpr size_t PoolSize = 100;
+
+        void SetUp(const ::benchmark::State& st) override
+        {
+            NameBenchmarkFixture::SetUp(st);
+            CreateSharedNames(st);
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            NameBenchmarkFixture::SetUp(st);
+            CreateSharedNames(st);
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            DestroySharedNames(st);
+            NameBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            DestroySharedNames(st);
+            NameBenchmarkFixture::TearDown(st);
+        }
+
+        static AZStd::string GetSharedNameString(size_t index)
+        {
+            return AZStd::string::format("shared%zu", index);
+        }
+
+    private:
+        void CreateSharedNames(const ::benchmark::State& st)
+        {
+            if (st.thread_index() == 0)
+            {
+                for (size_t i = 0; i < PoolSize; ++i)
+                {
+                    m_sharedNames.emplace_back(GetSharedNameString(i));
+                }
+            }
+        }
+
+        void DestroySharedNames(const ::benchmark::State& st)
+        {
+            if (st.thread_index() == 0)
+            {
+                m_sharedNames = {};
+            }
+        }
+
+        AZStd::vector<AZ::Name> m_sharedNames;
+    };
+
+    // Every thread creates names from strings that are already in the dictionary, the way worker threads resolve names
+    // when loading assets.
+    BENCHMARK_DEFINE_F(ConcurrentNameBenchmarkFixture, ConcurrentCreateNameCacheHit)(::benchmark::State& state)
+    {
+        AZStd::vector<AZStd::string> sharedStrings;
+        for (size_t i = 0; i < PoolSize; ++i)
+        {
+            sharedStrings.emplace_back(GetSharedNameString(i));
+        }
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(sharedStrings[i]));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(ConcurrentNameBenchmarkFixture, ConcurrentCreateNameCacheHit)->ThreadRange(1, 16)->UseRealTime();
+
+    // Mix of lookups of shared names with names that are unique to the thread, which are added to the dictionary and
+    // released again. The argument is the percentage of operations that add and release a name.
+    BENCHMARK_DEFINE_F(ConcurrentNameBenchmarkFixture, ConcurrentLookupInsertMix)(::benchmark::State& state)
+    {
+        const size_t insertPercentage = static_cast<size_t>(state.range(0));
+        AZStd::vector<AZStd::string> names;
+        for (size_t i = 0; i < PoolSize; ++i)
+        {
+            if (i < insertPercentage)
+            {
+                names.emplace_back(AZStd::string::format("thread%d_unique%zu", state.thread_index(), i));
+            }
+            else
+            {
+                names.emplace_back(GetSharedNameString(i));
+            }
+        }
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(names[i]));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(ConcurrentNameBenchmarkFixture, ConcurrentLookupInsertMix)
+        ->Arg(1)
+        ->Arg(10)
+        ->Arg(50)
+        ->ThreadRange(1, 16)
+        ->UseRealTime();
 } // namespace AZ::NameBenchmarks
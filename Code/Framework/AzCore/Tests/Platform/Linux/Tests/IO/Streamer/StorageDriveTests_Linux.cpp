@@ -0,0 +1,883 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr AZ::u32 TestRegisteredBufferCount = 2;
+    constexpr size_t TestRegisteredBufferSize = 16_kib;
+    constexpr bool TestEnableDirectReads = true;
+    constexpr bool HasSeekPenalty = false;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = HasSeekPenalty;
+            options.m_enableDirectReads = TestEnableDirectReads;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize,
+                TestQueueDepth, TestOverCommit, TestRegisteredBufferCount, TestRegisteredBufferSize, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_SUITE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::LeakDetectionFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        // Data...
+        static constexpr char s_dummyFilename[] = "Dummy.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StreamStackEntry> m_storageDriveLinux{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+        StorageDriveLinux::ConstructionOptions m_configurationOptions;
+
+        // Methods...
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetupStorageDrive(s32 overCommit)
+        {
+            if (m_context == nullptr)
+            {
+                m_context = new AZ::IO::StreamerContext();
+            }
+
+            ASSERT_FALSE(m_dummyFilepath.empty());
+
+            m_configurationOptions.m_hasSeekPenalty = HasSeekPenalty;
+            m_configurationOptions.m_enableDirectReads = TestEnableDirectReads;
+            m_configurationOptions.m_minimalReporting = true;
+
+            m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries,
+                TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, overCommit, TestRegisteredBufferCount,
+                TestRegisteredBufferSize, m_configurationOptions);
+            m_storageDriveLinux->SetContext(*m_context);
+        }
+
+        void SetUp() override
+        {
+            if (!StorageDriveLinux::IsSupported())
+            {
+                GTEST_SKIP() << "io_uring isn't available on this system.";
+            }
+
+            m_dummyRequestPath = RequestPath(AZ::IO::PathView(m_dummyFilepath));
+
+            SetupStorageDrive(TestOverCommit);
+        }
+
+        void TearDown() override
+        {
+            m_storageDriveLinux.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            RemoveDummyFiles();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // If beginEndMarkers is true, it will write in specific bytes to mark the begin and end of the file.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            SystemFile file;
+            bool fileCreated = file.Open(m_dummyFilepath.c_str(),
+                SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+
+            ASSERT_TRUE(fileCreated);
+
+            m_dummyFiles.push_back(m_dummyFilepath);
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void RemoveDummyFiles()
+        {
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+            m_dummyFiles.shrink_to_fit();
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::steady_clock::now();
+            do
+            {
+                m_storageDriveLinux->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDriveLinux->UpdateStatus(status);
+
+                if (AZStd::chrono::steady_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        void ReadAndVerify(u8* output, size_t outputSize, u64 offset, size_t readSize, size_t fileSize)
+        {
+            bool completed = false;
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, output, outputSize, m_dummyRequestPath, offset, readSize);
+            request->SetCompletionCallback([&completed](const FileRequest& request)
+                {
+                    EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    completed = true;
+                });
+
+            m_storageDriveLinux->QueueRequest(request);
+            WaitTillCompleted();
+            ASSERT_TRUE(completed);
+
+            for (size_t i = 0; i < readSize; ++i)
+            {
+                const u64 fileOffset = offset + i;
+                const char expected = fileOffset == 0 ? s_beginCharacter
+                    : fileOffset == fileSize - 1 ? s_endCharacter
+                    : s_fileCharacter;
+                ASSERT_EQ(expected, static_cast<char>(output[i])) << "Mismatch at file offset " << fileOffset;
+            }
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+
+            // Create the "TestFiles" dir in the bin directory if it doesn't exist...
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                if (!AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    return;
+                }
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0,
+            TestQueueDepth, TestOverCommit, TestRegisteredBufferCount, TestRegisteredBufferSize, m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidOvercommit_ErrorIsReportedAndSizeAdjusted)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries,
+            TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, -(aznumeric_cast<s32>(TestQueueDepth) + 2),
+            TestRegisteredBufferCount, TestRegisteredBufferSize, m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZ::IO::StreamStackEntry::Status status{};
+        m_storageDriveLinux->UpdateStatus(status);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileDoesntExist_ReturnsFalse)
+    {
+        AZ::IO::RequestPath path(AZ::IO::PathView(m_dummyFilepath + ".disappear"));
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_FALSE(fileMetaData.m_found);
+                EXPECT_EQ(0, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileExists_ReturnsCompletedWithFileFound)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_TRUE(fileExists.m_found);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_Directory_ReturnsCompletedWithFileNotFound)
+    {
+        AZStd::string directory = m_dummyFilepath;
+        AZ::StringFunc::Path::StripFullName(directory);
+        AZ::IO::RequestPath path{ AZ::IO::PathView(directory) };
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_FALSE(fileExists.m_found);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_AlignedRead_ReturnsCorrectData)
+    {
+        constexpr size_t fileSize = 16_kib;
+        CreateDummyFile(fileSize, 0, true);
+
+        u8* buffer = reinterpret_cast<u8*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        ReadAndVerify(buffer, fileSize, 0, fileSize, fileSize);
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetRead_ReturnsCorrectData)
+    {
+        constexpr size_t fileSize = 16_kib;
+        constexpr u64 offset = 1_kib + 3;
+        constexpr size_t readSize = fileSize - offset;
+        CreateDummyFile(fileSize, 0, true);
+
+        // Fits in a registered buffer.
+        AZStd::unique_ptr<u8[]> buffer(new u8[readSize]);
+        ReadAndVerify(buffer.get(), readSize, offset, readSize, fileSize);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedSizeRead_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        constexpr size_t fileSize = 16_kib;
+        constexpr size_t readSize = 4_kib + 7;
+        CreateDummyFile(fileSize, 0, true);
+
+        AZStd::unique_ptr<u8[]> buffer(new u8[readSize + 1]);
+        buffer[readSize] = 'X';
+        ReadAndVerify(buffer.get(), readSize, 0, readSize, fileSize);
+        EXPECT_EQ('X', buffer[readSize]);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedReadLargerThanRegisteredBuffers_ReturnsCorrectData)
+    {
+        constexpr size_t fileSize = TestRegisteredBufferSize * 4;
+        CreateDummyFile(fileSize, 0, true);
+
+        // Offset the memory by a byte so the read can't be done directly into the output buffer.
+        AZStd::unique_ptr<u8[]> buffer(new u8[fileSize + 1]);
+        ReadAndVerify(buffer.get() + 1, fileSize, 0, fileSize, fileSize);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_ReportsFailure)
+    {
+        AZ::IO::RequestPath path(AZ::IO::PathView(m_dummyFilepath + ".disappear"));
+        u8 buffer[16];
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), path, 0, sizeof(buffer));
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ReadPastEndOfFile_ReportsFailure)
+    {
+        constexpr size_t fileSize = 4_kib;
+        CreateDummyFile(fileSize);
+
+        AZStd::unique_ptr<u8[]> buffer(new u8[fileSize]);
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 1_kib, fileSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ParallelReads_AllReadsSubmittedTogetherAndDataIsCorrect)
+    {
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = TestQueueDepth * 2;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        u8* buffer = reinterpret_cast<u8*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        size_t numCompleted = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer + i * chunkSize, chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&numCompleted](const FileRequest& request)
+                {
+                    EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    numCompleted++;
+                });
+            m_storageDriveLinux->QueueRequest(request);
+        }
+
+        // The first call queues as many reads as the queue depth allows in a single submission.
+        m_storageDriveLinux->ExecuteRequests();
+        AZ::IO::StreamStackEntry::Status status;
+        m_storageDriveLinux->UpdateStatus(status);
+        EXPECT_EQ(TestOverCommit + aznumeric_cast<s32>(TestQueueDepth) - aznumeric_cast<s32>(numChunks), status.m_numAvailableSlots);
+
+        WaitTillCompleted();
+        EXPECT_EQ(numChunks, numCompleted);
+
+        EXPECT_EQ(s_beginCharacter, buffer[0]);
+        EXPECT_EQ(s_endCharacter, buffer[fileSize - 1]);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(s_chunkCharacter, buffer[i * chunkSize]);
+            EXPECT_EQ(s_fileCharacter, buffer[i * chunkSize - 1]);
+        }
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FlushEntireCacheRequest_FlushPreviouslyReadFileAndMetaData_NoErrorsReported)
+    {
+        constexpr size_t fileSize = 4_kib;
+        CreateDummyFile(fileSize, 0, true);
+        u8* buffer = reinterpret_cast<u8*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        ReadAndVerify(buffer, fileSize, 0, fileSize, fileSize);
+        azfree(buffer);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFlushAll();
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+
+        AZStd::vector<Statistic> report;
+        request = m_context->GetNewInternalRequest();
+        request->CreateReport(report, IStreamerTypes::ReportType::FileLocks);
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+        EXPECT_TRUE(report.empty());
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        constexpr size_t fileSize = 4_kib;
+        CreateDummyFile(fileSize, 0, true);
+        u8* buffer = reinterpret_cast<u8*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        ReadAndVerify(buffer, fileSize, 0, fileSize, fileSize);
+        azfree(buffer);
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDriveLinux->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+    }
+
+    class Streamer_StorageDriveLinuxTestFixture_WithScheduler
+        : public Streamer_StorageDriveLinuxTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            Streamer_StorageDriveLinuxTestFixture::SetUp();
+            if (IsSkipped())
+            {
+                return;
+            }
+
+            AZStd::unique_ptr<Scheduler> stack = AZStd::make_unique<Scheduler>(m_storageDriveLinux);
+            m_streamer = aznew AZ::IO::Streamer(AZStd::thread_desc{}, AZStd::move(stack));
+            ASSERT_NE(m_streamer, nullptr);
+            Interface<IStreamer>::Register(m_streamer);
+        }
+
+        void TearDown() override
+        {
+            if (m_streamer)
+            {
+                Interface<IStreamer>::Unregister(m_streamer);
+                delete m_streamer;
+                m_streamer = nullptr;
+            }
+
+            Streamer_StorageDriveLinuxTestFixture::TearDown();
+        }
+
+    protected:
+        Streamer* m_streamer{ nullptr };
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture_WithScheduler, ReadDataRequest_ParallelReadsUsingIStreamer_DataIsCorrect)
+    {
+        // The Streamer thread is suspended while reads are in flight, so this also verifies completions wake it up.
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = 32;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+        AZStd::vector<AZ::IO::FileRequestPtr> requests;
+        requests.reserve(numChunks);
+
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        AZStd::binary_semaphore waitForReads;
+        AZStd::atomic_size_t numCallbacks = 0;
+
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            requests.push_back(m_streamer->Read(
+                m_dummyFilepath,
+                buffers[i].get(),
+                chunkSize,
+                chunkSize,
+                IStreamerTypes::s_noDeadline,
+                IStreamerTypes::s_priorityMedium,
+                i * chunkSize
+            ));
+
+            auto callback = [&numCallbacks, &waitForReads](FileRequestHandle request)
+            {
+                IStreamer* streamer = Interface<IStreamer>::Get();
+                if (streamer)
+                {
+                    auto result = streamer->GetRequestStatus(request);
+                    EXPECT_EQ(result, IStreamerTypes::RequestStatus::Completed);
+                }
+                if (++numCallbacks == numChunks)
+                {
+                    waitForReads.release();
+                }
+            };
+
+            m_streamer->SetRequestCompleteCallback(requests[i], AZStd::move(callback));
+        }
+
+        m_streamer->QueueRequestBatch(AZStd::move(requests));
+
+        ASSERT_TRUE(waitForReads.try_acquire_for(AZStd::chrono::seconds(5)));
+
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        EXPECT_EQ(buffers[0][chunkSize - 1], s_fileCharacter);
+        EXPECT_EQ(buffers[numChunks - 1][0], s_chunkCharacter);
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+        for (size_t i = 1; i < numChunks - 1; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+            EXPECT_EQ(buffers[i][chunkSize - 1], s_fileCharacter);
+        }
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture_WithScheduler, ReadDataRequest_CanceledParallelReads_AllReadsComplete)
+    {
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = 100;
+        constexpr size_t fileSize = numChunks * chunkSize;
+
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+        AZStd::vector<AZ::IO::FileRequestPtr> requests;
+        requests.reserve(numChunks);
+
+        CreateDummyFile(fileSize, chunkSize);
+
+        AZStd::binary_semaphore waitForReads;
+        AZStd::atomic_size_t numReadCallbacks = 0;
+        AZStd::atomic_size_t numFailed = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            requests.push_back(m_streamer->Read(m_dummyFilepath, buffers[i].get(), chunkSize, chunkSize,
+                IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, i * chunkSize));
+
+            auto callback = [&waitForReads, &numReadCallbacks, &numFailed](FileRequestHandle request)
+            {
+                // Depending on timing reads are either canceled or already completed, but none should fail.
+                if (Interface<IStreamer>::Get()->GetRequestStatus(request) == IStreamerTypes::RequestStatus::Failed)
+                {
+                    numFailed++;
+                }
+                if (++numReadCallbacks == numChunks)
+                {
+                    waitForReads.release();
+                }
+            };
+            m_streamer->SetRequestCompleteCallback(requests[i], AZStd::move(callback));
+        }
+
+        AZStd::vector<AZ::IO::FileRequestPtr> cancels;
+        cancels.reserve(numChunks);
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            cancels.push_back(m_streamer->Cancel(requests[numChunks - i - 1]));
+        }
+
+        m_streamer->QueueRequestBatch(requests);
+        m_streamer->QueueRequestBatch(AZStd::move(cancels));
+
+        ASSERT_TRUE(waitForReads.try_acquire_for(AZStd::chrono::seconds(5)));
+        EXPECT_EQ(0, numFailed);
+    }
+} // namespace AZ::IO
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Benchmark
+{
+    //! Measures the throughput of the Streamer over a set of large files with either the generic or the io_uring storage drive.
+    //! The file set is created once and evicted from the page cache before every iteration so both drives read from disk.
+    class StorageDriveLinuxFixture : public benchmark::Fixture
+    {
+        void internalTearDown()
+        {
+            delete m_streamer;
+            m_streamer = nullptr;
+
+            if (m_buffer)
+            {
+                azfree(m_buffer, AZ::SystemAllocator);
+                m_buffer = nullptr;
+            }
+
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_previousFileIO);
+            delete m_fileIO;
+            m_fileIO = nullptr;
+        }
+
+    public:
+        constexpr static size_t FileCount = 8;
+        constexpr static size_t FileSize = 256_mib;
+        constexpr static size_t ReadsPerIteration = 256;
+
+        enum class DriveType
+        {
+            Generic,
+            IoUring
+        };
+
+        static void CreateFileSet()
+        {
+            static bool fileSetCreated = false;
+            if (fileSetCreated)
+            {
+                return;
+            }
+
+            AZStd::unique_ptr<char[]> buffer(new char[1_mib]);
+            ::memset(buffer.get(), 'c', 1_mib);
+            for (size_t i = 0; i < FileCount; ++i)
+            {
+                AZ::IO::SystemFile file;
+                file.Open(GetFileName(i).c_str(),
+                    AZ::IO::SystemFile::OpenMode::SF_OPEN_CREATE | AZ::IO::SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+                for (size_t written = 0; written < FileSize; written += 1_mib)
+                {
+                    file.Write(buffer.get(), 1_mib);
+                }
+                file.Close();
+            }
+            ::atexit(&RemoveFileSet);
+            fileSetCreated = true;
+        }
+
+        static void RemoveFileSet()
+        {
+            for (size_t i = 0; i < FileCount; ++i)
+            {
+                AZ::IO::SystemFile::Delete(GetFileName(i).c_str());
+            }
+        }
+
+        static AZStd::string GetFileName(size_t index)
+        {
+            return AZStd::string::format("StreamerThroughputBenchmark%zu.bin", index);
+        }
+
+        static void EvictFileSetFromPageCache()
+        {
+            for (size_t i = 0; i < FileCount; ++i)
+            {
+                int file = ::open(GetFileName(i).c_str(), O_RDONLY | O_CLOEXEC);
+                if (file >= 0)
+                {
+                    ::fdatasync(file);
+                    ::posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+                    ::close(file);
+                }
+            }
+        }
+
+        void SetupStreamer(DriveType driveType, size_t readSize)
+        {
+            using namespace AZ::IO;
+
+            m_fileIO = new UnitTest::TestFileIOBase();
+            m_previousFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_fileIO);
+
+            CreateFileSet();
+            for (size_t i = 0; i < FileCount; ++i)
+            {
+                AZStd::optional<AZ::IO::FixedMaxPathString> absolutePath = AZ::Utils::ConvertToAbsolutePath(GetFileName(i));
+                m_absolutePaths[i] = absolutePath.has_value() ? AZStd::string(absolutePath->c_str()) : GetFileName(i);
+            }
+
+            AZStd::shared_ptr<StreamStackEntry> drive;
+            if (driveType == DriveType::IoUring && StorageDriveLinux::IsSupported())
+            {
+                StorageDriveLinux::ConstructionOptions options;
+                options.m_hasSeekPenalty = false;
+                options.m_enableDirectReads = true;
+                options.m_minimalReporting = true;
+                drive = AZStd::make_shared<StorageDriveLinux>(32, 32, 4_kib, 512, 32, 8, 8, 512_kib, options);
+            }
+            else
+            {
+                drive = AZStd::make_shared<StorageDrive>(32);
+            }
+
+            AZStd::unique_ptr<Scheduler> stack = AZStd::make_unique<Scheduler>(AZStd::move(drive));
+            m_streamer = aznew Streamer(AZStd::thread_desc{}, AZStd::move(stack));
+            m_buffer = reinterpret_cast<char*>(azmalloc(ReadsPerIteration * readSize, 4_kib, AZ::SystemAllocator));
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void ReadFileSet(benchmark::State& state, bool randomAccess)
+        {
+            using namespace AZ::IO;
+            using namespace AZStd::chrono;
+
+            const size_t readSize = aznumeric_cast<size_t>(state.range(0));
+            const size_t readsPerFile = FileSize / readSize;
+            size_t sequentialIndex = 0;
+            AZ::u64 randomState = 0x2545F4914F6CDD1D;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                EvictFileSetFromPageCache();
+                state.ResumeTiming();
+
+                AZStd::binary_semaphore waitForReads;
+                AZStd::atomic_size_t numCompleted = 0;
+                AZStd::atomic<steady_clock::time_point> end;
+                auto callback = [&numCompleted, &end, &waitForReads]([[maybe_unused]] FileRequestHandle request)
+                {
+                    if (++numCompleted == ReadsPerIteration)
+                    {
+                        benchmark::DoNotOptimize(end = steady_clock::now());
+                        waitForReads.release();
+                    }
+                };
+
+                AZStd::vector<FileRequestPtr> requests;
+                requests.reserve(ReadsPerIteration);
+                for (size_t i = 0; i < ReadsPerIteration; ++i)
+                {
+                    size_t fileIndex;
+                    size_t blockIndex;
+                    if (randomAccess)
+                    {
+                        // xorshift to get a reproducible sequence.
+                        randomState ^= randomState << 13;
+                        randomState ^= randomState >> 7;
+                        randomState ^= randomState << 17;
+                        fileIndex = randomState % FileCount;
+                        blockIndex = (randomState >> 8) % readsPerFile;
+                    }
+                    else
+                    {
+                        fileIndex = (sequentialIndex / readsPerFile) % FileCount;
+                        blockIndex = sequentialIndex % readsPerFile;
+                        ++sequentialIndex;
+                    }
+
+                    FileRequestPtr request = m_streamer->Read(m_absolutePaths[fileIndex], m_buffer + i * readSize, readSize, readSize,
+                        IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, blockIndex * readSize);
+                    m_streamer->SetRequestCompleteCallback(request, callback);
+                    requests.push_back(AZStd::move(request));
+                }
+
+                steady_clock::time_point start;
+                benchmark::DoNotOptimize(start = steady_clock::now());
+                m_streamer->QueueRequestBatch(AZStd::move(requests));
+
+                waitForReads.try_acquire_for(AZStd::chrono::seconds(30));
+                auto durationInSeconds = duration_cast<duration<double>>(end.load() - start);
+                state.SetIterationTime(durationInSeconds.count());
+            }
+            state.SetBytesProcessed(aznumeric_cast<int64_t>(state.iterations() * ReadsPerIteration * readSize));
+        }
+
+        AZStd::array<AZStd::string, FileCount> m_absolutePaths;
+        AZ::IO::Streamer* m_streamer{};
+        char* m_buffer{};
+        AZ::IO::FileIOBase* m_previousFileIO{};
+        UnitTest::TestFileIOBase* m_fileIO{};
+    };
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, GenericDrive_SequentialReads)(benchmark::State& state)
+    {
+        SetupStreamer(DriveType::Generic, aznumeric_cast<size_t>(state.range(0)));
+        ReadFileSet(state, false);
+    }
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, IoUringDrive_SequentialReads)(benchmark::State& state)
+    {
+        SetupStreamer(DriveType::IoUring, aznumeric_cast<size_t>(state.range(0)));
+        ReadFileSet(state, false);
+    }
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, GenericDrive_RandomReads)(benchmark::State& state)
+    {
+        SetupStreamer(DriveType::Generic, aznumeric_cast<size_t>(state.range(0)));
+        ReadFileSet(state, true);
+    }
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxFixture, IoUringDrive_RandomReads)(benchmark::State& state)
+    {
+        SetupStreamer(DriveType::IoUring, aznumeric_cast<size_t>(state.range(0)));
+        ReadFileSet(state, true);
+    }
+
+    // The reads are done on the Streamer thread while the main thread waits, so only the manually recorded wall time is meaningful.
+
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, GenericDrive_SequentialReads)
+        ->RangeMultiplier(8)->Range(64_kib, 512_kib)->UseManualTime()->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, IoUringDrive_SequentialReads)
+        ->RangeMultiplier(8)->Range(64_kib, 512_kib)->UseManualTime()->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, GenericDrive_RandomReads)
+        ->RangeMultiplier(8)->Range(4_kib, 512_kib)->UseManualTime()->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(StorageDriveLinuxFixture, IoUringDrive_RandomReads)
+        ->RangeMultiplier(8)->Range(4_kib, 512_kib)->UseManualTime()->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -11,5 +11,6 @@ set(FILES
     ../Common/UnixLike/Tests/Process/ProcessInfoTests_UnixLike.cpp
     Tests/UtilsTests_Linux.cpp
     ../Common/UnixLike/Tests/UtilsTests_UnixLike.cpp
+    Tests/IO/Streamer/StorageDriveTests_Linux.cpp
     Tests/Memory/AllocatorBenchmarks_Linux.cpp
 )
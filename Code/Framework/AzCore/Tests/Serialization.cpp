@@ -65,6 +65,10 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Utils/Utils.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 #include <locale.h>
 
 namespace SerializeTestClasses {
@@ -8335,3 +8339,267 @@ namespace UnitTest
         EXPECT_EQ(AssociativeType::UnorderedMap, unorderedMapAssociativeContainer->GetAssociativeType());
     }
 }
+
+namespace UnitTest
+{
+    class ObjectStreamLoadPlanTestComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ObjectStreamLoadPlanTestComponent, "{1A5F3C0E-7B55-4C7F-9B1D-2E6A8D4F0C31}");
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                ReflectVersion(*serializeContext, 1);
+            }
+        }
+
+        static void ReflectVersion(AZ::SerializeContext& serializeContext, unsigned int version, AZ::SerializeContext::VersionConverter converter = nullptr)
+        {
+            serializeContext.Class<ObjectStreamLoadPlanTestComponent, AZ::Component>()
+                ->Version(version, converter)
+                ->Field("Label", &ObjectStreamLoadPlanTestComponent::m_label)
+                ->Field("Scale", &ObjectStreamLoadPlanTestComponent::m_scale)
+                ->Field("Layer", &ObjectStreamLoadPlanTestComponent::m_layer)
+                ->Field("Weights", &ObjectStreamLoadPlanTestComponent::m_weights)
+                ->Field("Visible", &ObjectStreamLoadPlanTestComponent::m_visible);
+        }
+
+        AZStd::string m_label;
+        float m_scale = 1.0f;
+        AZ::u32 m_layer = 0;
+        AZStd::vector<float> m_weights;
+        bool m_visible = true;
+    };
+
+    //! Mimics the layout of a level or slice, which stores a large number of small entities
+    struct ObjectStreamLoadPlanTestLevel
+    {
+        AZ_TYPE_INFO(ObjectStreamLoadPlanTestLevel, "{6C2B8E47-0D13-4A9E-8F5B-93C1E2A7D604}");
+        AZ_CLASS_ALLOCATOR(ObjectStreamLoadPlanTestLevel, AZ::SystemAllocator);
+
+        ObjectStreamLoadPlanTestLevel() = default;
+        ObjectStreamLoadPlanTestLevel(const ObjectStreamLoadPlanTestLevel&) = delete;
+        ~ObjectStreamLoadPlanTestLevel()
+        {
+            for (AZ::Entity* entity : m_entities)
+            {
+                delete entity;
+            }
+        }
+
+        static void Reflect(AZ::SerializeContext& serializeContext)
+        {
+            serializeContext.Class<ObjectStreamLoadPlanTestLevel>()
+                ->Field("Entities", &ObjectStreamLoadPlanTestLevel::m_entities);
+        }
+
+        static void Populate(ObjectStreamLoadPlanTestLevel& level, size_t entityCount)
+        {
+            level.m_entities.reserve(entityCount);
+            for (size_t index = 0; index < entityCount; ++index)
+            {
+                AZ::Entity* entity = aznew AZ::Entity(AZ::EntityId(index + 1), AZStd::string::format("Entity_%zu", index));
+                auto component = entity->CreateComponent<ObjectStreamLoadPlanTestComponent>();
+                component->m_label = AZStd::string::format("Label_%zu", index % 17);
+                component->m_scale = static_cast<float>(index) * 0.5f;
+                component->m_layer = static_cast<AZ::u32>(index % 8);
+                component->m_weights = { 0.25f, static_cast<float>(index % 5) };
+                component->m_visible = (index % 3) != 0;
+                level.m_entities.push_back(entity);
+            }
+        }
+
+        AZStd::vector<AZ::Entity*> m_entities;
+    };
+
+    class ObjectStreamLoadPlanFixture
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            AZ::Entity::Reflect(m_serializeContext.get());
+            ObjectStreamLoadPlanTestComponent::Reflect(m_serializeContext.get());
+            ObjectStreamLoadPlanTestLevel::Reflect(*m_serializeContext);
+        }
+
+        void TearDown() override
+        {
+            m_serializeContext.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        static void ExpectSameComponents(const ObjectStreamLoadPlanTestLevel& expected, const ObjectStreamLoadPlanTestLevel& actual)
+        {
+            ASSERT_EQ(expected.m_entities.size(), actual.m_entities.size());
+            for (size_t index = 0; index < expected.m_entities.size(); ++index)
+            {
+                EXPECT_EQ(expected.m_entities[index]->GetId(), actual.m_entities[index]->GetId());
+                EXPECT_EQ(expected.m_entities[index]->GetName(), actual.m_entities[index]->GetName());
+                auto expectedComponent = expected.m_entities[index]->FindComponent<ObjectStreamLoadPlanTestComponent>();
+                auto actualComponent = actual.m_entities[index]->FindComponent<ObjectStreamLoadPlanTestComponent>();
+                ASSERT_NE(nullptr, actualComponent);
+                EXPECT_EQ(expectedComponent->m_label, actualComponent->m_label);
+                EXPECT_EQ(expectedComponent->m_layer, actualComponent->m_layer);
+                EXPECT_EQ(expectedComponent->m_weights, actualComponent->m_weights);
+                EXPECT_EQ(expectedComponent->m_visible, actualComponent->m_visible);
+            }
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+    };
+
+    TEST_F(ObjectStreamLoadPlanFixture, FindObjectStreamLoadPlan_ReflectedClass_ResolvesEveryMember)
+    {
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<ObjectStreamLoadPlanTestComponent>());
+        ASSERT_NE(nullptr, classData);
+
+        const AZ::SerializeContext::ObjectStreamLoadPlan* loadPlan = m_serializeContext->FindObjectStreamLoadPlan(classData);
+        ASSERT_NE(nullptr, loadPlan);
+        // The base class is stored as an element as well
+        EXPECT_EQ(classData->m_elements.size(), loadPlan->m_fields.size());
+        EXPECT_EQ(loadPlan, m_serializeContext->FindObjectStreamLoadPlan(classData));
+
+        size_t cursor = 0;
+        const AZ::SerializeContext::ObjectStreamLoadPlan::Field* weightsField =
+            loadPlan->FindField(AZ_CRC_CE("Weights"), azrtti_typeid<AZStd::vector<float>>(), cursor);
+        ASSERT_NE(nullptr, weightsField);
+        EXPECT_EQ(m_serializeContext->FindClassData(azrtti_typeid<AZStd::vector<float>>()), weightsField->m_classData);
+        ASSERT_NE(nullptr, weightsField->m_classElement);
+        EXPECT_EQ(AZ_CRC_CE("Weights"), weightsField->m_classElement->m_nameCrc);
+        EXPECT_FALSE(weightsField->m_isAssetReference);
+
+        // Elements with a different type than the reflected member are left to the regular lookups
+        EXPECT_EQ(nullptr, loadPlan->FindField(AZ_CRC_CE("Weights"), azrtti_typeid<float>(), cursor));
+
+        // Classes without elements don't have a plan
+        EXPECT_EQ(nullptr, m_serializeContext->FindObjectStreamLoadPlan(m_serializeContext->FindClassData(azrtti_typeid<float>())));
+    }
+
+    TEST_F(ObjectStreamLoadPlanFixture, FindObjectStreamLoadPlan_ReflectionChanged_PlanIsRecreated)
+    {
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<ObjectStreamLoadPlanTestComponent>());
+        ASSERT_NE(nullptr, classData);
+        const AZ::SerializeContext::ObjectStreamLoadPlan* loadPlan = m_serializeContext->FindObjectStreamLoadPlan(classData);
+        ASSERT_NE(nullptr, loadPlan);
+        const size_t reflectedFieldCount = loadPlan->m_fields.size();
+
+        m_serializeContext->EnableRemoveReflection();
+        ObjectStreamLoadPlanTestComponent::Reflect(m_serializeContext.get());
+        m_serializeContext->DisableRemoveReflection();
+        m_serializeContext->Class<ObjectStreamLoadPlanTestComponent, AZ::Component>()
+            ->Field("Scale", &ObjectStreamLoadPlanTestComponent::m_scale);
+
+        classData = m_serializeContext->FindClassData(azrtti_typeid<ObjectStreamLoadPlanTestComponent>());
+        ASSERT_NE(nullptr, classData);
+        loadPlan = m_serializeContext->FindObjectStreamLoadPlan(classData);
+        ASSERT_NE(nullptr, loadPlan);
+        EXPECT_EQ(2, loadPlan->m_fields.size());
+        EXPECT_LT(loadPlan->m_fields.size(), reflectedFieldCount);
+    }
+
+    TEST_F(ObjectStreamLoadPlanFixture, LoadBinaryStream_MatchingClassVersions_RoundTripsEntities)
+    {
+        ObjectStreamLoadPlanTestLevel level;
+        ObjectStreamLoadPlanTestLevel::Populate(level, 64);
+
+        AZStd::vector<char> binaryBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> binaryStream(&binaryBuffer);
+        ASSERT_TRUE(AZ::Utils::SaveObjectToStream(binaryStream, AZ::ObjectStream::ST_BINARY, &level, m_serializeContext.get()));
+
+        binaryStream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        ObjectStreamLoadPlanTestLevel loadedLevel;
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(binaryStream, loadedLevel, m_serializeContext.get()));
+
+        ExpectSameComponents(level, loadedLevel);
+        for (size_t index = 0; index < level.m_entities.size(); ++index)
+        {
+            EXPECT_FLOAT_EQ(level.m_entities[index]->FindComponent<ObjectStreamLoadPlanTestComponent>()->m_scale,
+                loadedLevel.m_entities[index]->FindComponent<ObjectStreamLoadPlanTestComponent>()->m_scale);
+        }
+    }
+
+    TEST_F(ObjectStreamLoadPlanFixture, LoadBinaryStream_OlderClassVersion_RunsVersionConverter)
+    {
+        ObjectStreamLoadPlanTestLevel level;
+        ObjectStreamLoadPlanTestLevel::Populate(level, 16);
+
+        AZStd::vector<char> binaryBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> binaryStream(&binaryBuffer);
+        ASSERT_TRUE(AZ::Utils::SaveObjectToStream(binaryStream, AZ::ObjectStream::ST_BINARY, &level, m_serializeContext.get()));
+
+        // Version 2 of the component stores the scale doubled
+        AZ::SerializeContext serializeContext;
+        AZ::Entity::Reflect(&serializeContext);
+        ObjectStreamLoadPlanTestLevel::Reflect(serializeContext);
+        ObjectStreamLoadPlanTestComponent::ReflectVersion(serializeContext, 2,
+            [](AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
+            {
+                float scale = 0.0f;
+                if (!classElement.FindSubElementAndGetData(AZ_CRC_CE("Scale"), scale))
+                {
+                    return false;
+                }
+                classElement.RemoveElementByName(AZ_CRC_CE("Scale"));
+                return classElement.AddElementWithData(context, "Scale", scale * 2.0f) != -1;
+            });
+
+        binaryStream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        ObjectStreamLoadPlanTestLevel loadedLevel;
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(binaryStream, loadedLevel, &serializeContext));
+
+        ExpectSameComponents(level, loadedLevel);
+        for (size_t index = 0; index < level.m_entities.size(); ++index)
+        {
+            EXPECT_FLOAT_EQ(level.m_entities[index]->FindComponent<ObjectStreamLoadPlanTestComponent>()->m_scale * 2.0f,
+                loadedLevel.m_entities[index]->FindComponent<ObjectStreamLoadPlanTestComponent>()->m_scale);
+        }
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Loads a binary ObjectStream of a level with state.range(0) entities, which each have a component with a handful of fields
+    static void BM_ObjectStreamLoadBinaryEntities(::benchmark::State& state)
+    {
+        AZ::SerializeContext serializeContext;
+        AZ::Entity::Reflect(&serializeContext);
+        UnitTest::ObjectStreamLoadPlanTestComponent::Reflect(&serializeContext);
+        UnitTest::ObjectStreamLoadPlanTestLevel::Reflect(serializeContext);
+
+        AZStd::vector<char> binaryBuffer;
+        {
+            UnitTest::ObjectStreamLoadPlanTestLevel level;
+            UnitTest::ObjectStreamLoadPlanTestLevel::Populate(level, static_cast<size_t>(state.range(0)));
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> binaryStream(&binaryBuffer);
+            AZ::Utils::SaveObjectToStream(binaryStream, AZ::ObjectStream::ST_BINARY, &level, &serializeContext);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::MemoryStream binaryStream(binaryBuffer.data(), binaryBuffer.size());
+            auto level = AZ::Utils::LoadObjectFromStream<UnitTest::ObjectStreamLoadPlanTestLevel>(binaryStream, &serializeContext);
+
+            state.PauseTiming();
+            benchmark::DoNotOptimize(level);
+            delete level;
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * binaryBuffer.size());
+    }
+
+    BENCHMARK(BM_ObjectStreamLoadBinaryEntities)->Arg(50000)->Unit(::benchmark::kMillisecond);
+} // Benchmark
+#endif // HAVE_BENCHMARK
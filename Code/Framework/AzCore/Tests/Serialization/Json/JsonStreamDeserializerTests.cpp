@@ -0,0 +1,491 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/RapidJsonAllocator.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <Tests/Serialization/Json/BaseJsonSerializerFixture.h>
+
+namespace JsonSerializationTests
+{
+    //! Small prefab-like set of classes with a mix of values that can be loaded while streaming (classes and basic containers)
+    //! and values that fall back to loading from a json value (smart pointers and maps).
+    class StreamTestComponent
+    {
+    public:
+        AZ_RTTI(StreamTestComponent, "{4E3F3C8B-63F4-4D4B-9C0E-0C6C3F6C9A51}");
+        AZ_CLASS_ALLOCATOR(StreamTestComponent, AZ::SystemAllocator);
+
+        virtual ~StreamTestComponent() = default;
+
+        static void Reflect(AZ::SerializeContext& serializeContext)
+        {
+            serializeContext.Class<StreamTestComponent>()
+                ->Field("Name", &StreamTestComponent::m_name)
+                ->Field("Scale", &StreamTestComponent::m_scale)
+                ->Field("Visible", &StreamTestComponent::m_visible)
+                ->Field("Values", &StreamTestComponent::m_values);
+        }
+
+        AZStd::string m_name;
+        float m_scale{ 1.0f };
+        bool m_visible{ true };
+        AZStd::vector<int> m_values;
+    };
+
+    struct StreamTestEntity
+    {
+        AZ_TYPE_INFO(StreamTestEntity, "{1A4A8E0E-7B1B-4E3A-8D65-1F4A6A9C2B7D}");
+
+        static void Reflect(AZ::SerializeContext& serializeContext)
+        {
+            serializeContext.Class<StreamTestEntity>()
+                ->Field("Id", &StreamTestEntity::m_id)
+                ->Field("Name", &StreamTestEntity::m_name)
+                ->Field("Translation", &StreamTestEntity::m_translation)
+                ->Field("Components", &StreamTestEntity::m_components)
+                ->Field("Tags", &StreamTestEntity::m_tags);
+        }
+
+        AZ::u64 m_id{ 0 };
+        AZStd::string m_name;
+        AZStd::vector<float> m_translation;
+        AZStd::vector<AZStd::shared_ptr<StreamTestComponent>> m_components;
+        AZStd::unordered_map<AZStd::string, AZStd::string> m_tags;
+    };
+
+    struct StreamTestLevel
+    {
+        AZ_TYPE_INFO(StreamTestLevel, "{C7F0D5A2-2E1B-4B8F-A6C3-5D9E8B7A6F41}");
+
+        static void Reflect(AZ::SerializeContext& serializeContext)
+        {
+            serializeContext.Class<StreamTestLevel>()
+                ->Field("Name", &StreamTestLevel::m_name)
+                ->Field("Entities", &StreamTestLevel::m_entities);
+        }
+
+        static void Populate(StreamTestLevel& level, size_t entityCount)
+        {
+            level.m_name = "StreamTestLevel";
+            level.m_entities.resize(entityCount);
+            for (size_t index = 0; index < entityCount; ++index)
+            {
+                StreamTestEntity& entity = level.m_entities[index];
+                entity.m_id = 0x1000'0000'0000 + index;
+                entity.m_name = AZStd::string::format("Entity_%zu", index);
+                entity.m_translation = { static_cast<float>(index), 0.5f, static_cast<float>(index % 13) };
+                for (size_t componentIndex = 0; componentIndex < 3; ++componentIndex)
+                {
+                    auto component = AZStd::make_shared<StreamTestComponent>();
+                    component->m_name = AZStd::string::format("Component_%zu", componentIndex);
+                    component->m_scale = 0.25f * static_cast<float>(componentIndex + index % 7);
+                    component->m_visible = (index + componentIndex) % 2 == 0;
+                    component->m_values = { static_cast<int>(index), static_cast<int>(componentIndex), -1 };
+                    entity.m_components.push_back(AZStd::move(component));
+                }
+                entity.m_tags["Layer"] = AZStd::string::format("Layer_%zu", index % 5);
+            }
+        }
+
+        AZStd::string m_name;
+        AZStd::vector<StreamTestEntity> m_entities;
+    };
+
+    class StreamTestDerivedComponent
+        : public StreamTestComponent
+    {
+    public:
+        AZ_RTTI(StreamTestDerivedComponent, "{8D2B6F37-0C4A-4E59-B1A8-3F7E25C9D604}", StreamTestComponent);
+        AZ_CLASS_ALLOCATOR(StreamTestDerivedComponent, AZ::SystemAllocator);
+
+        static void Reflect(AZ::SerializeContext& serializeContext)
+        {
+            serializeContext.Class<StreamTestDerivedComponent, StreamTestComponent>()
+                ->Field("Extra", &StreamTestDerivedComponent::m_extra);
+        }
+
+        int m_extra{ 0 };
+    };
+
+    //! Holds components through raw pointers, which are resolved by the deserializers themselves rather than by a serializer.
+    struct StreamTestComponentOwner
+    {
+        AZ_TYPE_INFO(StreamTestComponentOwner, "{5C71E0A9-94D3-4F26-8B1E-A2D6C03F7B58}");
+
+        StreamTestComponentOwner() = default;
+        StreamTestComponentOwner(const StreamTestComponentOwner&) = delete;
+        ~StreamTestComponentOwner()
+        {
+            delete m_component;
+            for (StreamTestComponent* component : m_components)
+            {
+                delete component;
+            }
+        }
+
+        static void Reflect(AZ::SerializeContext& serializeContext)
+        {
+            serializeContext.Class<StreamTestComponentOwner>()
+                ->Field("Component", &StreamTestComponentOwner::m_component)
+                ->Field("Components", &StreamTestComponentOwner::m_components);
+        }
+
+        StreamTestComponent* m_component{ nullptr };
+        AZStd::vector<StreamTestComponent*> m_components;
+    };
+
+    static void ExpectSameComponent(const StreamTestComponent* lhs, const StreamTestComponent* rhs)
+    {
+        ASSERT_EQ(lhs == nullptr, rhs == nullptr);
+        if (lhs)
+        {
+            ASSERT_EQ(azrtti_typeid(lhs), azrtti_typeid(rhs));
+            EXPECT_STREQ(lhs->m_name.c_str(), rhs->m_name.c_str());
+            EXPECT_FLOAT_EQ(lhs->m_scale, rhs->m_scale);
+            EXPECT_EQ(lhs->m_values, rhs->m_values);
+            if (auto lhsDerived = azrtti_cast<const StreamTestDerivedComponent*>(lhs))
+            {
+                EXPECT_EQ(lhsDerived->m_extra, azrtti_cast<const StreamTestDerivedComponent*>(rhs)->m_extra);
+            }
+        }
+    }
+
+    static void ExpectSameLevel(const StreamTestLevel& lhs, const StreamTestLevel& rhs)
+    {
+        EXPECT_STREQ(lhs.m_name.c_str(), rhs.m_name.c_str());
+        ASSERT_EQ(lhs.m_entities.size(), rhs.m_entities.size());
+        for (size_t index = 0; index < lhs.m_entities.size(); ++index)
+        {
+            const StreamTestEntity& lhsEntity = lhs.m_entities[index];
+            const StreamTestEntity& rhsEntity = rhs.m_entities[index];
+            EXPECT_EQ(lhsEntity.m_id, rhsEntity.m_id);
+            EXPECT_STREQ(lhsEntity.m_name.c_str(), rhsEntity.m_name.c_str());
+            EXPECT_EQ(lhsEntity.m_translation, rhsEntity.m_translation);
+            EXPECT_EQ(lhsEntity.m_tags, rhsEntity.m_tags);
+            ASSERT_EQ(lhsEntity.m_components.size(), rhsEntity.m_components.size());
+            for (size_t componentIndex = 0; componentIndex < lhsEntity.m_components.size(); ++componentIndex)
+            {
+                const StreamTestComponent& lhsComponent = *lhsEntity.m_components[componentIndex];
+                const StreamTestComponent& rhsComponent = *rhsEntity.m_components[componentIndex];
+                EXPECT_STREQ(lhsComponent.m_name.c_str(), rhsComponent.m_name.c_str());
+                EXPECT_FLOAT_EQ(lhsComponent.m_scale, rhsComponent.m_scale);
+                EXPECT_EQ(lhsComponent.m_visible, rhsComponent.m_visible);
+                EXPECT_EQ(lhsComponent.m_values, rhsComponent.m_values);
+            }
+        }
+    }
+
+    class JsonStreamDeserializerTests
+        : public BaseJsonSerializerFixture
+    {
+    public:
+        using BaseJsonSerializerFixture::RegisterAdditional;
+        void RegisterAdditional(AZStd::unique_ptr<AZ::SerializeContext>& serializeContext) override
+        {
+            StreamTestComponent::Reflect(*serializeContext);
+            StreamTestDerivedComponent::Reflect(*serializeContext);
+            StreamTestComponentOwner::Reflect(*serializeContext);
+            StreamTestEntity::Reflect(*serializeContext);
+            StreamTestLevel::Reflect(*serializeContext);
+        }
+
+        AZStd::string StoreLevel(const StreamTestLevel& level)
+        {
+            rapidjson::Document document;
+            AZ::JsonSerializationResult::ResultCode result =
+                AZ::JsonSerialization::Store(document, document.GetAllocator(), level, *m_serializationSettings);
+            EXPECT_NE(AZ::JsonSerializationResult::Processing::Halted, result.GetProcessing());
+
+            AZStd::string jsonText;
+            EXPECT_TRUE(AZ::JsonSerializationUtils::WriteJsonString(document, jsonText).IsSuccess());
+            return jsonText;
+        }
+
+        template<typename T>
+        AZ::JsonSerializationResult::ResultCode LoadFromStream(T& object, AZStd::string_view jsonText)
+        {
+            AZ::IO::MemoryStream stream(jsonText.data(), jsonText.size());
+            return AZ::JsonSerialization::LoadFromStream(object, stream, *m_deserializationSettings);
+        }
+
+        template<typename T>
+        AZ::JsonSerializationResult::ResultCode LoadFromDocument(T& object, AZStd::string_view jsonText)
+        {
+            auto document = AZ::JsonSerializationUtils::ReadJsonString(jsonText);
+            EXPECT_TRUE(document.IsSuccess());
+            return AZ::JsonSerialization::Load(object, document.GetValue(), *m_deserializationSettings);
+        }
+    };
+
+    TEST_F(JsonStreamDeserializerTests, LoadFromStream_LargeDocument_MatchesLoadFromDocument)
+    {
+        // Use enough entities for the document to be larger than the buffer of the input stream.
+        StreamTestLevel level;
+        StreamTestLevel::Populate(level, 2000);
+        AZStd::string jsonText = StoreLevel(level);
+        ASSERT_GT(jsonText.size(), 64 * 1024);
+
+        StreamTestLevel documentLevel;
+        AZ::JsonSerializationResult::ResultCode documentResult = LoadFromDocument(documentLevel, jsonText);
+        StreamTestLevel streamLevel;
+        AZ::JsonSerializationResult::ResultCode streamResult = LoadFromStream(streamLevel, jsonText);
+
+        EXPECT_EQ(documentResult.GetOutcome(), streamResult.GetOutcome());
+        EXPECT_EQ(documentResult.GetProcessing(), streamResult.GetProcessing());
+        ExpectSameLevel(level, streamLevel);
+        ExpectSameLevel(documentLevel, streamLevel);
+    }
+
+    TEST_F(JsonStreamDeserializerTests, LoadFromStream_ExplicitDefault_DefaultsUsed)
+    {
+        StreamTestLevel level;
+        AZ::JsonSerializationResult::ResultCode result = LoadFromStream(level, "{}");
+
+        EXPECT_EQ(AZ::JsonSerializationResult::Outcomes::DefaultsUsed, result.GetOutcome());
+        EXPECT_TRUE(level.m_name.empty());
+        EXPECT_TRUE(level.m_entities.empty());
+    }
+
+    TEST_F(JsonStreamDeserializerTests, LoadFromStream_UnknownAndTypeFields_SkippedSameAsLoadFromDocument)
+    {
+        constexpr AZStd::string_view jsonText = R"(
+            {
+                "$type": "StreamTestLevel",
+                "Unknown": { "Nested": [ 1, { "Deeper": [] }, "Text" ] },
+                // Comments are supported the same way as when reading the json into a document.
+                "Name": "Level",
+                "Entities": [ { "Id": 42, "Unused": [ [], {} ], "Translation": [ 1.0, 2.0, 3.0 ] } ]
+            })";
+
+        StreamTestLevel documentLevel;
+        AZ::JsonSerializationResult::ResultCode documentResult = LoadFromDocument(documentLevel, jsonText);
+        StreamTestLevel streamLevel;
+        AZ::JsonSerializationResult::ResultCode streamResult = LoadFromStream(streamLevel, jsonText);
+
+        EXPECT_EQ(documentResult.GetOutcome(), streamResult.GetOutcome());
+        EXPECT_EQ(AZ::JsonSerializationResult::Processing::Completed, streamResult.GetProcessing());
+        EXPECT_STREQ("Level", streamLevel.m_name.c_str());
+        ASSERT_EQ(1, streamLevel.m_entities.size());
+        EXPECT_EQ(42, streamLevel.m_entities[0].m_id);
+        ExpectSameLevel(documentLevel, streamLevel);
+    }
+
+    TEST_F(JsonStreamDeserializerTests, LoadFromStream_RawPointers_MatchesLoadFromDocument)
+    {
+        // The first component has its type up front and is loaded while reading, the second one has it at the end and is read
+        // into a json value first. Both have to create the same instances as loading from the document.
+        constexpr AZStd::string_view jsonText = R"(
+            {
+                "Component": { "$type": "StreamTestDerivedComponent", "Name": "Primary", "Unknown": [ 1, 2 ], "Extra": 3 },
+                "Components": [
+                    { "$type": "StreamTestComponent", "Name": "First", "Values": [ 4, 5 ] },
+                    { "Name": "Second", "Extra": 6, "$type": "StreamTestDerivedComponent" },
+                    { "$type": "StreamTestDerivedComponent" }
+                ]
+            })";
+
+        StreamTestComponentOwner documentOwner;
+        AZ::JsonSerializationResult::ResultCode documentResult = LoadFromDocument(documentOwner, jsonText);
+        StreamTestComponentOwner streamOwner;
+        AZ::JsonSerializationResult::ResultCode streamResult = LoadFromStream(streamOwner, jsonText);
+
+        EXPECT_EQ(documentResult.GetOutcome(), streamResult.GetOutcome());
+        EXPECT_EQ(documentResult.GetProcessing(), streamResult.GetProcessing());
+        ASSERT_NE(nullptr, streamOwner.m_component);
+        EXPECT_EQ(azrtti_typeid<StreamTestDerivedComponent>(), azrtti_typeid(streamOwner.m_component));
+        EXPECT_EQ(3, azrtti_cast<StreamTestDerivedComponent*>(streamOwner.m_component)->m_extra);
+        ExpectSameComponent(documentOwner.m_component, streamOwner.m_component);
+        ASSERT_EQ(3, streamOwner.m_components.size());
+        ASSERT_EQ(documentOwner.m_components.size(), streamOwner.m_components.size());
+        for (size_t index = 0; index < streamOwner.m_components.size(); ++index)
+        {
+            ExpectSameComponent(documentOwner.m_components[index], streamOwner.m_components[index]);
+        }
+    }
+
+    TEST_F(JsonStreamDeserializerTests, LoadFromStream_RawPointerWithUnknownType_NoInstanceCreated)
+    {
+        constexpr AZStd::string_view jsonText = R"({ "Component": { "$type": "UnknownComponent", "Name": "Primary" }, "Components": [] })";
+
+        StreamTestComponentOwner owner;
+        AZ::JsonSerializationResult::ResultCode result = LoadFromStream(owner, jsonText);
+
+        EXPECT_NE(AZ::JsonSerializationResult::Outcomes::Success, result.GetOutcome());
+        EXPECT_EQ(nullptr, owner.m_component);
+    }
+
+    TEST_F(JsonStreamDeserializerTests, LoadFromStream_ClearContainers_ReplacesExistingEntries)
+    {
+        StreamTestLevel level;
+        StreamTestLevel::Populate(level, 4);
+
+        m_deserializationSettings->m_clearContainers = true;
+        AZ::JsonSerializationResult::ResultCode result = LoadFromStream(level, R"({ "Entities": [ { "Id": 7 } ] })");
+
+        EXPECT_NE(AZ::JsonSerializationResult::Processing::Halted, result.GetProcessing());
+        ASSERT_EQ(1, level.m_entities.size());
+        EXPECT_EQ(7, level.m_entities[0].m_id);
+    }
+
+    TEST_F(JsonStreamDeserializerTests, LoadFromStream_TruncatedDocument_Halts)
+    {
+        StreamTestLevel level;
+        AZ::JsonSerializationResult::ResultCode result = LoadFromStream(level, R"({ "Name": "Level", "Entities": [ { "Id": 1 }, )");
+
+        EXPECT_EQ(AZ::JsonSerializationResult::Outcomes::Catastrophic, result.GetOutcome());
+        EXPECT_EQ(AZ::JsonSerializationResult::Processing::Halted, result.GetProcessing());
+    }
+
+    TEST_F(JsonStreamDeserializerTests, LoadFromStream_TrailingContent_Halts)
+    {
+        StreamTestLevel level;
+        AZ::JsonSerializationResult::ResultCode result = LoadFromStream(level, R"({ "Name": "Level" } { "Name": "Other" })");
+
+        EXPECT_EQ(AZ::JsonSerializationResult::Outcomes::Catastrophic, result.GetOutcome());
+    }
+
+    TEST_F(JsonStreamDeserializerTests, LoadFromStream_EmptyStream_Halts)
+    {
+        StreamTestLevel level;
+        AZ::JsonSerializationResult::ResultCode result = LoadFromStream(level, "");
+
+        EXPECT_EQ(AZ::JsonSerializationResult::Outcomes::Catastrophic, result.GetOutcome());
+    }
+} // namespace JsonSerializationTests
+
+#if defined(HAVE_BENCHMARK)
+namespace JsonSerializationTests::Benchmark
+{
+    //! Reflection contexts and a generated level document shared by the json streaming benchmarks.
+    class JsonStreamBenchmarkData
+    {
+    public:
+        explicit JsonStreamBenchmarkData(size_t entityCount)
+        {
+            AZ::JsonSystemComponent::Reflect(&m_registrationContext);
+            Reflect(m_serializeContext);
+
+            StreamTestLevel level;
+            StreamTestLevel::Populate(level, entityCount);
+
+            AZ::JsonSerializerSettings storeSettings;
+            storeSettings.m_serializeContext = &m_serializeContext;
+            storeSettings.m_registrationContext = &m_registrationContext;
+            rapidjson::Document document;
+            AZ::JsonSerialization::Store(document, document.GetAllocator(), level, storeSettings);
+            AZ::JsonSerializationUtils::WriteJsonString(document, m_jsonText);
+
+            m_loadSettings.m_serializeContext = &m_serializeContext;
+            m_loadSettings.m_registrationContext = &m_registrationContext;
+            // Sample the json memory whenever the deserializer reports progress to approximate the peak memory use.
+            m_loadSettings.m_reporting = [this](AZStd::string_view, AZ::JsonSerializationResult::ResultCode result, AZStd::string_view)
+            {
+                SampleJsonMemory();
+                return result;
+            };
+        }
+
+        ~JsonStreamBenchmarkData()
+        {
+            m_registrationContext.EnableRemoveReflection();
+            AZ::JsonSystemComponent::Reflect(&m_registrationContext);
+            m_registrationContext.DisableRemoveReflection();
+
+            m_serializeContext.EnableRemoveReflection();
+            Reflect(m_serializeContext);
+            m_serializeContext.DisableRemoveReflection();
+        }
+
+        void BeginIteration()
+        {
+            m_baseJsonBytes = AZ::AllocatorInstance<AZ::JSON::RapidJSONAllocator>::Get().NumAllocatedBytes();
+            m_peakJsonBytes = 0;
+        }
+
+        void SampleJsonMemory(size_t additionalBytes = 0)
+        {
+            size_t jsonBytes = AZ::AllocatorInstance<AZ::JSON::RapidJSONAllocator>::Get().NumAllocatedBytes() - m_baseJsonBytes;
+            m_peakJsonBytes = AZStd::max(m_peakJsonBytes, jsonBytes + additionalBytes);
+        }
+
+        static void Reflect(AZ::SerializeContext& serializeContext)
+        {
+            StreamTestComponent::Reflect(serializeContext);
+            StreamTestEntity::Reflect(serializeContext);
+            StreamTestLevel::Reflect(serializeContext);
+        }
+
+        AZ::SerializeContext m_serializeContext;
+        AZ::JsonRegistrationContext m_registrationContext;
+        AZ::JsonDeserializerSettings m_loadSettings;
+        AZStd::string m_jsonText;
+        size_t m_baseJsonBytes{ 0 };
+        size_t m_peakJsonBytes{ 0 };
+    };
+
+    //! Loads a level with state.range(0) entities by first reading the entire document into a rapidjson::Document.
+    static void BM_JsonLoadLevelFromDocument(::benchmark::State& state)
+    {
+        JsonStreamBenchmarkData data(static_cast<size_t>(state.range(0)));
+        size_t peakJsonBytes = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            data.BeginIteration();
+            StreamTestLevel level;
+            {
+                AZ::IO::MemoryStream stream(data.m_jsonText.data(), data.m_jsonText.size());
+                auto document = AZ::JsonSerializationUtils::ReadJsonStream(stream);
+                // The text of the document is kept in memory while parsing.
+                data.SampleJsonMemory(data.m_jsonText.size());
+                AZ::JsonSerialization::Load(level, document.GetValue(), data.m_loadSettings);
+            }
+            peakJsonBytes = AZStd::max(peakJsonBytes, data.m_peakJsonBytes);
+
+            state.PauseTiming();
+            level = {};
+            state.ResumeTiming();
+        }
+
+        state.SetBytesProcessed(state.iterations() * data.m_jsonText.size());
+        state.counters["PeakJsonBytes"] = static_cast<double>(peakJsonBytes);
+    }
+    BENCHMARK(BM_JsonLoadLevelFromDocument)->Arg(20000)->Unit(::benchmark::kMillisecond);
+
+    //! Loads a level with state.range(0) entities directly from the stream without creating a document for the entire level.
+    static void BM_JsonLoadLevelFromStream(::benchmark::State& state)
+    {
+        JsonStreamBenchmarkData data(static_cast<size_t>(state.range(0)));
+        size_t peakJsonBytes = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            data.BeginIteration();
+            StreamTestLevel level;
+            {
+                AZ::IO::MemoryStream stream(data.m_jsonText.data(), data.m_jsonText.size());
+                AZ::JsonSerialization::LoadFromStream(level, stream, data.m_loadSettings);
+            }
+            peakJsonBytes = AZStd::max(peakJsonBytes, data.m_peakJsonBytes);
+
+            state.PauseTiming();
+            level = {};
+            state.ResumeTiming();
+        }
+
+        state.SetBytesProcessed(state.iterations() * data.m_jsonText.size());
+        state.counters["PeakJsonBytes"] = static_cast<double>(peakJsonBytes);
+    }
+    BENCHMARK(BM_JsonLoadLevelFromStream)->Arg(20000)->Unit(::benchmark::kMillisecond);
+} // namespace JsonSerializationTests::Benchmark
+#endif // HAVE_BENCHMARK
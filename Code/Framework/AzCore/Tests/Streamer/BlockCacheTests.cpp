@@ -16,6 +16,7 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/Utils.h>
 #include <Tests/FileIOBaseTestTypes.h>
 #include <Tests/Streamer/StreamStackEntryConformityTests.h>
 #include <Tests/Streamer/StreamStackEntryMock.h>
@@ -65,7 +66,8 @@ namespace AZ::IO
         {
             using ::testing::_;
 
-            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites);
+            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites,
+                m_readAheadBlocks, m_maxConcurrentPrefetches);
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_cache->SetNext(m_mock);
             EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
@@ -113,7 +115,8 @@ namespace AZ::IO
             }
             else if (
                 AZStd::holds_alternative<Requests::FlushData>(request->GetCommand()) ||
-                AZStd::holds_alternative<Requests::FlushAllData>(request->GetCommand()))
+                AZStd::holds_alternative<Requests::FlushAllData>(request->GetCommand()) ||
+                AZStd::holds_alternative<Requests::CustomData>(request->GetCommand()))
             {
                 request->SetStatus(IStreamerTypes::RequestStatus::Completed);
                 m_context->MarkRequestAsCompleted(request);
@@ -234,6 +237,8 @@ namespace AZ::IO
         u32 m_blockSize{ 64 * 1024 };
         u64 m_fakeFileLength{ 5 * m_blockSize };
         u64 m_readBufferLength{ 10 * 1024 * 1024 };
+        u32 m_readAheadBlocks{ 0 };
+        u32 m_maxConcurrentPrefetches{ 0 };
         bool m_fakeFileFound{ true };
     };
 
@@ -1167,4 +1172,112 @@ namespace AZ::IO
         EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
         ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
     }
+
+
+
+    /////////////////////////////////////////////////////////////
+    // Prefetching
+    /////////////////////////////////////////////////////////////
+    class Streamer_BlockCachePrefetchTest
+        : public BlockCacheTest
+    {
+    public:
+        void CreateTestEnvironment()
+        {
+            m_fakeFileLength = 16 * m_blockSize;
+            m_maxConcurrentPrefetches = 2;
+            CreateTestEnvironmentImplementation(false);
+        }
+
+        void ProcessAccessTraceCommand(AZStd::any command)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCustom(AZStd::move(command), false);
+            RunAndCompleteRequest(request, IStreamerTypes::RequestStatus::Completed);
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    // File    |------------------------------------------------|
+    // Request |-|     |-|     |-|     |-|     |-|
+    // Cache   [ v ][ x ][ v ][ x ][ v ][ x ][ v ][ x ][ p ][ x ][ p ]
+    TEST_F(Streamer_BlockCachePrefetchTest, ReadFile_StridedReads_NextBlockIsReadAhead)
+    {
+        using ::testing::_;
+
+        m_readAheadBlocks = 1;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        const u64 stride = 2 * m_blockSize;
+        const u64 readSize = m_blockSize / 2;
+        // The first four reads establish the pattern, after which the block for the fifth read is prefetched. The fifth read
+        // then prefetches the block for the sixth read.
+        for (u64 i = 0; i < 6; ++i)
+        {
+            EXPECT_CALL(*this, ReadFile(_, _, i * stride, m_blockSize)).Times(1);
+        }
+
+        for (u64 i = 0; i < 5; ++i)
+        {
+            ProcessRead(m_buffer, m_path, i * stride, readSize, IStreamerTypes::RequestStatus::Completed);
+            VerifyReadBuffer(i * stride, readSize);
+        }
+        EXPECT_DOUBLE_EQ(1.0, m_cache->CalculatePrefetchAccuracyPercentage());
+    }
+
+    TEST_F(Streamer_BlockCachePrefetchTest, ReadFile_FlushUnusedPrefetch_AccuracyDrops)
+    {
+        using ::testing::_;
+
+        m_readAheadBlocks = 1;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(5);
+        for (u64 i = 0; i < 4; ++i)
+        {
+            ProcessRead(m_buffer, m_path, i * m_blockSize + 256, 256, IStreamerTypes::RequestStatus::Completed);
+        }
+
+        // The fourth read prefetched the fifth block, but it's flushed before it's read.
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFlushAll();
+        RunAndCompleteRequest(request, IStreamerTypes::RequestStatus::Completed);
+        EXPECT_DOUBLE_EQ(0.0, m_cache->CalculatePrefetchAccuracyPercentage());
+    }
+
+    TEST_F(Streamer_BlockCachePrefetchTest, AccessTrace_ReplayRecordedTrace_MissedBlocksArePrefetched)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        // Both blocks are read once while recording and once more when the trace is replayed.
+        EXPECT_CALL(*this, ReadFile(_, _, 0, m_blockSize)).Times(2);
+        EXPECT_CALL(*this, ReadFile(_, _, 3 * m_blockSize, m_blockSize)).Times(2);
+
+        const AZ::IO::Path tracePath = m_tempDirectory.GetDirectoryAsPath() / "Level.blocktrace";
+        ProcessAccessTraceCommand(AZStd::any(BlockCacheBeginAccessTrace{ tracePath }));
+        ProcessRead(m_buffer, m_path, 256, 512, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 3 * m_blockSize + 256, 512, IStreamerTypes::RequestStatus::Completed);
+        ProcessAccessTraceCommand(AZStd::any(BlockCacheEndAccessTrace{}));
+        EXPECT_TRUE(AZ::IO::SystemFile::Exists(tracePath.c_str()));
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFlushAll();
+        RunAndCompleteRequest(request, IStreamerTypes::RequestStatus::Completed);
+
+        // Starting the trace again prefetches the blocks, so the reads are serviced from the cache.
+        ProcessAccessTraceCommand(AZStd::any(BlockCacheBeginAccessTrace{ tracePath }));
+        ProcessRead(m_buffer, m_path, 3 * m_blockSize + 256, 512, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(3 * m_blockSize + 256, 512);
+        ProcessRead(m_buffer, m_path, 256, 512, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(256, 512);
+        ProcessAccessTraceCommand(AZStd::any(BlockCacheEndAccessTrace{}));
+
+        EXPECT_DOUBLE_EQ(1.0, m_cache->CalculatePrefetchAccuracyPercentage());
+    }
 } // namespace AZ::IO
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StreamerCoroutine.h>
+
+#if defined(AZ_TASK_COROUTINES_SUPPORTED)
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/Streamer/IStreamerMock.h>
+
+namespace UnitTest
+{
+    class StreamerCoroutineTest
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            using ::testing::_;
+
+            LeakDetectionFixture::SetUp();
+            m_executor = aznew AZ::TaskExecutor();
+
+            ON_CALL(m_mockStreamer, Read(_, ::testing::An<void*>(), _, _, _, _, _))
+                .WillByDefault(
+                    [this](
+                        AZStd::string_view relativePath,
+                        void* outputBuffer,
+                        [[maybe_unused]] size_t outputBufferSize,
+                        size_t readSize,
+                        [[maybe_unused]] AZStd::chrono::microseconds deadline,
+                        [[maybe_unused]] IStreamerTypes::Priority priority,
+                        [[maybe_unused]] size_t offset)
+                    {
+                        m_relativePath = relativePath;
+                        m_outputBuffer = outputBuffer;
+                        m_readSize = readSize;
+                        return nullptr;
+                    });
+
+            ON_CALL(m_mockStreamer, SetRequestCompleteCallback(_, _))
+                .WillByDefault(
+                    [this](FileRequestPtr& request, AZ::IO::IStreamer::OnCompleteCallback callback) -> FileRequestPtr&
+                    {
+                        m_callback = AZStd::move(callback);
+                        return request;
+                    });
+
+            // Requests are completed by CompleteRequest instead, so tests can check the state of the coroutine while it's suspended.
+            ON_CALL(m_mockStreamer, QueueRequest(_))
+                .WillByDefault(
+                    [this]([[maybe_unused]] const FileRequestPtr& request)
+                    {
+                        m_queued.release();
+                    });
+
+            ON_CALL(m_mockStreamer, GetRequestStatus(_))
+                .WillByDefault(
+                    [this]([[maybe_unused]] FileRequestHandle request)
+                    {
+                        return m_requestStatus;
+                    });
+
+            ON_CALL(m_mockStreamer, GetReadRequestResult(_, _, _, _))
+                .WillByDefault(
+                    [this](
+                        [[maybe_unused]] FileRequestHandle request,
+                        void*& buffer,
+                        AZ::u64& numBytesRead,
+                        [[maybe_unused]] IStreamerTypes::ClaimMemory claimMemory)
+                    {
+                        buffer = m_outputBuffer;
+                        numBytesRead = m_requestStatus == IStreamerTypes::RequestStatus::Completed ? m_readSize : 0;
+                        return m_requestStatus == IStreamerTypes::RequestStatus::Completed;
+                    });
+        }
+
+        void TearDown() override
+        {
+            azdestroy(m_executor);
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        //! Waits for the read to be queued and then completes it with the given status from a separate thread, the same way the
+        //! streamer thread calls the completion callback.
+        void CompleteRequest(IStreamerTypes::RequestStatus status)
+        {
+            m_queued.acquire();
+            m_requestStatus = status;
+            AZStd::thread streamerThread(
+                [this]()
+                {
+                    m_callback(FileRequestHandle(FileRequestPtr{}));
+                });
+            streamerThread.join();
+        }
+
+        //! Reads into the buffer and records where and with which result the coroutine was resumed.
+        static AZ::TaskCoroutine<> ReadFile(
+            AZ::IO::IStreamer& streamer,
+            AZ::TaskExecutor& executor,
+            AZStd::span<char> buffer,
+            AZ::IO::StreamerReadResult& result,
+            AZStd::atomic_bool& resumedOnWorker,
+            AZStd::binary_semaphore& done)
+        {
+            result = co_await AZ::IO::ReadAsync(
+                streamer, "streamer/coroutine/test.bin", buffer.data(), buffer.size(), buffer.size(), AZ::IO::IStreamerTypes::s_noDeadline,
+                AZ::IO::IStreamerTypes::s_priorityMedium, 0, executor);
+            resumedOnWorker = executor.IsWorkerThread();
+            done.release();
+        }
+
+        ::testing::NiceMock<StreamerMock> m_mockStreamer;
+        AZ::TaskExecutor* m_executor = nullptr;
+
+        AZStd::string_view m_relativePath;
+        void* m_outputBuffer = nullptr;
+        size_t m_readSize = 0;
+        IStreamerTypes::RequestStatus m_requestStatus = IStreamerTypes::RequestStatus::Pending;
+        AZ::IO::IStreamer::OnCompleteCallback m_callback;
+        AZStd::binary_semaphore m_queued;
+    };
+
+    TEST_F(StreamerCoroutineTest, ReadAsync_ReadCompleted_ResumesOnWorkerWithReadResult)
+    {
+        char buffer[64] = {};
+        AZ::IO::StreamerReadResult result;
+        AZStd::atomic_bool resumedOnWorker = false;
+        AZStd::binary_semaphore done;
+        ReadFile(m_mockStreamer, *m_executor, buffer, result, resumedOnWorker, done).Start(*m_executor);
+
+        CompleteRequest(IStreamerTypes::RequestStatus::Completed);
+        done.acquire();
+
+        EXPECT_EQ("streamer/coroutine/test.bin", m_relativePath);
+        EXPECT_TRUE(resumedOnWorker);
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result.m_status);
+        EXPECT_EQ(buffer, result.m_buffer);
+        EXPECT_EQ(sizeof(buffer), result.m_bytesRead);
+    }
+
+    TEST_F(StreamerCoroutineTest, ReadAsync_ReadFailed_ResumesOnWorkerWithFailedStatus)
+    {
+        char buffer[64] = {};
+        AZ::IO::StreamerReadResult result;
+        AZStd::atomic_bool resumedOnWorker = false;
+        AZStd::binary_semaphore done;
+        ReadFile(m_mockStreamer, *m_executor, buffer, result, resumedOnWorker, done).Start(*m_executor);
+
+        CompleteRequest(IStreamerTypes::RequestStatus::Failed);
+        done.acquire();
+
+        EXPECT_TRUE(resumedOnWorker);
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, result.m_status);
+        EXPECT_EQ(0, result.m_bytesRead);
+    }
+
+    TEST_F(StreamerCoroutineTest, ReadAsync_ReadCanceled_StaysSuspendedUntilCanceledThenResumes)
+    {
+        char buffer[64] = {};
+        AZ::IO::StreamerReadResult result;
+        AZStd::atomic_bool resumedOnWorker = false;
+        AZStd::binary_semaphore done;
+        ReadFile(m_mockStreamer, *m_executor, buffer, result, resumedOnWorker, done).Start(*m_executor);
+
+        // The read is queued but not processed, so the coroutine has to remain suspended.
+        m_queued.acquire();
+        EXPECT_FALSE(done.try_acquire_for(AZStd::chrono::milliseconds(10)));
+        m_queued.release();
+
+        CompleteRequest(IStreamerTypes::RequestStatus::Canceled);
+        done.acquire();
+
+        EXPECT_TRUE(resumedOnWorker);
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Canceled, result.m_status);
+        EXPECT_EQ(0, result.m_bytesRead);
+    }
+} // namespace UnitTest
+
+#endif // defined(AZ_TASK_COROUTINES_SUPPORTED)
@@ -6,9 +6,12 @@
  *
  */
 
+#include <AzCore/Task/TaskCoroutine.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Threading/ThreadUtils.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -18,6 +21,7 @@ using AZ::TaskDescriptor;
 using AZ::TaskGraph;
 using AZ::TaskGraphEvent;
 using AZ::TaskExecutor;
+using AZ::TaskExecutorDesc;
 using AZ::Internal::Task;
 using AZ::TaskPriority;
 
@@ -624,6 +628,146 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST(TaskGraphTests, ParseCpuList_RangesAndSingleCpus_AreExpanded)
+    {
+        EXPECT_EQ(AZStd::vector<uint32_t>({ 0, 1, 2, 3, 8, 10, 11 }), AZ::Threading::ParseCpuList("0-3,8,10-11\n"));
+        EXPECT_EQ(AZStd::vector<uint32_t>({ 5 }), AZ::Threading::ParseCpuList("5"));
+        EXPECT_TRUE(AZ::Threading::ParseCpuList("").empty());
+        EXPECT_TRUE(AZ::Threading::ParseCpuList("3-1").empty());
+        EXPECT_TRUE(AZ::Threading::ParseCpuList("0-x").empty());
+    }
+
+    TEST_F(TaskGraphTestFixture, TopologyAwareExecutor_RunsFanOutFanInGraph)
+    {
+        TaskExecutorDesc desc;
+        desc.m_threadCount = 4;
+        desc.m_topologyAware = true;
+        TaskExecutor executor(desc);
+
+        // Workers are always covered by contiguous domains, whether or not the topology is available
+        ASSERT_GE(executor.GetWorkerDomainCount(), 1u);
+        uint32_t nextWorker = 0;
+        for (uint32_t domain = 0; domain != executor.GetWorkerDomainCount(); ++domain)
+        {
+            EXPECT_EQ(nextWorker, executor.GetWorkerDomainFirstWorker(domain));
+            EXPECT_GT(executor.GetWorkerDomainWorkerCount(domain), 0u);
+            nextWorker += executor.GetWorkerDomainWorkerCount(domain);
+        }
+        EXPECT_EQ(executor.GetWorkerCount(), nextWorker);
+
+        constexpr int FanOut = 64;
+        AZStd::atomic<int> counter = 0;
+        AZStd::atomic<int> joined = 0;
+
+        TaskGraph graph{ "TestGraph" };
+        auto root = graph.AddTask(defaultTD, [] {});
+        auto join = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                joined = counter.load();
+            });
+        for (int i = 0; i != FanOut; ++i)
+        {
+            auto task = graph.AddTask(
+                defaultTD,
+                [&counter]
+                {
+                    ++counter;
+                });
+            root.Precedes(task);
+            task.Precedes(join);
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(FanOut, counter);
+        EXPECT_EQ(FanOut, joined);
+    }
+
+    TEST_F(TaskGraphTestFixture, ExecutorShutdown_WaitsForSingleTasks)
+    {
+        constexpr int TaskCount = 256;
+        AZStd::atomic<int> counter = 0;
+        {
+            TaskExecutorDesc desc;
+            desc.m_threadCount = 2;
+            TaskExecutor executor(desc);
+            for (int i = 0; i != TaskCount; ++i)
+            {
+                executor.SubmitTask(
+                    defaultTD,
+                    [&counter]
+                    {
+                        ++counter;
+                    });
+            }
+        }
+        EXPECT_EQ(TaskCount, counter);
+    }
+
+#if defined(AZ_TASK_COROUTINES_SUPPORTED)
+    static AZ::TaskCoroutine<int> SumOnWorker(TaskExecutor& executor, int a, int b)
+    {
+        co_await AZ::TaskYield(executor);
+        EXPECT_TRUE(executor.IsWorkerThread());
+        co_return a + b;
+    }
+
+    static AZ::TaskCoroutine<int> SumGraphOnWorker(TaskExecutor& executor, AZStd::atomic<int>& counter)
+    {
+        TaskGraph graph{ "CoroutineGraph" };
+        for (int i = 0; i != 8; ++i)
+        {
+            graph.AddTask(
+                defaultTD,
+                [&counter]
+                {
+                    ++counter;
+                });
+        }
+        co_await AZ::SubmitAndAwait(graph, executor);
+        EXPECT_TRUE(executor.IsWorkerThread());
+
+        const int sum = co_await SumOnWorker(executor, counter, 2);
+        co_return sum;
+    }
+
+    TEST_F(TaskGraphTestFixture, TaskCoroutine_AwaitGraphAndCoroutine_ResumesOnWorker)
+    {
+        AZStd::atomic<int> counter = 0;
+        EXPECT_EQ(10, SumGraphOnWorker(*m_executor, counter).Wait(*m_executor));
+        EXPECT_EQ(8, counter);
+    }
+
+    TEST_F(TaskGraphTestFixture, TaskCoroutine_AwaitEmptyGraph_Resumes)
+    {
+        auto coroutine = [](TaskExecutor& executor) -> AZ::TaskCoroutine<bool>
+        {
+            TaskGraph graph{ "EmptyGraph" };
+            co_await AZ::SubmitAndAwait(graph, executor);
+            co_return true;
+        };
+        EXPECT_TRUE(coroutine(*m_executor).Wait(*m_executor));
+    }
+
+    TEST_F(TaskGraphTestFixture, TaskCoroutine_Start_RunsToCompletionDetached)
+    {
+        AZStd::binary_semaphore done;
+        AZStd::atomic<int> result = 0;
+        auto coroutine = [](TaskExecutor& executor, AZStd::binary_semaphore& done, AZStd::atomic<int>& result) -> AZ::TaskCoroutine<>
+        {
+            result = co_await SumOnWorker(executor, 3, 4);
+            done.release();
+        };
+        coroutine(*m_executor, done, result).Start(*m_executor);
+        done.acquire();
+        EXPECT_EQ(7, result);
+    }
+#endif // defined(AZ_TASK_COROUTINES_SUPPORTED)
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -710,6 +854,75 @@ namespace Benchmark
         }
     }
 
+    // Runs a root task fanning out to a number of tasks touching their own block of memory, which then fan in to a join
+    // task. Arguments are the worker count and whether the executor is topology aware.
+    static void BM_TaskGraph_FanOutFanIn(benchmark::State& state)
+    {
+        constexpr uint32_t FanOut = 256;
+        constexpr size_t BlockSize = 16 * 1024;
+
+        TaskExecutorDesc desc;
+        desc.m_threadCount = static_cast<uint32_t>(state.range(0));
+        desc.m_topologyAware = state.range(1) != 0;
+        TaskExecutor executor(desc);
+
+        AZStd::vector<AZStd::vector<uint32_t>> blocks(FanOut, AZStd::vector<uint32_t>(BlockSize / sizeof(uint32_t), 1));
+        AZStd::vector<uint32_t> sums(FanOut, 0);
+        uint64_t total = 0;
+
+        TaskGraph graph{ "FanOutFanIn" };
+        TaskDescriptor descriptor{ "fan", "benchmark" };
+        auto root = graph.AddTask(descriptor, [] {});
+        auto join = graph.AddTask(
+            descriptor,
+            [&]
+            {
+                total = 0;
+                for (uint32_t sum : sums)
+                {
+                    total += sum;
+                }
+            });
+        for (uint32_t i = 0; i != FanOut; ++i)
+        {
+            auto task = graph.AddTask(
+                descriptor,
+                [&blocks, &sums, i]
+                {
+                    uint32_t sum = 0;
+                    for (uint32_t& value : blocks[i])
+                    {
+                        value = value * 3 + 1;
+                        sum += value;
+                    }
+                    sums[i] = sum;
+                });
+            root.Precedes(task);
+            task.Precedes(join);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraphEvent ev{ "ev" };
+            graph.SubmitOnExecutor(executor, &ev);
+            ev.Wait();
+        }
+        benchmark::DoNotOptimize(total);
+        state.SetItemsProcessed(state.iterations() * FanOut);
+    }
+    static void FanOutFanInSettings(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "Workers", "TopologyAware" })->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+        const int64_t maxWorkers = AZStd::max(1u, AZStd::thread::hardware_concurrency());
+        for (int64_t workers = 1; workers < maxWorkers * 2; workers *= 2)
+        {
+            benchmark->Args({ AZStd::min(workers, maxWorkers), 0 });
+            benchmark->Args({ AZStd::min(workers, maxWorkers), 1 });
+        }
+    }
+    BENCHMARK(BM_TaskGraph_FanOutFanIn)->Apply(&FanOutFanInSettings);
+
     BENCHMARK_F(TaskGraphBenchmarkFixture, FourToOneJoin)(benchmark::State& state)
     {
         auto [a, b, c, d, e] = graph->AddTasks(
@@ -91,6 +91,7 @@ set(FILES
     DOM/DomValueBenchmarks.cpp
     DOM/DomPrefixTreeTests.cpp
     DOM/DomPrefixTreeBenchmarks.cpp
+    EBus/EBusMultiProducerQueueTests.cpp
     EBus/EBusSharedDispatchMutexTests.cpp
     EBus/ScheduledEventTests.cpp
     EBus.cpp
@@ -149,6 +150,8 @@ set(FILES
     Math/ShapeIntersectionTests.cpp
     Math/SfmtTests.cpp
     Math/SimdMathTests.cpp
+    Math/SoaMathPerformanceTests.cpp
+    Math/SoaMathTests.cpp
     Math/SphereTests.cpp
     Math/RayTests.cpp
     Math/LineSegmentTests.cpp
@@ -165,6 +168,7 @@ set(FILES
     Math/VectorNPerformanceTests.cpp
     Math/PackedVectorTest.cpp
     Memory/AllocatorBenchmarks.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaAllocator.cpp
     Memory/HphaAllocatorErrorDetection.cpp
     Memory/LeakDetection.cpp
@@ -204,6 +208,7 @@ set(FILES
     Serialization/Json/JsonSerializationTests.h
     Serialization/Json/JsonSerializationTests.cpp
     Serialization/Json/JsonSerializationUtilsTests.cpp
+    Serialization/Json/JsonStreamDeserializerTests.cpp
     Serialization/Json/JsonSerializerConformityTests.h
     Serialization/Json/JsonSerializerMock.h
     Serialization/Json/MapSerializerTests.cpp
@@ -255,6 +260,7 @@ set(FILES
     Streamer/IStreamerTypesMock.h
     Streamer/ReadSplitterTests.cpp
     Streamer/SchedulerTests.cpp
+    Streamer/StreamerCoroutineTests.cpp
     Streamer/StreamStackEntryConformityTests.h
     Streamer/StreamStackEntryMock.h
     Streamer/StreamStackEntryTests.cpp
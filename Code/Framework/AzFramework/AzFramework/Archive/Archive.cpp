@@ -50,6 +50,9 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(bool, sys_PakMemoryMapped, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If set, read-only archives that are opened afterwards are memory mapped instead of read through file handles.\n"
+        "Stored files are then accessed in place and compressed files are uncompressed straight from the mapping.");
 }
 
 namespace AZ::IO::ArchiveInternal
@@ -1382,6 +1385,7 @@ namespace AZ::IO
     {
         m_nArchiveFlags = nArchiveFlags;
         m_pFileData = nullptr;
+        m_bFileDataMapped = false;
         m_pZip = pZip;
         m_pFileEntry = pFileEntry;
     }
@@ -1389,11 +1393,11 @@ namespace AZ::IO
     CCachedFileData::~CCachedFileData()
     {
         // forced destruction
-        if (m_pFileData)
+        if (m_pFileData && !m_bFileDataMapped)
         {
             AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(m_pFileData);
-            m_pFileData = nullptr;
         }
+        m_pFileData = nullptr;
 
         m_pZip = nullptr;
         m_pFileEntry = nullptr;
@@ -1451,6 +1455,17 @@ namespace AZ::IO
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
             if (!m_pFileData)
             {
+                // stored files in a memory mapped archive are returned in place, without copying them
+                if (!m_pFileEntry->IsCompressed())
+                {
+                    if (AZStd::span<const AZStd::byte> mappedData = m_pZip->GetMappedFileData(m_pFileEntry); !mappedData.empty())
+                    {
+                        m_pFileData = const_cast<AZStd::byte*>(mappedData.data());
+                        m_bFileDataMapped = true;
+                        return m_pFileData;
+                    }
+                }
+
                 // don't try to decompress if its not actually compressed
                 decompress = decompress && m_pFileEntry->IsCompressed();
 
@@ -1503,8 +1518,13 @@ namespace AZ::IO
         if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
         {
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
+            if (AZStd::span<const AZStd::byte> mappedData = m_pZip->GetMappedFileData(m_pFileEntry); !mappedData.empty())
+            {
+                // the mapping can be read at any offset, so only the requested range is copied
+                memcpy(pBuffer, mappedData.data() + nFileOffset, static_cast<size_t>(nReadSize));
+            }
             // Uncompressed read.
-            if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, nullptr, pBuffer))
+            else if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, nullptr, pBuffer))
             {
                 return -1;
             }
@@ -1562,6 +1582,11 @@ namespace AZ::IO
         if (nFlags & INestedArchive::FLAGS_READ_ONLY)
         {
             nFactoryFlags |= ZipDir::CacheFactory::FLAGS_READ_ONLY;
+
+            if ((nFlags & INestedArchive::FLAGS_MEMORY_MAPPED) || sys_PakMemoryMapped)
+            {
+                nFactoryFlags |= ZipDir::CacheFactory::FLAGS_MEMORY_MAPPED;
+            }
         }
 
 
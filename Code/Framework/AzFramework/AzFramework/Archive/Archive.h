@@ -57,6 +57,7 @@ namespace AZ::IO
         // the cache is refreshed. Otherwise, it returns whatever cache is (nullptr if the data isn't cached yet)
         // decompress can be harmlessly set to true if you want the data back decompressed.
         // set them to false only if you want to operate on the raw data while its still compressed.
+        // for stored files in a memory mapped archive the returned data points into the read-only mapping and must not be modified.
         void* GetData(bool bRefreshCache = true, bool decompress = true);
         // Uncompress file data directly to provided memory.
         bool GetDataTo(void* pFileData, int nDataSize, bool bDecompress = true);
@@ -70,6 +71,8 @@ namespace AZ::IO
         uint32_t GetFileDataOffset();
 
         void* m_pFileData;
+        // true if m_pFileData points into the memory mapped archive instead of an allocation owned by this object
+        bool m_bFileDataMapped;
 
         // the zip file in which this file is opened
         ZipDir::CachePtr m_pZip;
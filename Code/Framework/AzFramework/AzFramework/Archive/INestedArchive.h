@@ -84,6 +84,11 @@ namespace AZ::IO
             // to ensure that specific paks stay in the position(to keep the same priority) but being disabled
             // when running multiplayer
             FLAGS_DISABLE_PAK = 1 << 11,
+
+            // if this is set, a read-only archive is memory mapped. Stored files are then accessed in place
+            // and compressed files are uncompressed straight from the mapping, without any file reads.
+            // The sys_PakMemoryMapped cvar sets this flag for all read-only archives
+            FLAGS_MEMORY_MAPPED = 1 << 12,
         };
 
         using Handle = void*;
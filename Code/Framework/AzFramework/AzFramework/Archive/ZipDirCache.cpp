@@ -150,6 +150,7 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        m_mappedFile.Close();
         m_treeDir.Clear();
     }
 
@@ -666,6 +667,11 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
+        if (m_mappedFile.IsOpen())
+        {
+            return ReadMappedFile(pFileEntry, pCompressed, pUncompressed);
+        }
+
         if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
         {
             return ZD_ERROR_IO_FAILED;
@@ -707,27 +713,78 @@ namespace AZ::IO::ZipDir
             }
             else
             {
-                size_t nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
-                if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
-                {
-                    return ZD_ERROR_CORRUPTED_DATA;
-                }
-                if (pFileEntry->bCheckCRCNextRead)
-                {
-                    pFileEntry->bCheckCRCNextRead = false;
-                    uLong uCRC32 = AZ::Crc32((Bytef*)pUncompressed, nSizeUncompressed);
-                    if (uCRC32 != pFileEntry->desc.lCRC32)
-                    {
-                        AZ_Warning("Archive", false, "ZD_ERROR_CRC32_CHECK: Uncompressed stream CRC32 check failed");
-                        return ZD_ERROR_CRC32_CHECK;
-                    }
-                }
+                return UncompressFile(pFileEntry, pBuffer, pUncompressed);
+            }
+        }
+
+        return ZD_ERROR_SUCCESS;
+    }
+
+    ErrorEnum Cache::ReadMappedFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed)
+    {
+        AZStd::span<const AZStd::byte> fileData = GetMappedFileData(pFileEntry);
+        if (fileData.size() != pFileEntry->desc.lSizeCompressed)
+        {
+            return ZD_ERROR_IO_FAILED;
+        }
+
+        if (!pCompressed && !pUncompressed)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        // unlike a file read, the compressed data doesn't need to be staged in a buffer before it's uncompressed
+        if (pCompressed)
+        {
+            memcpy(pCompressed, fileData.data(), fileData.size());
+        }
+
+        if (pUncompressed)
+        {
+            if (pFileEntry->nMethod == 0)
+            {
+                memcpy(pUncompressed, fileData.data(), fileData.size());
+            }
+            else
+            {
+                return UncompressFile(pFileEntry, fileData.data(), pUncompressed);
             }
         }
 
         return ZD_ERROR_SUCCESS;
     }
 
+    ErrorEnum Cache::UncompressFile(FileEntry* pFileEntry, const void* pCompressed, void* pUncompressed)
+    {
+        size_t nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
+        if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pCompressed, pFileEntry->desc.lSizeCompressed))
+        {
+            return ZD_ERROR_CORRUPTED_DATA;
+        }
+        if (pFileEntry->bCheckCRCNextRead)
+        {
+            pFileEntry->bCheckCRCNextRead = false;
+            uLong uCRC32 = AZ::Crc32((Bytef*)pUncompressed, nSizeUncompressed);
+            if (uCRC32 != pFileEntry->desc.lCRC32)
+            {
+                AZ_Warning("Archive", false, "ZD_ERROR_CRC32_CHECK: Uncompressed stream CRC32 check failed");
+                return ZD_ERROR_CRC32_CHECK;
+            }
+        }
+        return ZD_ERROR_SUCCESS;
+    }
+
+    AZStd::span<const AZStd::byte> Cache::GetMappedFileData(FileEntry* pFileEntry)
+    {
+        if (!m_mappedFile.IsOpen() || Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return {};
+        }
+
+        AZStd::span<const AZStd::byte> fileData = m_mappedFile.GetView(pFileEntry->nFileDataOffset, pFileEntry->desc.lSizeCompressed);
+        return fileData.size() == pFileEntry->desc.lSizeCompressed ? fileData : AZStd::span<const AZStd::byte>{};
+    }
+
 
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
@@ -760,6 +817,20 @@ namespace AZ::IO::ZipDir
         {
             return ZD_ERROR_SUCCESS; // the data offset has been successfully read..
         }
+
+        if (m_mappedFile.IsOpen())
+        {
+            // parse the local header from the mapping, which avoids seeking the shared file handle
+            AZStd::span<const AZStd::byte> headerData = m_mappedFile.GetView(pFileEntry->nFileHeaderOffset, sizeof(ZipFile::LocalFileHeader));
+            if (headerData.size() != sizeof(ZipFile::LocalFileHeader))
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
+            ZipFile::LocalFileHeader fileHeader;
+            memcpy(&fileHeader, headerData.data(), sizeof(fileHeader));
+            return ZipDir::Refresh(fileHeader, pFileEntry);
+        }
+
         CZipFile tmp;
         tmp.m_fileHandle = m_fileHandle;
         return ZipDir::Refresh(&tmp, pFileEntry);
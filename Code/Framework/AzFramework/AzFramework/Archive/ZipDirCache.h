@@ -16,6 +16,7 @@
 #pragma once
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
@@ -83,6 +84,17 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // returns a view of the raw (compressed or stored) file data inside the memory mapped archive.
+        // the view is empty if the archive isn't memory mapped or the file data lies outside of the archive.
+        // the data is read-only and remains valid until the cache is closed
+        AZStd::span<const AZStd::byte> GetMappedFileData(FileEntry* pFileEntry);
+
+        // returns true if the archive was opened with CacheFactory::FLAGS_MEMORY_MAPPED and could be mapped
+        bool IsMemoryMapped() const
+        {
+            return m_mappedFile.IsOpen();
+        }
+
         void Free(void* ptr)
         {
             azfree(ptr);
@@ -119,6 +131,11 @@ namespace AZ::IO::ZipDir
         // writes out the file data in the queue into the given file. Empties the queue
         bool WriteZipFiles(AZStd::vector<AZStd::intrusive_ptr<FileDataRecord>>& queFiles, AZ::IO::HandleType fTmp);
 
+        // reads the file data from the memory mapped archive
+        ErrorEnum ReadMappedFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
+        // uncompresses the file data and validates the CRC if requested
+        ErrorEnum UncompressFile(FileEntry* pFileEntry, const void* pCompressed, void* pUncompressed);
+
         bool WriteCompressedData(uint8_t* data, size_t size, bool encrypt);
         bool WriteNullData(size_t size);
 
@@ -135,6 +152,9 @@ namespace AZ::IO::ZipDir
         AZ::IO::HandleType m_fileHandle = AZ::IO::InvalidHandle;
         AZ::IO::Path m_strFilePath;
 
+        // read-only mapping of the whole archive. When open, file data is read straight from it instead of through m_fileHandle
+        AZ::IO::MappedFile m_mappedFile;
+
         // String Pool for persistently storing paths as long as they reside in the cache
         AZStd::unordered_set<AZ::IO::Path> m_relativePathPool;
 
@@ -89,6 +89,16 @@ namespace AZ::IO::ZipDir
                 AZ_Warning("Archive", false, R"(ZD_ERROR_IO_FAILED: Could not read the CDR of the pack file "%s".)", pCache->m_strFilePath.c_str());
                 return {};
             }
+
+            if (m_nFlags & FLAGS_MEMORY_MAPPED)
+            {
+                // the mapping needs the native path, while the file IO instance also accepts aliased paths
+                AZStd::optional<AZ::IO::FixedMaxPath> resolvedPath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(AZ::IO::PathView(szFileName));
+                if (!resolvedPath || !pCache->m_mappedFile.Open(resolvedPath->c_str()))
+                {
+                    AZ_Warning("Archive", false, R"(Could not memory map the pack file "%s". Falling back to regular file reads.)", szFileName);
+                }
+            }
         }
         else
         {
@@ -33,6 +33,9 @@ namespace AZ::IO::ZipDir
             FLAGS_DONT_MEMORIZE_ZIP_PATH = 1 << 2,
             // if this is set, the archive will be created anew (the existing file will be overwritten)
             FLAGS_CREATE_NEW = 1 << 3,
+            // if this is set, a read-only archive is memory mapped and file data is read from the mapping.
+            // falls back to regular file reads if the archive can't be mapped
+            FLAGS_MEMORY_MAPPED = 1 << 4,
 
             // if this is set, zip path will be searched inside other zips
             FLAGS_READ_INSIDE_PAK = 1 << 7,
@@ -707,6 +707,11 @@ namespace AZ::IO::ZipDir
             return ZD_ERROR_IO_FAILED;
         }
 
+        return Refresh(fileHeader, pFileEntry);
+    }
+
+    ErrorEnum Refresh(const ZipFile::LocalFileHeader& fileHeader, FileEntryBase* pFileEntry)
+    {
         if (fileHeader.desc != pFileEntry->desc
             || fileHeader.nMethod != pFileEntry->nMethod)
         {
@@ -243,6 +243,9 @@ namespace AZ::IO::ZipDir
     // returns the error code if the operation was impossible to complete
     AZF_API ErrorEnum Refresh(CZipFile* f, FileEntryBase* pFileEntry);
 
+    // validates the local file header against the file entry and calculates the offset to the file data from it
+    AZF_API ErrorEnum Refresh(const ZipFile::LocalFileHeader& fileHeader, FileEntryBase* pFileEntry);
+
     // writes into the file local header (NOT including the name, only the header structure)
     // the file must be opened both for reading and writing
     AZF_API ErrorEnum UpdateLocalHeader(AZ::IO::HandleType fileHandle, FileEntryBase* pFileEntry);
@@ -12,6 +12,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Quaternion.h>
@@ -80,6 +81,10 @@ namespace AZ
 
 namespace AzFramework
 {
+    AZ_CVAR(bool, bg_transformHierarchyBatching, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If set to true, transform components activated afterwards update their children once per tick through the TransformHierarchy, "
+        "instead of through TransformNotificationBus events. The children's notifications are sent by the batched update.");
+
     bool TransformComponentVersionConverter(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
     {
         if (classElement.GetVersion() < 3)
@@ -156,12 +161,31 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        if (bg_transformHierarchyBatching)
+        {
+            m_hierarchy = AZ::Interface<TransformHierarchy>::Get();
+            if (m_hierarchy)
+            {
+                m_hierarchyNode = m_hierarchy->AddNode(this, m_localTM, m_worldTM);
+                m_hierarchy->SetNodeKeepWorldTM(m_hierarchyNode, m_onParentChangedBehavior != AZ::OnParentChangedBehavior::Update);
+            }
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
 
     void TransformComponent::Deactivate()
     {
+        if (m_hierarchy)
+        {
+            UpdateFromHierarchy();
+            m_hierarchy->RemoveNode(m_hierarchyNode);
+            m_hierarchy = nullptr;
+            m_hierarchyNode = TransformHierarchy::InvalidNodeHandle;
+            m_hierarchyParentLinked = false;
+        }
+
         AZ::TransformNotificationBus::Event(m_parentId, &AZ::TransformNotificationBus::Events::OnChildRemoved, GetEntityId());
         auto parentTransform = AZ::TransformBus::FindFirstHandler(m_parentId);
         if (parentTransform)
@@ -227,49 +251,49 @@ namespace AzFramework
 
     void TransformComponent::SetWorldTranslation(const AZ::Vector3& newPosition)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetTranslation(newPosition);
         SetWorldTM(newWorldTransform);
     }
 
     void TransformComponent::SetLocalTranslation(const AZ::Vector3& newPosition)
     {
-        AZ::Transform newLocalTransform = m_localTM;
+        AZ::Transform newLocalTransform = GetLocalTM();
         newLocalTransform.SetTranslation(newPosition);
         SetLocalTM(newLocalTransform);
     }
 
     AZ::Vector3 TransformComponent::GetWorldTranslation()
     {
-        return m_worldTM.GetTranslation();
+        return GetWorldTM().GetTranslation();
     }
 
     AZ::Vector3 TransformComponent::GetLocalTranslation()
     {
-        return m_localTM.GetTranslation();
+        return GetLocalTM().GetTranslation();
     }
 
     void TransformComponent::MoveEntity(const AZ::Vector3& offset)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(worldPosition + offset);
     }
 
     void TransformComponent::SetWorldX(float x)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(x, worldPosition.GetY(), worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldY(float y)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), y, worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldZ(float z)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), worldPosition.GetY(), z));
     }
 
@@ -290,77 +314,77 @@ namespace AzFramework
 
     void TransformComponent::SetLocalX(float x)
     {
-        AZ::Vector3 newLocalTranslation = m_localTM.GetTranslation();
+        AZ::Vector3 newLocalTranslation = GetLocalTM().GetTranslation();
         newLocalTranslation.SetX(x);
         SetLocalTranslation(newLocalTranslation);
     }
 
     void TransformComponent::SetLocalY(float y)
     {
-        AZ::Vector3 newLocalTranslation = m_localTM.GetTranslation();
+        AZ::Vector3 newLocalTranslation = GetLocalTM().GetTranslation();
         newLocalTranslation.SetY(y);
         SetLocalTranslation(newLocalTranslation);
     }
 
     void TransformComponent::SetLocalZ(float z)
     {
-        AZ::Vector3 newLocalTranslation = m_localTM.GetTranslation();
+        AZ::Vector3 newLocalTranslation = GetLocalTM().GetTranslation();
         newLocalTranslation.SetZ(z);
         SetLocalTranslation(newLocalTranslation);
     }
 
     float TransformComponent::GetLocalX()
     {
-        float localX = m_localTM.GetTranslation().GetX();
+        float localX = GetLocalTM().GetTranslation().GetX();
         return localX;
     }
 
     float TransformComponent::GetLocalY()
     {
-        float localY = m_localTM.GetTranslation().GetY();
+        float localY = GetLocalTM().GetTranslation().GetY();
         return localY;
     }
 
     float TransformComponent::GetLocalZ()
     {
-        float localZ = m_localTM.GetTranslation().GetZ();
+        float localZ = GetLocalTM().GetTranslation().GetZ();
         return localZ;
     }
 
     void TransformComponent::SetWorldRotation(const AZ::Vector3& eulerAnglesRadian)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotation(AZ::Quaternion::CreateFromEulerAnglesRadians(eulerAnglesRadian));
         SetWorldTM(newWorldTransform);
     }
 
     void TransformComponent::SetWorldRotationQuaternion(const AZ::Quaternion& quaternion)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotation(quaternion);
         SetWorldTM(newWorldTransform);
     }
 
     AZ::Vector3 TransformComponent::GetWorldRotation()
     {
-        return m_worldTM.GetRotation().GetEulerRadians();
+        return GetWorldTM().GetRotation().GetEulerRadians();
     }
 
     AZ::Quaternion TransformComponent::GetWorldRotationQuaternion()
     {
-        return m_worldTM.GetRotation();
+        return GetWorldTM().GetRotation();
     }
 
     void TransformComponent::SetLocalRotation(const AZ::Vector3& eulerRadianAngles)
     {
-        AZ::Transform newLocalTM = m_localTM;
+        AZ::Transform newLocalTM = GetLocalTM();
         newLocalTM.SetRotation(AZ::Quaternion::CreateFromEulerAnglesRadians(eulerRadianAngles));
         SetLocalTM(newLocalTM);
     }
 
     void TransformComponent::SetLocalRotationQuaternion(const AZ::Quaternion& quaternion)
     {
-        AZ::Transform newLocalTM = m_localTM;
+        AZ::Transform newLocalTM = GetLocalTM();
         newLocalTM.SetRotation(quaternion);
         SetLocalTM(newLocalTM);
     }
@@ -378,62 +402,62 @@ namespace AzFramework
 
     void TransformComponent::RotateAroundLocalX(float eulerAngleRadian)
     {
-        AZ::Vector3 xAxis = m_localTM.GetBasisX();
+        AZ::Vector3 xAxis = GetLocalTM().GetBasisX();
         
-        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, m_localTM, xAxis);
+        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, GetLocalTM(), xAxis);
         
         SetLocalTM(newLocalTM);
     }
 
     void TransformComponent::RotateAroundLocalY(float eulerAngleRadian)
     {
-        AZ::Vector3 yAxis = m_localTM.GetBasisY();
+        AZ::Vector3 yAxis = GetLocalTM().GetBasisY();
         
-        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, m_localTM, yAxis);
+        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, GetLocalTM(), yAxis);
 
         SetLocalTM(newLocalTM);
     }
 
     void TransformComponent::RotateAroundLocalZ(float eulerAngleRadian)
     {
-        AZ::Vector3 zAxis = m_localTM.GetBasisZ();
+        AZ::Vector3 zAxis = GetLocalTM().GetBasisZ();
         
-        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, m_localTM, zAxis);
+        AZ::Transform newLocalTM = RotateAroundLocalHelper(eulerAngleRadian, GetLocalTM(), zAxis);
 
         SetLocalTM(newLocalTM);
     }
 
     AZ::Vector3 TransformComponent::GetLocalRotation()
     {
-        return m_localTM.GetRotation().GetEulerRadians();
+        return GetLocalTM().GetRotation().GetEulerRadians();
     }
 
     AZ::Quaternion TransformComponent::GetLocalRotationQuaternion()
     {
-        return m_localTM.GetRotation();
+        return GetLocalTM().GetRotation();
     }
 
     AZ::Vector3 TransformComponent::GetLocalScale()
     {
         AZ_WarningOnce("TransformComponent", false, "GetLocalScale is deprecated, please use GetLocalUniformScale instead");
-        return AZ::Vector3(m_localTM.GetUniformScale());
+        return AZ::Vector3(GetLocalTM().GetUniformScale());
     }
 
     void TransformComponent::SetLocalUniformScale(float scale)
     {
-        AZ::Transform newLocalTM = m_localTM;
+        AZ::Transform newLocalTM = GetLocalTM();
         newLocalTM.SetUniformScale(scale);
         SetLocalTM(newLocalTM);
     }
 
     float TransformComponent::GetLocalUniformScale()
     {
-        return m_localTM.GetUniformScale();
+        return GetLocalTM().GetUniformScale();
     }
 
     float TransformComponent::GetWorldUniformScale()
     {
-        return m_worldTM.GetUniformScale();
+        return GetWorldTM().GetUniformScale();
     }
 
     AZStd::vector<AZ::EntityId> TransformComponent::GetChildren()
@@ -478,6 +502,10 @@ namespace AzFramework
     void TransformComponent::SetOnParentChangedBehavior(AZ::OnParentChangedBehavior onParentChangedBehavior)
     {
         m_onParentChangedBehavior = onParentChangedBehavior;
+        if (m_hierarchy)
+        {
+            m_hierarchy->SetNodeKeepWorldTM(m_hierarchyNode, m_onParentChangedBehavior != AZ::OnParentChangedBehavior::Update);
+        }
     }
 
     void TransformComponent::OnTransformChanged(const AZ::Transform& parentLocalTM, const AZ::Transform& parentWorldTM)
@@ -537,12 +565,16 @@ namespace AzFramework
             {
                 ComputeWorldTM();
             }
+
+            UpdateHierarchyParent(m_parentTM);
         }
     }
 
     void TransformComponent::OnEntityDeactivated([[maybe_unused]] const AZ::EntityId& parentEntityId)
     {
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
+        UpdateFromHierarchy();
+        UpdateHierarchyParent(nullptr);
         m_parentTM = nullptr;
         m_parentActive = false;
         ComputeLocalTM();
@@ -556,6 +588,9 @@ namespace AzFramework
             return;
         }
 
+        UpdateFromHierarchy();
+        UpdateHierarchyParent(nullptr);
+
         AZ::EntityId oldParent = m_parentId;
         if (m_parentId.IsValid())
         {
@@ -622,12 +657,14 @@ namespace AzFramework
 
     void TransformComponent::SetLocalTMImpl(const AZ::Transform& tm)
     {
+        UpdateFromHierarchy();
         m_localTM = tm;
         ComputeWorldTM();  // We can user dirty flags and compute it later on demand
     }
 
     void TransformComponent::SetWorldTMImpl(const AZ::Transform& tm)
     {
+        UpdateFromHierarchy();
         m_worldTM = tm;
         ComputeLocalTM(); // We can user dirty flags and compute it later on demand
     }
@@ -641,6 +678,7 @@ namespace AzFramework
             if (m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
             {
                 m_worldTM = parentWorldTM * m_localTM;
+                SendTransformsToHierarchy(true);
                 AZ::TransformNotificationBus::Event(
                     m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
                 m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -652,6 +690,7 @@ namespace AzFramework
                 // transform has not changed, and with this OnParentChangedBehavior setting the expectation is that
                 // another system will update our transform, and the notification will be triggered then.
                 m_localTM = parentWorldTM.GetInverse() * m_worldTM;
+                SendTransformsToHierarchy(false);
             }
         }
     }
@@ -667,6 +706,7 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
+        SendTransformsToHierarchy(true);
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -689,6 +729,7 @@ namespace AzFramework
             m_worldTM = m_localTM;
         }
 
+        SendTransformsToHierarchy(true);
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -706,6 +747,60 @@ namespace AzFramework
         return true;
     }
 
+    void TransformComponent::OnHierarchyTransformsUpdated(const AZ::Transform& localTM, const AZ::Transform& worldTM)
+    {
+        m_localTM = localTM;
+        m_worldTM = worldTM;
+    }
+
+    void TransformComponent::OnHierarchyTransformChanged()
+    {
+        // Same notifications as OnTransformChangedImpl, sent once the whole hierarchy is up to date.
+        AZ::TransformNotificationBus::Event(
+            m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+    }
+
+    void TransformComponent::OnHierarchyDisconnected()
+    {
+        UpdateHierarchyParent(nullptr);
+        m_hierarchy = nullptr;
+        m_hierarchyNode = TransformHierarchy::InvalidNodeHandle;
+    }
+
+    void TransformComponent::UpdateHierarchyParent(AZ::TransformInterface* parent)
+    {
+        if (!m_hierarchy)
+        {
+            return;
+        }
+
+        TransformComponent* parentComponent = parent ? azrtti_cast<TransformComponent*>(parent) : nullptr;
+        const bool link = parentComponent && parentComponent->m_hierarchy == m_hierarchy;
+        m_hierarchy->SetNodeParent(m_hierarchyNode, link ? parentComponent->m_hierarchyNode : TransformHierarchy::InvalidNodeHandle);
+
+        if (link != m_hierarchyParentLinked)
+        {
+            m_hierarchyParentLinked = link;
+            if (link)
+            {
+                AZ::TransformNotificationBus::Handler::BusDisconnect();
+            }
+            else if (m_parentId.IsValid())
+            {
+                AZ::TransformNotificationBus::Handler::BusConnect(m_parentId);
+            }
+        }
+    }
+
+    void TransformComponent::SendTransformsToHierarchy(bool worldChanged)
+    {
+        if (m_hierarchy)
+        {
+            m_hierarchy->SetNodeTransforms(m_hierarchyNode, m_localTM, m_worldTM, worldChanged);
+        }
+    }
+
     void TransformComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
     {
         provided.push_back(AZ_CRC_CE("TransformService"));
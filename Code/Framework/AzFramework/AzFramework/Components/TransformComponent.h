@@ -14,6 +14,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
 #include <AzFramework/AzFrameworkAPI.h>
+#include <AzFramework/Components/TransformHierarchy.h>
 
 namespace AzToolsFramework
 {
@@ -37,6 +38,7 @@ namespace AzFramework
         , public AZ::TransformBus::Handler
         , public AZ::TransformNotificationBus::Handler
         , private AZ::TransformHierarchyInformationBus::Handler
+        , private TransformHierarchyListener
     {
     public:
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
@@ -55,11 +57,11 @@ namespace AzFramework
         void BindChildChangedEventHandler(AZ::ChildChangedEvent::Handler& handler) override;
         void NotifyChildChangedEvent(AZ::ChildChangeType changeType, AZ::EntityId entityId) override;
         //! Returns true if the tm was set to the local transform.
-        const AZ::Transform& GetLocalTM() override { return m_localTM; }
+        const AZ::Transform& GetLocalTM() override { UpdateFromHierarchy(); return m_localTM; }
         //! Returns true if the tm was set to the world transform.
-        const AZ::Transform& GetWorldTM() override { return m_worldTM; }
+        const AZ::Transform& GetWorldTM() override { UpdateFromHierarchy(); return m_worldTM; }
         //! Returns both local and world transforms.
-        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = m_worldTM; }
+        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { UpdateFromHierarchy(); localTM = m_localTM; worldTM = m_worldTM; }
         //! Returns parent EntityId.
         AZ::EntityId GetParentId() override { return m_parentId; }
         //! Returns parent interface if available.
@@ -166,6 +168,29 @@ namespace AzFramework
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
+        //! Methods implementing the batched hierarchy update, used when bg_transformHierarchyBatching is set.
+        //! @{
+        // TransformHierarchyListener
+        void OnHierarchyTransformsUpdated(const AZ::Transform& localTM, const AZ::Transform& worldTM) override;
+        void OnHierarchyTransformChanged() override;
+        void OnHierarchyDisconnected() override;
+
+        //! Brings the transforms up to date if an ancestor changed since the last hierarchy update.
+        //! Only done on the main thread, other threads read the transforms stored by the last update.
+        void UpdateFromHierarchy()
+        {
+            if (m_hierarchyParentLinked)
+            {
+                m_hierarchy->UpdateNodeIfStale(m_hierarchyNode);
+            }
+        }
+        //! Links the hierarchy node to the node of the parent if it is also part of the hierarchy. Linked transforms are
+        //! updated by the hierarchy instead of the parent's TransformNotificationBus events.
+        void UpdateHierarchyParent(AZ::TransformInterface* parent);
+        //! Sends the current transforms to the hierarchy.
+        void SendTransformsToHierarchy(bool worldChanged);
+        //! @}
+
         // TransformHierarchyInformationBus
         void GatherChildren(AZStd::vector<AZ::EntityId>& children) override;
 
@@ -191,5 +216,9 @@ namespace AzFramework
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
         /// Behavior for this entity's transform when its parent's transform changes.
         AZ::OnParentChangedBehavior m_onParentChangedBehavior = AZ::OnParentChangedBehavior::Update;
+
+        TransformHierarchy* m_hierarchy = nullptr; ///< The hierarchy updating this transform, if batching is enabled.
+        TransformHierarchy::NodeHandle m_hierarchyNode = TransformHierarchy::InvalidNodeHandle; ///< Node of this transform in m_hierarchy.
+        bool m_hierarchyParentLinked = false; ///< If true, the node is linked to the parent's node and updated by the hierarchy.
     };
 }   // namespace AZ
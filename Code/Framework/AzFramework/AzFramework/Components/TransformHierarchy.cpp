@@ -0,0 +1,558 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformHierarchy.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/atomic.h>
+
+#if defined(AZ_MONOLITHIC_BUILD)
+AZ_DECLARE_BUDGET(AzFramework);
+#else
+AZ_DECLARE_BUDGET_SHARED(AzFramework);
+#endif // defined(AZ_MONOLITHIC_BUILD)
+
+namespace AzFramework
+{
+    // Levels smaller than this are updated on the calling thread, as the cost of submitting a task graph would
+    // outweigh the time saved.
+    static constexpr uint32_t ParallelUpdateMinLevelSize = 2048;
+    static constexpr uint32_t ParallelUpdateBatchSize = 512;
+
+    TransformHierarchy::~TransformHierarchy()
+    {
+        AZ_Assert(!AZ::TickBus::Handler::BusIsConnected(), "TransformHierarchy must be disconnected before it is destroyed");
+    }
+
+    void TransformHierarchy::Connect()
+    {
+        m_updateThreadId = AZStd::this_thread::get_id();
+        AZ::Interface<TransformHierarchy>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TransformHierarchy::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<TransformHierarchy>::Unregister(this);
+
+        UpdateTransforms();
+        for (NodeRecord& record : m_nodes)
+        {
+            if (record.m_listener != nullptr)
+            {
+                TransformHierarchyListener* listener = record.m_listener;
+                record.m_listener = nullptr;
+                listener->OnHierarchyDisconnected();
+            }
+        }
+
+        m_nodes.clear();
+        m_firstFreeNode = InvalidSlot;
+        m_nodeCount = 0;
+        m_localTMs.clear();
+        m_worldTMs.clear();
+        m_parentSlots.clear();
+        m_nodeIndices.clear();
+        m_depths.clear();
+        m_flags.clear();
+        m_levelOffsets.clear();
+        m_orderDirty = false;
+        m_dirtyNodes.clear();
+    }
+
+    TransformHierarchy::NodeHandle TransformHierarchy::AddNode(
+        TransformHierarchyListener* listener, const AZ::Transform& localTM, const AZ::Transform& worldTM)
+    {
+        uint32_t index = m_firstFreeNode;
+        if (index != InvalidSlot)
+        {
+            m_firstFreeNode = m_nodes[index].m_slot;
+        }
+        else
+        {
+            index = aznumeric_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        const uint32_t slot = aznumeric_cast<uint32_t>(m_flags.size());
+        NodeRecord& record = m_nodes[index];
+        record.m_parent = InvalidNodeHandle;
+        record.m_listener = listener;
+        record.m_slot = slot;
+
+        // Root nodes can be appended to the first level as long as it is the only one, otherwise the levels are rebuilt
+        // by the next update.
+        if (!m_orderDirty && m_levelOffsets.size() <= 2)
+        {
+            m_levelOffsets = { 0, slot + 1 };
+        }
+        else
+        {
+            m_orderDirty = true;
+        }
+
+        m_localTMs.push_back(localTM);
+        m_worldTMs.push_back(worldTM);
+        m_parentSlots.push_back(InvalidSlot);
+        m_nodeIndices.push_back(index);
+        m_depths.push_back(0);
+        m_flags.push_back(0);
+        ++m_nodeCount;
+
+        return (static_cast<NodeHandle>(record.m_generation) << 32) | index;
+    }
+
+    void TransformHierarchy::RemoveNode(NodeHandle node)
+    {
+        const uint32_t slot = GetSlot(node);
+        if (slot == InvalidSlot)
+        {
+            AZ_Assert(false, "Removing an invalid node from the TransformHierarchy");
+            return;
+        }
+
+        // The slot is kept until the next rebuild, the children still referencing it become root nodes then.
+        m_flags[slot] = NodeFlag_Free;
+        m_nodeIndices[slot] = InvalidSlot;
+        m_orderDirty = true;
+
+        const uint32_t index = static_cast<uint32_t>(node);
+        NodeRecord& record = m_nodes[index];
+        record.m_parent = InvalidNodeHandle;
+        record.m_listener = nullptr;
+        record.m_slot = m_firstFreeNode;
+        ++record.m_generation;
+        m_firstFreeNode = index;
+        --m_nodeCount;
+    }
+
+    void TransformHierarchy::SetNodeParent(NodeHandle node, NodeHandle parent)
+    {
+        const uint32_t slot = GetSlot(node);
+        const uint32_t parentSlot = GetSlot(parent);
+        AZ_Assert(slot != InvalidSlot, "Setting the parent of an invalid node in the TransformHierarchy");
+        AZ_Assert(parentSlot != InvalidSlot || parent == InvalidNodeHandle, "Setting an invalid parent in the TransformHierarchy");
+
+        NodeRecord& record = m_nodes[static_cast<uint32_t>(node)];
+        if (slot == InvalidSlot || record.m_parent == parent)
+        {
+            return;
+        }
+
+        record.m_parent = parentSlot != InvalidSlot ? parent : InvalidNodeHandle;
+        m_parentSlots[slot] = parentSlot;
+        m_orderDirty = true;
+    }
+
+    void TransformHierarchy::SetNodeKeepWorldTM(NodeHandle node, bool keepWorldTM)
+    {
+        const uint32_t slot = GetSlot(node);
+        AZ_Assert(slot != InvalidSlot, "Accessing an invalid node in the TransformHierarchy");
+        if (slot != InvalidSlot)
+        {
+            m_flags[slot] = keepWorldTM ? (m_flags[slot] | NodeFlag_KeepWorldTM) : (m_flags[slot] & ~NodeFlag_KeepWorldTM);
+        }
+    }
+
+    void TransformHierarchy::SetNodeTransforms(
+        NodeHandle node, const AZ::Transform& localTM, const AZ::Transform& worldTM, bool worldChanged)
+    {
+        AZ_Assert(!m_updating, "Nodes can't be changed while the TransformHierarchy is updating");
+        const uint32_t slot = GetSlot(node);
+        AZ_Assert(slot != InvalidSlot, "Accessing an invalid node in the TransformHierarchy");
+        if (slot == InvalidSlot)
+        {
+            return;
+        }
+
+        m_localTMs[slot] = localTM;
+        m_worldTMs[slot] = worldTM;
+        if (worldChanged && !(m_flags[slot] & NodeFlag_Dirty))
+        {
+            m_flags[slot] |= NodeFlag_Dirty;
+            m_dirtyNodes.push_back(node);
+        }
+    }
+
+    const AZ::Transform& TransformHierarchy::GetNodeLocalTM(NodeHandle node) const
+    {
+        const uint32_t slot = GetSlot(node);
+        AZ_Assert(slot != InvalidSlot, "Accessing an invalid node in the TransformHierarchy");
+        return slot != InvalidSlot ? m_localTMs[slot] : AZ::Transform::Identity();
+    }
+
+    const AZ::Transform& TransformHierarchy::GetNodeWorldTM(NodeHandle node) const
+    {
+        const uint32_t slot = GetSlot(node);
+        AZ_Assert(slot != InvalidSlot, "Accessing an invalid node in the TransformHierarchy");
+        return slot != InvalidSlot ? m_worldTMs[slot] : AZ::Transform::Identity();
+    }
+
+    bool TransformHierarchy::IsNodeStale(NodeHandle node) const
+    {
+        if (m_dirtyNodes.empty())
+        {
+            return false;
+        }
+
+        const NodeRecord* record = FindRecord(node);
+        while (record != nullptr && (record = FindRecord(record->m_parent)) != nullptr)
+        {
+            if (m_flags[record->m_slot] & NodeFlag_Dirty)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void TransformHierarchy::UpdateNodeIfStale(NodeHandle node)
+    {
+        // Transforms are also read from jobs and other worker threads. The hierarchy is only modified on its own thread, so the
+        // other threads don't look at its state at all and keep the stored transforms until the next update.
+        if (AZStd::this_thread::get_id() != m_updateThreadId)
+        {
+            return;
+        }
+
+        if (!m_updating && IsNodeStale(node))
+        {
+            UpdateTransforms();
+        }
+    }
+
+    void TransformHierarchy::UpdateTransforms()
+    {
+        if (m_dirtyNodes.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(AzFramework, "TransformHierarchy::UpdateTransforms");
+        AZ_Assert(!m_updating, "TransformHierarchy::UpdateTransforms can't be called while the hierarchy is updating");
+        m_updating = true;
+
+        if (m_orderDirty)
+        {
+            RebuildOrder();
+        }
+
+        uint32_t minDirtyDepth = InvalidSlot;
+        uint32_t maxDirtyDepth = 0;
+        for (const NodeHandle node : m_dirtyNodes)
+        {
+            const uint32_t slot = GetSlot(node);
+            if (slot != InvalidSlot)
+            {
+                m_flags[slot] |= NodeFlag_WorldChanged;
+                minDirtyDepth = AZStd::min(minDirtyDepth, m_depths[slot]);
+                maxDirtyDepth = AZStd::max(maxDirtyDepth, m_depths[slot]);
+            }
+        }
+
+        if (minDirtyDepth != InvalidSlot)
+        {
+            // Each level only depends on the previous one, so the levels are updated in order and the nodes of a level
+            // in parallel. The update stops at the first level below the dirty nodes whose world transforms didn't change.
+            const uint32_t levelCount = aznumeric_cast<uint32_t>(m_levelOffsets.size() - 1);
+            uint32_t level = minDirtyDepth + 1;
+            bool levelChanged = true;
+            for (; level < levelCount && (levelChanged || level <= maxDirtyDepth + 1); ++level)
+            {
+                levelChanged = UpdateLevel(m_levelOffsets[level], m_levelOffsets[level + 1]);
+            }
+
+            // Gather the updated nodes in depth order
+            const uint32_t begin = m_levelOffsets[minDirtyDepth + 1];
+            const uint32_t end = m_levelOffsets[level];
+            for (uint32_t slot = begin; slot < end; ++slot)
+            {
+                uint8_t& flags = m_flags[slot];
+                if ((flags & (NodeFlag_Updated | NodeFlag_WorldChanged)) == (NodeFlag_Updated | NodeFlag_WorldChanged))
+                {
+                    const uint32_t index = m_nodeIndices[slot];
+                    m_changedNodes.push_back((static_cast<NodeHandle>(m_nodes[index].m_generation) << 32) | index);
+                }
+                flags &= ~(NodeFlag_WorldChanged | NodeFlag_Updated);
+            }
+        }
+
+        for (const NodeHandle node : m_dirtyNodes)
+        {
+            if (const uint32_t slot = GetSlot(node); slot != InvalidSlot)
+            {
+                m_flags[slot] &= ~(NodeFlag_Dirty | NodeFlag_WorldChanged | NodeFlag_Updated);
+            }
+        }
+        m_dirtyNodes.clear();
+        m_updating = false;
+
+        // The listeners are notified once the whole hierarchy is up to date, so they can query any transform. The list is
+        // moved out first, as listeners may change transforms and start a new update.
+        AZStd::vector<NodeHandle> changedNodes = AZStd::move(m_changedNodes);
+        m_changedNodes.clear();
+        for (const NodeHandle node : changedNodes)
+        {
+            if (const NodeRecord* record = FindRecord(node); record != nullptr && record->m_listener != nullptr)
+            {
+                record->m_listener->OnHierarchyTransformChanged();
+            }
+        }
+
+        if (m_changedNodes.empty())
+        {
+            changedNodes.clear();
+            m_changedNodes = AZStd::move(changedNodes);
+        }
+    }
+
+    bool TransformHierarchy::HasPendingUpdates() const
+    {
+        return !m_dirtyNodes.empty();
+    }
+
+    size_t TransformHierarchy::GetNodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+    void TransformHierarchy::SetTaskExecutor(AZ::TaskExecutor* executor)
+    {
+        m_taskExecutor = executor;
+    }
+
+    void TransformHierarchy::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        UpdateTransforms();
+    }
+
+    int TransformHierarchy::GetTickOrder()
+    {
+        // Update after every handler that may move entities, rendering reads the transforms in the system tick.
+        return AZ::TICK_LAST;
+    }
+
+    const TransformHierarchy::NodeRecord* TransformHierarchy::FindRecord(NodeHandle node) const
+    {
+        const uint32_t index = static_cast<uint32_t>(node);
+        const uint32_t generation = static_cast<uint32_t>(node >> 32);
+        if (index < m_nodes.size() && m_nodes[index].m_generation == generation)
+        {
+            return &m_nodes[index];
+        }
+        return nullptr;
+    }
+
+    uint32_t TransformHierarchy::GetSlot(NodeHandle node) const
+    {
+        const NodeRecord* record = FindRecord(node);
+        return record != nullptr ? record->m_slot : InvalidSlot;
+    }
+
+    void TransformHierarchy::RebuildOrder()
+    {
+        AZ_PROFILE_SCOPE(AzFramework, "TransformHierarchy::RebuildOrder");
+
+        const uint32_t slotCount = aznumeric_cast<uint32_t>(m_flags.size());
+
+        // Gather the children of each slot, children of removed nodes become root nodes.
+        AZStd::vector<uint32_t> childOffsets(slotCount + 1, 0);
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            uint32_t& parentSlot = m_parentSlots[slot];
+            if (m_flags[slot] & NodeFlag_Free)
+            {
+                continue;
+            }
+            if (parentSlot != InvalidSlot && (m_flags[parentSlot] & NodeFlag_Free))
+            {
+                parentSlot = InvalidSlot;
+                m_nodes[m_nodeIndices[slot]].m_parent = InvalidNodeHandle;
+            }
+            if (parentSlot != InvalidSlot)
+            {
+                ++childOffsets[parentSlot + 1];
+            }
+        }
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            childOffsets[slot + 1] += childOffsets[slot];
+        }
+        AZStd::vector<uint32_t> children(childOffsets[slotCount]);
+        {
+            AZStd::vector<uint32_t> childCounts(slotCount, 0);
+            for (uint32_t slot = 0; slot < slotCount; ++slot)
+            {
+                const uint32_t parentSlot = m_parentSlots[slot];
+                if (!(m_flags[slot] & NodeFlag_Free) && parentSlot != InvalidSlot)
+                {
+                    children[childOffsets[parentSlot] + childCounts[parentSlot]++] = slot;
+                }
+            }
+        }
+
+        // Breadth first traversal from the root nodes, which sorts the nodes by depth.
+        AZStd::vector<uint32_t> order;
+        order.reserve(m_nodeCount);
+        AZStd::vector<uint32_t> newSlots(slotCount, InvalidSlot);
+        m_levelOffsets.clear();
+        for (uint32_t slot = 0; slot < slotCount; ++slot)
+        {
+            if (!(m_flags[slot] & NodeFlag_Free) && m_parentSlots[slot] == InvalidSlot)
+            {
+                newSlots[slot] = aznumeric_cast<uint32_t>(order.size());
+                order.push_back(slot);
+            }
+        }
+        for (uint32_t levelBegin = 0; levelBegin < order.size();)
+        {
+            m_levelOffsets.push_back(levelBegin);
+            const uint32_t levelEnd = aznumeric_cast<uint32_t>(order.size());
+            for (uint32_t i = levelBegin; i < levelEnd; ++i)
+            {
+                const uint32_t slot = order[i];
+                for (uint32_t child = childOffsets[slot]; child < childOffsets[slot + 1]; ++child)
+                {
+                    newSlots[children[child]] = aznumeric_cast<uint32_t>(order.size());
+                    order.push_back(children[child]);
+                }
+            }
+            levelBegin = levelEnd;
+        }
+        m_levelOffsets.push_back(aznumeric_cast<uint32_t>(order.size()));
+
+        // Nodes that weren't reached are part of a cycle, which the transform components prevent. They are added to the last
+        // level without a parent, so they are never updated but can still be accessed.
+        if (order.size() < m_nodeCount)
+        {
+            AZ_Error("TransformHierarchy", false, "The TransformHierarchy contains a cycle.");
+            for (uint32_t slot = 0; slot < slotCount; ++slot)
+            {
+                if (!(m_flags[slot] & NodeFlag_Free) && newSlots[slot] == InvalidSlot)
+                {
+                    m_parentSlots[slot] = InvalidSlot;
+                    newSlots[slot] = aznumeric_cast<uint32_t>(order.size());
+                    order.push_back(slot);
+                }
+            }
+            if (m_levelOffsets.size() == 1)
+            {
+                m_levelOffsets.insert(m_levelOffsets.begin(), 0);
+            }
+            m_levelOffsets.back() = aznumeric_cast<uint32_t>(order.size());
+        }
+
+        AZStd::vector<AZ::Transform> localTMs(order.size());
+        AZStd::vector<AZ::Transform> worldTMs(order.size());
+        AZStd::vector<uint32_t> parentSlots(order.size());
+        AZStd::vector<uint32_t> nodeIndices(order.size());
+        AZStd::vector<uint32_t> depths(order.size());
+        AZStd::vector<uint8_t> flags(order.size());
+        for (uint32_t newSlot = 0; newSlot < order.size(); ++newSlot)
+        {
+            const uint32_t slot = order[newSlot];
+            const uint32_t parentSlot = m_parentSlots[slot] != InvalidSlot ? newSlots[m_parentSlots[slot]] : InvalidSlot;
+            localTMs[newSlot] = m_localTMs[slot];
+            worldTMs[newSlot] = m_worldTMs[slot];
+            parentSlots[newSlot] = parentSlot;
+            nodeIndices[newSlot] = m_nodeIndices[slot];
+            depths[newSlot] = parentSlot != InvalidSlot ? depths[parentSlot] + 1 : 0;
+            flags[newSlot] = m_flags[slot];
+            m_nodes[m_nodeIndices[slot]].m_slot = newSlot;
+        }
+
+        m_localTMs = AZStd::move(localTMs);
+        m_worldTMs = AZStd::move(worldTMs);
+        m_parentSlots = AZStd::move(parentSlots);
+        m_nodeIndices = AZStd::move(nodeIndices);
+        m_depths = AZStd::move(depths);
+        m_flags = AZStd::move(flags);
+        m_orderDirty = false;
+    }
+
+    bool TransformHierarchy::UpdateSlots(uint32_t begin, uint32_t end)
+    {
+        bool worldChanged = false;
+        for (uint32_t slot = begin; slot < end; ++slot)
+        {
+            const uint32_t parentSlot = m_parentSlots[slot];
+            if (parentSlot == InvalidSlot || !(m_flags[parentSlot] & NodeFlag_WorldChanged))
+            {
+                continue;
+            }
+
+            uint8_t& flags = m_flags[slot];
+            if (flags & NodeFlag_KeepWorldTM)
+            {
+                m_localTMs[slot] = m_worldTMs[parentSlot].GetInverse() * m_worldTMs[slot];
+                flags |= NodeFlag_Updated;
+            }
+            else
+            {
+                m_worldTMs[slot] = m_worldTMs[parentSlot] * m_localTMs[slot];
+                flags |= NodeFlag_Updated | NodeFlag_WorldChanged;
+                worldChanged = true;
+            }
+
+            if (TransformHierarchyListener* listener = m_nodes[m_nodeIndices[slot]].m_listener)
+            {
+                listener->OnHierarchyTransformsUpdated(m_localTMs[slot], m_worldTMs[slot]);
+            }
+        }
+        return worldChanged;
+    }
+
+    bool TransformHierarchy::UpdateLevel(uint32_t begin, uint32_t end)
+    {
+        bool useTaskGraph = false;
+        if (end - begin >= ParallelUpdateMinLevelSize)
+        {
+            const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            useTaskGraph = m_taskExecutor != nullptr || (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive());
+        }
+
+        if (!useTaskGraph)
+        {
+            return UpdateSlots(begin, end);
+        }
+
+        AZStd::atomic_bool worldChanged{ false };
+        static const AZ::TaskDescriptor updateLevelTaskDescriptor{ "TransformHierarchy::UpdateLevel", "Transform" };
+        AZ::TaskGraphEvent updateLevelEvent{ "TransformHierarchy UpdateLevel Wait" };
+        AZ::TaskGraph updateLevelGraph{ "TransformHierarchy UpdateLevel" };
+        for (uint32_t batchBegin = begin; batchBegin < end; batchBegin += ParallelUpdateBatchSize)
+        {
+            const uint32_t batchEnd = AZStd::min(batchBegin + ParallelUpdateBatchSize, end);
+            updateLevelGraph.AddTask(
+                updateLevelTaskDescriptor,
+                [this, batchBegin, batchEnd, &worldChanged]()
+                {
+                    if (UpdateSlots(batchBegin, batchEnd))
+                    {
+                        worldChanged.store(true, AZStd::memory_order_relaxed);
+                    }
+                });
+        }
+
+        if (m_taskExecutor != nullptr)
+        {
+            updateLevelGraph.SubmitOnExecutor(*m_taskExecutor, &updateLevelEvent);
+        }
+        else
+        {
+            updateLevelGraph.Submit(&updateLevelEvent);
+        }
+        updateLevelEvent.Wait();
+
+        return worldChanged.load(AZStd::memory_order_relaxed);
+    }
+} // namespace AzFramework
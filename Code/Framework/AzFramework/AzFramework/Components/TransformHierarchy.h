@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzFramework/AzFrameworkAPI.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
+
+namespace AzFramework
+{
+    //! Receives the transforms computed by a TransformHierarchy for one of its nodes.
+    class TransformHierarchyListener
+    {
+    public:
+        //! Called with the new transforms of a node after its parent's world transform changed.
+        //! @note This may be called from a task graph worker, so it should only store the transforms.
+        virtual void OnHierarchyTransformsUpdated(const AZ::Transform& localTM, const AZ::Transform& worldTM) = 0;
+
+        //! Called on the updating thread once every node has been updated, in depth order, for each node whose world
+        //! transform was changed by the update.
+        virtual void OnHierarchyTransformChanged() = 0;
+
+        //! Called when the hierarchy is disconnected while the node is still in it, after which the node is no longer valid.
+        virtual void OnHierarchyDisconnected() = 0;
+
+    protected:
+        ~TransformHierarchyListener() = default;
+    };
+
+    //! Stores the local and world transforms of a hierarchy of nodes in flat arrays sorted by depth, and propagates
+    //! the changes made to a node to all its descendants in a single batched update.
+    //! Each level of the hierarchy is updated in one pass over contiguous memory, and large levels are split across task
+    //! graph workers. The update runs once per tick, or earlier when a stale node is accessed through UpdateNodeIfStale.
+    //! @note The hierarchy is not thread safe, and is expected to be used from the main thread like the transform components.
+    //! The only exception is UpdateNodeIfStale, which may be called while reading transforms on other threads.
+    class AZF_API TransformHierarchy
+        : private AZ::TickBus::Handler
+    {
+    public:
+        AZ_RTTI(TransformHierarchy, "{3E2B3C64-5E1A-4E0F-9B8C-6A1F2D7C4B95}");
+        AZ_CLASS_ALLOCATOR(TransformHierarchy, AZ::SystemAllocator);
+
+        using NodeHandle = uint64_t;
+        static constexpr NodeHandle InvalidNodeHandle = AZStd::numeric_limits<NodeHandle>::max();
+
+        TransformHierarchy() = default;
+        virtual ~TransformHierarchy();
+
+        //! Registers the hierarchy with AZ::Interface and connects it to the tick bus.
+        //! The calling thread becomes the only thread on which stale nodes are updated by UpdateNodeIfStale.
+        void Connect();
+        //! Runs the pending update, then removes all nodes and unregisters the hierarchy.
+        void Disconnect();
+
+        //! Adds a root node to the hierarchy.
+        //! @param listener Receives the transforms computed for the node, may be null.
+        NodeHandle AddNode(TransformHierarchyListener* listener, const AZ::Transform& localTM, const AZ::Transform& worldTM);
+
+        //! Removes a node from the hierarchy. The children of the node become root nodes.
+        void RemoveNode(NodeHandle node);
+
+        //! Sets the parent of a node, or makes it a root node if parent is InvalidNodeHandle.
+        //! The transforms of the node are not changed until the parent's world transform changes.
+        void SetNodeParent(NodeHandle node, NodeHandle parent);
+
+        //! If set, the world transform of the node is kept when the parent's world transform changes, and its local
+        //! transform is recomputed instead. Mirrors AZ::OnParentChangedBehavior::DoNotUpdate.
+        void SetNodeKeepWorldTM(NodeHandle node, bool keepWorldTM);
+
+        //! Sets the transforms of a node.
+        //! @param worldChanged If true, the descendants of the node are updated by the next update.
+        void SetNodeTransforms(NodeHandle node, const AZ::Transform& localTM, const AZ::Transform& worldTM, bool worldChanged = true);
+
+        //! Returns the transforms stored for a node, which are stale if IsNodeStale returns true.
+        const AZ::Transform& GetNodeLocalTM(NodeHandle node) const;
+        const AZ::Transform& GetNodeWorldTM(NodeHandle node) const;
+
+        //! Returns true if an ancestor of the node has changed since the last update.
+        bool IsNodeStale(NodeHandle node) const;
+
+        //! Runs the update if an ancestor of the node has changed since the last update.
+        //! Does nothing when called from any thread other than the one that created or connected the hierarchy, in which case
+        //! the stored transforms are used until the next update on that thread.
+        void UpdateNodeIfStale(NodeHandle node);
+
+        //! Propagates all pending changes down the hierarchy, then notifies the listeners of the updated nodes.
+        void UpdateTransforms();
+
+        //! Returns true if some nodes have changed since the last update.
+        bool HasPendingUpdates() const;
+
+        //! Returns the number of nodes in the hierarchy.
+        size_t GetNodeCount() const;
+
+        //! Overrides the executor used to update large levels of the hierarchy, for testing and benchmarking.
+        //! By default the system executor is used while the task graph system is active.
+        void SetTaskExecutor(AZ::TaskExecutor* executor);
+
+    private:
+        static constexpr uint32_t InvalidSlot = AZStd::numeric_limits<uint32_t>::max();
+
+        enum NodeFlags : uint8_t
+        {
+            NodeFlag_Free = 1 << 0, //!< The slot belongs to a removed node.
+            NodeFlag_KeepWorldTM = 1 << 1, //!< The local transform is recomputed when the parent changes.
+            NodeFlag_Dirty = 1 << 2, //!< The node was changed since the last update.
+            NodeFlag_WorldChanged = 1 << 3, //!< The world transform changed during the current update.
+            NodeFlag_Updated = 1 << 4, //!< The transforms were recomputed during the current update.
+        };
+
+        struct NodeRecord
+        {
+            NodeHandle m_parent = InvalidNodeHandle;
+            TransformHierarchyListener* m_listener = nullptr;
+            uint32_t m_slot = InvalidSlot; //!< Index of the node in the depth ordered arrays, or the next free record.
+            uint32_t m_generation = 0;
+        };
+
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        const NodeRecord* FindRecord(NodeHandle node) const;
+        uint32_t GetSlot(NodeHandle node) const;
+
+        //! Sorts the nodes by depth, removing the slots of removed nodes.
+        void RebuildOrder();
+
+        //! Updates the nodes in the slot range [begin, end), which all belong to the same level.
+        //! @return True if the world transform of one of the nodes changed.
+        bool UpdateSlots(uint32_t begin, uint32_t end);
+        bool UpdateLevel(uint32_t begin, uint32_t end);
+
+        AZStd::vector<NodeRecord> m_nodes;
+        uint32_t m_firstFreeNode = InvalidSlot;
+        size_t m_nodeCount = 0;
+
+        // Depth ordered arrays, indexed by slot.
+        AZStd::vector<AZ::Transform> m_localTMs;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+        AZStd::vector<uint32_t> m_parentSlots;
+        AZStd::vector<uint32_t> m_nodeIndices;
+        AZStd::vector<uint32_t> m_depths;
+        AZStd::vector<uint8_t> m_flags;
+        AZStd::vector<uint32_t> m_levelOffsets; //!< First slot of each level, followed by the slot count.
+        bool m_orderDirty = false;
+
+        AZStd::vector<NodeHandle> m_dirtyNodes;
+        AZStd::vector<NodeHandle> m_changedNodes;
+        AZ::TaskExecutor* m_taskExecutor = nullptr;
+        AZStd::thread::id m_updateThreadId = AZStd::this_thread::get_id(); //!< The thread UpdateNodeIfStale may update on.
+        bool m_updating = false;
+    };
+} // namespace AzFramework
@@ -100,6 +100,7 @@ namespace AzFramework
         GameEntityContextRequestBus::Handler::BusConnect();
 
         m_entityVisibilityBoundsUnionSystem.Connect();
+        m_transformHierarchy.Connect();
     }
 
     //=========================================================================
@@ -107,6 +108,7 @@ namespace AzFramework
     //=========================================================================
     void GameEntityContextComponent::Deactivate()
     {
+        m_transformHierarchy.Disconnect();
         m_entityVisibilityBoundsUnionSystem.Disconnect();
 
         GameEntityContextRequestBus::Handler::BusDisconnect();
@@ -13,6 +13,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipService.h>
+#include <AzFramework/Components/TransformHierarchy.h>
 #include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
 #include <AzFramework/AzFrameworkAPI.h>
 
@@ -92,5 +93,6 @@ namespace AzFramework
     private:
 
         AzFramework::EntityVisibilityBoundsUnionSystem m_entityVisibilityBoundsUnionSystem;
+        AzFramework::TransformHierarchy m_transformHierarchy;
     };
 } // namespace AzFramework
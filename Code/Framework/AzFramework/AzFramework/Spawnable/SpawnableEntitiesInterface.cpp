@@ -277,6 +277,16 @@ namespace AzFramework
     }
 
 
+    //
+    // SpawnablePatch
+    //
+
+    bool SpawnablePatch::IsEmpty() const
+    {
+        return m_updatedEntityIndices.empty() && m_removedEntityIds.empty();
+    }
+
+
     //
     // EntitySpawnTicket
     //
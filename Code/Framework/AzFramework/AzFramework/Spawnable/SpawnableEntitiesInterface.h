@@ -161,6 +161,21 @@ namespace AzFramework
         Spawnable::EntityAliasType m_newAliasType;
     };
 
+    //! Describes the differences between two versions of a spawnable in terms of its prototype entities. A patch allows entities
+    //! that were spawned from the older version to be updated in place, without despawning the entities that didn't change.
+    //! Prototype entities are matched between versions by their entity id. Respawned entities get new ids, so entities that refer to
+    //! an updated or removed entity need to be included in the patch as well to have their references updated.
+    struct AZF_API SpawnablePatch final
+    {
+        //! Returns true if the patch doesn't contain any changes.
+        bool IsEmpty() const;
+
+        //! Indices in the new version of the spawnable of the prototype entities that were added or changed.
+        AZStd::vector<uint32_t> m_updatedEntityIndices;
+        //! Ids of the prototype entities in the old version of the spawnable that are no longer in the new version.
+        AZStd::vector<AZ::EntityId> m_removedEntityIds;
+    };
+
     //! Requests to the SpawnableEntitiesInterface require a ticket with a valid spawnable that is used as a template. A ticket can
     //! be reused for multiple calls on the same spawnable and is safe to be used by multiple threads at the same time. Entities created
     //! from the spawnable may be tracked by the ticket and so using the same ticket is needed to despawn the exact entities created
@@ -207,6 +222,7 @@ namespace AzFramework
     using EntityDespawnCallback = AZStd::function<void(EntitySpawnTicket::Id)>;
     using RetrieveEntitySpawnTicketCallback = AZStd::function<void(EntitySpawnTicket&&)>;
     using ReloadSpawnableCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
+    using ApplySpawnablePatchCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
     using UpdateEntityAliasTypesCallback = AZStd::function<void(EntitySpawnTicket::Id)>;
     using ListEntitiesCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
     using ListIndicesEntitiesCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstIndexEntityContainerView)>;
@@ -283,6 +299,17 @@ namespace AzFramework
         SpawnablePriority m_priority { SpawnablePriority_Default };
     };
 
+    struct AZF_API ApplySpawnablePatchOptionalArgs final
+    {
+        //! Callback that's called after the patch has been applied. This can be triggered from a different thread than the one that
+        //!     made the function call to patch. The returned list of entities contains only the newly created entities.
+        ApplySpawnablePatchCallback m_completionCallback;
+        //! The Serialize Context used to clone entities with. If this is not provided the global Serialize Context will be used.
+        AZ::SerializeContext* m_serializeContext{ nullptr };
+        //! The priority at which this call will be executed.
+        SpawnablePriority m_priority{ SpawnablePriority_Default };
+    };
+
     struct AZF_API UpdateEntityAliasTypesOptionalArgs final
     {
         //! Callback that's called when entity aliases are updated. This can be triggered from a different thread than the one that
@@ -373,6 +400,20 @@ namespace AzFramework
         //! @param optionalArgs Optional additional arguments, see ReloadSpawnableOptionalArgs.
         virtual void ReloadSpawnable(
             EntitySpawnTicket& ticket, AZ::Data::Asset<Spawnable> spawnable, ReloadSpawnableOptionalArgs optionalArgs = {}) = 0;
+        //! Replaces the spawnable on the ticket with a newer version of it and only respawns the entities listed in the patch.
+        //! Entities spawned from changed prototypes are despawned and cloned again from the new spawnable, entities spawned from
+        //! removed prototypes are despawned and all other entities are left untouched. Added prototypes are only spawned if all
+        //! entities in the spawnable were spawned with the ticket. Unlike ReloadSpawnable the new spawnable is allowed to have a
+        //! different asset id, such as is the case for a spawnable that was converted again from an updated prefab.
+        //! @param ticket Holds the information on the entities to patch.
+        //! @param spawnable The new version of the spawnable that will replace the existing spawnable.
+        //! @param patch The list of prototype entities that changed between the spawnable on the ticket and the new spawnable.
+        //! @param optionalArgs Optional additional arguments, see ApplySpawnablePatchOptionalArgs.
+        virtual void ApplySpawnablePatch(
+            EntitySpawnTicket& ticket,
+            AZ::Data::Asset<Spawnable> spawnable,
+            SpawnablePatch patch,
+            ApplySpawnablePatchOptionalArgs optionalArgs = {}) = 0;
 
         //! Allows updating the entity alias on a spawnable. This allows the spawning behavior for all entities spawned from the used
         //! spawnable to be changed and is not restricted to this ticket alone.
@@ -8,9 +8,11 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
@@ -44,6 +46,15 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            AZ::u64 budget = aznumeric_caster(m_spawnTimeBudget.count());
+            settingsRegistry->Get(budget, "/O3DE/AzFramework/Spawnables/SpawnTimeBudgetUs");
+            m_spawnTimeBudget = AZStd::chrono::microseconds(budget);
+
+            AZ::u64 threshold = m_parallelCloneThreshold;
+            settingsRegistry->Get(threshold, "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold");
+            m_parallelCloneThreshold =
+                aznumeric_cast<uint32_t>(AZStd::min(threshold, AZ::u64{ AZStd::numeric_limits<uint32_t>::max() }));
         }
     }
 
@@ -62,6 +73,9 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_firstEntityIndex = 0;
+        queueEntry.m_nextEntityIndex = 0;
+        queueEntry.m_entitiesCreated = false;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -136,6 +150,24 @@ namespace AzFramework
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
+    void SpawnableEntitiesManager::ApplySpawnablePatch(
+        EntitySpawnTicket& ticket,
+        AZ::Data::Asset<Spawnable> spawnable,
+        SpawnablePatch patch,
+        ApplySpawnablePatchOptionalArgs optionalArgs)
+    {
+        AZ_Assert(ticket.IsValid(), "Ticket provided to ApplySpawnablePatch hasn't been initialized.");
+
+        ApplySpawnablePatchCommand queueEntry;
+        queueEntry.m_ticketId = ticket.GetId();
+        queueEntry.m_spawnable = AZStd::move(spawnable);
+        queueEntry.m_patch = AZStd::move(patch);
+        queueEntry.m_serializeContext =
+            optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
+        queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
+        QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
+    }
+
     void SpawnableEntitiesManager::UpdateEntityAliasTypes(
         EntitySpawnTicket& ticket,
         AZStd::vector<EntityAliasTypeChange> updatedAliases,
@@ -212,6 +244,11 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessQueue(CommandQueuePriority priority) -> CommandQueueStatus
     {
+        if (m_spawnTimeBudget.count() > 0)
+        {
+            m_spawnDeadline = AZStd::chrono::steady_clock::now() + m_spawnTimeBudget;
+        }
+
         CommandQueueStatus result = CommandQueueStatus::NoCommandsLeft;
         if ((priority & CommandQueuePriority::High) == CommandQueuePriority::High)
         {
@@ -230,6 +267,16 @@ namespace AzFramework
         return result;
     }
 
+    void SpawnableEntitiesManager::SetSpawnTimeBudget(AZStd::chrono::microseconds budget)
+    {
+        m_spawnTimeBudget = budget;
+    }
+
+    void SpawnableEntitiesManager::SetParallelCloneThreshold(uint32_t threshold)
+    {
+        m_parallelCloneThreshold = threshold;
+    }
+
     auto SpawnableEntitiesManager::ProcessQueue(Queue& queue) -> CommandQueueStatus
     {
         // Process delayed requests first.
@@ -411,6 +458,83 @@ namespace AzFramework
         }
     }
 
+    void SpawnableEntitiesManager::CloneEntitiesInParallel(
+        const Spawnable::EntityList& entityPrototypes,
+        AZ::Entity** clones,
+        const EntityIdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext)
+    {
+        // Entities are cloned in batches as cloning a single entity is typically too little work for a task.
+        static constexpr size_t CloneBatchSize = 64;
+
+        // All ids are already in the map so the ids and the references to them can be remapped in a single pass without needing to
+        // update the map, which allows multiple entities to be cloned at the same time.
+        auto cloneBatch = [&entityPrototypes, clones, &prototypeToCloneMap, &serializeContext](size_t begin, size_t end)
+        {
+            auto idReplacer = [&prototypeToCloneMap](const AZ::EntityId& originalId) -> AZ::EntityId
+            {
+                auto it = prototypeToCloneMap.find(originalId);
+                return it != prototypeToCloneMap.end() ? it->second : originalId;
+            };
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                AZ::Entity* clone = serializeContext.CloneObject(entityPrototypes[i].get());
+                AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                AZ::IdUtils::Remapper<AZ::EntityId>::RemapIdsAndIdRefs(clone, idReplacer, &serializeContext);
+                clones[i] = clone;
+            }
+        };
+
+        const size_t entityCount = entityPrototypes.size();
+        const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (entityCount <= CloneBatchSize || !taskGraphActiveInterface || !taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            cloneBatch(0, entityCount);
+            return;
+        }
+
+        static const AZ::TaskDescriptor cloneTaskDescriptor{ "SpawnableEntitiesManager::CloneEntities", "Spawnables" };
+        AZ::TaskGraphEvent cloneEvent{ "SpawnableEntitiesManager Clone Wait" };
+        AZ::TaskGraph cloneGraph{ "SpawnableEntitiesManager Clone" };
+        for (size_t batchBegin = 0; batchBegin < entityCount; batchBegin += CloneBatchSize)
+        {
+            const size_t batchEnd = AZStd::min(batchBegin + CloneBatchSize, entityCount);
+            cloneGraph.AddTask(
+                cloneTaskDescriptor,
+                [&cloneBatch, batchBegin, batchEnd]()
+                {
+                    cloneBatch(batchBegin, batchEnd);
+                });
+        }
+        cloneGraph.Submit(&cloneEvent);
+        cloneEvent.Wait();
+    }
+
+    bool SpawnableEntitiesManager::AddEntitiesToGameContext(
+        AZStd::vector<AZ::Entity*>& entities, size_t& nextEntityIndex, EntitySpawnTicket::Id ticketId)
+    {
+        const size_t entityCount = entities.size();
+        while (nextEntityIndex < entityCount)
+        {
+            AZ::Entity* clone = entities[nextEntityIndex++];
+            clone->SetEntitySpawnTicketId(ticketId);
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+
+            // At least one entity is always added so spawning keeps progressing even with a very small budget.
+            if (nextEntityIndex < entityCount && IsSpawnTimeBudgetExhausted())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool SpawnableEntitiesManager::IsSpawnTimeBudgetExhausted() const
+    {
+        return m_spawnTimeBudget.count() > 0 && AZStd::chrono::steady_clock::now() >= m_spawnDeadline;
+    }
+
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
         const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
     {
@@ -447,115 +571,144 @@ namespace AzFramework
     auto SpawnableEntitiesManager::ProcessRequest(SpawnAllEntitiesCommand& request) -> CommandResult
     {
         Ticket& ticket = *request.m_ticket;
-        if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
+        if (!ticket.m_spawnable.IsReady() || request.m_requestId != ticket.m_currentRequestId)
         {
-            if (Spawnable::EntityAliasConstVisitor aliases = ticket.m_spawnable->TryGetAliasesConst();
-                aliases.IsValid() && aliases.AreAllSpawnablesReady())
+            return CommandResult::Requeue;
+        }
+
+        if (!request.m_entitiesCreated)
+        {
+            Spawnable::EntityAliasConstVisitor aliases = ticket.m_spawnable->TryGetAliasesConst();
+            if (!aliases.IsValid() || !aliases.AreAllSpawnablesReady())
             {
-                AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
-                AZStd::vector<uint32_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
+                return CommandResult::Requeue;
+            }
 
-                // Keep track how many entities there were in the array initially
-                size_t spawnedEntitiesInitialCount = spawnedEntities.size();
+            AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
+            AZStd::vector<uint32_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
 
-                // These are 'prototype' entities we'll be cloning from
-                const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
-                uint32_t entitiesToSpawnSize = aznumeric_caster(entitiesToSpawn.size());
+            // Keep track how many entities there were in the array initially
+            size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
-                // Reserve buffers
-                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
-                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
+            // These are 'prototype' entities we'll be cloning from
+            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+            uint32_t entitiesToSpawnSize = aznumeric_caster(entitiesToSpawn.size());
 
-                // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
-                // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-                // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
-                // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
-                // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
-                // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
-                InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+            // Reserve buffers
+            spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
+            spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
-                auto aliasIt = aliases.begin();
-                auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
+            // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
+            // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+            // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
+            // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
+            // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
+            // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
+            InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+            auto aliasIt = aliases.begin();
+            auto aliasEnd = aliases.end();
+            if (aliasIt == aliasEnd && m_parallelCloneThreshold != 0 && entitiesToSpawnSize >= m_parallelCloneThreshold)
+            {
+                // The mappings were just reset, so marking all entities as spawned won't change any of the ids in the map. This
+                // means the map no longer changes while cloning so all entities can be cloned at the same time.
+                for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                 {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
-                    {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    RefreshEntityIdMapping(
+                        entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    spawnedEntityIndices.push_back(i);
+                }
+
+                spawnedEntities.resize(spawnedEntitiesInitialCount + entitiesToSpawnSize);
+                CloneEntitiesInParallel(
+                    entitiesToSpawn, spawnedEntities.data() + spawnedEntitiesInitialCount, ticket.m_entityIdReferenceMap,
+                    *request.m_serializeContext);
+            }
+            else if (aliasIt == aliasEnd)
+            {
+                for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                {
+                    // If this entity has previously been spawned, give it a new id in the reference map
+                    RefreshEntityIdMapping(
+                        entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                    spawnedEntities.emplace_back(
+                        CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                    spawnedEntityIndices.push_back(i);
+                }
+            }
+            else
+            {
+                for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                {
+                    // If this entity has previously been spawned, give it a new id in the reference map
+                    RefreshEntityIdMapping(
+                        entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
+                    if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
+                    {
                         spawnedEntities.emplace_back(
                             CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                         spawnedEntityIndices.push_back(i);
                     }
-                }
-                else
-                {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                    else
                     {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                        if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
-                        {
-                            spawnedEntities.emplace_back(
-                                CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                            spawnedEntityIndices.push_back(i);
-                        }
-                        else
+                        // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
+                        // be safely executed in order without risking an invalid state.
+                        AZ::Entity* previousEntity = nullptr;
+                        do
                         {
-                            // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
-                            // be safely executed in order without risking an invalid state.
-                            AZ::Entity* previousEntity = nullptr;
-                            do
+                            AZ::Entity* clone = CloneSingleAliasedEntity(
+                                *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
+                                *request.m_serializeContext);
+                            previousEntity = clone;
+                            if (clone)
                             {
-                                AZ::Entity* clone = CloneSingleAliasedEntity(
-                                    *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
-                                    *request.m_serializeContext);
-                                previousEntity = clone;
-                                if (clone)
-                                {
-                                    spawnedEntities.emplace_back(clone);
-                                    spawnedEntityIndices.push_back(i);
-                                }
-                                ++aliasIt;
-                            } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
-                        }
+                                spawnedEntities.emplace_back(clone);
+                                spawnedEntityIndices.push_back(i);
+                            }
+                            ++aliasIt;
+                        } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
                     }
                 }
+            }
 
-                // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
-                // a new set are not added so it no longer holds exactly the number of entities.
-                ticket.m_loadAll = spawnedEntitiesInitialCount == 0;
+            // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
+            // a new set are not added so it no longer holds exactly the number of entities.
+            ticket.m_loadAll = spawnedEntitiesInitialCount == 0;
 
-                auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount;
-                auto newEntitiesEnd = ticket.m_spawnedEntities.end();
-                // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
-                if (request.m_preInsertionCallback)
-                {
-                    request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
-                }
+            request.m_firstEntityIndex = spawnedEntitiesInitialCount;
+            request.m_nextEntityIndex = spawnedEntitiesInitialCount;
+            request.m_entitiesCreated = true;
 
-                // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
-                {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
-                }
+            // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
+            if (request.m_preInsertionCallback)
+            {
+                request.m_preInsertionCallback(
+                    request.m_ticketId,
+                    SpawnableEntityContainerView(
+                        ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+            }
+        }
 
-                // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
-                if (request.m_completionCallback)
-                {
-                    request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
-                }
+        // Add to the game context, now the entities are active. If the time budget runs out before all entities are added, the
+        // remaining entities will be added the next time the queue is processed.
+        if (!AddEntitiesToGameContext(ticket.m_spawnedEntities, request.m_nextEntityIndex, request.m_ticketId))
+        {
+            return CommandResult::Requeue;
+        }
 
-                ticket.m_currentRequestId++;
-                return CommandResult::Executed;
-            }
+        // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
+        if (request.m_completionCallback)
+        {
+            request.m_completionCallback(
+                request.m_ticketId,
+                SpawnableConstEntityContainerView(
+                    ticket.m_spawnedEntities.begin() + request.m_firstEntityIndex, ticket.m_spawnedEntities.end()));
         }
-        return CommandResult::Requeue;
+
+        ticket.m_currentRequestId++;
+        return CommandResult::Executed;
     }
 
     auto SpawnableEntitiesManager::ProcessRequest(SpawnEntitiesCommand& request) -> CommandResult
@@ -740,6 +893,14 @@ namespace AzFramework
                     (*entityIterator)->SetEntitySpawnTicketId(0);
                     GameEntityContextRequestBus::Broadcast(
                         &GameEntityContextRequestBus::Events::DestroyGameEntity, (*entityIterator)->GetId());
+                    // Keep the indices in sync with the entities so the entity's index isn't associated with another entity.
+                    AZStd::vector<uint32_t>& spawnedEntityIndices = request.m_ticket->m_spawnedEntityIndices;
+                    size_t position = AZStd::distance(spawnedEntities.begin(), entityIterator);
+                    if (position < spawnedEntityIndices.size())
+                    {
+                        spawnedEntityIndices[position] = spawnedEntityIndices.back();
+                        spawnedEntityIndices.pop_back();
+                    }
                     AZStd::iter_swap(entityIterator, spawnedEntities.rbegin());
                     spawnedEntities.pop_back();
                     break;
@@ -847,6 +1008,150 @@ namespace AzFramework
         }
     }
 
+    auto SpawnableEntitiesManager::ProcessRequest(ApplySpawnablePatchCommand& request) -> CommandResult
+    {
+        Ticket& ticket = *request.m_ticket;
+        if (ticket.m_spawnable.IsReady() && request.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
+        {
+            AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
+            AZStd::vector<uint32_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
+            AZ_Assert(
+                spawnedEntities.size() == spawnedEntityIndices.size(),
+                "The indices for the spawned entities has gone out of sync with the entities.");
+            const bool hasSpawnedEntities = !spawnedEntities.empty();
+
+            const Spawnable::EntityList& oldEntities = ticket.m_spawnable->GetEntities();
+            const Spawnable::EntityList& newEntities = request.m_spawnable->GetEntities();
+            const uint32_t oldEntitiesSize = aznumeric_caster(oldEntities.size());
+            const uint32_t newEntitiesSize = aznumeric_caster(newEntities.size());
+
+            // Prototype entities are matched by id between the two versions of the spawnable, so entities that are kept can have
+            // their index moved over to the index of the same prototype in the new spawnable.
+            AZStd::unordered_map<AZ::EntityId, uint32_t> newEntityIndices;
+            newEntityIndices.reserve(newEntitiesSize);
+            for (uint32_t i = 0; i < newEntitiesSize; ++i)
+            {
+                newEntityIndices.emplace(newEntities[i]->GetId(), i);
+            }
+
+            AZStd::unordered_set<AZ::EntityId> patchedEntityIds;
+            for (uint32_t index : request.m_patch.m_updatedEntityIndices)
+            {
+                if (index < newEntitiesSize)
+                {
+                    patchedEntityIds.emplace(newEntities[index]->GetId());
+                }
+            }
+            for (const AZ::EntityId& entityId : request.m_patch.m_removedEntityIds)
+            {
+                patchedEntityIds.emplace(entityId);
+                ticket.m_entityIdReferenceMap.erase(entityId);
+                ticket.m_previouslySpawned.erase(entityId);
+            }
+
+            // Despawn the entities created from changed or removed prototypes and count how many times each of the changed
+            // prototypes needs to be spawned again. The remaining entities are compacted in their original order.
+            AZStd::unordered_map<uint32_t, uint32_t> respawnCounts;
+            size_t keptEntitiesCount = 0;
+            for (size_t i = 0; i < spawnedEntities.size(); ++i)
+            {
+                AZ::Entity* entity = spawnedEntities[i];
+                uint32_t oldIndex = spawnedEntityIndices[i];
+                AZ::EntityId prototypeId = oldIndex < oldEntitiesSize ? oldEntities[oldIndex]->GetId() : AZ::EntityId();
+                auto newIndexIt = newEntityIndices.find(prototypeId);
+                if (newIndexIt != newEntityIndices.end() && !patchedEntityIds.contains(prototypeId))
+                {
+                    spawnedEntities[keptEntitiesCount] = entity;
+                    spawnedEntityIndices[keptEntitiesCount] = newIndexIt->second;
+                    ++keptEntitiesCount;
+                }
+                else if (entity != nullptr)
+                {
+                    if (newIndexIt != newEntityIndices.end())
+                    {
+                        respawnCounts[newIndexIt->second]++;
+                    }
+                    // Setting it to 0 is needed to avoid the infinite loop between GameEntityContext and SpawnableEntitiesManager.
+                    entity->SetEntitySpawnTicketId(0);
+                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DestroyGameEntity, entity->GetId());
+                }
+            }
+            spawnedEntities.resize(keptEntitiesCount);
+            spawnedEntityIndices.resize(keptEntitiesCount);
+
+            // Prototypes that were added to the spawnable are only spawned if the user intended to spawn every entity.
+            AZStd::unordered_set<AZ::EntityId> oldEntityIds;
+            oldEntityIds.reserve(oldEntitiesSize);
+            for (const auto& entity : oldEntities)
+            {
+                oldEntityIds.emplace(entity->GetId());
+            }
+            for (uint32_t index : request.m_patch.m_updatedEntityIndices)
+            {
+                if (index < newEntitiesSize && !oldEntityIds.contains(newEntities[index]->GetId()))
+                {
+                    ticket.m_entityIdReferenceMap.emplace(newEntities[index]->GetId(), AZ::Entity::MakeId());
+                    if (ticket.m_loadAll && hasSpawnedEntities)
+                    {
+                        respawnCounts[index] = 1;
+                    }
+                }
+            }
+
+            // Give all respawned prototypes new ids before cloning so respawned entities referring to each other get the new ids.
+            for (const auto& [index, count] : respawnCounts)
+            {
+                RefreshEntityIdMapping(newEntities[index]->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+            }
+
+            // Spawn in the order of the patch so the results don't depend on the order of the (unordered) respawn counts.
+            for (uint32_t index : request.m_patch.m_updatedEntityIndices)
+            {
+                auto countIt = respawnCounts.find(index);
+                if (countIt == respawnCounts.end())
+                {
+                    continue;
+                }
+                for (uint32_t copy = 0; copy < countIt->second; ++copy)
+                {
+                    if (copy > 0)
+                    {
+                        RefreshEntityIdMapping(newEntities[index]->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    }
+                    AZ::Entity* clone = CloneSingleEntity(*newEntities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                    spawnedEntities.push_back(clone);
+                    spawnedEntityIndices.push_back(index);
+                }
+                // Prevent duplicate indices in the patch from spawning the entity again.
+                respawnCounts.erase(countIt);
+            }
+
+            ticket.m_spawnable = AZStd::move(request.m_spawnable);
+
+            auto newEntitiesBegin = spawnedEntities.begin() + keptEntitiesCount;
+            auto newEntitiesEnd = spawnedEntities.end();
+            for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
+            {
+                AZ::Entity* clone = (*it);
+                clone->SetEntitySpawnTicketId(request.m_ticketId);
+                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+            }
+
+            if (request.m_completionCallback)
+            {
+                request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+            }
+
+            ticket.m_currentRequestId++;
+            return CommandResult::Executed;
+        }
+        else
+        {
+            return CommandResult::Requeue;
+        }
+    }
+
     auto SpawnableEntitiesManager::ProcessRequest(UpdateEntityAliasTypesCommand& request) -> CommandResult
     {
         Ticket& ticket = *request.m_ticket;
@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/variant.h>
@@ -66,6 +67,11 @@ namespace AzFramework
             RetrieveTicketOptionalArgs optionalArgs = {}) override;
         void ReloadSpawnable(
             EntitySpawnTicket& ticket, AZ::Data::Asset<Spawnable> spawnable, ReloadSpawnableOptionalArgs optionalArgs = {}) override;
+        void ApplySpawnablePatch(
+            EntitySpawnTicket& ticket,
+            AZ::Data::Asset<Spawnable> spawnable,
+            SpawnablePatch patch,
+            ApplySpawnablePatchOptionalArgs optionalArgs = {}) override;
 
         void UpdateEntityAliasTypes(
             EntitySpawnTicket& ticket,
@@ -89,6 +95,16 @@ namespace AzFramework
 
         CommandQueueStatus ProcessQueue(CommandQueuePriority priority);
 
+        //! Sets the amount of time a single call to ProcessQueue can spend on spawning entities. When the budget runs out, the remaining
+        //! entities of a SpawnAllEntities call are added in the next call to ProcessQueue, which spreads out large spawns over multiple
+        //! frames. The completion callback is only called once all entities have been added. A budget of zero disables the limit.
+        //! The budget can also be configured through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/SpawnTimeBudgetUs".
+        void SetSpawnTimeBudget(AZStd::chrono::microseconds budget);
+        //! Sets the minimum number of entities a spawnable needs to have before SpawnAllEntities clones them in parallel. Parallel
+        //! cloning is opt-in, the default threshold of zero disables it. The threshold can also be configured through the Settings
+        //! Registry under the key "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold".
+        void SetParallelCloneThreshold(uint32_t threshold);
+
     protected:
         enum class CommandResult : bool
         {
@@ -135,6 +151,12 @@ namespace AzFramework
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            //! Index in the ticket's spawned entities of the first entity created by this command.
+            size_t m_firstEntityIndex;
+            //! Index in the ticket's spawned entities of the next entity to add to the game entity context.
+            size_t m_nextEntityIndex;
+            //! Whether or not the entities have been cloned. If so, the command is waiting for time budget to add the remaining entities.
+            bool m_entitiesCreated;
         };
         struct SpawnEntitiesCommand final
         {
@@ -171,6 +193,16 @@ namespace AzFramework
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
         };
+        struct ApplySpawnablePatchCommand final
+        {
+            AZ::Data::Asset<Spawnable> m_spawnable;
+            SpawnablePatch m_patch;
+            ApplySpawnablePatchCallback m_completionCallback;
+            AZ::SerializeContext* m_serializeContext;
+            Ticket* m_ticket;
+            EntitySpawnTicket::Id m_ticketId;
+            uint32_t m_requestId;
+        };
         struct UpdateEntityAliasTypesCommand final
         {
             AZStd::vector<EntityAliasTypeChange> m_entityAliases;
@@ -237,6 +269,7 @@ namespace AzFramework
             DespawnAllEntitiesCommand,
             DespawnEntityCommand,
             ReloadSpawnableCommand,
+            ApplySpawnablePatchCommand,
             UpdateEntityAliasTypesCommand,
             ListEntitiesCommand,
             ListIndicesEntitiesCommand,
@@ -278,12 +311,24 @@ namespace AzFramework
             const AZ::Entity::ComponentArrayType& componentPrototypes,
             EntityIdMap& prototypeToCloneMap,
             AZ::SerializeContext& serializeContext);
+        //! Clones all prototype entities into the provided range, spreading the work over the task graph if it's available. Unlike
+        //! CloneSingleEntity, the id map is only read from so it needs to contain the new ids for all prototype entities.
+        void CloneEntitiesInParallel(
+            const Spawnable::EntityList& entityPrototypes,
+            AZ::Entity** clones,
+            const EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext);
+        //! Adds the spawned entities from the provided index onwards to the game entity context until either all entities have been
+        //! added or the spawn time budget has been used up. Returns true if all entities have been added.
+        bool AddEntitiesToGameContext(AZStd::vector<AZ::Entity*>& entities, size_t& nextEntityIndex, EntitySpawnTicket::Id ticketId);
+        bool IsSpawnTimeBudgetExhausted() const;
         
         CommandResult ProcessRequest(SpawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(SpawnEntitiesCommand& request);
         CommandResult ProcessRequest(DespawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(DespawnEntityCommand& request);
         CommandResult ProcessRequest(ReloadSpawnableCommand& request);
+        CommandResult ProcessRequest(ApplySpawnablePatchCommand& request);
         CommandResult ProcessRequest(UpdateEntityAliasTypesCommand& request);
         CommandResult ProcessRequest(ListEntitiesCommand& request);
         CommandResult ProcessRequest(ListIndicesEntitiesCommand& request);
@@ -312,6 +357,13 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The maximum time a call to ProcessQueue can spend on spawning entities, or zero if spawning isn't limited.
+        AZStd::chrono::microseconds m_spawnTimeBudget{ 0 };
+        //! The point in time at which the spawn time budget for the current call to ProcessQueue runs out.
+        AZStd::chrono::steady_clock::time_point m_spawnDeadline;
+        //! The minimum number of entities in a spawnable for SpawnAllEntities to clone them in parallel, or zero (the default) to
+        //! always clone entities one by one.
+        uint32_t m_parallelCloneThreshold{ 0 };
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
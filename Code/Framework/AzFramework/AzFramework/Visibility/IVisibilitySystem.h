@@ -19,6 +19,8 @@
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
@@ -63,6 +65,13 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! A volume tested by EnumerateBatch.
+        using BatchQueryVolume = AZStd::variant<AZ::Aabb, AZ::Sphere, AZ::Frustum>;
+        //! Mask of the volumes of a batch that a node is visible to, bit i is set for the i-th volume.
+        using BatchQueryMask = uint64_t;
+        static constexpr size_t MaxBatchQueryCount = 64;
+        using BatchEnumerateCallback = AZStd::function<void(const NodeData&, BatchQueryMask)>;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -115,6 +124,16 @@ namespace AzFramework
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a batch of volumes against the visibility system in a single traversal.
+        //! This is cheaper than enumerating each volume separately, as the volumes share the traversal of the nodes they overlap.
+        //! @param volumes the volumes to test against, at most MaxBatchQueryCount
+        //! @param callback the callback to invoke once for each node visible to any of the volumes, along with the mask of those volumes
+        //! @param parallel if true, the traversal is split across the task graph workers while the task graph is active,
+        //!        in which case the callback may be invoked concurrently from several threads.
+        //!        Small scenes, and calls made from a task graph worker, are always traversed serially on the calling thread
+        virtual void EnumerateBatch(
+            AZStd::span<const BatchQueryVolume> volumes, const BatchEnumerateCallback& callback, bool parallel = false) const = 0;
+
         //! Return the number of VisibilityEntries that have been added to the system
         virtual uint32_t GetEntryCount() const = 0;
     };
@@ -7,8 +7,11 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace AzFramework
 {
@@ -16,6 +19,20 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,           1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scale applied to the node bounds when fitting entries into the visibility octrees of new scenes, 1 for a regular octree and 2 for a loose octree");
+    AZ_CVAR(bool,     bg_octreeDeferUpdates,       false, nullptr, AZ::ConsoleFunctorFlags::Null, "If set to true, the visibility octrees of new scenes queue inserts and updates and apply them once per tick");
+
+    static constexpr uint32_t MaxChildNodeCount = 8;
+
+    // Number of shared scene locks held by the calling thread across all scenes, including the locks held on its behalf by the
+    // thread that submitted the parallel batched enumeration it is running.
+    static thread_local uint32_t t_sharedSceneLockCount = 0;
+
+    // Number of subtrees a parallel batched enumeration is split into, when the tree is deep enough.
+    static constexpr size_t ParallelEnumerateSubtreeCount = 32;
+
+    // Scenes with fewer entries are enumerated serially, as splitting the traversal would cost more than it saves.
+    static constexpr uint32_t ParallelEnumerateMinEntryCount = 1024;
 
     static uint32_t GetChildNodeCount()
     {
@@ -24,14 +41,24 @@ namespace AzFramework
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
+    static AZ::Aabb CreateLooseBounds(const AZ::Aabb& bounds, float looseness)
+    {
+        // Grow each side by (looseness - 1) half extents, so a looseness of 1 keeps the exact cell bounds
+        const AZ::Vector3 expansion = (bounds.GetMax() - bounds.GetMin()) * (0.5f * (looseness - 1.0f));
+        return AZ::Aabb::CreateFromMinMax(bounds.GetMin() - expansion, bounds.GetMax() + expansion);
+    }
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
+        , m_looseBounds(bounds)
     {
         ;
     }
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseBounds(rhs.m_looseBounds)
+        , m_childBounds(rhs.m_childBounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
@@ -46,6 +73,8 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseBounds = rhs.m_looseBounds;
+        m_childBounds = rhs.m_childBounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
@@ -66,14 +95,18 @@ namespace AzFramework
         // If this is not a leaf node, try to insert into the child nodes
         if (m_children != nullptr)
         {
+            // The loose bounds of each child are centered on its cell, so the only child that can contain the entry is the one
+            // whose cell contains the center of the entry. The max corner of the first child is the split point of this node.
             const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
+            const AZ::Vector3 center = boundingVolume.GetCenter();
+            const AZ::Vector3 split = m_children[0].m_bounds.GetMax();
+            uint32_t child = 0;
+            child |= (center.GetX() >= split.GetX()) ? 0x01 : 0;
+            child |= (center.GetY() >= split.GetY()) ? 0x02 : 0;
+            child |= (GetChildNodeCount() > 4 && center.GetZ() >= split.GetZ()) ? 0x04 : 0;
+            if (AZ::ShapeIntersection::Contains(m_children[child].m_looseBounds, boundingVolume))
             {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
-                {
-                    return m_children[child].Insert(octreeScene, entry);
-                }
+                return m_children[child].Insert(octreeScene, entry);
             }
         }
 
@@ -98,7 +131,7 @@ namespace AzFramework
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
         const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_looseBounds, boundingVolume))
         {
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
@@ -114,7 +147,7 @@ namespace AzFramework
         OctreeNode* insertCheck = this;
         while (insertCheck != nullptr)
         {
-            if (AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume) || !insertCheck->m_parent)
+            if (AZ::ShapeIntersection::Contains(insertCheck->m_looseBounds, boundingVolume) || !insertCheck->m_parent)
             {
                 // Insert here if the entry is fully contained or if we've reached the root node
                 return insertCheck->Insert(octreeScene, entry);
@@ -147,7 +180,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(aabb, m_looseBounds))
         {
             EnumerateHelper(aabb, callback);
         }
@@ -155,7 +188,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(sphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(sphere, m_looseBounds))
         {
             EnumerateHelper(sphere, callback);
         }
@@ -163,7 +196,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(hemisphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(hemisphere, m_looseBounds))
         {
             EnumerateHelper(hemisphere, callback);
         }
@@ -171,7 +204,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(capsule, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(capsule, m_looseBounds))
         {
             EnumerateHelper(capsule, callback);
         }
@@ -179,7 +212,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_looseBounds))
         {
             EnumerateHelper(frustum, callback);
         }
@@ -187,12 +220,12 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(includeFrustum, m_bounds) && !AZ::ShapeIntersection::Contains(excludeFrustum, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(includeFrustum, m_looseBounds) && !AZ::ShapeIntersection::Contains(excludeFrustum, m_looseBounds))
         {
             // Invoke the callback for the current node
             if (!m_entries.empty())
             {
-                callback({ m_bounds, m_entries });
+                callback({ m_looseBounds, m_entries });
             }
 
             if (m_children != nullptr)
@@ -212,7 +245,7 @@ namespace AzFramework
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -226,6 +259,76 @@ namespace AzFramework
         }
     }
 
+    void OctreeNode::EnumerateBatch(
+        AZStd::span<const IVisibilityScene::BatchQueryVolume> volumes,
+        IVisibilityScene::BatchQueryMask activeMask,
+        IVisibilityScene::BatchQueryMask containedMask,
+        const IVisibilityScene::BatchEnumerateCallback& callback) const
+    {
+        IVisibilityScene::BatchQueryMask childActiveMasks[MaxChildNodeCount];
+        IVisibilityScene::BatchQueryMask childContainedMasks[MaxChildNodeCount];
+        const uint32_t childCount = EnumerateBatchNode(volumes, activeMask, containedMask, callback, childActiveMasks, childContainedMasks);
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            if ((childActiveMasks[child] | childContainedMasks[child]) != 0)
+            {
+                m_children[child].EnumerateBatch(volumes, childActiveMasks[child], childContainedMasks[child], callback);
+            }
+        }
+    }
+
+    uint32_t OctreeNode::EnumerateBatchNode(
+        AZStd::span<const IVisibilityScene::BatchQueryVolume> volumes,
+        IVisibilityScene::BatchQueryMask activeMask,
+        IVisibilityScene::BatchQueryMask containedMask,
+        const IVisibilityScene::BatchEnumerateCallback& callback,
+        IVisibilityScene::BatchQueryMask* childActiveMasks,
+        IVisibilityScene::BatchQueryMask* childContainedMasks) const
+    {
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({ m_looseBounds, m_entries }, activeMask | containedMask);
+        }
+
+        if (m_children == nullptr)
+        {
+            return 0;
+        }
+
+        // The volumes containing this node contain all the children, so only the volumes overlapping it need to be tested
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            childActiveMasks[child] = 0;
+            childContainedMasks[child] = containedMask;
+        }
+
+        // Test each volume against all the children at once, then distribute the results to the masks of the children
+        for (IVisibilityScene::BatchQueryMask remainingMask = activeMask; remainingMask != 0; remainingMask &= remainingMask - 1)
+        {
+            const uint32_t query = aznumeric_cast<uint32_t>(az_ctz_u64(remainingMask));
+            const IVisibilityScene::BatchQueryMask queryBit = IVisibilityScene::BatchQueryMask(1) << query;
+
+            uint32_t overlapMask = 0;
+            uint32_t containedChildMask = 0;
+            AZStd::visit(
+                [this, &overlapMask, &containedChildMask](const auto& volume)
+                {
+                    GetOverlappingChildren(volume, overlapMask, containedChildMask);
+                },
+                volumes[query]);
+
+            for (uint32_t remainingChildren = overlapMask; remainingChildren != 0; remainingChildren &= remainingChildren - 1)
+            {
+                const uint32_t child = aznumeric_cast<uint32_t>(az_ctz_u32(remainingChildren));
+                IVisibilityScene::BatchQueryMask* childMasks = (containedChildMask & (1 << child)) ? childContainedMasks : childActiveMasks;
+                childMasks[child] |= queryBit;
+            }
+        }
+        return childCount;
+    }
+
     const AZStd::vector<VisibilityEntry*>& OctreeNode::GetEntries() const
     {
         return m_entries;
@@ -241,6 +344,11 @@ namespace AzFramework
         return m_children == nullptr;
     }
 
+    const AZ::Aabb& OctreeNode::GetLooseBounds() const
+    {
+        return m_looseBounds;
+    }
+
     void OctreeNode::TryMerge(OctreeScene& octreeScene)
     {
         if (IsLeaf())
@@ -271,21 +379,30 @@ namespace AzFramework
     template <typename T>
     void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_looseBounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
 
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
         {
             // If this is not a leaf node, recurse into the children
+            uint32_t overlapMask = 0;
+            uint32_t containedMask = 0;
+            GetOverlappingChildren(boundingVolume, overlapMask, containedMask);
+
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (containedMask & (1 << child))
+                {
+                    // The loose bounds of the descendants are inside the loose bounds of the child, so they all overlap the volume
+                    m_children[child].EnumerateNoCull(callback);
+                }
+                else if (overlapMask & (1 << child))
                 {
                     m_children[child].EnumerateHelper(boundingVolume, callback);
                 }
@@ -293,6 +410,38 @@ namespace AzFramework
         }
     }
 
+    template <typename T>
+    void OctreeNode::GetOverlappingChildren(const T& boundingVolume, uint32_t& overlapMask, uint32_t& containedMask) const
+    {
+        overlapMask = 0;
+        containedMask = 0;
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_looseBounds))
+            {
+                overlapMask |= 1 << child;
+            }
+        }
+    }
+
+    void OctreeNode::GetOverlappingChildren(const AZ::Aabb& aabb, uint32_t& overlapMask, uint32_t& containedMask) const
+    {
+        AZ::Soa::OverlapAabbs(aabb, &m_childBounds, 1, &overlapMask);
+        containedMask = 0;
+    }
+
+    void OctreeNode::GetOverlappingChildren(const AZ::Sphere& sphere, uint32_t& overlapMask, uint32_t& containedMask) const
+    {
+        AZ::Soa::OverlapAabbs(sphere, &m_childBounds, 1, &overlapMask);
+        containedMask = 0;
+    }
+
+    void OctreeNode::GetOverlappingChildren(const AZ::Frustum& frustum, uint32_t& overlapMask, uint32_t& containedMask) const
+    {
+        AZ::Soa::OverlapAabbs(frustum, &m_childBounds, 1, &overlapMask, &containedMask);
+    }
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
@@ -301,6 +450,9 @@ namespace AzFramework
 
         // Set child split planes and bounding volumes
         {
+            // Unused elements are left null, so they never overlap the enumerated volumes
+            m_childBounds = AZ::AabbArray8::CreateSplat(AZ::Aabb::CreateNull());
+
             const AZ::Vector3 childExtent = (m_bounds.GetMax() - m_bounds.GetMin()) * 0.5f;
             const AZ::Aabb childBound = AZ::Aabb::CreateFromMinMax(m_bounds.GetMin(), m_bounds.GetMin() + childExtent);
             const uint32_t childCount = GetChildNodeCount();
@@ -328,7 +480,9 @@ namespace AzFramework
                 }
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                m_children[child].m_looseBounds = CreateLooseBounds(m_children[child].m_bounds, octreeScene.m_looseness);
                 m_children[child].m_parent = this;
+                m_childBounds.SetElement(child, m_children[child].m_looseBounds);
             }
         }
 
@@ -365,7 +519,10 @@ namespace AzFramework
     }
 
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
-        : m_sceneName(sceneName)
+        : m_deferUpdates(bg_octreeDeferUpdates)
+        , m_looseness(AZStd::max(static_cast<float>(bg_octreeLooseness), 1.0f))
+        , m_sharedMutex(m_deferUpdates)
+        , m_sceneName(sceneName)
         , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)))
     {
         AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
@@ -381,6 +538,51 @@ namespace AzFramework
         m_nodeCache.shrink_to_fit();
     }
 
+    OctreeScene::SharedMutex::SharedMutex(bool writerPriority)
+        : m_writerPriority(writerPriority)
+    {
+    }
+
+    void OctreeScene::SharedMutex::lock()
+    {
+        if (!m_writerPriority)
+        {
+            m_mutex.lock();
+            return;
+        }
+
+        m_waitingWriters.fetch_add(1, AZStd::memory_order_relaxed);
+        m_mutex.lock();
+        m_waitingWriters.fetch_sub(1, AZStd::memory_order_relaxed);
+    }
+
+    void OctreeScene::SharedMutex::unlock()
+    {
+        m_mutex.unlock();
+    }
+
+    void OctreeScene::SharedMutex::lock_shared()
+    {
+        // A thread that already holds a shared lock, for example when a query callback queries again, must not wait for the
+        // writers, as they wait for that lock to be released. The underlying mutex only blocks readers while a writer holds it.
+        if (m_writerPriority && t_sharedSceneLockCount == 0)
+        {
+            AZStd::exponential_backoff backoff;
+            while (m_waitingWriters.load(AZStd::memory_order_relaxed) != 0)
+            {
+                backoff.wait();
+            }
+        }
+        m_mutex.lock_shared();
+        ++t_sharedSceneLockCount;
+    }
+
+    void OctreeScene::SharedMutex::unlock_shared()
+    {
+        --t_sharedSceneLockCount;
+        m_mutex.unlock_shared();
+    }
+
     const AZ::Name& OctreeScene::GetName() const
     {
         return m_sceneName;
@@ -388,7 +590,19 @@ namespace AzFramework
 
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
-        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (m_deferUpdates)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingEntriesMutex);
+            m_pendingEntries.insert(&entry);
+            return;
+        }
+
+        AZStd::lock_guard<SharedMutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryInternal(entry);
+    }
+
+    void OctreeScene::InsertOrUpdateEntryInternal(VisibilityEntry& entry)
+    {
         if (entry.m_internalNode != nullptr)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
@@ -400,9 +614,37 @@ namespace AzFramework
         }
     }
 
+    void OctreeScene::ApplyPendingUpdates()
+    {
+        AZStd::lock_guard<AZStd::mutex> pendingLock(m_pendingEntriesMutex);
+        if (m_pendingEntries.empty())
+        {
+            return;
+        }
+
+        AZStd::lock_guard<SharedMutex> lock(m_sharedMutex);
+        for (VisibilityEntry* entry : m_pendingEntries)
+        {
+            InsertOrUpdateEntryInternal(*entry);
+        }
+        m_pendingEntries.clear();
+    }
+
+    bool OctreeScene::IsDeferringUpdates() const
+    {
+        return m_deferUpdates;
+    }
+
     void OctreeScene::RemoveEntry(VisibilityEntry& entry)
     {
-        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (m_deferUpdates)
+        {
+            // The entry may be destroyed after this returns, so it can't be left in the queue
+            AZStd::lock_guard<AZStd::mutex> pendingLock(m_pendingEntriesMutex);
+            m_pendingEntries.erase(&entry);
+        }
+
+        AZStd::lock_guard<SharedMutex> lock(m_sharedMutex);
         if (entry.m_internalNode)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
@@ -412,46 +654,157 @@ namespace AzFramework
 
     void OctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<SharedMutex> lock(m_sharedMutex);
         m_root.Enumerate(aabb, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<SharedMutex> lock(m_sharedMutex);
         m_root.Enumerate(sphere, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<SharedMutex> lock(m_sharedMutex);
         m_root.Enumerate(hemisphere, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Capsule & capsule, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<SharedMutex> lock(m_sharedMutex);
         m_root.Enumerate(capsule, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<SharedMutex> lock(m_sharedMutex);
         m_root.Enumerate(frustum, callback);
     }
 
     void OctreeScene::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<SharedMutex> lock(m_sharedMutex);
         m_root.Enumerate(includeFrustum, excludeFrustum, callback);
     }
 
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::shared_lock<SharedMutex> lock(m_sharedMutex);
         m_root.EnumerateNoCull(callback);
     }
 
+    void OctreeScene::EnumerateBatch(
+        AZStd::span<const BatchQueryVolume> volumes, const BatchEnumerateCallback& callback, bool parallel) const
+    {
+        AZ_Assert(volumes.size() <= MaxBatchQueryCount, "EnumerateBatch supports at most %zu volumes", MaxBatchQueryCount);
+        volumes = volumes.first(AZStd::min(volumes.size(), MaxBatchQueryCount));
+
+        AZStd::shared_lock<SharedMutex> lock(m_sharedMutex);
+
+        BatchQueryMask activeMask = 0;
+        for (size_t query = 0; query < volumes.size(); ++query)
+        {
+            const bool overlaps = AZStd::visit(
+                [this](const auto& volume)
+                {
+                    return AZ::ShapeIntersection::Overlaps(volume, m_root.GetLooseBounds());
+                },
+                volumes[query]);
+            if (overlaps)
+            {
+                activeMask |= BatchQueryMask(1) << query;
+            }
+        }
+
+        if (activeMask == 0)
+        {
+            return;
+        }
+
+        bool useTaskGraph = false;
+        if (parallel && !m_root.IsLeaf() && m_entryCount >= ParallelEnumerateMinEntryCount)
+        {
+            const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            useTaskGraph = m_taskExecutor != nullptr || (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive());
+
+            // Waiting on the subtree tasks from one of the executor's own workers could deadlock, so traverse serially instead
+            if (useTaskGraph)
+            {
+                AZ::TaskExecutor& executor = m_taskExecutor != nullptr ? *m_taskExecutor : AZ::TaskExecutor::Instance();
+                useTaskGraph = !executor.IsWorkerThread();
+            }
+        }
+
+        if (!useTaskGraph)
+        {
+            m_root.EnumerateBatch(volumes, activeMask, 0, callback);
+            return;
+        }
+
+        // Expand the top of the tree breadth first on this thread, until there are enough subtrees to balance between the workers
+        struct Subtree
+        {
+            const OctreeNode* m_node;
+            BatchQueryMask m_activeMask;
+            BatchQueryMask m_containedMask;
+        };
+        AZStd::vector<Subtree> subtrees;
+        subtrees.push_back({ &m_root, activeMask, 0 });
+        size_t firstSubtree = 0;
+        while (firstSubtree < subtrees.size() && subtrees.size() - firstSubtree < ParallelEnumerateSubtreeCount)
+        {
+            const Subtree subtree = subtrees[firstSubtree++];
+            BatchQueryMask childActiveMasks[MaxChildNodeCount];
+            BatchQueryMask childContainedMasks[MaxChildNodeCount];
+            const uint32_t childCount = subtree.m_node->EnumerateBatchNode(
+                volumes, subtree.m_activeMask, subtree.m_containedMask, callback, childActiveMasks, childContainedMasks);
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                if ((childActiveMasks[child] | childContainedMasks[child]) != 0)
+                {
+                    subtrees.push_back({ &subtree.m_node->GetChildren()[child], childActiveMasks[child], childContainedMasks[child] });
+                }
+            }
+        }
+
+        if (firstSubtree == subtrees.size())
+        {
+            return;
+        }
+
+        static const AZ::TaskDescriptor enumerateTaskDescriptor{ "OctreeScene::EnumerateBatch", "Visibility" };
+        AZ::TaskGraphEvent enumerateEvent{ "OctreeScene EnumerateBatch Wait" };
+        AZ::TaskGraph enumerateGraph{ "OctreeScene EnumerateBatch" };
+        for (size_t subtreeIndex = firstSubtree; subtreeIndex < subtrees.size(); ++subtreeIndex)
+        {
+            enumerateGraph.AddTask(
+                enumerateTaskDescriptor,
+                [&subtree = subtrees[subtreeIndex], volumes, &callback]()
+                {
+                    // The workers run under the shared lock of this thread, so queries from the callback must not wait for writers
+                    ++t_sharedSceneLockCount;
+                    subtree.m_node->EnumerateBatch(volumes, subtree.m_activeMask, subtree.m_containedMask, callback);
+                    --t_sharedSceneLockCount;
+                });
+        }
+
+        if (m_taskExecutor != nullptr)
+        {
+            enumerateGraph.SubmitOnExecutor(*m_taskExecutor, &enumerateEvent);
+        }
+        else
+        {
+            enumerateGraph.Submit(&enumerateEvent);
+        }
+        enumerateEvent.Wait();
+    }
+
+    void OctreeScene::SetTaskExecutor(AZ::TaskExecutor* executor)
+    {
+        m_taskExecutor = executor;
+    }
+
     uint32_t OctreeScene::GetEntryCount() const
     {
         return m_entryCount;
@@ -595,12 +948,28 @@ namespace AzFramework
 
     void OctreeSystemComponent::Activate()
     {
-        ;
+        AZ::TickBus::Handler::BusConnect();
     }
 
     void OctreeSystemComponent::Deactivate()
     {
-        ;
+        AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    void OctreeSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_defaultScene->ApplyPendingUpdates();
+        for (OctreeScene* scene : m_scenes)
+        {
+            scene->ApplyPendingUpdates();
+        }
+    }
+
+    int OctreeSystemComponent::GetTickOrder()
+    {
+        // After the handlers at TICK_LAST, so the entries moved by the transform updates of this tick are visible to the
+        // culling that runs after the tick bus
+        return AZ::TICK_LAST + 1;
     }
 
     IVisibilityScene* OctreeSystemComponent::GetDefaultVisibilityScene()
@@ -10,13 +10,23 @@
 
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Math/Plane.h>
+#include <AzCore/Math/SoaMath.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/std/containers/stack.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzFramework/AzFrameworkAPI.h>
 
+namespace AZ
+{
+    class TaskExecutor;
+}
+
 namespace AzFramework
 {
     class OctreeSystemComponent;
@@ -24,6 +34,7 @@ namespace AzFramework
 
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
+    //! In a loose octree the bounds used to fit the objects are larger than the node's cell, see bg_octreeLooseness.
     class AZF_API OctreeNode
         : public VisibilityNode
     {
@@ -61,6 +72,26 @@ namespace AzFramework
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
+        //! Recursively enumerates any OctreeNodes and their children that intersect any of the volumes of a batch.
+        //! @param activeMask the volumes overlapping this node, which are tested against the child nodes
+        //! @param containedMask the volumes containing this node, and so all of its descendants
+        void EnumerateBatch(
+            AZStd::span<const IVisibilityScene::BatchQueryVolume> volumes,
+            IVisibilityScene::BatchQueryMask activeMask,
+            IVisibilityScene::BatchQueryMask containedMask,
+            const IVisibilityScene::BatchEnumerateCallback& callback) const;
+
+        //! Same as EnumerateBatch, but only invokes the callback for this node and returns the masks of the child nodes instead of
+        //! recursing into them. The child masks are zero for the children that aren't visible to any volume.
+        //! @return The number of child masks written, which is 0 for a leaf node.
+        uint32_t EnumerateBatchNode(
+            AZStd::span<const IVisibilityScene::BatchQueryVolume> volumes,
+            IVisibilityScene::BatchQueryMask activeMask,
+            IVisibilityScene::BatchQueryMask containedMask,
+            const IVisibilityScene::BatchEnumerateCallback& callback,
+            IVisibilityScene::BatchQueryMask* childActiveMasks,
+            IVisibilityScene::BatchQueryMask* childContainedMasks) const;
+
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
@@ -70,6 +101,9 @@ namespace AzFramework
         //! Returns true if this is a leaf node.
         bool IsLeaf() const;
 
+        //! Returns the bounds that contain every entry bound to this node.
+        const AZ::Aabb& GetLooseBounds() const;
+
     private:
 
         void TryMerge(OctreeScene& octreeScene);
@@ -77,6 +111,16 @@ namespace AzFramework
         template <typename T>
         void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
 
+        //! Tests the child nodes against a bounding volume, setting bit i of overlapMask if child i overlaps the volume, and
+        //! of containedMask if the child is fully inside it. The aabb, sphere and frustum tests use the SIMD kernels on m_childBounds.
+        //! @{
+        template <typename T>
+        void GetOverlappingChildren(const T& boundingVolume, uint32_t& overlapMask, uint32_t& containedMask) const;
+        void GetOverlappingChildren(const AZ::Aabb& aabb, uint32_t& overlapMask, uint32_t& containedMask) const;
+        void GetOverlappingChildren(const AZ::Sphere& sphere, uint32_t& overlapMask, uint32_t& containedMask) const;
+        void GetOverlappingChildren(const AZ::Frustum& frustum, uint32_t& overlapMask, uint32_t& containedMask) const;
+        //! @}
+
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
 
@@ -84,7 +128,9 @@ namespace AzFramework
         // This gives us a maximum of 65,536 pages and 65,536 nodes per page, for a total of 2^32 - 1 total pages (-1 reserved for the invalid index)
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
-        AZ::Aabb m_bounds;
+        AZ::Aabb m_bounds; //< The cell covered by this node, which is split evenly between the child nodes
+        AZ::Aabb m_looseBounds; //< The bounds used to fit entries into this node, which are the cell bounds scaled by the scene's looseness
+        AZ::AabbArray8 m_childBounds; //< The loose bounds of the child nodes, stored as SoA so they can be tested at once during enumeration
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
@@ -92,6 +138,8 @@ namespace AzFramework
 
     //! Implementation of the visibility system interface.
     //! This uses a simple adaptive octree to support partitioning an object set for a specific scene and efficiently running gathers and visibility queries.
+    //! If bg_octreeDeferUpdates was set when the scene was created, inserts and updates are queued and applied once per tick by
+    //! ApplyPendingUpdates, so that threads enumerating the scene only wait for a single batched update per tick.
     class AZF_API OctreeScene
         : public IVisibilityScene
     {
@@ -115,9 +163,21 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateBatch(
+            AZStd::span<const BatchQueryVolume> volumes, const BatchEnumerateCallback& callback, bool parallel = false) const override;
         uint32_t GetEntryCount() const override;
         //! @}
 
+        //! Overrides the executor used by parallel batched enumerations, for testing and benchmarking.
+        //! By default the system executor is used while the task graph system is active.
+        void SetTaskExecutor(AZ::TaskExecutor* executor);
+
+        //! Applies the inserts and updates queued while deferred updates are enabled.
+        void ApplyPendingUpdates();
+
+        //! Returns true if inserts and updates are queued until the next ApplyPendingUpdates.
+        bool IsDeferringUpdates() const;
+
         //! Stats
         //! @{
         uint32_t GetNodeCount() const;
@@ -128,11 +188,41 @@ namespace AzFramework
         //! @}
 
     private:
+        void InsertOrUpdateEntryInternal(VisibilityEntry& entry);
+
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
 
-        mutable AZStd::shared_mutex m_sharedMutex;
+        //! Shared mutex that can give priority to writers. The spin lock of AZStd::shared_mutex is only granted to a writer once
+        //! no reader holds it, which never happens while queries are running on several threads.
+        //! Writers only get priority in scenes that defer updates, so other scenes keep the reader-preferring behavior.
+        //! Shared locking is reentrant: threads that already hold a shared lock, and the workers of a parallel batched
+        //! enumeration, don't wait for the writers.
+        class SharedMutex
+        {
+        public:
+            explicit SharedMutex(bool writerPriority);
+
+            void lock();
+            void unlock();
+            void lock_shared();
+            void unlock_shared();
+
+        private:
+            AZStd::shared_mutex m_mutex;
+            AZStd::atomic<uint32_t> m_waitingWriters{ 0 }; //< New readers wait until this drops to zero.
+            const bool m_writerPriority;
+        };
+
+        //! Entries inserted or updated since the last ApplyPendingUpdates, when deferring updates.
+        //! The mutex is held while the updates are applied, so an entry can't be removed while it is being reinserted.
+        AZStd::mutex m_pendingEntriesMutex;
+        AZStd::unordered_set<VisibilityEntry*> m_pendingEntries;
+        AZ::TaskExecutor* m_taskExecutor = nullptr;
+        const bool m_deferUpdates; //< Cached value of bg_octreeDeferUpdates when the scene was created.
+        const float m_looseness; //< Cached value of bg_octreeLooseness when the scene was created.
+        mutable SharedMutex m_sharedMutex; //< Declared after m_deferUpdates, which it is constructed from.
 
         AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
         OctreeNode m_root; //< The root node for the octreeSystemComponent.
@@ -155,6 +245,7 @@ namespace AzFramework
     class AZF_API OctreeSystemComponent
         : public AZ::Component
         , public IVisibilitySystemRequestBus::Handler
+        , public AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(OctreeSystemComponent, "{CD4FF1C5-BAF4-421D-951B-1E05DAEEF67B}");
@@ -184,6 +275,12 @@ namespace AzFramework
         void DumpStats(const AZ::ConsoleCommandContainer& arguments) override;
         //! @}
 
+        //! AZ::TickBus overrides
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
     private:
         //! The default scene used for most entities (e.g. gameplay, networking)
         OctreeScene* m_defaultScene = nullptr;
@@ -50,6 +50,14 @@ namespace AzFramework
             ReloadSpawnable,
             void(EntitySpawnTicket& ticket, AZ::Data::Asset<Spawnable> spawnable, ReloadSpawnableOptionalArgs optionalArgs));
 
+        MOCK_METHOD4(
+            ApplySpawnablePatch,
+            void(
+                EntitySpawnTicket& ticket,
+                AZ::Data::Asset<Spawnable> spawnable,
+                SpawnablePatch patch,
+                ApplySpawnablePatchOptionalArgs optionalArgs));
+
         MOCK_METHOD3(
             UpdateEntityAliasTypes,
             void(
@@ -7,7 +7,12 @@
  */
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -332,6 +337,256 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+    // Compares the regular octree with the loose octree and the deferred updates, using a scene with 100000 entries.
+    // The argument selects the octree configuration:
+    //  0 - Regular octree with immediate updates.
+    //  1 - Loose octree with immediate updates.
+    //  2 - Loose octree with updates deferred to ApplyPendingUpdates.
+    class BM_OctreeLoose
+        : public benchmark::Fixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_console = aznew AZ::Console();
+            AZ::Interface<AZ::IConsole>::Register(m_console);
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+            }
+            m_console->PerformCommand(state.range(0) == 0 ? "bg_octreeLooseness 1" : "bg_octreeLooseness 2");
+            m_console->PerformCommand(state.range(0) == 2 ? "bg_octreeDeferUpdates true" : "bg_octreeDeferUpdates false");
+
+            m_octreeSystemComponent = new AzFramework::OctreeSystemComponent;
+            m_visScene = azdynamic_cast<AzFramework::OctreeScene*>(
+                m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeLooseBenchmarkVisibilityScene")));
+
+            std::mt19937_64 rng(1);
+            std::uniform_real_distribution<float> unif;
+            m_dataArray.resize(100000);
+            for (AzFramework::VisibilityEntry& data : m_dataArray)
+            {
+                const AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 8000.0f;
+                data.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 50.0f);
+                m_visScene->InsertOrUpdateEntry(data);
+            }
+            m_visScene->ApplyPendingUpdates();
+
+            m_frustums.resize(100);
+            for (AZ::Frustum& frustum : m_frustums)
+            {
+                const AZ::Quaternion quaternion = AZ::Quaternion::CreateFromAxisAngle(
+                    AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetNormalized(), unif(rng));
+                frustum = AZ::Frustum(AZ::ViewFrustumAttributes(
+                    AZ::Transform::CreateFromQuaternionAndTranslation(quaternion, AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 8000.0f),
+                    1.0f, 2.0f * atanf(0.5f), 0.1f, 1000.0f));
+                m_frustumVolumes.push_back(frustum);
+            }
+
+            // The 6 faces of cube maps at 10 positions, like the shadows of point lights, where the frustums share most of the nodes
+            const AZ::Quaternion faceRotations[] = { AZ::Quaternion::CreateIdentity(),
+                                                     AZ::Quaternion::CreateRotationZ(AZ::Constants::HalfPi),
+                                                     AZ::Quaternion::CreateRotationZ(AZ::Constants::Pi),
+                                                     AZ::Quaternion::CreateRotationZ(-AZ::Constants::HalfPi),
+                                                     AZ::Quaternion::CreateRotationX(AZ::Constants::HalfPi),
+                                                     AZ::Quaternion::CreateRotationX(-AZ::Constants::HalfPi) };
+            for (uint32_t cubeIndex = 0; cubeIndex < 10; ++cubeIndex)
+            {
+                const AZ::Vector3 position = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 8000.0f;
+                for (const AZ::Quaternion& faceRotation : faceRotations)
+                {
+                    m_cubeFaceVolumes.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(
+                        AZ::Transform::CreateFromQuaternionAndTranslation(faceRotation, position), 1.0f, AZ::Constants::HalfPi, 0.1f, 500.0f)));
+                }
+            }
+        }
+
+        void internalTearDown()
+        {
+            for (AzFramework::VisibilityEntry& data : m_dataArray)
+            {
+                m_visScene->RemoveEntry(data);
+            }
+            m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+            delete m_octreeSystemComponent;
+            AZ::NameDictionary::Destroy();
+
+            m_console->PerformCommand("bg_octreeLooseness 1");
+            m_console->PerformCommand("bg_octreeDeferUpdates false");
+            AZ::Interface<AZ::IConsole>::Unregister(m_console);
+            delete m_console;
+
+            m_dataArray = {};
+            m_frustums = {};
+            m_frustumVolumes = {};
+            m_cubeFaceVolumes = {};
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        // Moves the first entries by a small offset, like the per tick movement of dynamic objects.
+        void MoveEntries(uint32_t entryCount, float offset)
+        {
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                m_dataArray[i].m_boundingVolume.Translate(AZ::Vector3(offset, 0.0f, 0.0f));
+                m_visScene->InsertOrUpdateEntry(m_dataArray[i]);
+            }
+            m_visScene->ApplyPendingUpdates();
+        }
+
+        // Enumerates the volumes with one batched query per MaxBatchQueryCount volumes.
+        void EnumerateBatches(AZStd::span<const AzFramework::IVisibilityScene::BatchQueryVolume> volumes, bool parallel)
+        {
+            AZStd::atomic_uint32_t entryCount{ 0 };
+            for (size_t first = 0; first < volumes.size(); first += AzFramework::IVisibilityScene::MaxBatchQueryCount)
+            {
+                m_visScene->EnumerateBatch(
+                    volumes.subspan(first, AZStd::min(AzFramework::IVisibilityScene::MaxBatchQueryCount, volumes.size() - first)),
+                    [&entryCount](const AzFramework::IVisibilityScene::NodeData& nodeData, AzFramework::IVisibilityScene::BatchQueryMask queryMask)
+                    {
+                        entryCount += aznumeric_cast<uint32_t>(nodeData.m_entries.size()) * az_popcnt_u64(queryMask);
+                    },
+                    parallel);
+            }
+            benchmark::DoNotOptimize(entryCount.load());
+        }
+
+        AZStd::vector<AzFramework::VisibilityEntry> m_dataArray;
+        AZStd::vector<AZ::Frustum> m_frustums;
+        AZStd::vector<AzFramework::IVisibilityScene::BatchQueryVolume> m_frustumVolumes;
+        AZStd::vector<AzFramework::IVisibilityScene::BatchQueryVolume> m_cubeFaceVolumes;
+        AZ::Console* m_console = nullptr;
+        AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
+        AzFramework::OctreeScene* m_visScene = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(BM_OctreeLoose, EnumerateFrustum)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            uint32_t entryCount = 0;
+            for (const AZ::Frustum& frustum : m_frustums)
+            {
+                m_visScene->Enumerate(frustum, [&entryCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    entryCount += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+                });
+            }
+            benchmark::DoNotOptimize(entryCount);
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_OctreeLoose, EnumerateFrustum)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+    // Same frustums as EnumerateFrustum, shared traversal of the tree for up to 64 frustums at a time.
+    BENCHMARK_DEFINE_F(BM_OctreeLoose, EnumerateFrustumBatch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateBatches(m_frustumVolumes, false);
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_OctreeLoose, EnumerateFrustumBatch)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BM_OctreeLoose, EnumerateFrustumBatchParallel)(benchmark::State& state)
+    {
+        AZ::TaskExecutor executor;
+        m_visScene->SetTaskExecutor(&executor);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateBatches(m_frustumVolumes, true);
+        }
+        m_visScene->SetTaskExecutor(nullptr);
+    }
+    BENCHMARK_REGISTER_F(BM_OctreeLoose, EnumerateFrustumBatchParallel)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(BM_OctreeLoose, EnumerateCubeFaces)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            uint32_t entryCount = 0;
+            for (const AzFramework::IVisibilityScene::BatchQueryVolume& volume : m_cubeFaceVolumes)
+            {
+                m_visScene->Enumerate(AZStd::get<AZ::Frustum>(volume), [&entryCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    entryCount += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+                });
+            }
+            benchmark::DoNotOptimize(entryCount);
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_OctreeLoose, EnumerateCubeFaces)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BM_OctreeLoose, EnumerateCubeFacesBatch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            EnumerateBatches(m_cubeFaceVolumes, false);
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_OctreeLoose, EnumerateCubeFacesBatch)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BM_OctreeLoose, MoveEntries)(benchmark::State& state)
+    {
+        float offset = 1.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveEntries(10000, offset = -offset);
+        }
+        state.SetItemsProcessed(state.iterations() * 10000);
+    }
+    BENCHMARK_REGISTER_F(BM_OctreeLoose, MoveEntries)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+    // Measures the entry updates while worker threads keep enumerating the scene, like the culling jobs of the renderer.
+    BENCHMARK_DEFINE_F(BM_OctreeLoose, MoveEntriesWithConcurrentQueries)(benchmark::State& state)
+    {
+        AZStd::atomic_bool running{ true };
+        AZStd::vector<AZStd::thread> queryThreads;
+        for (uint32_t threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            queryThreads.emplace_back([this, &running, threadIndex]()
+            {
+                uint32_t entryCount = 0;
+                for (size_t i = threadIndex; running; i = (i + 1) % m_frustums.size())
+                {
+                    m_visScene->Enumerate(m_frustums[i], [&entryCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                    {
+                        entryCount += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+                    });
+                }
+                benchmark::DoNotOptimize(entryCount);
+            });
+        }
+
+        float offset = 1.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveEntries(10000, offset = -offset);
+        }
+        state.SetItemsProcessed(state.iterations() * 10000);
+
+        running = false;
+        for (AZStd::thread& thread : queryThreads)
+        {
+            thread.join();
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_OctreeLoose, MoveEntriesWithConcurrentQueries)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond)->UseRealTime();
 }
 
 #endif
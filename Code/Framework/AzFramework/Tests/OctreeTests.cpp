@@ -12,6 +12,13 @@
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -32,6 +39,8 @@ namespace UnitTest
             m_console->GetCvarValue("bg_octreeNodeMaxEntries", m_savedMaxEntries);
             m_console->GetCvarValue("bg_octreeNodeMinEntries", m_savedMinEntries);
             m_console->GetCvarValue("bg_octreeMaxWorldExtents", m_savedBounds);
+            m_console->GetCvarValue("bg_octreeLooseness", m_savedLooseness);
+            m_console->GetCvarValue("bg_octreeDeferUpdates", m_savedDeferUpdates);
 
             // To ease unit testing, configure the octreeSystemComponent to only allow one entry per node
             m_console->PerformCommand("bg_octreeNodeMaxEntries 1");
@@ -51,11 +60,15 @@ namespace UnitTest
         {
             //Restore octreeSystemComponent cvars for any future tests or benchmarks that might get executed
             AZStd::string commandString;
-            commandString.format("bg_octreeNodeMaxEntries %u", m_savedMaxEntries);
+            commandString = AZStd::string::format("bg_octreeNodeMaxEntries %u", m_savedMaxEntries);
             m_console->PerformCommand(commandString.c_str());
-            commandString.format("bg_octreeNodeMinEntries %u", m_savedMinEntries);
+            commandString = AZStd::string::format("bg_octreeNodeMinEntries %u", m_savedMinEntries);
             m_console->PerformCommand(commandString.c_str());
-            commandString.format("bg_octreeMaxWorldExtents %f", m_savedBounds);
+            commandString = AZStd::string::format("bg_octreeMaxWorldExtents %f", m_savedBounds);
+            m_console->PerformCommand(commandString.c_str());
+            commandString = AZStd::string::format("bg_octreeLooseness %f", m_savedLooseness);
+            m_console->PerformCommand(commandString.c_str());
+            commandString = AZStd::string::format("bg_octreeDeferUpdates %s", m_savedDeferUpdates ? "true" : "false");
             m_console->PerformCommand(commandString.c_str());
 
             m_octreeSystemComponent->DestroyVisibilityScene(m_octreeScene);
@@ -74,6 +87,8 @@ namespace UnitTest
         uint32_t m_savedMaxEntries = 0;
         uint32_t m_savedMinEntries = 0;
         float m_savedBounds = 0.0f;
+        float m_savedLooseness = 1.0f;
+        bool m_savedDeferUpdates = false;
         AZ::Console* m_console;
     };
 
@@ -108,6 +123,58 @@ namespace UnitTest
         EXPECT_TRUE(true); //TEST
     }
 
+    TEST_F(OctreeTests, EnumerateFromCallback_WhileWriterWaits_DoesNotDeadlock)
+    {
+        // Writers only get priority over readers in scenes that defer updates
+        m_console->PerformCommand("bg_octreeDeferUpdates true");
+        OctreeScene* deferredScene = azdynamic_cast<OctreeScene*>(m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("DeferredOctreeScene")));
+
+        AzFramework::VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+        deferredScene->InsertOrUpdateEntry(visEntry);
+        deferredScene->ApplyPendingUpdates();
+
+        AzFramework::VisibilityEntry writerEntry;
+        writerEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateOne(), AZ::Vector3(2.0f));
+        deferredScene->InsertOrUpdateEntry(writerEntry);
+        AZStd::atomic_bool writerStarted{ false };
+        AZStd::thread writer;
+        size_t nestedEntryCount = 0;
+        deferredScene->EnumerateNoCull(
+            [deferredScene, &writerStarted, &writer, &nestedEntryCount](const AzFramework::IVisibilityScene::NodeData&)
+            {
+                if (writer.joinable())
+                {
+                    return;
+                }
+                writer = AZStd::thread(
+                    [deferredScene, &writerStarted]()
+                    {
+                        writerStarted = true;
+                        deferredScene->ApplyPendingUpdates();
+                    });
+                while (!writerStarted)
+                {
+                    AZStd::this_thread::yield();
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+
+                // The writer waits for this thread to release its shared lock, so querying again must not wait for the writer
+                deferredScene->EnumerateNoCull(
+                    [&nestedEntryCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                    {
+                        nestedEntryCount += nodeData.m_entries.size();
+                    });
+            });
+        writer.join();
+
+        EXPECT_EQ(1, nestedEntryCount);
+        ValidateEntryCountEqualsExpectedCount(deferredScene, 2);
+        deferredScene->RemoveEntry(writerEntry);
+        deferredScene->RemoveEntry(visEntry);
+        m_octreeSystemComponent->DestroyVisibilityScene(deferredScene);
+    }
+
     TEST_F(OctreeTests, InsertDeleteSplitMerge)
     {
         AzFramework::VisibilityEntry visEntry[3];
@@ -467,4 +534,357 @@ namespace UnitTest
         }
 
     }
+
+    TEST_F(OctreeTests, LooseOctree_EntryOnSplitPlane_InsertedIntoChildNode)
+    {
+        m_console->PerformCommand("bg_octreeLooseness 2");
+        OctreeScene* looseScene = azdynamic_cast<OctreeScene*>(m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("LooseOctreeScene")));
+
+        // The second entry straddles the split planes of the root node, so it can't be pushed down a regular octree
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.1f), AZ::Vector3(0.1f));
+
+        m_octreeScene->InsertOrUpdateEntry(visEntry[0]);
+        m_octreeScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_FALSE(static_cast<OctreeNode*>(visEntry[1].m_internalNode)->IsLeaf());
+        m_octreeScene->RemoveEntry(visEntry[0]);
+        m_octreeScene->RemoveEntry(visEntry[1]);
+
+        looseScene->InsertOrUpdateEntry(visEntry[0]);
+        looseScene->InsertOrUpdateEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(looseScene, 2);
+        const OctreeNode* node = static_cast<OctreeNode*>(visEntry[1].m_internalNode);
+        EXPECT_TRUE(node->IsLeaf());
+        EXPECT_TRUE(AZ::ShapeIntersection::Contains(node->GetLooseBounds(), visEntry[1].m_boundingVolume));
+
+        // Small moves inside the loose bounds keep the entry in the same node
+        visEntry[1].m_boundingVolume.Translate(AZ::Vector3(-0.2f, -0.2f, -0.2f));
+        looseScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(node, visEntry[1].m_internalNode);
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        looseScene->Enumerate(AZ::Sphere(AZ::Vector3(-0.2f), 0.05f), [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        EXPECT_THAT(gatheredEntries, ::testing::Contains(&visEntry[1]));
+
+        looseScene->RemoveEntry(visEntry[0]);
+        looseScene->RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(looseScene, 0);
+        m_octreeSystemComponent->DestroyVisibilityScene(looseScene);
+    }
+
+    TEST_F(OctreeTests, LooseOctree_EnumerateFrustum_MatchesBruteForce)
+    {
+        m_console->PerformCommand("bg_octreeLooseness 1.5");
+        m_console->PerformCommand("bg_octreeNodeMaxEntries 4");
+        OctreeScene* looseScene = azdynamic_cast<OctreeScene*>(m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("LooseOctreeScene")));
+
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> position(-0.95f, 0.9f);
+        std::uniform_real_distribution<float> extent(0.001f, 0.05f);
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(1000);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            const AZ::Vector3 minimum(position(rng), position(rng), position(rng));
+            entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(minimum, minimum + AZ::Vector3(extent(rng), extent(rng), extent(rng)));
+            looseScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(looseScene, static_cast<uint32_t>(visEntries.size()));
+
+        // Every entry overlapping the frustum must be in an enumerated node
+        const AZ::Frustum frustum(AZ::ViewFrustumAttributes(
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(0.3f), AZ::Vector3(0.0f, -2.0f, 0.0f)),
+            1.0f, 2.0f * atanf(0.3f), 1.0f, 2.5f));
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        looseScene->Enumerate(frustum, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+
+        size_t overlapCount = 0;
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            if (AZ::ShapeIntersection::Overlaps(frustum, entry.m_boundingVolume))
+            {
+                ++overlapCount;
+                EXPECT_THAT(gatheredEntries, ::testing::Contains(&entry));
+            }
+        }
+        EXPECT_GT(overlapCount, 0u);
+        EXPECT_LT(gatheredEntries.size(), visEntries.size());
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            looseScene->RemoveEntry(entry);
+        }
+        m_octreeSystemComponent->DestroyVisibilityScene(looseScene);
+    }
+
+    TEST_F(OctreeTests, DeferredUpdates_AppliedByApplyPendingUpdates)
+    {
+        m_console->PerformCommand("bg_octreeDeferUpdates true");
+        OctreeScene* deferredScene = azdynamic_cast<OctreeScene*>(m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("DeferredOctreeScene")));
+        EXPECT_TRUE(deferredScene->IsDeferringUpdates());
+        EXPECT_FALSE(m_octreeScene->IsDeferringUpdates());
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.1f), AZ::Vector3(0.4f));
+        deferredScene->InsertOrUpdateEntry(visEntry[0]);
+        deferredScene->InsertOrUpdateEntry(visEntry[1]);
+        deferredScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_TRUE(visEntry[0].m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(deferredScene, 0);
+
+        deferredScene->ApplyPendingUpdates();
+        EXPECT_TRUE(visEntry[0].m_internalNode != nullptr);
+        ValidateEntryCountEqualsExpectedCount(deferredScene, 2);
+
+        // Moves are only visible after the next update
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        const AZ::Aabb query = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.5f), AZ::Vector3(1.0f));
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.6f), AZ::Vector3(0.9f));
+        deferredScene->InsertOrUpdateEntry(visEntry[0]);
+        deferredScene->Enumerate(query, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        EXPECT_THAT(gatheredEntries, ::testing::Not(::testing::Contains(&visEntry[0])));
+
+        deferredScene->ApplyPendingUpdates();
+        gatheredEntries.clear();
+        deferredScene->Enumerate(query, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        EXPECT_THAT(gatheredEntries, ::testing::Contains(&visEntry[0]));
+
+        // Removing an entry also drops its queued update, so it isn't reinserted
+        deferredScene->InsertOrUpdateEntry(visEntry[1]);
+        deferredScene->RemoveEntry(visEntry[1]);
+        deferredScene->ApplyPendingUpdates();
+        EXPECT_TRUE(visEntry[1].m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(deferredScene, 1);
+
+        deferredScene->RemoveEntry(visEntry[0]);
+        ValidateEntryCountEqualsExpectedCount(deferredScene, 0);
+        m_octreeSystemComponent->DestroyVisibilityScene(deferredScene);
+    }
+
+    // Returns the mask of the queries each node was enumerated for, using the address of the node's entries to identify it
+    static AZStd::map<const void*, IVisibilityScene::BatchQueryMask> EnumerateSeparately(
+        const IVisibilityScene* visScene, AZStd::span<const IVisibilityScene::BatchQueryVolume> volumes)
+    {
+        AZStd::map<const void*, IVisibilityScene::BatchQueryMask> nodeMasks;
+        for (size_t query = 0; query < volumes.size(); ++query)
+        {
+            AZStd::visit(
+                [visScene, query, &nodeMasks](const auto& volume)
+                {
+                    visScene->Enumerate(volume, [query, &nodeMasks](const IVisibilityScene::NodeData& nodeData)
+                    {
+                        nodeMasks[&nodeData.m_entries] |= IVisibilityScene::BatchQueryMask(1) << query;
+                    });
+                },
+                volumes[query]);
+        }
+        return nodeMasks;
+    }
+
+    class OctreeBatchTests
+        : public OctreeTests
+    {
+    public:
+        void SetUp() override
+        {
+            OctreeTests::SetUp();
+            m_console->PerformCommand("bg_octreeNodeMaxEntries 4");
+
+            std::mt19937 rng(3);
+            std::uniform_real_distribution<float> position(-0.95f, 0.9f);
+            std::uniform_real_distribution<float> extent(0.001f, 0.05f);
+            m_visEntries.resize(2000);
+            for (AzFramework::VisibilityEntry& entry : m_visEntries)
+            {
+                const AZ::Vector3 minimum(position(rng), position(rng), position(rng));
+                entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(minimum, minimum + AZ::Vector3(extent(rng), extent(rng), extent(rng)));
+                m_octreeScene->InsertOrUpdateEntry(entry);
+            }
+
+            std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+            for (int i = 0; i < 20; ++i)
+            {
+                const AZ::Vector3 center(position(rng), position(rng), position(rng));
+                m_volumes.push_back(AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(0.05f + 0.2f * unit(rng))));
+                m_volumes.push_back(AZ::Sphere(center, 0.05f + 0.3f * unit(rng)));
+                m_volumes.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(
+                    AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(6.0f * unit(rng)), center),
+                    1.0f, 2.0f * atanf(0.2f + unit(rng)), 0.01f, 0.5f + unit(rng))));
+            }
+            // A volume containing the whole scene, and one outside of it
+            m_volumes.push_back(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-2.0f), AZ::Vector3(2.0f)));
+            m_volumes.push_back(AZ::Sphere(AZ::Vector3(5.0f), 1.0f));
+        }
+
+        void TearDown() override
+        {
+            for (AzFramework::VisibilityEntry& entry : m_visEntries)
+            {
+                m_octreeScene->RemoveEntry(entry);
+            }
+            m_visEntries = {};
+            m_volumes = {};
+            OctreeTests::TearDown();
+        }
+
+        AZStd::vector<AzFramework::VisibilityEntry> m_visEntries;
+        AZStd::vector<IVisibilityScene::BatchQueryVolume> m_volumes;
+    };
+
+    TEST_F(OctreeBatchTests, EnumerateBatch_MixedVolumes_MatchesSeparateEnumerations)
+    {
+        const auto expectedMasks = EnumerateSeparately(m_octreeScene, m_volumes);
+
+        AZStd::map<const void*, IVisibilityScene::BatchQueryMask> nodeMasks;
+        m_octreeScene->EnumerateBatch(m_volumes, [&nodeMasks](const IVisibilityScene::NodeData& nodeData, IVisibilityScene::BatchQueryMask queryMask)
+        {
+            EXPECT_TRUE(nodeMasks.emplace(&nodeData.m_entries, queryMask).second) << "Node enumerated more than once";
+            EXPECT_NE(0, queryMask);
+        });
+
+        EXPECT_EQ(expectedMasks, nodeMasks);
+        EXPECT_GT(nodeMasks.size(), 1u);
+    }
+
+    TEST_F(OctreeBatchTests, EnumerateBatch_Parallel_MatchesSeparateEnumerations)
+    {
+        const auto expectedMasks = EnumerateSeparately(m_octreeScene, m_volumes);
+
+        AZ::TaskExecutor executor(2);
+        m_octreeScene->SetTaskExecutor(&executor);
+
+        AZStd::mutex nodeMasksMutex;
+        AZStd::map<const void*, IVisibilityScene::BatchQueryMask> nodeMasks;
+        m_octreeScene->EnumerateBatch(
+            m_volumes,
+            [&nodeMasks, &nodeMasksMutex](const IVisibilityScene::NodeData& nodeData, IVisibilityScene::BatchQueryMask queryMask)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(nodeMasksMutex);
+                nodeMasks.emplace(&nodeData.m_entries, queryMask);
+            },
+            true);
+        m_octreeScene->SetTaskExecutor(nullptr);
+
+        EXPECT_EQ(expectedMasks, nodeMasks);
+    }
+
+    TEST_F(OctreeBatchTests, EnumerateBatch_ParallelFromWorkerThread_EnumeratesSerially)
+    {
+        const auto expectedMasks = EnumerateSeparately(m_octreeScene, m_volumes);
+
+        AZ::TaskExecutor executor(2);
+        m_octreeScene->SetTaskExecutor(&executor);
+
+        // Enumerating from inside a task must not wait on the executor it is running on
+        AZStd::map<const void*, IVisibilityScene::BatchQueryMask> nodeMasks;
+        AZStd::thread::id callbackThread;
+        bool singleThreaded = true;
+        AZ::TaskGraph graph{ "OctreeBatchTests" };
+        graph.AddTask(
+            AZ::TaskDescriptor{ "EnumerateBatch", "OctreeBatchTests" },
+            [this, &nodeMasks, &callbackThread, &singleThreaded]
+            {
+                const AZStd::thread::id workerThread = AZStd::this_thread::get_id();
+                m_octreeScene->EnumerateBatch(
+                    m_volumes,
+                    [&nodeMasks, &singleThreaded, workerThread](const IVisibilityScene::NodeData& nodeData, IVisibilityScene::BatchQueryMask queryMask)
+                    {
+                        singleThreaded = singleThreaded && AZStd::this_thread::get_id() == workerThread;
+                        nodeMasks.emplace(&nodeData.m_entries, queryMask);
+                    },
+                    true);
+                callbackThread = workerThread;
+            });
+        AZ::TaskGraphEvent finishedEvent{ "OctreeBatchTests Wait" };
+        graph.SubmitOnExecutor(executor, &finishedEvent);
+        finishedEvent.Wait();
+        m_octreeScene->SetTaskExecutor(nullptr);
+
+        EXPECT_NE(AZStd::this_thread::get_id(), callbackThread);
+        EXPECT_TRUE(singleThreaded);
+        EXPECT_EQ(expectedMasks, nodeMasks);
+    }
+
+    TEST_F(OctreeBatchTests, EnumerateBatch_ParallelQueryFromWorkerWhileWriterWaits_DoesNotDeadlock)
+    {
+        // Writers only get priority over readers in scenes that defer updates
+        m_console->PerformCommand("bg_octreeDeferUpdates true");
+        OctreeScene* deferredScene = azdynamic_cast<OctreeScene*>(m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("DeferredOctreeScene")));
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(m_visEntries.size());
+        for (size_t index = 0; index < visEntries.size(); ++index)
+        {
+            visEntries[index].m_boundingVolume = m_visEntries[index].m_boundingVolume;
+            deferredScene->InsertOrUpdateEntry(visEntries[index]);
+        }
+        deferredScene->ApplyPendingUpdates();
+
+        AzFramework::VisibilityEntry writerEntry;
+        writerEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.1f), AZ::Vector3(0.2f));
+        deferredScene->InsertOrUpdateEntry(writerEntry);
+
+        AZ::TaskExecutor executor(2);
+        deferredScene->SetTaskExecutor(&executor);
+
+        // The first callback running on a worker starts a writer, which waits for the shared lock held by this thread. This thread
+        // waits for the workers, so a query from the worker must not wait for the writer.
+        const AZStd::thread::id submittingThread = AZStd::this_thread::get_id();
+        AZStd::atomic_bool writerStarted{ false };
+        AZStd::atomic_bool nestedQueryStarted{ false };
+        AZStd::atomic<size_t> nestedEntryCount{ 0 };
+        AZStd::thread writer;
+        deferredScene->EnumerateBatch(
+            m_volumes,
+            [deferredScene, submittingThread, &writerStarted, &nestedQueryStarted, &nestedEntryCount, &writer](
+                const IVisibilityScene::NodeData&, IVisibilityScene::BatchQueryMask)
+            {
+                if (AZStd::this_thread::get_id() == submittingThread || nestedQueryStarted.exchange(true))
+                {
+                    return;
+                }
+                writer = AZStd::thread(
+                    [deferredScene, &writerStarted]()
+                    {
+                        writerStarted = true;
+                        deferredScene->ApplyPendingUpdates();
+                    });
+                while (!writerStarted)
+                {
+                    AZStd::this_thread::yield();
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+
+                deferredScene->EnumerateNoCull(
+                    [&nestedEntryCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                    {
+                        nestedEntryCount += nodeData.m_entries.size();
+                    });
+            },
+            true);
+        ASSERT_TRUE(writer.joinable()) << "No callback ran on a worker thread";
+        writer.join();
+        deferredScene->SetTaskExecutor(nullptr);
+
+        EXPECT_EQ(visEntries.size(), nestedEntryCount);
+        ValidateEntryCountEqualsExpectedCount(deferredScene, aznumeric_cast<uint32_t>(visEntries.size() + 1));
+
+        deferredScene->RemoveEntry(writerEntry);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            deferredScene->RemoveEntry(entry);
+        }
+        m_octreeSystemComponent->DestroyVisibilityScene(deferredScene);
+    }
+
+    TEST_F(OctreeBatchTests, EnumerateBatch_NoOverlappingVolume_CallbackNotInvoked)
+    {
+        const IVisibilityScene::BatchQueryVolume volumes[] = { AZ::Sphere(AZ::Vector3(5.0f), 1.0f),
+                                                              AZ::Aabb::CreateFromMinMax(AZ::Vector3(-4.0f), AZ::Vector3(-3.0f)) };
+        bool invoked = false;
+        m_octreeScene->EnumerateBatch(volumes, [&invoked](const IVisibilityScene::NodeData&, IVisibilityScene::BatchQueryMask)
+        {
+            invoked = true;
+        });
+        EXPECT_FALSE(invoked);
+    }
 }
@@ -6,8 +6,11 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Spawnable/SpawnableAssetHandler.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
@@ -216,6 +219,47 @@ namespace UnitTest
             return AZ::Data::Asset<AzFramework::Spawnable>(target, AZ::Data::AssetLoadBehavior::NoLoad);
         }
 
+        //! Creates a new version of the spawnable with the same prototype entity ids as FillSpawnable, but with a different asset id.
+        AZ::Data::Asset<AzFramework::Spawnable> CreatePatchedSpawnable(size_t numElements)
+        {
+            auto patched = aznew AzFramework::Spawnable(
+                AZ::Data::AssetId(AZ::Uuid("{0A6D5E8A-4C8B-4C3F-9D2E-6B1C0F7E9A31}")), AZ::Data::AssetData::AssetStatus::Ready);
+
+            AzFramework::Spawnable::EntityList& entities = patched->GetEntities();
+            entities.reserve(numElements);
+            for (size_t i = 0; i < numElements; ++i)
+            {
+                auto entry = AZStd::make_unique<AZ::Entity>();
+                entry->AddComponent(aznew SourceSpawnableComponent());
+                entry->SetId(AZ::EntityId(EntityIdStartId + i));
+                entities.push_back(AZStd::move(entry));
+            }
+
+            return AZ::Data::Asset<AzFramework::Spawnable>(patched, AZ::Data::AssetLoadBehavior::NoLoad);
+        }
+
+        //! Returns the ids of the spawned entities, ordered by the index of the prototype entity they were spawned from.
+        AZStd::vector<AZStd::pair<uint32_t, AZ::EntityId>> ListSpawnedEntities()
+        {
+            AZStd::vector<AZStd::pair<uint32_t, AZ::EntityId>> result;
+            auto callback = [&result](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstIndexEntityContainerView entities)
+            {
+                for (auto&& indexEntityPair : entities)
+                {
+                    result.emplace_back(indexEntityPair.GetIndex(), indexEntityPair.GetEntity()->GetId());
+                }
+            };
+            m_manager->ListIndicesAndEntities(*m_ticket, AZStd::move(callback));
+            ProcessQueueTillEmtpy();
+
+            AZStd::sort(result.begin(), result.end(),
+                [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first < rhs.first;
+                });
+            return result;
+        }
+
         template<size_t AliasCount>
         void InsertEntityAliases(
             const AZStd::array<uint32_t, AliasCount>& sourceIds,
@@ -631,6 +675,92 @@ namespace UnitTest
         ProcessQueueTillEmtpy();
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ParallelClone_EntityIdsAreMappedCorrectly)
+    {
+        // Entities are only cloned in parallel on an active task graph, and in batches of 64, so use enough entities for several
+        // batches and a partial one. References to the first and last entities, and the circular references at batch boundaries,
+        // cross batches that are cloned on different tasks.
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+        console->PerformCommand("cl_activateTaskGraph true");
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        ASSERT_NE(nullptr, taskGraphActiveInterface);
+        ASSERT_TRUE(taskGraphActiveInterface->IsTaskGraphActive());
+
+        constexpr size_t NumEntities = 200;
+        m_manager->SetParallelCloneThreshold(NumEntities);
+
+        for (EntityReferenceScheme refScheme : {
+                EntityReferenceScheme::AllReferenceFirst, EntityReferenceScheme::AllReferenceLast,
+                EntityReferenceScheme::AllReferenceThemselves, EntityReferenceScheme::AllReferenceNextCircular,
+                EntityReferenceScheme::AllReferencePreviousCircular })
+        {
+            delete m_ticket;
+            m_ticket = aznew AzFramework::EntitySpawnTicket(*m_spawnableAsset);
+
+            FillSpawnable(NumEntities);
+            CreateEntityReferences(refScheme);
+
+            size_t spawnedEntitiesCount = 0;
+            auto callback = [this, refScheme, &spawnedEntitiesCount]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                spawnedEntitiesCount += entities.size();
+                ValidateEntityReferences(refScheme, NumEntities, entities);
+
+                // None of the references may still point to a prototype entity.
+                for (const AZ::Entity* entity : entities)
+                {
+                    const AZ::EntityId reference = entity->FindComponent<ComponentWithEntityReference>()->m_entityReference;
+                    EXPECT_FALSE(
+                        static_cast<AZ::u64>(reference) >= EntityIdStartId &&
+                        static_cast<AZ::u64>(reference) < EntityIdStartId + NumEntities);
+                }
+            };
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = AZStd::move(callback);
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            ProcessQueueTillEmtpy();
+
+            EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        }
+
+        console->PerformCommand("cl_activateTaskGraph false");
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_SpawnTimeBudgetExceeded_EntitiesAreAddedOverMultipleCalls)
+    {
+        static constexpr size_t NumEntities = 16;
+        FillSpawnable(NumEntities);
+
+        // Use the smallest possible budget so only a single entity is added per call.
+        m_manager->SetSpawnTimeBudget(AZStd::chrono::microseconds(1));
+
+        size_t callbackCount = 0;
+        size_t spawnedEntitiesCount = 0;
+        auto callback = [&callbackCount, &spawnedEntitiesCount]
+            (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            callbackCount++;
+            spawnedEntitiesCount += entities.size();
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+
+        EXPECT_EQ(
+            AzFramework::SpawnableEntitiesManager::CommandQueueStatus::HasCommandsLeft,
+            m_manager->ProcessQueue(
+                AzFramework::SpawnableEntitiesManager::CommandQueuePriority::High |
+                AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular));
+        EXPECT_EQ(0, callbackCount);
+
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(1, callbackCount);
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_AllAliasesWithDisabled_NoEntitiesSpawned)
     {
         using namespace AzFramework;
@@ -1316,6 +1446,84 @@ namespace UnitTest
     }
 
 
+    //
+    // ApplySpawnablePatch
+    //
+
+    TEST_F(SpawnableEntitiesManagerTest, ApplySpawnablePatch_UpdateEntity_OnlyUpdatedEntityIsRespawned)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        m_manager->SpawnAllEntities(*m_ticket);
+        ProcessQueueTillEmtpy();
+        auto originalEntities = ListSpawnedEntities();
+        ASSERT_EQ(NumEntities, originalEntities.size());
+
+        size_t respawnedEntitiesCount = 0;
+        AzFramework::ApplySpawnablePatchOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback =
+            [&respawnedEntitiesCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            respawnedEntitiesCount += entities.size();
+        };
+        AzFramework::SpawnablePatch patch;
+        patch.m_updatedEntityIndices.push_back(2);
+        m_manager->ApplySpawnablePatch(*m_ticket, CreatePatchedSpawnable(NumEntities), AZStd::move(patch), AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(1, respawnedEntitiesCount);
+        auto patchedEntities = ListSpawnedEntities();
+        ASSERT_EQ(NumEntities, patchedEntities.size());
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            EXPECT_EQ(i, patchedEntities[i].first);
+            if (i == 2)
+            {
+                EXPECT_NE(originalEntities[i].second, patchedEntities[i].second);
+            }
+            else
+            {
+                EXPECT_EQ(originalEntities[i].second, patchedEntities[i].second);
+            }
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, ApplySpawnablePatch_AddAndRemoveEntities_EntitiesAreSpawnedAndDespawned)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        m_manager->SpawnAllEntities(*m_ticket);
+        ProcessQueueTillEmtpy();
+
+        // The new version drops the first entity, so all remaining prototypes move down by one and a new prototype is added at the end.
+        AZ::Data::Asset<AzFramework::Spawnable> patchedSpawnable = CreatePatchedSpawnable(NumEntities + 1);
+        patchedSpawnable->GetEntities().erase(patchedSpawnable->GetEntities().begin());
+
+        AzFramework::SpawnablePatch patch;
+        patch.m_removedEntityIds.push_back(AZ::EntityId(EntityIdStartId));
+        patch.m_updatedEntityIndices.push_back(NumEntities - 1);
+        m_manager->ApplySpawnablePatch(*m_ticket, patchedSpawnable, AZStd::move(patch));
+        ProcessQueueTillEmtpy();
+
+        auto patchedEntities = ListSpawnedEntities();
+        ASSERT_EQ(NumEntities, patchedEntities.size());
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            EXPECT_EQ(i, patchedEntities[i].first);
+        }
+        EXPECT_EQ(patchedSpawnable.GetId(), m_ticket->GetSpawnable()->GetId());
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, ApplySpawnablePatch_DeleteTicketBeforeCall_NoCrash)
+    {
+        {
+            AzFramework::EntitySpawnTicket ticket(*m_spawnableAsset);
+            m_manager->ApplySpawnablePatch(ticket, *m_spawnableAsset, AzFramework::SpawnablePatch{});
+        }
+        ProcessQueueTillEmtpy();
+    }
+
+
     //
     // ListEntitities
     //
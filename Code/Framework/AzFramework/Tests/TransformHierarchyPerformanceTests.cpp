@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Compares the batched TransformHierarchy update with the event driven propagation of the transform components, where each
+    // node updates its children from its own change notification.
+    // The argument selects the shape of the hierarchy:
+    //  0 - Deep: 10 chains of 1000 nodes.
+    //  1 - Wide: 1 root with 10000 children.
+    //  2 - Tree: 8 levels with 4 children per node, 21845 nodes.
+    class BM_TransformHierarchy
+        : public benchmark::Fixture
+    {
+        // A node of the event driven reference, allocated separately like the transform components.
+        struct EventNode
+        {
+            virtual ~EventNode() = default;
+
+            virtual void OnParentTransformChanged(const AZ::Transform& parentWorldTM)
+            {
+                m_worldTM = parentWorldTM * m_localTM;
+                for (EventNode* child : m_children)
+                {
+                    child->OnParentTransformChanged(m_worldTM);
+                }
+            }
+
+            AZ::Transform m_localTM = AZ::Transform::CreateIdentity();
+            AZ::Transform m_worldTM = AZ::Transform::CreateIdentity();
+            AZStd::vector<EventNode*> m_children;
+        };
+
+        struct HierarchyNode
+            : public AzFramework::TransformHierarchyListener
+        {
+            void OnHierarchyTransformsUpdated(const AZ::Transform& localTM, const AZ::Transform& worldTM) override
+            {
+                m_localTM = localTM;
+                m_worldTM = worldTM;
+            }
+            void OnHierarchyTransformChanged() override
+            {
+                ++m_changeCount;
+            }
+            void OnHierarchyDisconnected() override
+            {
+            }
+
+            AZ::Transform m_localTM = AZ::Transform::CreateIdentity();
+            AZ::Transform m_worldTM = AZ::Transform::CreateIdentity();
+            uint32_t m_changeCount = 0;
+        };
+
+        void internalSetUp(const benchmark::State& state)
+        {
+            AZStd::vector<int> parents;
+            switch (state.range(0))
+            {
+            case 0:
+                for (int chain = 0; chain < 10; ++chain)
+                {
+                    for (int depth = 0; depth < 1000; ++depth)
+                    {
+                        parents.push_back(depth == 0 ? -1 : static_cast<int>(parents.size()) - 1);
+                    }
+                }
+                break;
+            case 1:
+                parents.resize(10001, 0);
+                parents[0] = -1;
+                break;
+            default:
+                parents.push_back(-1);
+                for (size_t node = 0; parents.size() < 21845; ++node)
+                {
+                    for (int child = 0; child < 4; ++child)
+                    {
+                        parents.push_back(static_cast<int>(node));
+                    }
+                }
+                break;
+            }
+
+            const AZ::Transform localTM = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(0.01f), AZ::Vector3(0.1f, 0.0f, 0.0f));
+
+            m_hierarchy = AZStd::make_unique<AzFramework::TransformHierarchy>();
+            m_hierarchyNodes.resize(parents.size());
+            m_handles.resize(parents.size());
+            m_eventNodes.resize(parents.size());
+            for (size_t i = 0; i < parents.size(); ++i)
+            {
+                m_eventNodes[i] = AZStd::make_unique<EventNode>();
+                m_eventNodes[i]->m_localTM = localTM;
+                m_hierarchyNodes[i].m_localTM = localTM;
+                m_handles[i] = m_hierarchy->AddNode(&m_hierarchyNodes[i], localTM, localTM);
+                if (parents[i] < 0)
+                {
+                    m_roots.push_back(i);
+                }
+                else
+                {
+                    m_eventNodes[parents[i]]->m_children.push_back(m_eventNodes[i].get());
+                    m_hierarchy->SetNodeParent(m_handles[i], m_handles[parents[i]]);
+                }
+            }
+
+            // Sort the hierarchy once, so the benchmarks only measure the updates
+            MoveRoots(AZ::Transform::CreateIdentity());
+            m_hierarchy->UpdateTransforms();
+        }
+
+        void internalTearDown()
+        {
+            m_hierarchy.reset();
+            m_hierarchyNodes = {};
+            m_handles = {};
+            m_eventNodes = {};
+            m_roots = {};
+            m_executor.reset();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void MoveRoots(const AZ::Transform& worldTM)
+        {
+            for (size_t root : m_roots)
+            {
+                m_hierarchy->SetNodeTransforms(m_handles[root], m_hierarchyNodes[root].m_localTM, worldTM);
+            }
+        }
+
+        AZStd::unique_ptr<AzFramework::TransformHierarchy> m_hierarchy;
+        AZStd::vector<HierarchyNode> m_hierarchyNodes;
+        AZStd::vector<AzFramework::TransformHierarchy::NodeHandle> m_handles;
+        AZStd::vector<AZStd::unique_ptr<EventNode>> m_eventNodes;
+        AZStd::vector<size_t> m_roots;
+        AZStd::unique_ptr<AZ::TaskExecutor> m_executor;
+    };
+
+    BENCHMARK_DEFINE_F(BM_TransformHierarchy, EventDrivenPropagation)(benchmark::State& state)
+    {
+        float offset = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const AZ::Transform worldTM = AZ::Transform::CreateTranslation(AZ::Vector3(offset += 1.0f, 0.0f, 0.0f));
+            for (size_t root : m_roots)
+            {
+                EventNode& node = *m_eventNodes[root];
+                node.m_worldTM = worldTM;
+                for (EventNode* child : node.m_children)
+                {
+                    child->OnParentTransformChanged(node.m_worldTM);
+                }
+            }
+            benchmark::DoNotOptimize(m_eventNodes.back()->m_worldTM);
+        }
+        state.SetItemsProcessed(state.iterations() * m_eventNodes.size());
+    }
+    BENCHMARK_REGISTER_F(BM_TransformHierarchy, EventDrivenPropagation)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BM_TransformHierarchy, BatchedUpdate)(benchmark::State& state)
+    {
+        float offset = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveRoots(AZ::Transform::CreateTranslation(AZ::Vector3(offset += 1.0f, 0.0f, 0.0f)));
+            m_hierarchy->UpdateTransforms();
+            benchmark::DoNotOptimize(m_hierarchyNodes.back().m_worldTM);
+        }
+        state.SetItemsProcessed(state.iterations() * m_hierarchyNodes.size());
+    }
+    BENCHMARK_REGISTER_F(BM_TransformHierarchy, BatchedUpdate)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BM_TransformHierarchy, BatchedUpdateParallel)(benchmark::State& state)
+    {
+        m_executor = AZStd::make_unique<AZ::TaskExecutor>();
+        m_hierarchy->SetTaskExecutor(m_executor.get());
+
+        float offset = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MoveRoots(AZ::Transform::CreateTranslation(AZ::Vector3(offset += 1.0f, 0.0f, 0.0f)));
+            m_hierarchy->UpdateTransforms();
+            benchmark::DoNotOptimize(m_hierarchyNodes.back().m_worldTM);
+        }
+        state.SetItemsProcessed(state.iterations() * m_hierarchyNodes.size());
+
+        m_hierarchy->SetTaskExecutor(nullptr);
+    }
+    BENCHMARK_REGISTER_F(BM_TransformHierarchy, BatchedUpdateParallel)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif
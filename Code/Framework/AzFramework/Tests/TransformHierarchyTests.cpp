@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+using namespace AzFramework;
+
+namespace UnitTest
+{
+    class TransformHierarchyTests
+        : public LeakDetectionFixture
+    {
+    public:
+        struct TestNode
+            : public TransformHierarchyListener
+        {
+            void OnHierarchyTransformsUpdated(const AZ::Transform& localTM, const AZ::Transform& worldTM) override
+            {
+                m_localTM = localTM;
+                m_worldTM = worldTM;
+            }
+
+            void OnHierarchyTransformChanged() override
+            {
+                m_notifications->push_back(m_id);
+            }
+
+            void OnHierarchyDisconnected() override
+            {
+                m_handle = TransformHierarchy::InvalidNodeHandle;
+            }
+
+            int m_id = 0;
+            AZStd::vector<int>* m_notifications = nullptr;
+            AZ::Transform m_localTM = AZ::Transform::CreateIdentity();
+            AZ::Transform m_worldTM = AZ::Transform::CreateIdentity();
+            TransformHierarchy::NodeHandle m_handle = TransformHierarchy::InvalidNodeHandle;
+        };
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_hierarchy = AZStd::make_unique<TransformHierarchy>();
+        }
+
+        void TearDown() override
+        {
+            m_hierarchy.reset();
+            m_nodes.clear();
+            m_nodes.shrink_to_fit();
+            m_notifications.clear();
+            m_notifications.shrink_to_fit();
+            LeakDetectionFixture::TearDown();
+        }
+
+        // Adds nodes with the given parent indices, -1 for root nodes. All local transforms are a translation along x.
+        void CreateNodes(const AZStd::vector<int>& parents)
+        {
+            m_nodes.resize(parents.size());
+            for (size_t i = 0; i < parents.size(); ++i)
+            {
+                TestNode& node = m_nodes[i];
+                node.m_id = static_cast<int>(i);
+                node.m_notifications = &m_notifications;
+                node.m_localTM = AZ::Transform::CreateTranslation(AZ::Vector3::CreateAxisX(1.0f));
+                node.m_worldTM = parents[i] < 0 ? node.m_localTM : m_nodes[parents[i]].m_worldTM * node.m_localTM;
+                node.m_handle = m_hierarchy->AddNode(&node, node.m_localTM, node.m_worldTM);
+            }
+            for (size_t i = 0; i < parents.size(); ++i)
+            {
+                if (parents[i] >= 0)
+                {
+                    m_hierarchy->SetNodeParent(m_nodes[i].m_handle, m_nodes[parents[i]].m_handle);
+                }
+            }
+        }
+
+        void MoveNode(int index, const AZ::Transform& worldTM)
+        {
+            TestNode& node = m_nodes[index];
+            node.m_worldTM = worldTM;
+            m_hierarchy->SetNodeTransforms(node.m_handle, node.m_localTM, node.m_worldTM);
+        }
+
+        AZStd::unique_ptr<TransformHierarchy> m_hierarchy;
+        AZStd::vector<TestNode> m_nodes;
+        AZStd::vector<int> m_notifications;
+    };
+
+    TEST_F(TransformHierarchyTests, UpdateTransforms_RootMoved_DescendantsUpdatedAndNotifiedInDepthOrder)
+    {
+        // 0 -> 1 -> 3
+        //   -> 2
+        CreateNodes({ -1, 0, 0, 1 });
+        m_hierarchy->UpdateTransforms();
+        EXPECT_FALSE(m_hierarchy->HasPendingUpdates());
+
+        const AZ::Transform rootTM = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(AZ::Constants::HalfPi), AZ::Vector3(10.0f, 0.0f, 0.0f));
+        MoveNode(0, rootTM);
+        EXPECT_TRUE(m_hierarchy->HasPendingUpdates());
+        m_hierarchy->UpdateTransforms();
+
+        const AZ::Transform offset = AZ::Transform::CreateTranslation(AZ::Vector3::CreateAxisX(1.0f));
+        EXPECT_THAT(m_nodes[1].m_worldTM, IsClose(rootTM * offset));
+        EXPECT_THAT(m_nodes[2].m_worldTM, IsClose(rootTM * offset));
+        EXPECT_THAT(m_nodes[3].m_worldTM, IsClose(rootTM * offset * offset));
+        EXPECT_THAT(m_hierarchy->GetNodeWorldTM(m_nodes[3].m_handle), IsClose(rootTM * offset * offset));
+        EXPECT_THAT(m_notifications, ::testing::ElementsAre(1, 2, 3));
+        EXPECT_FALSE(m_hierarchy->HasPendingUpdates());
+    }
+
+    TEST_F(TransformHierarchyTests, UpdateTransforms_InnerNodeMoved_OnlySubtreeUpdated)
+    {
+        CreateNodes({ -1, 0, 0, 1, 2 });
+        MoveNode(1, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 5.0f, 0.0f)));
+        m_hierarchy->UpdateTransforms();
+
+        EXPECT_THAT(m_nodes[3].m_worldTM.GetTranslation(), IsClose(AZ::Vector3(1.0f, 5.0f, 0.0f)));
+        EXPECT_THAT(m_nodes[4].m_worldTM.GetTranslation(), IsClose(AZ::Vector3(3.0f, 0.0f, 0.0f)));
+        EXPECT_THAT(m_notifications, ::testing::ElementsAre(3));
+    }
+
+    TEST_F(TransformHierarchyTests, UpdateTransforms_KeepWorldTM_LocalRecomputedWithoutNotification)
+    {
+        CreateNodes({ -1, 0, 1 });
+        m_hierarchy->SetNodeKeepWorldTM(m_nodes[1].m_handle, true);
+        const AZ::Transform childWorldTM = m_nodes[1].m_worldTM;
+        const AZ::Transform grandChildWorldTM = m_nodes[2].m_worldTM;
+
+        MoveNode(0, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 3.0f)));
+        m_hierarchy->UpdateTransforms();
+
+        EXPECT_THAT(m_nodes[1].m_worldTM, IsClose(childWorldTM));
+        EXPECT_THAT(m_nodes[1].m_localTM.GetTranslation(), IsClose(AZ::Vector3(2.0f, 0.0f, -3.0f)));
+        EXPECT_THAT(m_nodes[2].m_worldTM, IsClose(grandChildWorldTM));
+        EXPECT_TRUE(m_notifications.empty());
+    }
+
+    TEST_F(TransformHierarchyTests, UpdateNodeIfStale_AncestorMoved_UpdatesBeforeTick)
+    {
+        CreateNodes({ -1, 0, 1, -1 });
+        MoveNode(0, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 1.0f, 0.0f)));
+
+        EXPECT_FALSE(m_hierarchy->IsNodeStale(m_nodes[0].m_handle));
+        EXPECT_FALSE(m_hierarchy->IsNodeStale(m_nodes[3].m_handle));
+        EXPECT_TRUE(m_hierarchy->IsNodeStale(m_nodes[2].m_handle));
+
+        m_hierarchy->UpdateNodeIfStale(m_nodes[3].m_handle);
+        EXPECT_TRUE(m_hierarchy->HasPendingUpdates());
+
+        m_hierarchy->UpdateNodeIfStale(m_nodes[2].m_handle);
+        EXPECT_FALSE(m_hierarchy->HasPendingUpdates());
+        EXPECT_FALSE(m_hierarchy->IsNodeStale(m_nodes[2].m_handle));
+        EXPECT_THAT(m_nodes[2].m_worldTM.GetTranslation(), IsClose(AZ::Vector3(2.0f, 1.0f, 0.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, UpdateNodeIfStale_FromOtherThreads_KeepsStoredTransformsUntilUpdated)
+    {
+        CreateNodes({ -1, 0, 1, 2 });
+        const AZ::Vector3 staleTranslation = m_nodes[3].m_worldTM.GetTranslation();
+        MoveNode(0, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 1.0f, 0.0f)));
+        ASSERT_TRUE(m_hierarchy->HasPendingUpdates());
+
+        // Readers on other threads must not run the update, which modifies the hierarchy and notifies the listeners
+        constexpr int ReaderCount = 4;
+        AZStd::atomic_int staleReads{ 0 };
+        AZStd::vector<AZStd::thread> readers;
+        for (int reader = 0; reader < ReaderCount; ++reader)
+        {
+            readers.emplace_back(
+                [this, &staleReads, staleTranslation]()
+                {
+                    for (int read = 0; read < 100; ++read)
+                    {
+                        m_hierarchy->UpdateNodeIfStale(m_nodes[3].m_handle);
+                        if (m_hierarchy->GetNodeWorldTM(m_nodes[3].m_handle).GetTranslation().IsClose(staleTranslation))
+                        {
+                            ++staleReads;
+                        }
+                    }
+                });
+        }
+        for (AZStd::thread& reader : readers)
+        {
+            reader.join();
+        }
+
+        EXPECT_EQ(ReaderCount * 100, staleReads);
+        EXPECT_TRUE(m_hierarchy->HasPendingUpdates());
+        EXPECT_TRUE(m_notifications.empty());
+
+        // The thread owning the hierarchy still brings the node up to date
+        m_hierarchy->UpdateNodeIfStale(m_nodes[3].m_handle);
+        EXPECT_FALSE(m_hierarchy->HasPendingUpdates());
+        EXPECT_THAT(m_nodes[3].m_worldTM.GetTranslation(), IsClose(AZ::Vector3(3.0f, 1.0f, 0.0f)));
+        EXPECT_THAT(m_notifications, ::testing::ElementsAre(1, 2, 3));
+    }
+
+    TEST_F(TransformHierarchyTests, SetNodeParent_ParentAddedAfterChild_UpdatesInDepthOrder)
+    {
+        // Each node is parented to the node added after it, so the levels are the reverse of the insertion order.
+        CreateNodes({ 1, 2, 3, -1 });
+        MoveNode(3, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 1.0f)));
+        m_hierarchy->UpdateTransforms();
+
+        EXPECT_THAT(m_nodes[0].m_worldTM.GetTranslation(), IsClose(AZ::Vector3(3.0f, 0.0f, 1.0f)));
+        EXPECT_THAT(m_notifications, ::testing::ElementsAre(2, 1, 0));
+    }
+
+    TEST_F(TransformHierarchyTests, RemoveNode_NodeWithChildren_ChildrenBecomeRoots)
+    {
+        CreateNodes({ -1, 0, 1 });
+        m_hierarchy->RemoveNode(m_nodes[1].m_handle);
+        EXPECT_EQ(2, m_hierarchy->GetNodeCount());
+
+        MoveNode(0, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 1.0f)));
+        m_hierarchy->UpdateTransforms();
+        EXPECT_TRUE(m_notifications.empty());
+        EXPECT_THAT(m_nodes[2].m_worldTM.GetTranslation(), IsClose(AZ::Vector3(3.0f, 0.0f, 0.0f)));
+
+        // The handle of the removed node stays invalid after its record is reused
+        const TransformHierarchy::NodeHandle newNode =
+            m_hierarchy->AddNode(nullptr, AZ::Transform::CreateIdentity(), AZ::Transform::CreateIdentity());
+        EXPECT_NE(newNode, m_nodes[1].m_handle);
+        EXPECT_EQ(3, m_hierarchy->GetNodeCount());
+    }
+
+    TEST_F(TransformHierarchyTests, UpdateTransforms_WideLevelOnTaskExecutor_MatchesSequentialUpdate)
+    {
+        constexpr int ChildCount = 10000;
+        AZStd::vector<int> parents(ChildCount + 1, 0);
+        parents[0] = -1;
+        CreateNodes(parents);
+        for (int i = 1; i <= ChildCount; ++i)
+        {
+            m_nodes[i].m_localTM = AZ::Transform::CreateTranslation(AZ::Vector3(static_cast<float>(i), 0.0f, 0.0f));
+            m_hierarchy->SetNodeTransforms(m_nodes[i].m_handle, m_nodes[i].m_localTM, m_nodes[i].m_localTM, false);
+        }
+
+        AZ::TaskExecutor executor(2);
+        m_hierarchy->SetTaskExecutor(&executor);
+        const AZ::Transform rootTM = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationX(1.0f), AZ::Vector3(0.0f, 2.0f, 0.0f));
+        MoveNode(0, rootTM);
+        m_hierarchy->UpdateTransforms();
+        m_hierarchy->SetTaskExecutor(nullptr);
+
+        ASSERT_EQ(ChildCount, m_notifications.size());
+        for (int i = 1; i <= ChildCount; ++i)
+        {
+            EXPECT_THAT(m_nodes[i].m_worldTM, IsClose(rootTM * m_nodes[i].m_localTM));
+            EXPECT_EQ(i, m_notifications[i - 1]);
+        }
+    }
+
+    TEST_F(TransformHierarchyTests, Disconnect_NodesRemaining_ListenersNotified)
+    {
+        CreateNodes({ -1, 0 });
+        m_hierarchy->Connect();
+        EXPECT_EQ(m_hierarchy.get(), AZ::Interface<TransformHierarchy>::Get());
+
+        m_hierarchy->Disconnect();
+        EXPECT_EQ(nullptr, AZ::Interface<TransformHierarchy>::Get());
+        EXPECT_EQ(0, m_hierarchy->GetNodeCount());
+        EXPECT_EQ(TransformHierarchy::InvalidNodeHandle, m_nodes[0].m_handle);
+        EXPECT_EQ(TransformHierarchy::InvalidNodeHandle, m_nodes[1].m_handle);
+    }
+} // namespace UnitTest
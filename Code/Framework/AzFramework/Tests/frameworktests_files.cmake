@@ -25,6 +25,8 @@ set(FILES
     GenAppDescriptors.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
+    TransformHierarchyPerformanceTests.cpp
+    TransformHierarchyTests.cpp
     AssetCatalog.cpp
     AssetProcessorConnection.cpp
     ProcessLaunchParseTests.cpp
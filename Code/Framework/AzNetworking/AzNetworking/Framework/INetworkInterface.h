@@ -74,6 +74,10 @@ namespace AzNetworking
         //! Updates the INetworkInterface.
         virtual void Update() = 0;
 
+        //! Transmits any outgoing packets this network interface has queued up for batched sending.
+        //! Network interfaces that transmit packets immediately treat this as a no-op.
+        virtual void FlushSends() = 0;
+
         //! A helper function that transmits a packet on this connection reliably.
         //! Note that a packetId is not returned here, since retransmits may cause the packetId to change
         //! @param connectionId identifier of the connection to send to
@@ -68,10 +68,12 @@ namespace AzNetworking
     void NetworkingSystemComponent::Activate()
     {
         AZ::SystemTickBus::Handler::BusConnect();
+        AZ::TickBus::Handler::BusConnect();
     }
 
     void NetworkingSystemComponent::Deactivate()
     {
+        AZ::TickBus::Handler::BusDisconnect();
         AZ::SystemTickBus::Handler::BusDisconnect();
     }
 
@@ -84,6 +86,20 @@ namespace AzNetworking
         }
     }
 
+    void NetworkingSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        // Packets sent by game systems during the tick are queued on the sockets, send them all out at the end of the frame
+        for (auto& networkInterface : m_networkInterfaces)
+        {
+            networkInterface.second->FlushSends();
+        }
+    }
+
+    int NetworkingSystemComponent::GetTickOrder()
+    {
+        return AZ::TICK_LAST;
+    }
+
     INetworkInterface* NetworkingSystemComponent::CreateNetworkInterface(const AZ::Name& name, ProtocolType protocolType, TrustZone trustZone, IConnectionListener& listener)
     {
         AZ_Assert(RetrieveNetworkInterface(name) == nullptr, "A network interface with this name already exists");
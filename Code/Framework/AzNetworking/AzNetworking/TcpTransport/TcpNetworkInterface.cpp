@@ -105,6 +105,12 @@ namespace AzNetworking
         return connectionId;
     }
 
+    void TcpNetworkInterface::FlushSends()
+    {
+        // Tcp sends are handed to the socket immediately, nothing to flush
+        ;
+    }
+
     void TcpNetworkInterface::Update()
     {
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
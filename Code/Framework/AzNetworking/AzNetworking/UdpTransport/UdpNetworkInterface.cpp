@@ -180,6 +180,9 @@ namespace AzNetworking
             return;
         }
 
+        // Push out anything that was queued on the socket since the last update, such as connection handshakes
+        m_socket->FlushSends();
+
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
         if (packets == nullptr)
@@ -346,6 +349,9 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        // Transmit acks, retransmits and disconnects generated during this update in a single batch
+        m_socket->FlushSends();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -358,6 +364,11 @@ namespace AzNetworking
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void UdpNetworkInterface::FlushSends()
+    {
+        m_socket->FlushSends();
+    }
+
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AzNetworking
 {
@@ -176,7 +177,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +185,45 @@ namespace AzNetworking
                     break;
                 }
 
-                uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                if (receivedPackets.full())
+                {
+                    break;
+                }
+
+                // Read as many datagrams as fit in both the receive buffer and the packet list in a single call
+                const uint32_t bufferSlots = static_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t packetSlots = static_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t batchCount = AZStd::min(AZStd::min(bufferSlots, packetSlots), UdpSocket::MaxBatchedDatagrams);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                uint8_t* batchData = receiveBuffer.GetBufferEnd();
+                receiveBuffer.Resize(bufferHead + batchCount * MaxUdpTransmissionUnit);
+
+                AZStd::array<UdpSocket::ReceivedDatagram, UdpSocket::MaxBatchedDatagrams> datagrams;
+                const uint32_t receivedCount = socket->ReceiveBatch(datagrams.data(), batchData, MaxUdpTransmissionUnit, batchCount);
+
+                // Pack the received datagrams together so small packets don't use up an entire MTU worth of the buffer
+                uint8_t* dstData = batchData;
+                for (uint32_t i = 0; i < receivedCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    const int32_t receivedBytes = datagrams[i].m_receivedBytes;
+                    if (receivedBytes <= 0)
+                    {
+                        continue;
+                    }
+
+                    const uint8_t* srcData = batchData + i * MaxUdpTransmissionUnit;
+                    if (dstData != srcData)
+                    {
+                        memmove(dstData, srcData, receivedBytes);
+                    }
+                    receivedPackets.push_back(ReceivedPacket(datagrams[i].m_address, dstData, receivedBytes));
+                    dstData += receivedBytes;
                 }
-                else
+                receiveBuffer.Resize(bufferHead + static_cast<uint32_t>(dstData - batchData));
+
+                if (receivedCount < batchCount)
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has been drained
                     break;
                 }
             }
@@ -23,6 +23,7 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchSocketIo, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, UDP sockets will send and receive multiple datagrams per system call on platforms that support it");
 
     UdpSocket::~UdpSocket()
     {
@@ -96,6 +97,9 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        // Make sure any queued payloads, such as disconnect notifications, make it out before the socket closes
+        FlushSends();
+
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -223,9 +227,104 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    uint32_t UdpSocket::ReceiveBatch(ReceivedDatagram* outDatagrams, uint8_t* outData, uint32_t size, uint32_t maxCount) const
+    {
+        AZ_Assert(size > 0, "Invalid data size for receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to receive");
+        AZ_Assert(maxCount <= MaxBatchedDatagrams, "Requested more datagrams than a single batch supports");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (net_UdpBatchSocketIo)
+        {
+            const uint32_t count = AZStd::min(maxCount, MaxBatchedDatagrams);
+            mmsghdr messages[MaxBatchedDatagrams];
+            iovec buffers[MaxBatchedDatagrams];
+            sockaddr_in addresses[MaxBatchedDatagrams];
+            memset(messages, 0, sizeof(mmsghdr) * count);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                buffers[i].iov_base = outData + i * size;
+                buffers[i].iov_len = size;
+                messages[i].msg_hdr.msg_name = &addresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int32_t receivedCount = recvmmsg(static_cast<int32_t>(m_socketFd), messages, count, 0, nullptr);
+            if (receivedCount < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+
+                bool ignoreForciblyClosedError = false;
+                if (!ErrorIsWouldBlock(error) && !ErrorIsForciblyClosed(error, ignoreForciblyClosedError)) // Filter would block messages
+                {
+                    AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+                return 0;
+            }
+
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                outDatagrams[i].m_address = IpAddress(ByteOrder::Network, addresses[i].sin_addr.s_addr, addresses[i].sin_port);
+                outDatagrams[i].m_receivedBytes = static_cast<int32_t>(messages[i].msg_len);
+                m_recvPackets++;
+                m_recvBytes += messages[i].msg_len;
+            }
+            return static_cast<uint32_t>(receivedCount);
+        }
+#endif
+
+        uint32_t receivedCount = 0;
+        while (receivedCount < maxCount)
+        {
+            ReceivedDatagram& datagram = outDatagrams[receivedCount];
+            datagram.m_receivedBytes = Receive(datagram.m_address, outData + receivedCount * size, size);
+            if (datagram.m_receivedBytes <= 0)
+            {
+                break;
+            }
+            ++receivedCount;
+        }
+        return receivedCount;
+    }
+
+    void UdpSocket::FlushSends() const
+    {
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        AZStd::scoped_lock<AZStd::mutex> lock(m_sendBatchMutex);
+        FlushSendBatch();
+#endif
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (net_UdpBatchSocketIo && size <= MaxUdpTransmissionUnit)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_sendBatchMutex);
+            if (m_queuedSends.full() || (m_sendBatchBuffer.GetSize() + size > m_sendBatchBuffer.GetCapacity()))
+            {
+                FlushSendBatch();
+            }
+
+            const uint32_t offset = static_cast<uint32_t>(m_sendBatchBuffer.GetSize());
+            m_sendBatchBuffer.Resize(offset + size);
+            memcpy(m_sendBatchBuffer.GetBuffer() + offset, data, size);
+            m_queuedSends.push_back(QueuedSend{ address, offset, size });
+            return static_cast<int32_t>(size);
+        }
+
+        // Payloads that don't fit a batch slot are sent right away, send everything queued before them first to preserve ordering
+        FlushSends();
+#endif
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -234,6 +333,58 @@ namespace AzNetworking
         return static_cast<int32_t>(sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr)));
     }
 
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+    void UdpSocket::FlushSendBatch() const
+    {
+        const uint32_t count = static_cast<uint32_t>(m_queuedSends.size());
+        if (count > 0 && IsOpen())
+        {
+            mmsghdr messages[MaxBatchedDatagrams];
+            iovec buffers[MaxBatchedDatagrams];
+            sockaddr_in addresses[MaxBatchedDatagrams];
+            memset(messages, 0, sizeof(mmsghdr) * count);
+            memset(addresses, 0, sizeof(sockaddr_in) * count);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const QueuedSend& queuedSend = m_queuedSends[i];
+                addresses[i].sin_family = AF_INET;
+                addresses[i].sin_addr.s_addr = queuedSend.m_address.GetAddress(ByteOrder::Network);
+                addresses[i].sin_port = queuedSend.m_address.GetPort(ByteOrder::Network);
+                buffers[i].iov_base = m_sendBatchBuffer.GetBuffer() + queuedSend.m_offset;
+                buffers[i].iov_len = queuedSend.m_size;
+                messages[i].msg_hdr.msg_name = &addresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            uint32_t sentCount = 0;
+            while (sentCount < count)
+            {
+                const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, count - sentCount, 0);
+                if (result < 0)
+                {
+                    const int32_t error = GetLastNetworkError();
+                    if (ErrorIsWouldBlock(error)) // Filter would block messages
+                    {
+                        // The send buffer is full, drop the remaining payloads the same way an unbatched send would
+                        break;
+                    }
+
+                    // Skip the payload that failed so a single bad address doesn't drop the entire batch
+                    AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                    ++sentCount;
+                    continue;
+                }
+                sentCount += static_cast<uint32_t>(result);
+            }
+        }
+
+        m_queuedSends.clear();
+        m_sendBatchBuffer.Resize(0);
+    }
+#endif
+
 #ifdef ENABLE_LATENCY_DEBUG
     int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
     {
@@ -14,6 +14,7 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +43,16 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! The maximum number of payloads sent or received by a single batched socket call.
+        static constexpr uint32_t MaxBatchedDatagrams = 64;
+
+        //! Address and size of a single payload received by ReceiveBatch.
+        struct ReceivedDatagram
+        {
+            IpAddress m_address;
+            int32_t   m_receivedBytes = 0;
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -93,6 +104,18 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param outDatagrams on success, the address and size of each received payload
+        //! @param outData      address to write the received data to, payload i is written to outData + i * size
+        //! @param size         maximum size of a single payload in bytes
+        //! @param maxCount     maximum number of payloads to receive, at most MaxBatchedDatagrams
+        //! @return number of payloads received, 0 if no data was available or on error
+        uint32_t ReceiveBatch(ReceivedDatagram* outDatagrams, uint8_t* outData, uint32_t size, uint32_t maxCount) const;
+
+        //! Transmits all payloads queued by Send since the last flush.
+        //! Payloads are only queued on platforms that support batched socket calls and while net_UdpBatchSocketIo is enabled.
+        void FlushSends() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -136,6 +159,22 @@ namespace AzNetworking
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
 
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        struct QueuedSend
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
+        //! Sends all queued payloads, m_sendBatchMutex must be locked by the caller.
+        void FlushSendBatch() const;
+
+        mutable AZStd::mutex m_sendBatchMutex;
+        mutable AZStd::fixed_vector<QueuedSend, MaxBatchedDatagrams> m_queuedSends;
+        mutable ByteBuffer<MaxBatchedDatagrams * MaxUdpTransmissionUnit> m_sendBatchBuffer;
+#endif
+
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
         {
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Sends packets between two UDP sockets over loopback to measure the number of packets per second the socket layer can move.
+    //! Both benchmarks report the rate as the PacketsPerSecond counter.
+    class BM_UdpSocket
+        : public benchmark::Fixture
+    {
+    public:
+        static constexpr uint16_t SenderPort = 45320;
+        static constexpr uint16_t ReceiverPort = 45321;
+        static constexpr uint32_t PacketSize = 256;
+
+        void internalSetUp()
+        {
+            m_console = AZStd::make_unique<AZ::Console>();
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+
+            SocketLayerInit();
+            m_sender.Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+            m_payload.fill(0xA5);
+        }
+
+        void internalTearDown()
+        {
+            m_sender.Close();
+            m_receiver.Close();
+            SocketLayerShutdown();
+
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console = nullptr;
+        }
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        //! Sends packetCount packets, flushing the sender after every flushInterval packets, and reads them back in reads of at
+        //! most receiveCount packets. Returns the number of packets that were received.
+        int64_t SendAndReceive(uint32_t packetCount, uint32_t flushInterval, uint32_t receiveCount)
+        {
+            const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+            for (uint32_t i = 0; i < packetCount; ++i)
+            {
+                m_sender.Send(receiverAddress, m_payload.data(), PacketSize, false, m_dtlsEndpoint, m_connectionQuality);
+                if ((i + 1) % flushInterval == 0)
+                {
+                    m_sender.FlushSends();
+                }
+            }
+            m_sender.FlushSends();
+
+            int64_t receivedPackets = 0;
+            while (receivedPackets < packetCount)
+            {
+                const uint32_t receivedCount = m_receiver.ReceiveBatch(m_datagrams.data(), m_receiveBuffer.data(), MaxUdpTransmissionUnit, receiveCount);
+                if (receivedCount == 0)
+                {
+                    // Anything that didn't arrive by now was dropped by the socket layer
+                    break;
+                }
+                receivedPackets += receivedCount;
+            }
+            return receivedPackets;
+        }
+
+        static void ReportPacketRate(benchmark::State& state, int64_t receivedPackets)
+        {
+            state.SetItemsProcessed(receivedPackets);
+            state.counters["PacketsPerSecond"] = benchmark::Counter(aznumeric_cast<double>(receivedPackets), benchmark::Counter::kIsRate);
+        }
+
+        AZStd::unique_ptr<AZ::Console> m_console;
+        UdpSocket m_sender;
+        UdpSocket m_receiver;
+        DtlsEndpoint m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+        AZStd::array<uint8_t, PacketSize> m_payload;
+        AZStd::array<UdpSocket::ReceivedDatagram, UdpSocket::MaxBatchedDatagrams> m_datagrams;
+        AZStd::array<uint8_t, UdpSocket::MaxBatchedDatagrams * MaxUdpTransmissionUnit> m_receiveBuffer;
+    };
+
+    BENCHMARK_DEFINE_F(BM_UdpSocket, SendReceivePerPacket)(benchmark::State& state)
+    {
+        // Baseline without batched socket calls, every packet is sent with sendto and received with recvfrom
+        m_console->PerformCommand("net_UdpBatchSocketIo false");
+
+        const uint32_t packetCount = aznumeric_cast<uint32_t>(state.range(0));
+        int64_t receivedPackets = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            receivedPackets += SendAndReceive(packetCount, 1, 1);
+        }
+        ReportPacketRate(state, receivedPackets);
+
+        m_console->PerformCommand("net_UdpBatchSocketIo true");
+    }
+    BENCHMARK_REGISTER_F(BM_UdpSocket, SendReceivePerPacket)
+        ->Arg(8)
+        ->Arg(64)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(BM_UdpSocket, SendReceiveBatched)(benchmark::State& state)
+    {
+        m_console->PerformCommand("net_UdpBatchSocketIo true");
+
+        const uint32_t packetCount = aznumeric_cast<uint32_t>(state.range(0));
+        int64_t receivedPackets = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Sends are only flushed once per tick, the way the network interfaces flush them
+            receivedPackets += SendAndReceive(packetCount, packetCount, UdpSocket::MaxBatchedDatagrams);
+        }
+        ReportPacketRate(state, receivedPackets);
+    }
+    BENCHMARK_REGISTER_F(BM_UdpSocket, SendReceiveBatched)
+        ->Arg(8)
+        ->Arg(64)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
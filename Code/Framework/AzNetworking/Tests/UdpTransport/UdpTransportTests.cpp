@@ -9,6 +9,8 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -320,4 +322,47 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestBatchedSendReceive)
+    {
+        constexpr uint32_t NumTestPackets = 8;
+        constexpr uint16_t ReceiverPort = 12346;
+
+        UdpSocket sender;
+        UdpSocket receiver;
+        EXPECT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        for (uint8_t i = 0; i < NumTestPackets; ++i)
+        {
+            // Every packet has a different size and contents so misordered or misaligned payloads are detected
+            const uint8_t payload[NumTestPackets] = { i, i, i, i, i, i, i, i };
+            EXPECT_EQ(sender.Send(IpAddress(127, 0, 0, 1, ReceiverPort), payload, i + 1, false, dtlsEndpoint, connectionQuality), i + 1);
+        }
+        sender.FlushSends();
+
+        UdpSocket::ReceivedDatagram datagrams[UdpSocket::MaxBatchedDatagrams];
+        uint8_t receiveBuffer[UdpSocket::MaxBatchedDatagrams * MaxUdpTransmissionUnit];
+        uint32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (receivedCount < NumTestPackets && (AZ::GetElapsedTimeMs() - startTimeMs) < AZ::TimeMs{ 1000 })
+        {
+            const uint32_t count = receiver.ReceiveBatch(&datagrams[receivedCount], receiveBuffer + receivedCount * MaxUdpTransmissionUnit,
+                MaxUdpTransmissionUnit, NumTestPackets - receivedCount);
+            receivedCount += count;
+        }
+
+        ASSERT_EQ(receivedCount, NumTestPackets);
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            EXPECT_EQ(datagrams[i].m_receivedBytes, aznumeric_cast<int32_t>(i + 1));
+            EXPECT_EQ(receiveBuffer[i * MaxUdpTransmissionUnit], i);
+        }
+        EXPECT_EQ(receiver.GetRecvPackets(), NumTestPackets);
+
+        sender.Close();
+        receiver.Close();
+    }
 }
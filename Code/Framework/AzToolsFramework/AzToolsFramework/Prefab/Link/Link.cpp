@@ -196,34 +196,10 @@ namespace AzToolsFramework
             {
                 // Copy the source template dom so that the actual template DOM does not change and only the linked instance DOM does.
                 linkedInstanceDom.CopyFrom(sourceTemplatePrefabDom, targetTemplatePrefabDom.GetAllocator());
-
-                AZ::JsonSerializationResult::ResultCode applyPatchResult =
-                    PrefabDomUtils::ApplyPatches(linkedInstanceDom, targetTemplatePrefabDom.GetAllocator(), patchesReference->get());
-
-                [[maybe_unused]] PrefabDomValueReference sourceTemplateName =
-                    PrefabDomUtils::FindPrefabDomValue(sourceTemplatePrefabDom, PrefabDomUtils::SourceName);
-                AZ_Assert(sourceTemplateName && sourceTemplateName->get().IsString(), "A valid source template name couldn't be found");
-                [[maybe_unused]] PrefabDomValueReference targetTemplateName =
-                    PrefabDomUtils::FindPrefabDomValue(targetTemplatePrefabDom, PrefabDomUtils::SourceName);
-                AZ_Assert(targetTemplateName && targetTemplateName->get().IsString(), "A valid target template name couldn't be found");
-
-                if (applyPatchResult.GetProcessing() != AZ::JsonSerializationResult::Processing::Completed)
+                if (!ApplyLinkPatches(linkedInstanceDom, targetTemplatePrefabDom.GetAllocator(), patchesReference->get()))
                 {
-                    AZ_Error(
-                        "Prefab", false,
-                        "Link::UpdateTarget - ApplyPatches failed for Prefab DOM from source Template '%u' and target Template '%u'.",
-                        m_sourceTemplateId, m_targetTemplateId);
                     return false;
                 }
-                if (applyPatchResult.GetOutcome() == AZ::JsonSerializationResult::Outcomes::PartialSkip ||
-                    applyPatchResult.GetOutcome() == AZ::JsonSerializationResult::Outcomes::Skipped)
-                {
-                    AZ_Warning(
-                        "Prefab", false,
-                        "Link::UpdateTarget - Some of the patches couldn't be applied on the source template '%s' present under the  "
-                        "target Template '%s'.",
-                        sourceTemplateName->get().GetString(), targetTemplateName->get().GetString());
-                }
             }
 
             // This is a guardrail to ensure the linked instance dom always has the LinkId value
@@ -232,6 +208,62 @@ namespace AzToolsFramework
             return true;
         }
 
+        bool Link::GenerateLinkedInstanceDom(PrefabDom& linkedInstanceDom) const
+        {
+            AZ_PROFILE_FUNCTION(PrefabSystem);
+            const PrefabDom& sourceTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_sourceTemplateId);
+            linkedInstanceDom.CopyFrom(sourceTemplatePrefabDom, linkedInstanceDom.GetAllocator());
+
+            PrefabDom patchesDom;
+            ConstructLinkDomFromPatches(patchesDom, patchesDom.GetAllocator());
+            PrefabDomValueReference patchesReference = PrefabDomUtils::FindPrefabDomValue(patchesDom, PrefabDomUtils::PatchesName);
+            return !patchesReference.has_value() ||
+                ApplyLinkPatches(linkedInstanceDom, linkedInstanceDom.GetAllocator(), patchesReference->get());
+        }
+
+        void Link::UpdateTarget(const PrefabDom& linkedInstanceDom)
+        {
+            PrefabDomValue& targetInstanceDom = GetLinkedInstanceDom();
+            PrefabDom& targetTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_targetTemplateId);
+            targetInstanceDom.CopyFrom(linkedInstanceDom, targetTemplatePrefabDom.GetAllocator());
+            AddLinkIdToInstanceDom(targetInstanceDom, targetTemplatePrefabDom.GetAllocator());
+        }
+
+        bool Link::ApplyLinkPatches(PrefabDomValue& instanceDom, PrefabDomAllocator& allocator, const PrefabDomValue& patches) const
+        {
+            AZ::JsonSerializationResult::ResultCode applyPatchResult = PrefabDomUtils::ApplyPatches(instanceDom, allocator, patches);
+
+            if (applyPatchResult.GetProcessing() != AZ::JsonSerializationResult::Processing::Completed)
+            {
+                AZ_Error(
+                    "Prefab", false,
+                    "Link::UpdateTarget - ApplyPatches failed for Prefab DOM from source Template '%u' and target Template '%u'.",
+                    m_sourceTemplateId, m_targetTemplateId);
+                return false;
+            }
+            if (applyPatchResult.GetOutcome() == AZ::JsonSerializationResult::Outcomes::PartialSkip ||
+                applyPatchResult.GetOutcome() == AZ::JsonSerializationResult::Outcomes::Skipped)
+            {
+                [[maybe_unused]] const PrefabDom& sourceTemplatePrefabDom =
+                    m_prefabSystemComponentInterface->FindTemplateDom(m_sourceTemplateId);
+                [[maybe_unused]] const PrefabDom& targetTemplatePrefabDom =
+                    m_prefabSystemComponentInterface->FindTemplateDom(m_targetTemplateId);
+                [[maybe_unused]] PrefabDomValueConstReference sourceTemplateName =
+                    PrefabDomUtils::FindPrefabDomValue(sourceTemplatePrefabDom, PrefabDomUtils::SourceName);
+                AZ_Assert(sourceTemplateName && sourceTemplateName->get().IsString(), "A valid source template name couldn't be found");
+                [[maybe_unused]] PrefabDomValueConstReference targetTemplateName =
+                    PrefabDomUtils::FindPrefabDomValue(targetTemplatePrefabDom, PrefabDomUtils::SourceName);
+                AZ_Assert(targetTemplateName && targetTemplateName->get().IsString(), "A valid target template name couldn't be found");
+
+                AZ_Warning(
+                    "Prefab", false,
+                    "Link::UpdateTarget - Some of the patches couldn't be applied on the source template '%s' present under the  "
+                    "target Template '%s'.",
+                    sourceTemplateName->get().GetString(), targetTemplateName->get().GetString());
+            }
+            return true;
+        }
+
         PrefabDomValue& Link::GetLinkedInstanceDom()
         {
             AZ_Assert(IsValid(), "Link::GetLinkedInstanceDom - Trying to get DOM of an invalid link.");
@@ -146,6 +146,23 @@ namespace AzToolsFramework
 
             bool UpdateTarget();
 
+            /**
+             * Generates the DOM of the linked instance by applying the patches of the link to a copy of the source template DOM.
+             * This only reads from the source template, so the instance DOMs of different links can be generated on multiple threads
+             * as long as no templates or links are modified at the same time.
+             *
+             * @param[out] linkedInstanceDom The DOM to store the patched instance in.
+             * @return True if the patches of the link were applied, false otherwise.
+             */
+            bool GenerateLinkedInstanceDom(PrefabDom& linkedInstanceDom) const;
+
+            /**
+             * Updates the target template with an instance DOM created by GenerateLinkedInstanceDom.
+             *
+             * @param linkedInstanceDom The patched DOM of the linked instance.
+             */
+            void UpdateTarget(const PrefabDom& linkedInstanceDom);
+
             /**
              * Get the DOM of the instance that the link points to.
              * 
@@ -174,6 +191,13 @@ namespace AzToolsFramework
             //! @param allocator The allocator to use for memory allocations of patches.
             void ConstructLinkDomFromPatches(PrefabDomValue& linkDom, PrefabDomAllocator& allocator) const;
 
+            //! Applies the patches of the link to the provided instance DOM and reports any patches that failed to apply.
+            //! @param instanceDom The DOM of the instance to apply the patches to.
+            //! @param allocator The allocator to use for memory allocations in the instance DOM.
+            //! @param patches The patches of the link.
+            //! @return False if applying the patches failed, true otherwise.
+            bool ApplyLinkPatches(PrefabDomValue& instanceDom, PrefabDomAllocator& allocator, const PrefabDomValue& patches) const;
+
             //! Clears the existing tree and rebuilds it from the provided patches.
             //! @param patches The patches to build the tree with.
             void RebuildLinkPatchesTree(const PrefabDomValue& patches);
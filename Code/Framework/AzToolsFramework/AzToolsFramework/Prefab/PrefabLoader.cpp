@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Utils/Utils.h>
 
 #include <AzFramework/Asset/AssetSystemBus.h>
@@ -30,6 +31,39 @@ namespace AzToolsFramework
     {
         static constexpr const char s_saveAllPrefabsKey[] = "/O3DE/Preferences/Prefabs/SaveAllPrefabs";
 
+        namespace Internal
+        {
+            //! Calls the function for every index in [0, count). The calls are spread over the TaskGraph workers if the TaskGraph
+            //! is active, otherwise they're made in order on the calling thread. Returns after all calls have completed.
+            template<typename Function>
+            void ParallelFor(size_t count, const AZ::TaskDescriptor& taskDescriptor, const char* graphLabel, const Function& function)
+            {
+                const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+                if (count < 2 || !taskGraphActiveInterface || !taskGraphActiveInterface->IsTaskGraphActive())
+                {
+                    for (size_t index = 0; index < count; ++index)
+                    {
+                        function(index);
+                    }
+                    return;
+                }
+
+                AZ::TaskGraphEvent finishedEvent{ graphLabel };
+                AZ::TaskGraph taskGraph{ graphLabel };
+                for (size_t index = 0; index < count; ++index)
+                {
+                    taskGraph.AddTask(
+                        taskDescriptor,
+                        [&function, index]()
+                        {
+                            function(index);
+                        });
+                }
+                taskGraph.Submit(&finishedEvent);
+                finishedEvent.Wait();
+            }
+        } // namespace Internal
+
         void PrefabLoader::Reflect(AZ::ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -365,6 +399,21 @@ namespace AzToolsFramework
                 return InvalidTemplateId;
             }
 
+            // Use the Prefab DOM if the file was already read by PreloadNestedTemplateFiles.
+            if (auto preloadedTemplate = m_preloadedTemplateDoms.find(AZ::IO::Path(filePath));
+                preloadedTemplate != m_preloadedTemplateDoms.end())
+            {
+                PrefabDom preloadedTemplateDom = AZStd::move(preloadedTemplate->second);
+                m_preloadedTemplateDoms.erase(preloadedTemplate);
+                return LoadTemplate(
+                    filePath,
+                    [&preloadedTemplateDom]() -> AZ::Outcome<PrefabDom, AZStd::string>
+                    {
+                        return AZ::Success(AZStd::move(preloadedTemplateDom));
+                    },
+                    progressedFilePathsSet);
+            }
+
             auto readResult = AZ::Utils::ReadFile(GetFullPath(filePath).Native(), AZStd::numeric_limits<size_t>::max());
             if (!readResult.IsSuccess())
             {
@@ -393,6 +442,20 @@ namespace AzToolsFramework
             AZStd::string_view fileContent,
             AZ::IO::PathView originPath,
             AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet)
+        {
+            return LoadTemplate(
+                originPath,
+                [fileContent]()
+                {
+                    return AZ::JsonSerializationUtils::ReadJsonString(fileContent);
+                },
+                progressedFilePathsSet);
+        }
+
+        TemplateId PrefabLoader::LoadTemplate(
+            AZ::IO::PathView originPath,
+            const ReadPrefabDomCallback& readPrefabDom,
+            AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet)
         {
             if (!IsValidPrefabPath(originPath))
             {
@@ -429,7 +492,7 @@ namespace AzToolsFramework
             }
 
             // Read Template's prefab file from disk and parse Prefab DOM from file.
-            AZ::Outcome<PrefabDom, AZStd::string> readPrefabFileResult = AZ::JsonSerializationUtils::ReadJsonString(fileContent);
+            AZ::Outcome<PrefabDom, AZStd::string> readPrefabFileResult = readPrefabDom();
             if (!readPrefabFileResult.IsSuccess())
             {
                 AZ_Error(
@@ -478,6 +541,13 @@ namespace AzToolsFramework
                 }
             }
 
+            // The outermost template reads all nested Prefab files up front, so they can be read and parsed in parallel.
+            const bool isRootTemplate = progressedFilePathsSet.empty();
+            if (isRootTemplate)
+            {
+                PreloadNestedTemplateFiles(newTemplate.GetPrefabDom());
+            }
+
             // Mark the file as being in progress.
             progressedFilePathsSet.emplace(relativePath);
 
@@ -490,10 +560,12 @@ namespace AzToolsFramework
 
                 // For each instance value in 'instances', try to create source Templates for target Template's nested instance data.
                 // Also create Links between source/target Templates if source Template loaded successfully.
+                AZStd::vector<LinkId> linksToUpdate;
+                linksToUpdate.reserve(instances.MemberCount());
                 for (PrefabDomValue::MemberIterator instanceIterator = instances.MemberBegin(); instanceIterator != instances.MemberEnd();
                      ++instanceIterator)
                 {
-                    if (!LoadNestedInstance(instanceIterator, newTemplateId, progressedFilePathsSet))
+                    if (!LoadNestedInstance(instanceIterator, newTemplateId, progressedFilePathsSet, linksToUpdate))
                     {
                         isLoadSuccessful = false;
                         AZ_Error(
@@ -505,6 +577,9 @@ namespace AzToolsFramework
                         );
                     }
                 }
+
+                // All nested templates are loaded at this point, so the linked instances can be patched together.
+                isLoadSuccessful &= UpdateLinkedInstances(linksToUpdate);
             }
 
             isLoadSuccessful &= SanitizeLoadedTemplate(newTemplate.GetPrefabDom());
@@ -514,13 +589,19 @@ namespace AzToolsFramework
             // Un-mark the file as being in progress.
             progressedFilePathsSet.erase(originPath);
 
+            if (isRootTemplate)
+            {
+                // Drop any files that weren't used, for instance because of a cyclical dependency.
+                m_preloadedTemplateDoms.clear();
+            }
+
             // Return target Template id.
             return newTemplateId;
         }
 
         bool PrefabLoader::LoadNestedInstance(
             PrefabDomValue::MemberIterator& instanceIterator, TemplateId targetTemplateId,
-            AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet)
+            AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet, AZStd::vector<LinkId>& linksToUpdate)
         {
             const PrefabDomValue& instance = instanceIterator->value;
             AZ::IO::PathView instancePath = AZStd::string_view(instanceIterator->name.GetString(), instanceIterator->name.GetStringLength());
@@ -570,8 +651,9 @@ namespace AzToolsFramework
             }
 
             // After source template has been loaded, create Link between source/target Template.
-            LinkId newLinkId =
-                m_prefabSystemComponentInterface->AddLink(nestedTemplateId, targetTemplateId, instanceIterator, AZStd::nullopt);
+            // The linked instance is patched later together with the other instances in the target Template.
+            LinkId newLinkId = m_prefabSystemComponentInterface->AddLink(
+                nestedTemplateId, targetTemplateId, instanceIterator, AZStd::nullopt, /*updateTarget=*/false);
             if (newLinkId == InvalidLinkId)
             {
                 AZ_Error(
@@ -586,10 +668,172 @@ namespace AzToolsFramework
                 return false;
             }
 
+            linksToUpdate.push_back(newLinkId);
+
             // Let the new Template carry up the error flag of its nested Prefab.
             return !nestedTemplateReference->get().IsLoadedWithErrors();
         }
 
+        bool PrefabLoader::UpdateLinkedInstances(const AZStd::vector<LinkId>& linkIds)
+        {
+            return UpdateLinkedInstances(
+                linkIds,
+                [](const Link& link, PrefabDom& linkedInstanceDom)
+                {
+                    return link.GenerateLinkedInstanceDom(linkedInstanceDom);
+                });
+        }
+
+        bool PrefabLoader::UpdateLinkedInstances(
+            const AZStd::vector<LinkId>& linkIds, const GenerateLinkedInstanceDomCallback& generateLinkedInstanceDom)
+        {
+            AZ_PROFILE_FUNCTION(PrefabSystem);
+
+            AZStd::vector<Link*> links;
+            links.reserve(linkIds.size());
+            for (LinkId linkId : linkIds)
+            {
+                LinkReference linkReference = m_prefabSystemComponentInterface->FindLink(linkId);
+                AZ_Assert(linkReference.has_value(), "Link '%llu' was added while loading a template, but can't be found.", linkId);
+                links.push_back(&linkReference->get());
+            }
+
+            // Every patched instance is a full copy of its source template, so only a batch of them is kept around at a time.
+            const size_t batchSize = AZStd::min(links.size(), LinkedInstanceBatchSize);
+            AZStd::vector<PrefabDom> linkedInstanceDoms(batchSize);
+            AZStd::vector<AZ::u8> isGenerated(batchSize, 0);
+            static const AZ::TaskDescriptor generateInstanceTaskDescriptor{ "PrefabLoader::GenerateLinkedInstanceDom", "Prefab" };
+
+            bool isUpdateSuccessful = true;
+            AZStd::vector<LinkId> failedLinkIds;
+            for (size_t batchStart = 0; batchStart < links.size(); batchStart += batchSize)
+            {
+                const size_t batchCount = AZStd::min(batchSize, links.size() - batchStart);
+
+                // Generating the instances only reads from the source templates and links, which aren't modified until all tasks
+                // of the batch completed.
+                Internal::ParallelFor(
+                    batchCount, generateInstanceTaskDescriptor, "PrefabLoader UpdateLinkedInstances",
+                    [&links, &linkedInstanceDoms, &isGenerated, &generateLinkedInstanceDom, batchStart](size_t index)
+                    {
+                        isGenerated[index] = generateLinkedInstanceDom(*links[batchStart + index], linkedInstanceDoms[index]) ? 1 : 0;
+                    });
+
+                for (size_t index = 0; index < batchCount; ++index)
+                {
+                    Link& link = *links[batchStart + index];
+                    if (isGenerated[index])
+                    {
+                        link.UpdateTarget(linkedInstanceDoms[index]);
+                    }
+                    else
+                    {
+                        isUpdateSuccessful = false;
+                        AZ_Error(
+                            "Prefab", false,
+                            "PrefabLoader::UpdateLinkedInstances - "
+                            "Failed to update the linked instance '%s' with source Prefab file '%s' and target Prefab file '%s'.",
+                            link.GetInstanceName().c_str(),
+                            m_prefabSystemComponentInterface->FindTemplate(link.GetSourceTemplateId())->get().GetFilePath().c_str(),
+                            m_prefabSystemComponentInterface->FindTemplate(link.GetTargetTemplateId())->get().GetFilePath().c_str());
+                        failedLinkIds.push_back(linkIds[batchStart + index]);
+                    }
+                    // Release the patched copy right away to limit the memory overhead.
+                    linkedInstanceDoms[index] = PrefabDom();
+                }
+            }
+
+            // Drop the links that couldn't be patched, the same as AddLink does when it patches the linked instance itself.
+            // This is done after the loop because removing a link invalidates the pointers into the link map.
+            for (LinkId failedLinkId : failedLinkIds)
+            {
+                m_prefabSystemComponentInterface->RemoveLink(failedLinkId);
+            }
+            return isUpdateSuccessful;
+        }
+
+        void PrefabLoader::PreloadNestedTemplateFiles(const PrefabDom& templateDom)
+        {
+            AZ_PROFILE_FUNCTION(PrefabSystem);
+
+            AZStd::unordered_set<AZ::IO::Path> discoveredPaths;
+            AZStd::vector<AZ::IO::Path> pendingPaths;
+            auto addNestedTemplatePaths = [this, &discoveredPaths, &pendingPaths](const PrefabDomValue& prefabDom)
+            {
+                PrefabDomValueConstReference instancesReference = PrefabDomUtils::FindPrefabDomValue(prefabDom, PrefabDomUtils::InstancesName);
+                if (!instancesReference.has_value() || !instancesReference->get().IsObject())
+                {
+                    return;
+                }
+
+                for (const auto& instance : instancesReference->get().GetObject())
+                {
+                    PrefabDomValueConstReference sourceReference =
+                        PrefabDomUtils::FindPrefabDomValue(instance.value, PrefabDomUtils::SourceName);
+                    if (!sourceReference.has_value() || !sourceReference->get().IsString())
+                    {
+                        continue;
+                    }
+
+                    // Paths that can't be loaded or that are absolute are left to LoadTemplateFromFile to report or resolve.
+                    AZ::IO::Path sourcePath(AZStd::string_view(sourceReference->get().GetString(), sourceReference->get().GetStringLength()));
+                    if (!IsValidPrefabPath(sourcePath) || sourcePath.IsAbsolute() ||
+                        m_prefabSystemComponentInterface->GetTemplateIdFromFilePath(sourcePath) != InvalidTemplateId)
+                    {
+                        continue;
+                    }
+
+                    if (discoveredPaths.insert(sourcePath).second)
+                    {
+                        pendingPaths.push_back(AZStd::move(sourcePath));
+                    }
+                }
+            };
+
+            addNestedTemplatePaths(templateDom);
+
+            static const AZ::TaskDescriptor readTemplateTaskDescriptor{ "PrefabLoader::ReadTemplateFile", "Prefab" };
+            while (!pendingPaths.empty())
+            {
+                AZStd::vector<AZ::IO::Path> paths = AZStd::move(pendingPaths);
+                pendingPaths = {};
+
+                // Resolving the full paths goes through the asset system, so it's done before reading the files in parallel.
+                AZStd::vector<AZ::IO::Path> fullPaths;
+                fullPaths.reserve(paths.size());
+                for (const AZ::IO::Path& path : paths)
+                {
+                    fullPaths.push_back(GetFullPath(path));
+                }
+
+                AZStd::vector<AZStd::optional<PrefabDom>> templateDoms(paths.size());
+                Internal::ParallelFor(
+                    paths.size(), readTemplateTaskDescriptor, "PrefabLoader PreloadNestedTemplateFiles",
+                    [&fullPaths, &templateDoms](size_t index)
+                    {
+                        auto readResult = AZ::Utils::ReadFile(fullPaths[index].Native(), AZStd::numeric_limits<size_t>::max());
+                        if (readResult.IsSuccess())
+                        {
+                            AZ::Outcome<PrefabDom, AZStd::string> parseResult = AZ::JsonSerializationUtils::ReadJsonString(readResult.GetValue());
+                            if (parseResult.IsSuccess())
+                            {
+                                templateDoms[index] = parseResult.TakeValue();
+                            }
+                        }
+                    });
+
+                // Collect the next level of nested templates in the order of the files for a deterministic load order.
+                for (size_t index = 0; index < paths.size(); ++index)
+                {
+                    if (templateDoms[index].has_value())
+                    {
+                        addNestedTemplatePaths(*templateDoms[index]);
+                        m_preloadedTemplateDoms.emplace(AZStd::move(paths[index]), AZStd::move(*templateDoms[index]));
+                    }
+                }
+            }
+        }
+
         bool PrefabLoader::SanitizeLoadedTemplate(PrefabDomReference loadedTemplateDom)
         {
             // Prefabs are stored to disk with default values stripped. However, while in memory, we need those default values to be
@@ -13,7 +13,11 @@
 
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/string/string.h>
 #include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 #include <Prefab/ScriptingPrefabLoader.h>
@@ -23,10 +27,17 @@ namespace AZ
     class Entity;
 } // namespace AZ
 
+// Predefinition for unit test friend class
+namespace UnitTest
+{
+    class PrefabLoadTemplateTest;
+}
+
 namespace AzToolsFramework
 {
     namespace Prefab
     {
+        class Link;
         class PrefabSystemComponentInterface;
         class Template;
         using TemplateReference = AZStd::optional<AZStd::reference_wrapper<Template>>;
@@ -37,6 +48,8 @@ namespace AzToolsFramework
         class AZTF_API PrefabLoader final
             : public PrefabLoaderInterface
         {
+            friend class UnitTest::PrefabLoadTemplateTest;
+
         public:
             AZ_CLASS_ALLOCATOR(PrefabLoader, AZ::SystemAllocator);
             AZ_RTTI(PrefabLoader, "{A302B072-4DC4-4B7E-9188-226F56A3429C}", PrefabLoaderInterface);
@@ -176,17 +189,69 @@ namespace AzToolsFramework
                 AZ::IO::PathView filePath,
                 AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet);
 
+            using ReadPrefabDomCallback = AZStd::function<AZ::Outcome<PrefabDom, AZStd::string>()>;
+
+            /**
+             * Load Prefab Template from the Prefab DOM provided by the callback to memory and return the id of loaded Template.
+             * @param originPath Path that will be used for the template if saved to file.
+             * @param readPrefabDom Callback that reads the Prefab DOM of the template. It's only called if the template needs to be loaded.
+             * @param progressedFilePathsSet An unordered_set to track if there's any cyclical dependency between Templates.
+             * @return A unique id of Template on filePath loaded. Return invalid id if loading Template on filePath failed.
+             */
+            TemplateId LoadTemplate(
+                AZ::IO::PathView originPath,
+                const ReadPrefabDomCallback& readPrefabDom,
+                AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet);
+
             /**
              * Load nested instance given a nested instance value iterator and target Template with its id.
+             * The linked instance isn't patched yet, instead the id of the new link is added to linksToUpdate.
              * @param instanceIterator A nested instance value iterator.
              * @param targetTemplateId A unique id of target Template.
              * @param progressedFilePathsSet An unordered_set to track if there's any cyclical dependency between Templates.
+             * @param[out] linksToUpdate The links whose linked instances still need to be patched with UpdateLinkedInstances.
              * @return If loading the nested instance pointed by instanceIterator on targetTemplate succeeded or not.
              */
             bool LoadNestedInstance(
                 PrefabDomValue::MemberIterator& instanceIterator,
                 TemplateId targetTemplateId,
-                AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet);
+                AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet,
+                AZStd::vector<LinkId>& linksToUpdate);
+
+            /**
+             * Patches the linked instances of the provided links in their target template. The patched instance DOMs only depend
+             * on the already loaded source templates, so they're generated in parallel and then copied into the target template
+             * in the order of the links, which keeps the result identical to patching one link at a time. The links are processed
+             * in batches of at most LinkedInstanceBatchSize so only a bounded number of patched copies is kept in memory.
+             * Links whose patches can't be applied are removed.
+             * @param linkIds The links to update.
+             * @return True if all linked instances were patched, false otherwise.
+             */
+            bool UpdateLinkedInstances(const AZStd::vector<LinkId>& linkIds);
+
+            //! Callback that creates the patched instance DOM of a link. Called from TaskGraph workers if the TaskGraph is active.
+            using GenerateLinkedInstanceDomCallback = AZStd::function<bool(const Link& link, PrefabDom& linkedInstanceDom)>;
+            /**
+             * Same as UpdateLinkedInstances, but the patched instance DOMs are created by the provided callback.
+             * @param linkIds The links to update.
+             * @param generateLinkedInstanceDom Creates the patched instance DOM for a link, returning false if that failed.
+             * @return True if all linked instances were patched, false otherwise.
+             */
+            bool UpdateLinkedInstances(
+                const AZStd::vector<LinkId>& linkIds, const GenerateLinkedInstanceDomCallback& generateLinkedInstanceDom);
+
+            //! The maximum number of patched instance DOMs UpdateLinkedInstances holds at once.
+            static constexpr size_t LinkedInstanceBatchSize = 64;
+
+            /**
+             * Reads and parses the Prefab files of all templates that are directly or indirectly nested in the given template and
+             * that aren't loaded yet. The files are processed one level of nesting at a time, as the nested templates of a file are
+             * only known after parsing it, and all files of a level are read and parsed in parallel. The parsed DOMs are picked up by
+             * LoadTemplateFromFile instead of reading the files again. Files that fail to load are skipped so the errors are reported
+             * in the same way when the file is loaded on demand.
+             * @param templateDom The Prefab DOM of the template to start from.
+             */
+            void PreloadNestedTemplateFiles(const PrefabDom& templateDom);
 
             /*
              * Manipulate the provided PrefabDom into the right format to be stored in memory for editor usage.
@@ -206,6 +271,8 @@ namespace AzToolsFramework
             AZStd::optional<AZStd::pair<PrefabDom, AZ::IO::Path>> StoreTemplateIntoFileFormat(TemplateId templateId);
 
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
+            //! Prefab DOMs read by PreloadNestedTemplateFiles, by the source path used in the Prefab files.
+            AZStd::unordered_map<AZ::IO::Path, PrefabDom> m_preloadedTemplateDoms;
             ScriptingPrefabLoader m_scriptingPrefabLoader;
             AZ::IO::Path m_projectPathWithOsSeparator;
             AZ::IO::Path m_projectPathWithSlashSeparator;
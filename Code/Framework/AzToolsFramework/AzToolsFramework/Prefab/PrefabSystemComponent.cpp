@@ -719,7 +719,8 @@ namespace AzToolsFramework
             TemplateId sourceTemplateId,
             TemplateId targetTemplateId,
             PrefabDomValue::MemberIterator& instanceIterator,
-            InstanceOptionalReference instance)
+            InstanceOptionalReference instance,
+            bool updateTarget)
         {
             TemplateReference sourceTemplateReference = FindTemplate(sourceTemplateId);
             TemplateReference targetTemplateReference = FindTemplate(targetTemplateId);
@@ -744,7 +745,7 @@ namespace AzToolsFramework
 
             LinkId newLinkId = CreateUniqueLinkId();
             Link newLink(newLinkId);
-            if (!ConnectTemplates(newLink, sourceTemplateId, targetTemplateId, instanceIterator))
+            if (!ConnectTemplates(newLink, sourceTemplateId, targetTemplateId, instanceIterator, updateTarget))
             {
                 AZ_Error("Prefab", false,
                     "PrefabSystemComponent::AddLink - "
@@ -1064,7 +1065,8 @@ namespace AzToolsFramework
             Link& link,
             TemplateId sourceTemplateId,
             TemplateId targetTemplateId,
-            PrefabDomValue::MemberIterator& instanceIterator)
+            PrefabDomValue::MemberIterator& instanceIterator,
+            bool updateTarget)
         {
             TemplateReference sourceTemplateReference = FindTemplate(sourceTemplateId);
             TemplateReference targetTemplateReference = FindTemplate(targetTemplateId);
@@ -1117,7 +1119,7 @@ namespace AzToolsFramework
                     instanceObject.Move(), targetTemplatePrefabDom.GetAllocator());
             }
             //initialize link
-            if (!link.UpdateTarget())
+            if (updateTarget && !link.UpdateTarget())
             {
                 AZ_Error("Prefab", false,
                     "PrefabSystemComponent::ConnectTemplates - "
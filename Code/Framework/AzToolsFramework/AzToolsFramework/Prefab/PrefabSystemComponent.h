@@ -158,13 +158,16 @@ namespace AzToolsFramework
             * @param targetTemplateId The Id of Template which owns this Link.
             * @param instanceIterator The Prefab DOM value iterator that points to the instance associated by this Link.
             * @param instance The instance that this link may point to. This is optional and can also take the value of nullopt.
+            * @param updateTarget If false, the linked instance in targetTemplate isn't patched yet. This allows the caller to generate
+            *        the patched instance DOMs of multiple links in parallel with Link::GenerateLinkedInstanceDom.
             * @return A unique id for the new Link.
             */
             LinkId AddLink(
                 TemplateId sourceTemplateId,
                 TemplateId targetTemplateId,
                 PrefabDomValue::MemberIterator& instanceIterator,
-                InstanceOptionalReference instance) override;
+                InstanceOptionalReference instance,
+                bool updateTarget = true) override;
 
             /**
             * Create a new Link with Prefab System Component and create a unique id for it.
@@ -342,13 +345,15 @@ namespace AzToolsFramework
              * @param sourceTemplateId A unique id of source Template.
              * @param targetTemplateId A unique id of target Template.
              * @param instanceIterator A nested instance value iterator from targetTemplate.
+             * @param updateTarget Whether to apply the patches of the link to the linked instance in targetTemplate.
              * @return If newLink connects sourceTemplate and targetTemplate successfully.
              */
             bool ConnectTemplates(
                 Link& link,
                 TemplateId sourceTemplateId,
                 TemplateId targetTemplateId,
-                PrefabDomValue::MemberIterator& instanceIterator);
+                PrefabDomValue::MemberIterator& instanceIterator,
+                bool updateTarget = true);
 
             /**
             * Given a template this will traverse any nested instances found in its Prefab Dom
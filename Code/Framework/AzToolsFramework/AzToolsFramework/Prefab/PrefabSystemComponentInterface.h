@@ -42,7 +42,7 @@ namespace AzToolsFramework
             virtual void RemoveAllTemplates() = 0;
 
             virtual LinkId AddLink(TemplateId sourceTemplateId, TemplateId targetTemplateId,
-                PrefabDomValue::MemberIterator& instanceIterator, InstanceOptionalReference instance) = 0;
+                PrefabDomValue::MemberIterator& instanceIterator, InstanceOptionalReference instance, bool updateTarget = true) = 0;
 
             //creates a new Link
             virtual LinkId CreateLink(
@@ -44,6 +44,7 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
     void PrefabInMemorySpawnableConverter::Deactivate()
     {
         m_assetContainer.ClearAllInMemorySpawnableAssets();
+        m_sourceTrackers.clear();
         m_stackProfile = "";
         m_loaderInterface = nullptr;
         m_prefabSystemComponentInterface = nullptr;
@@ -78,10 +79,91 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
             return AZ::Failure(AZStd::string::format("Could not get Template DOM for given Template's id %llu .", templateId));
         }
 
+        const PrefabDom& templateDom = templateReference->get().GetPrefabDom();
+        PrefabDocument document(spawnableName);
+        document.SetPrefabDom(templateDom);
+        SpawnableEntitySourceTracker::EntityFingerprints fingerprints =
+            SpawnableEntitySourceTracker::CalculateFingerprints(templateDom, document.GetInstance());
+
+        auto result = ConvertToInMemorySpawnableAsset(AZStd::move(document), spawnableName, loadReferencedAssets);
+        if (result.IsSuccess())
+        {
+            if (auto spawnable = azrtti_cast<const AzFramework::Spawnable*>(result.GetValue().get().GetData()); spawnable != nullptr)
+            {
+                SpawnableEntitySourceTracker& tracker = m_sourceTrackers[AZStd::string(spawnableName)];
+                tracker.Reset();
+                tracker.Record(AZStd::move(fingerprints), *spawnable);
+            }
+        }
+        return result;
+    }
+
+    auto PrefabInMemorySpawnableConverter::UpdateInMemorySpawnableAsset(
+        AzToolsFramework::Prefab::TemplateId templateId, AZStd::string_view spawnableName, bool loadReferencedAssets)
+        -> UpdateSpawnableResult
+    {
+        if (!IsActivated())
+        {
+            return AZ::Failure(AZStd::string::format("Failed to create a prefab processing stack from key '%.*s'.", AZ_STRING_ARG(m_stackProfile)));
+        }
+
+        const AzFramework::InMemorySpawnableAssetContainer::SpawnableAssets& spawnableAssets =
+            m_assetContainer.GetAllInMemorySpawnableAssets();
+        auto spawnableAssetIt = spawnableAssets.find(AZStd::string(spawnableName));
+        auto trackerIt = m_sourceTrackers.find(AZStd::string(spawnableName));
+        if (spawnableAssetIt == spawnableAssets.end() || trackerIt == m_sourceTrackers.end() || !trackerIt->second.HasRecording())
+        {
+            return AZ::Failure(AZStd::string::format(
+                "In-memory Spawnable '%.*s' can't be updated as it wasn't created by this converter.", AZ_STRING_ARG(spawnableName)));
+        }
+
+        TemplateReference templateReference = m_prefabSystemComponentInterface->FindTemplate(templateId);
+        if (!templateReference.has_value())
+        {
+            return AZ::Failure(AZStd::string::format("Could not get Template DOM for given Template's id %llu .", templateId));
+        }
+
+        const PrefabDom& templateDom = templateReference->get().GetPrefabDom();
+        PrefabDocument document(spawnableName);
+        document.SetPrefabDom(templateDom);
+        SpawnableEntitySourceTracker::EntityFingerprints fingerprints =
+            SpawnableEntitySourceTracker::CalculateFingerprints(templateDom, document.GetInstance());
+
+        SpawnableUpdate update;
+        if (!trackerIt->second.HasChanges(fingerprints))
+        {
+            // None of the entities changed so there's no need to run the conversion again.
+            const AzFramework::InMemorySpawnableAssetContainer::SpawnableAssetData& spawnableAssetData = spawnableAssetIt->second;
+            for (const AZ::Data::Asset<AZ::Data::AssetData>& asset : spawnableAssetData.m_assets)
+            {
+                if (asset.GetId() == spawnableAssetData.m_spawnableAssetId)
+                {
+                    update.m_spawnable = asset;
+                    break;
+                }
+            }
+            return AZ::Success(AZStd::move(update));
+        }
+
+        auto result = ConvertToInMemorySpawnableAsset(AZStd::move(document), spawnableName, loadReferencedAssets);
+        if (!result.IsSuccess())
+        {
+            return AZ::Failure(result.TakeError());
+        }
+
+        update.m_spawnable = result.GetValue().get();
+        if (update.m_spawnable)
+        {
+            update.m_patch = trackerIt->second.Record(AZStd::move(fingerprints), *update.m_spawnable);
+        }
+        return AZ::Success(AZStd::move(update));
+    }
+
+    AzFramework::InMemorySpawnableAssetContainer::CreateSpawnableResult PrefabInMemorySpawnableConverter::ConvertToInMemorySpawnableAsset(
+        PrefabDocument&& document, AZStd::string_view spawnableName, bool loadReferencedAssets)
+    {
         // Use a random uuid as this is only a temporary source.
         PrefabConversionUtils::PrefabProcessorContext context(AZ::Uuid::CreateRandom());
-        PrefabDocument document(spawnableName);
-        document.SetPrefabDom(templateReference->get().GetPrefabDom());
         context.AddPrefab(AZStd::move(document));
         m_converter.ProcessPrefab(context);
 
@@ -112,6 +194,10 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
             }
         }
 
+        if (m_assetContainer.HasInMemorySpawnableAsset(spawnableName))
+        {
+            m_assetContainer.RemoveInMemorySpawnableAsset(spawnableName);
+        }
         return m_assetContainer.CreateInMemorySpawnableAsset(assetDataInfoContainer, loadReferencedAssets, spawnableName);
     }
 
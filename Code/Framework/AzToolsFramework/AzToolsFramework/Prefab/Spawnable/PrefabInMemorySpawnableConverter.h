@@ -11,10 +11,15 @@
 #include <AzToolsFramework/AzToolsFrameworkAPI.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabConversionPipeline.h>
+#include <AzToolsFramework/Prefab/Spawnable/SpawnableEntitySourceTracker.h>
 #include <AzFramework/Spawnable/InMemorySpawnableAssetContainer.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 
 namespace AzToolsFramework::Prefab
 {
@@ -29,6 +34,15 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
     public:
         AZ_CLASS_ALLOCATOR(PrefabInMemorySpawnableConverter, AZ::SystemAllocator);
 
+        struct SpawnableUpdate
+        {
+            //! The in-memory spawnable asset after the update.
+            AZ::Data::Asset<AzFramework::Spawnable> m_spawnable;
+            //! The entities that need to be respawned to update instances of the previous version of the spawnable.
+            AzFramework::SpawnablePatch m_patch;
+        };
+        using UpdateSpawnableResult = AZ::Outcome<SpawnableUpdate, AZStd::string>;
+
         ~PrefabInMemorySpawnableConverter();
 
         bool Activate(AZStd::string_view stackProfile);
@@ -45,11 +59,23 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         AzFramework::InMemorySpawnableAssetContainer::CreateSpawnableResult CreateInMemorySpawnableAsset(
             AzToolsFramework::Prefab::TemplateId templateId, AZStd::string_view spawnableName, bool loadReferencedAssets = false);
 
+        //! Converts a prefab template again into the in-memory spawnable asset that was previously created from it under the same name.
+        //! The DOM of each entity is compared to the previous conversion and the returned patch lists the entities that have to be
+        //! respawned, which can be passed to SpawnableEntitiesInterface::ApplySpawnablePatch to update running instances. If no entity
+        //! changed, the conversion is skipped, the existing spawnable is kept and an empty patch is returned.
+        UpdateSpawnableResult UpdateInMemorySpawnableAsset(
+            AzToolsFramework::Prefab::TemplateId templateId, AZStd::string_view spawnableName, bool loadReferencedAssets = false);
+
         const AzFramework::InMemorySpawnableAssetContainer& GetAssetContainerConst() const;
         AzFramework::InMemorySpawnableAssetContainer& GetAssetContainer();
 
     private:
+        //! Runs the conversion pipeline on the document and replaces the in-memory spawnable with the given name with the result.
+        AzFramework::InMemorySpawnableAssetContainer::CreateSpawnableResult ConvertToInMemorySpawnableAsset(
+            PrefabDocument&& document, AZStd::string_view spawnableName, bool loadReferencedAssets);
+
         AzFramework::InMemorySpawnableAssetContainer m_assetContainer;
+        AZStd::unordered_map<AZStd::string, SpawnableEntitySourceTracker> m_sourceTrackers;
         PrefabConversionUtils::PrefabConversionPipeline m_converter;
         AZStd::string_view m_stackProfile;
         PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/EntityUtils.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzToolsFramework/Prefab/Instance/Instance.h>
+#include <AzToolsFramework/Prefab/PrefabDomUtils.h>
+#include <AzToolsFramework/Prefab/Spawnable/SpawnableEntitySourceTracker.h>
+
+namespace AzToolsFramework::Prefab::PrefabConversionUtils
+{
+    namespace Internal
+    {
+        static void HashDomValue(size_t& seed, const PrefabDomValue& value)
+        {
+            AZStd::hash_combine(seed, static_cast<int>(value.GetType()));
+            switch (value.GetType())
+            {
+            case rapidjson::kStringType:
+                AZStd::hash_combine(seed, AZStd::string_view(value.GetString(), value.GetStringLength()));
+                break;
+            case rapidjson::kNumberType:
+                if (value.IsUint64())
+                {
+                    AZStd::hash_combine(seed, value.GetUint64());
+                }
+                else if (value.IsInt64())
+                {
+                    AZStd::hash_combine(seed, value.GetInt64());
+                }
+                else
+                {
+                    AZStd::hash_combine(seed, value.GetDouble());
+                }
+                break;
+            case rapidjson::kArrayType:
+                AZStd::hash_combine(seed, value.Size());
+                for (const PrefabDomValue& element : value.GetArray())
+                {
+                    HashDomValue(seed, element);
+                }
+                break;
+            case rapidjson::kObjectType:
+                AZStd::hash_combine(seed, value.MemberCount());
+                for (auto member = value.MemberBegin(); member != value.MemberEnd(); ++member)
+                {
+                    AZStd::hash_combine(seed, AZStd::string_view(member->name.GetString(), member->name.GetStringLength()));
+                    HashDomValue(seed, member->value);
+                }
+                break;
+            default:
+                // Null and boolean values are fully described by their type.
+                break;
+            }
+        }
+
+        static AZ::u64 HashDomValue(const PrefabDomValue& value)
+        {
+            size_t seed = 0;
+            HashDomValue(seed, value);
+            return aznumeric_cast<AZ::u64>(seed);
+        }
+
+        static void CalculateInstanceFingerprints(
+            const PrefabDomValue& instanceDom,
+            const AzToolsFramework::Prefab::Instance& instance,
+            SpawnableEntitySourceTracker::EntityFingerprints& fingerprints)
+        {
+            if (!instanceDom.IsObject())
+            {
+                return;
+            }
+
+            if (auto containerEntity = instanceDom.FindMember(PrefabDomUtils::ContainerEntityName);
+                containerEntity != instanceDom.MemberEnd())
+            {
+                fingerprints[instance.GetContainerEntityId()] = HashDomValue(containerEntity->value);
+            }
+
+            if (auto entities = instanceDom.FindMember(PrefabDomUtils::EntitiesName);
+                entities != instanceDom.MemberEnd() && entities->value.IsObject())
+            {
+                for (auto entity = entities->value.MemberBegin(); entity != entities->value.MemberEnd(); ++entity)
+                {
+                    AZ::EntityId entityId =
+                        instance.GetEntityId(EntityAlias(entity->name.GetString(), entity->name.GetStringLength()));
+                    if (entityId.IsValid())
+                    {
+                        fingerprints[entityId] = HashDomValue(entity->value);
+                    }
+                }
+            }
+
+            if (auto instances = instanceDom.FindMember(PrefabDomUtils::InstancesName);
+                instances != instanceDom.MemberEnd() && instances->value.IsObject())
+            {
+                for (auto nestedDom = instances->value.MemberBegin(); nestedDom != instances->value.MemberEnd(); ++nestedDom)
+                {
+                    InstanceOptionalConstReference nestedInstance =
+                        instance.FindNestedInstance(InstanceAlias(nestedDom->name.GetString(), nestedDom->name.GetStringLength()));
+                    if (nestedInstance.has_value())
+                    {
+                        CalculateInstanceFingerprints(nestedDom->value, nestedInstance->get(), fingerprints);
+                    }
+                }
+            }
+        }
+    } // namespace Internal
+
+    auto SpawnableEntitySourceTracker::CalculateFingerprints(
+        const PrefabDomValue& prefabDom, const AzToolsFramework::Prefab::Instance& instance)
+        -> EntityFingerprints
+    {
+        EntityFingerprints fingerprints;
+        Internal::CalculateInstanceFingerprints(prefabDom, instance, fingerprints);
+        return fingerprints;
+    }
+
+    bool SpawnableEntitySourceTracker::HasRecording() const
+    {
+        return m_hasRecording;
+    }
+
+    bool SpawnableEntitySourceTracker::HasChanges(const EntityFingerprints& fingerprints) const
+    {
+        return !m_hasRecording || m_fingerprints != fingerprints;
+    }
+
+    AzFramework::SpawnablePatch SpawnableEntitySourceTracker::Record(
+        EntityFingerprints fingerprints, const AzFramework::Spawnable& spawnable, AZ::SerializeContext* serializeContext)
+    {
+        const AzFramework::Spawnable::EntityList& entities = spawnable.GetEntities();
+        const uint32_t entityCount = aznumeric_caster(entities.size());
+
+        AZStd::unordered_set<AZ::EntityId> spawnableEntityIds;
+        spawnableEntityIds.reserve(entityCount);
+        for (const auto& entity : entities)
+        {
+            spawnableEntityIds.emplace(entity->GetId());
+        }
+
+        AzFramework::SpawnablePatch patch;
+        AZStd::vector<AZ::EntityId> changedEntityIds;
+        if (m_hasRecording)
+        {
+            for (const AZ::EntityId& entityId : m_spawnableEntityIds)
+            {
+                if (!spawnableEntityIds.contains(entityId))
+                {
+                    patch.m_removedEntityIds.push_back(entityId);
+                    changedEntityIds.push_back(entityId);
+                }
+            }
+            AZStd::sort(patch.m_removedEntityIds.begin(), patch.m_removedEntityIds.end());
+        }
+
+        AZStd::vector<AZ::u8> isUpdated(entityCount, 0);
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            AZ::EntityId entityId = entities[i]->GetId();
+            bool isChanged = !m_hasRecording || !m_spawnableEntityIds.contains(entityId);
+            if (!isChanged)
+            {
+                // Entities that weren't directly created from the prefab DOM, such as entities added by a prefab processor, can't be
+                // tracked and are therefore always considered to be changed.
+                auto newFingerprint = fingerprints.find(entityId);
+                auto oldFingerprint = m_fingerprints.find(entityId);
+                isChanged = newFingerprint == fingerprints.end() || oldFingerprint == m_fingerprints.end() ||
+                    newFingerprint->second != oldFingerprint->second;
+            }
+
+            if (isChanged)
+            {
+                isUpdated[i] = 1;
+                changedEntityIds.push_back(entityId);
+            }
+        }
+
+        // Respawned entities get new ids, so entities referring to them have to be respawned as well to have their references updated.
+        // This in turn can affect entities referring to those entities, so keep following the references until no entities are added.
+        if (m_hasRecording && !changedEntityIds.empty())
+        {
+            AZStd::unordered_map<AZ::EntityId, AZStd::vector<uint32_t>> referencingEntities;
+            for (uint32_t i = 0; i < entityCount; ++i)
+            {
+                const AZ::Entity* entity = entities[i].get();
+                AZ::EntityUtils::EnumerateEntityIds(
+                    entity,
+                    [&referencingEntities, entity, i](const AZ::EntityId& id, bool isEntityId, const AZ::SerializeContext::ClassElement*)
+                    {
+                        if (!isEntityId && id.IsValid() && id != entity->GetId())
+                        {
+                            referencingEntities[id].push_back(i);
+                        }
+                    },
+                    serializeContext);
+            }
+
+            while (!changedEntityIds.empty())
+            {
+                AZ::EntityId entityId = changedEntityIds.back();
+                changedEntityIds.pop_back();
+                if (auto referencingIt = referencingEntities.find(entityId); referencingIt != referencingEntities.end())
+                {
+                    for (uint32_t index : referencingIt->second)
+                    {
+                        if (!isUpdated[index])
+                        {
+                            isUpdated[index] = 1;
+                            changedEntityIds.push_back(entities[index]->GetId());
+                        }
+                    }
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < entityCount; ++i)
+        {
+            if (isUpdated[i])
+            {
+                patch.m_updatedEntityIndices.push_back(i);
+            }
+        }
+
+        m_fingerprints = AZStd::move(fingerprints);
+        m_spawnableEntityIds = AZStd::move(spawnableEntityIds);
+        m_hasRecording = true;
+
+        return patch;
+    }
+
+    void SpawnableEntitySourceTracker::Reset()
+    {
+        m_fingerprints.clear();
+        m_spawnableEntityIds.clear();
+        m_hasRecording = false;
+    }
+} // namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzToolsFramework/AzToolsFrameworkAPI.h>
+#include <AzCore/base.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
+
+namespace AZ
+{
+    class SerializeContext;
+}
+
+namespace AzToolsFramework::Prefab
+{
+    class Instance;
+}
+
+namespace AzToolsFramework::Prefab::PrefabConversionUtils
+{
+    //! Keeps track of the part of the prefab DOM that each entity in a spawnable was created from. When the prefab is converted
+    //! again after a change, the new conversion is compared against the previous one so only the entities affected by the change
+    //! need to be respawned, instead of the entire spawnable.
+    class AZTF_API SpawnableEntitySourceTracker
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableEntitySourceTracker, AZ::SystemAllocator);
+
+        //! Hashes of the DOM of each entity, keyed by the id the entity gets when it's loaded from the DOM.
+        using EntityFingerprints = AZStd::unordered_map<AZ::EntityId, AZ::u64>;
+
+        //! Calculates the fingerprints for all entities, including container entities, in the hierarchy of the provided instance.
+        //! The instance is expected to have been loaded from the provided DOM.
+        static EntityFingerprints CalculateFingerprints(
+            const PrefabDomValue& prefabDom, const AzToolsFramework::Prefab::Instance& instance);
+
+        //! Returns true if fingerprints have been recorded before.
+        bool HasRecording() const;
+        //! Returns true if the provided fingerprints differ from the ones recorded with the last call to Record.
+        bool HasChanges(const EntityFingerprints& fingerprints) const;
+
+        //! Records the fingerprints and the entities of a new conversion and returns the patch that updates entities spawned from
+        //! the previously recorded spawnable to the provided spawnable. Entities that refer to any of the updated or removed
+        //! entities are added to the patch as well as respawned entities get new ids. If nothing was recorded before, all
+        //! entities are reported as updated.
+        AzFramework::SpawnablePatch Record(
+            EntityFingerprints fingerprints, const AzFramework::Spawnable& spawnable, AZ::SerializeContext* serializeContext = nullptr);
+
+        //! Clears all recorded information.
+        void Reset();
+
+    private:
+        EntityFingerprints m_fingerprints;
+        AZStd::unordered_set<AZ::EntityId> m_spawnableEntityIds;
+        bool m_hasRecording{ false };
+    };
+} // namespace AzToolsFramework::Prefab::PrefabConversionUtils
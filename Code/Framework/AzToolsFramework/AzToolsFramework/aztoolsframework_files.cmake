@@ -973,6 +973,8 @@ set(FILES
     Prefab/Spawnable/PrefabProcessor.h
     Prefab/Spawnable/PrefabProcessorContext.h
     Prefab/Spawnable/PrefabProcessorContext.cpp
+    Prefab/Spawnable/SpawnableEntitySourceTracker.h
+    Prefab/Spawnable/SpawnableEntitySourceTracker.cpp
     Prefab/Spawnable/SpawnableMetaDataBuilder.h
     Prefab/Spawnable/SpawnableMetaDataBuilder.cpp
     Prefab/Spawnable/SpawnableUtils.h
@@ -8,6 +8,8 @@
 #if defined(HAVE_BENCHMARK)
 
 #include <Prefab/Benchmark/PrefabBenchmarkFixture.h>
+#include <Prefab/PrefabTestDataUtils.h>
+#include <Prefab/PrefabTestDomUtils.h>
 
 namespace Benchmark
 {
@@ -48,6 +50,82 @@ namespace Benchmark
         ->Range(100, 1000)
         ->Unit(benchmark::kMillisecond)
         ->Complexity();
+
+    //! Loads a synthetic level whose root prefab nests state.range() instances of a small set of prefabs,
+    //! each of which nests several leaf prefabs in turn.
+    BENCHMARK_DEFINE_F(BM_PrefabLoad, LoadPrefab_NestedLevel)(::benchmark::State& state)
+    {
+        constexpr unsigned int numLeafTemplates = 16;
+        constexpr unsigned int numNestedTemplates = 16;
+        constexpr unsigned int numLeafInstancesPerNestedTemplate = 4;
+        const unsigned int numLevelInstances = static_cast<unsigned int>(state.range());
+
+        const AZ::IO::Path levelPath = AZStd::string::format("%s/level_%u", m_pathString, numLevelInstances);
+
+        AZStd::vector<AZ::IO::Path> leafPaths;
+        for (unsigned int leafCounter = 0; leafCounter < numLeafTemplates; ++leafCounter)
+        {
+            leafPaths.push_back(AZStd::string::format("%s/leaf%u", m_pathString, leafCounter));
+        }
+
+        AZStd::vector<AZ::IO::Path> nestedPaths;
+        AZStd::vector<PrefabDom> nestedDoms;
+        for (unsigned int nestedCounter = 0; nestedCounter < numNestedTemplates; ++nestedCounter)
+        {
+            AZStd::vector<UnitTest::InstanceData> instancesData;
+            for (unsigned int instanceCounter = 0; instanceCounter < numLeafInstancesPerNestedTemplate; ++instanceCounter)
+            {
+                instancesData.push_back(UnitTest::PrefabTestDataUtils::CreateInstanceDataWithNoPatches(
+                    AZStd::string::format("Leaf_%u", instanceCounter),
+                    leafPaths[(nestedCounter + instanceCounter) % numLeafTemplates]));
+            }
+            nestedPaths.push_back(AZStd::string::format("%s/nested%u", m_pathString, nestedCounter));
+            nestedDoms.push_back(UnitTest::PrefabTestDomUtils::CreatePrefabDom(instancesData));
+        }
+
+        AZStd::vector<UnitTest::InstanceData> levelInstancesData;
+        for (unsigned int instanceCounter = 0; instanceCounter < numLevelInstances; ++instanceCounter)
+        {
+            levelInstancesData.push_back(UnitTest::PrefabTestDataUtils::CreateInstanceDataWithNoPatches(
+                AZStd::string::format("Nested_%u", instanceCounter),
+                nestedPaths[instanceCounter % numNestedTemplates]));
+        }
+        const PrefabDom levelDom = UnitTest::PrefabTestDomUtils::CreatePrefabDom(levelInstancesData);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+
+            m_mockIOActionValidator->ReadPrefabDom(levelPath, levelDom);
+            for (unsigned int nestedCounter = 0; nestedCounter < numNestedTemplates; ++nestedCounter)
+            {
+                m_mockIOActionValidator->ReadPrefabDom(nestedPaths[nestedCounter], nestedDoms[nestedCounter]);
+            }
+            for (const AZ::IO::Path& leafPath : leafPaths)
+            {
+                m_mockIOActionValidator->ReadPrefabDom(leafPath, UnitTest::PrefabTestDomUtils::CreatePrefabDom());
+            }
+
+            m_prefabLoaderInterface = AZ::Interface<PrefabLoaderInterface>::Get();
+
+            state.ResumeTiming();
+
+            m_prefabLoaderInterface->LoadTemplateFromFile(levelPath);
+
+            state.PauseTiming();
+
+            ResetPrefabSystem();
+
+            state.ResumeTiming();
+        }
+
+        state.SetComplexityN(numLevelInstances * (numLeafInstancesPerNestedTemplate + 1));
+    }
+    BENCHMARK_REGISTER_F(BM_PrefabLoad, LoadPrefab_NestedLevel)
+        ->RangeMultiplier(2)
+        ->Range(1000, 4000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
 }
 
 #endif
@@ -6,7 +6,12 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/sort.h>
+#include <AzToolsFramework/Prefab/Link/Link.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
+#include <AzToolsFramework/Prefab/PrefabLoader.h>
 #include <Prefab/MockPrefabFileIOActionValidator.h>
 #include <Prefab/PrefabTestData.h>
 #include <Prefab/PrefabTestDataUtils.h>
@@ -15,7 +20,85 @@
 
 namespace UnitTest
 {
-    using PrefabLoadTemplateTest = PrefabTestFixture;
+    class PrefabLoadTemplateTest
+        : public PrefabTestFixture
+    {
+    protected:
+        //! The state of a loaded template, with its ids relative to the first template and link id of the load.
+        struct LoadedTemplate
+        {
+            TemplateId m_templateIdOffset = InvalidTemplateId;
+            AZStd::vector<LinkId> m_linkIdOffsets;
+            PrefabDom m_prefabDom;
+        };
+
+        //! Loads the template at the first file path and captures the state of the templates at all file paths.
+        AZStd::vector<LoadedTemplate> LoadTemplates(const AZStd::vector<AZ::IO::Path>& filePaths)
+        {
+            m_prefabLoaderInterface->LoadTemplateFromFile(filePaths.front());
+
+            AZStd::vector<TemplateId> templateIds;
+            AZStd::vector<TemplateReference> templateReferences;
+            TemplateId firstTemplateId = InvalidTemplateId;
+            LinkId firstLinkId = InvalidLinkId;
+            for (const AZ::IO::Path& filePath : filePaths)
+            {
+                const TemplateId templateId = m_prefabSystemComponent->GetTemplateIdFromFilePath(filePath);
+                TemplateReference templateReference = m_prefabSystemComponent->FindTemplate(templateId);
+                EXPECT_TRUE(templateReference.has_value());
+                if (!templateReference.has_value())
+                {
+                    return {};
+                }
+                templateIds.push_back(templateId);
+                templateReferences.push_back(templateReference);
+                firstTemplateId = AZStd::min(firstTemplateId, templateId);
+                for (LinkId linkId : templateReference->get().GetLinks())
+                {
+                    firstLinkId = AZStd::min(firstLinkId, linkId);
+                }
+            }
+
+            AZStd::vector<LoadedTemplate> loadedTemplates(templateReferences.size());
+            for (size_t index = 0; index < templateReferences.size(); ++index)
+            {
+                const Template& loadedTemplate = templateReferences[index]->get();
+                LoadedTemplate& result = loadedTemplates[index];
+                result.m_templateIdOffset = templateIds[index] - firstTemplateId;
+                for (LinkId linkId : loadedTemplate.GetLinks())
+                {
+                    result.m_linkIdOffsets.push_back(linkId - firstLinkId);
+                }
+                AZStd::sort(result.m_linkIdOffsets.begin(), result.m_linkIdOffsets.end());
+
+                result.m_prefabDom.CopyFrom(loadedTemplate.GetPrefabDom(), result.m_prefabDom.GetAllocator());
+                PrefabDomValueReference instancesReference =
+                    PrefabDomUtils::FindPrefabDomValue(result.m_prefabDom, PrefabDomUtils::InstancesName);
+                if (instancesReference.has_value() && instancesReference->get().IsObject())
+                {
+                    for (auto& instance : instancesReference->get().GetObject())
+                    {
+                        PrefabDomValueReference linkIdReference =
+                            PrefabDomUtils::FindPrefabDomValue(instance.value, PrefabDomUtils::LinkIdName);
+                        if (linkIdReference.has_value() && linkIdReference->get().IsUint64())
+                        {
+                            linkIdReference->get().SetUint64(linkIdReference->get().GetUint64() - firstLinkId);
+                        }
+                    }
+                }
+            }
+            return loadedTemplates;
+        }
+
+        //! Calls PrefabLoader::UpdateLinkedInstances with a custom callback to create the patched instance DOMs.
+        template<typename GenerateFunction>
+        bool UpdateLinkedInstances(const AZStd::vector<LinkId>& linkIds, GenerateFunction&& generateLinkedInstanceDom)
+        {
+            auto prefabLoader = azrtti_cast<PrefabLoader*>(m_prefabLoaderInterface);
+            EXPECT_NE(nullptr, prefabLoader);
+            return prefabLoader && prefabLoader->UpdateLinkedInstances(linkIds, AZStd::forward<GenerateFunction>(generateLinkedInstanceDom));
+        }
+    };
 
     TEST_F(PrefabLoadTemplateTest, LoadTemplate_TemplateWithNoNestedInstance)
     {
@@ -199,6 +282,171 @@ namespace UnitTest
         PrefabTestDataUtils::ValidateTemplateLoad(templateData);
     }
 
+    TEST_F(PrefabLoadTemplateTest, LoadTemplate_RemoveLinkOfNestedInstance_NoLinkOrInstanceLeft)
+    {
+        // Loading removes the link of a nested instance whose patches fail to apply. Patch failures are reported as skipped
+        // patches by the Prefab serializer, so remove the link of a loaded instance the same way and check that nothing is left.
+        TemplateData sourceTemplateData;
+        sourceTemplateData.m_filePath = "path/to/template/with/no/nested/instance";
+
+        TemplateData targetTemplateData;
+        targetTemplateData.m_filePath = "path/to/template/with/one/nested/instance";
+
+        InstanceData targetTemplateInstanceData = PrefabTestDataUtils::CreateInstanceDataWithNoPatches(
+            "sourceTemplateInstance", sourceTemplateData.m_filePath);
+
+        MockPrefabFileIOActionValidator mockIOActionValidator;
+        mockIOActionValidator.ReadPrefabDom(
+            sourceTemplateData.m_filePath, PrefabTestDomUtils::CreatePrefabDom());
+        mockIOActionValidator.ReadPrefabDom(
+            targetTemplateData.m_filePath, PrefabTestDomUtils::CreatePrefabDom({ targetTemplateInstanceData }));
+
+        targetTemplateData.m_id = m_prefabLoaderInterface->LoadTemplateFromFile(targetTemplateData.m_filePath);
+        sourceTemplateData.m_id = m_prefabSystemComponent->GetTemplateIdFromFilePath(sourceTemplateData.m_filePath);
+
+        auto targetTemplateReference = m_prefabSystemComponent->FindTemplate(targetTemplateData.m_id);
+        ASSERT_TRUE(targetTemplateReference.has_value());
+        ASSERT_EQ(1, targetTemplateReference->get().GetLinks().size());
+        const LinkId linkId = *targetTemplateReference->get().GetLinks().begin();
+
+        EXPECT_TRUE(m_prefabSystemComponent->RemoveLink(linkId));
+
+        EXPECT_FALSE(m_prefabSystemComponent->FindLink(linkId).has_value());
+        PrefabDomPath instancePath = PrefabTestDomUtils::GetPrefabDomInstancePath(targetTemplateInstanceData.m_name.c_str());
+        EXPECT_EQ(nullptr, instancePath.Get(targetTemplateReference->get().GetPrefabDom()));
+        PrefabTestDataUtils::ValidateTemplateLoad(sourceTemplateData);
+        PrefabTestDataUtils::ValidateTemplateLoad(targetTemplateData);
+    }
+
+    TEST_F(PrefabLoadTemplateTest, UpdateLinkedInstances_PatchingFails_LinkAndInstanceRemoved)
+    {
+        // The Prefab issue reporter turns every failed patch operation into a skipped one, so let the patching fail directly.
+        TemplateData targetTemplateData;
+        targetTemplateData.m_filePath = "path/to/template/with/two/nested/instances";
+
+        AZStd::vector<InstanceData> targetTemplateInstancesData;
+        MockPrefabFileIOActionValidator mockIOActionValidator;
+        for (int i = 0; i < 2; i++)
+        {
+            AZ::IO::Path sourceTemplatePath = AZStd::string::format("path/to/source/%d/template", i);
+            targetTemplateInstancesData.push_back(PrefabTestDataUtils::CreateInstanceDataWithNoPatches(
+                AZStd::string::format("source%dTemplateInstance", i), sourceTemplatePath));
+            mockIOActionValidator.ReadPrefabDom(sourceTemplatePath, PrefabTestDomUtils::CreatePrefabDom());
+        }
+        mockIOActionValidator.ReadPrefabDom(
+            targetTemplateData.m_filePath, PrefabTestDomUtils::CreatePrefabDom(targetTemplateInstancesData));
+
+        targetTemplateData.m_id = m_prefabLoaderInterface->LoadTemplateFromFile(targetTemplateData.m_filePath);
+        auto targetTemplateReference = m_prefabSystemComponent->FindTemplate(targetTemplateData.m_id);
+        ASSERT_TRUE(targetTemplateReference.has_value());
+        const Template::Links& links = targetTemplateReference->get().GetLinks();
+        ASSERT_EQ(2, links.size());
+        const AZStd::vector<LinkId> linkIds(links.begin(), links.end());
+
+        const AZStd::string failingInstanceName = targetTemplateInstancesData[0].m_name;
+        LinkId failingLinkId = InvalidLinkId;
+        LinkId remainingLinkId = InvalidLinkId;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        const bool isUpdated = UpdateLinkedInstances(
+            linkIds,
+            [&failingInstanceName, &failingLinkId, &remainingLinkId](const Link& link, PrefabDom& linkedInstanceDom)
+            {
+                if (link.GetInstanceName() == failingInstanceName)
+                {
+                    failingLinkId = link.GetId();
+                    return false;
+                }
+                remainingLinkId = link.GetId();
+                return link.GenerateLinkedInstanceDom(linkedInstanceDom);
+            });
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        EXPECT_FALSE(isUpdated);
+        ASSERT_NE(InvalidLinkId, failingLinkId);
+        ASSERT_NE(InvalidLinkId, remainingLinkId);
+        EXPECT_FALSE(m_prefabSystemComponent->FindLink(failingLinkId).has_value());
+        EXPECT_TRUE(m_prefabSystemComponent->FindLink(remainingLinkId).has_value());
+        EXPECT_EQ(1, targetTemplateReference->get().GetLinks().size());
+
+        const PrefabDom& targetTemplateDom = targetTemplateReference->get().GetPrefabDom();
+        EXPECT_EQ(nullptr, PrefabTestDomUtils::GetPrefabDomInstancePath(failingInstanceName.c_str()).Get(targetTemplateDom));
+        EXPECT_NE(
+            nullptr,
+            PrefabTestDomUtils::GetPrefabDomInstancePath(targetTemplateInstancesData[1].m_name.c_str()).Get(targetTemplateDom));
+    }
+
+    TEST_F(PrefabLoadTemplateTest, LoadTemplate_ParallelLoading_MatchesSerialLoading)
+    {
+        // Use more instances in the root template than PrefabLoader patches in one batch, so several batches are processed.
+        constexpr unsigned int numLeafTemplates = 3;
+        constexpr unsigned int numNestedTemplates = 4;
+        constexpr unsigned int numLeafInstancesPerNestedTemplate = 2;
+        constexpr unsigned int numRootInstances = 150;
+
+        MockPrefabFileIOActionValidator mockIOActionValidator;
+        AZStd::vector<AZ::IO::Path> filePaths;
+        filePaths.push_back("path/to/parallel/root");
+
+        AZStd::vector<AZ::IO::Path> leafPaths;
+        for (unsigned int leafCounter = 0; leafCounter < numLeafTemplates; ++leafCounter)
+        {
+            leafPaths.push_back(AZStd::string::format("path/to/parallel/leaf%u", leafCounter));
+            mockIOActionValidator.ReadPrefabDom(leafPaths.back(), PrefabTestDomUtils::CreatePrefabDom());
+        }
+
+        AZStd::vector<AZ::IO::Path> nestedPaths;
+        for (unsigned int nestedCounter = 0; nestedCounter < numNestedTemplates; ++nestedCounter)
+        {
+            AZStd::vector<InstanceData> instancesData;
+            for (unsigned int instanceCounter = 0; instanceCounter < numLeafInstancesPerNestedTemplate; ++instanceCounter)
+            {
+                instancesData.push_back(PrefabTestDataUtils::CreateInstanceDataWithNoPatches(
+                    AZStd::string::format("Leaf_%u", instanceCounter), leafPaths[(nestedCounter + instanceCounter) % numLeafTemplates]));
+            }
+            nestedPaths.push_back(AZStd::string::format("path/to/parallel/nested%u", nestedCounter));
+            mockIOActionValidator.ReadPrefabDom(nestedPaths.back(), PrefabTestDomUtils::CreatePrefabDom(instancesData));
+        }
+
+        AZStd::vector<InstanceData> rootInstancesData;
+        for (unsigned int instanceCounter = 0; instanceCounter < numRootInstances; ++instanceCounter)
+        {
+            rootInstancesData.push_back(PrefabTestDataUtils::CreateInstanceDataWithNoPatches(
+                AZStd::string::format("Nested_%u", instanceCounter), nestedPaths[instanceCounter % numNestedTemplates]));
+        }
+        mockIOActionValidator.ReadPrefabDom(filePaths.front(), PrefabTestDomUtils::CreatePrefabDom(rootInstancesData));
+
+        filePaths.insert(filePaths.end(), nestedPaths.begin(), nestedPaths.end());
+        filePaths.insert(filePaths.end(), leafPaths.begin(), leafPaths.end());
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        ASSERT_NE(nullptr, taskGraphActiveInterface);
+
+        console->PerformCommand("cl_activateTaskGraph false");
+        ASSERT_FALSE(taskGraphActiveInterface->IsTaskGraphActive());
+        const AZStd::vector<LoadedTemplate> serialTemplates = LoadTemplates(filePaths);
+        m_prefabSystemComponent->RemoveAllTemplates();
+
+        console->PerformCommand("cl_activateTaskGraph true");
+        ASSERT_TRUE(taskGraphActiveInterface->IsTaskGraphActive());
+        const AZStd::vector<LoadedTemplate> parallelTemplates = LoadTemplates(filePaths);
+        console->PerformCommand("cl_activateTaskGraph false");
+
+        ASSERT_EQ(filePaths.size(), serialTemplates.size());
+        ASSERT_EQ(serialTemplates.size(), parallelTemplates.size());
+        EXPECT_EQ(numRootInstances, serialTemplates.front().m_linkIdOffsets.size());
+        for (size_t index = 0; index < serialTemplates.size(); ++index)
+        {
+            EXPECT_EQ(serialTemplates[index].m_templateIdOffset, parallelTemplates[index].m_templateIdOffset);
+            EXPECT_EQ(serialTemplates[index].m_linkIdOffsets, parallelTemplates[index].m_linkIdOffsets);
+            EXPECT_EQ(
+                AZ::JsonSerializerCompareResult::Equal,
+                AZ::JsonSerialization::Compare(serialTemplates[index].m_prefabDom, parallelTemplates[index].m_prefabDom))
+                << "Template '" << filePaths[index].c_str() << "' differs between serial and parallel loading.";
+        }
+    }
+
     TEST_F(PrefabLoadTemplateTest, LoadTemplate_MultiLevelTemplates_WithNoPatches)
     {
         MockPrefabFileIOActionValidator mockIOActionValidator;
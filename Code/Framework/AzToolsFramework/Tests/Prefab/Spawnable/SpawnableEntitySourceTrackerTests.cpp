@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzToolsFramework/Prefab/Spawnable/SpawnableEntitySourceTracker.h>
+#include <Prefab/Spawnable/SpawnableTestFixture.h>
+
+namespace UnitTest
+{
+    class SpawnableEntitySourceTrackerTests : public SpawnableTestFixture
+    {
+    protected:
+        using Tracker = AzToolsFramework::Prefab::PrefabConversionUtils::SpawnableEntitySourceTracker;
+
+        struct EntityDescription
+        {
+            AZ::u64 m_id;
+            AZ::u64 m_parentId;
+        };
+
+        //! Creates a spawnable with entities that have the given ids and refer to their parent through their transform.
+        AZ::Data::Asset<AzFramework::Spawnable> CreateHierarchySpawnable(const AZStd::vector<EntityDescription>& descriptions)
+        {
+            AzFramework::Spawnable* spawnable =
+                new AzFramework::Spawnable(AZ::Data::AssetId(AZ::Uuid::CreateRandom()), AZ::Data::AssetData::AssetStatus::Ready);
+
+            AzFramework::Spawnable::EntityList& entities = spawnable->GetEntities();
+            for (const EntityDescription& description : descriptions)
+            {
+                AZStd::unique_ptr<AZ::Entity> entity = CreateEntity(
+                    "Entity", description.m_parentId != 0 ? AZ::EntityId(description.m_parentId) : AZ::EntityId());
+                entity->SetId(AZ::EntityId(description.m_id));
+                entities.emplace_back(AZStd::move(entity));
+            }
+
+            return AZ::Data::Asset<AzFramework::Spawnable>(spawnable, AZ::Data::AssetLoadBehavior::Default);
+        }
+
+        // Entity 1 is the root of 2, which is the parent of 3. Entity 4 isn't related to the other entities.
+        const AZStd::vector<EntityDescription> m_hierarchy = { { 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 0 } };
+        const Tracker::EntityFingerprints m_fingerprints = {
+            { AZ::EntityId(1), 10 }, { AZ::EntityId(2), 20 }, { AZ::EntityId(3), 30 }, { AZ::EntityId(4), 40 }
+        };
+    };
+
+    TEST_F(SpawnableEntitySourceTrackerTests, Record_FirstRecording_AllEntitiesAreUpdated)
+    {
+        Tracker tracker;
+        EXPECT_FALSE(tracker.HasRecording());
+
+        AzFramework::SpawnablePatch patch = tracker.Record(m_fingerprints, *CreateHierarchySpawnable(m_hierarchy));
+
+        EXPECT_TRUE(tracker.HasRecording());
+        EXPECT_EQ((AZStd::vector<uint32_t>{ 0, 1, 2, 3 }), patch.m_updatedEntityIndices);
+        EXPECT_TRUE(patch.m_removedEntityIds.empty());
+    }
+
+    TEST_F(SpawnableEntitySourceTrackerTests, Record_SameFingerprints_PatchIsEmpty)
+    {
+        Tracker tracker;
+        tracker.Record(m_fingerprints, *CreateHierarchySpawnable(m_hierarchy));
+
+        EXPECT_FALSE(tracker.HasChanges(m_fingerprints));
+        AzFramework::SpawnablePatch patch = tracker.Record(m_fingerprints, *CreateHierarchySpawnable(m_hierarchy));
+        EXPECT_TRUE(patch.IsEmpty());
+    }
+
+    TEST_F(SpawnableEntitySourceTrackerTests, Record_ChangedFingerprint_ChangedAndReferencingEntitiesAreUpdated)
+    {
+        Tracker tracker;
+        tracker.Record(m_fingerprints, *CreateHierarchySpawnable(m_hierarchy));
+
+        Tracker::EntityFingerprints changedFingerprints = m_fingerprints;
+        changedFingerprints[AZ::EntityId(2)] = 21;
+        EXPECT_TRUE(tracker.HasChanges(changedFingerprints));
+
+        AzFramework::SpawnablePatch patch = tracker.Record(changedFingerprints, *CreateHierarchySpawnable(m_hierarchy));
+        // Entity 3 didn't change, but refers to entity 2 which will get a new id when respawned.
+        EXPECT_EQ((AZStd::vector<uint32_t>{ 1, 2 }), patch.m_updatedEntityIndices);
+        EXPECT_TRUE(patch.m_removedEntityIds.empty());
+    }
+
+    TEST_F(SpawnableEntitySourceTrackerTests, Record_RemovedAndAddedEntities_AreReportedInPatch)
+    {
+        Tracker tracker;
+        tracker.Record(m_fingerprints, *CreateHierarchySpawnable(m_hierarchy));
+
+        Tracker::EntityFingerprints changedFingerprints = m_fingerprints;
+        changedFingerprints.erase(AZ::EntityId(1));
+        changedFingerprints[AZ::EntityId(5)] = 50;
+
+        AzFramework::SpawnablePatch patch = tracker.Record(
+            changedFingerprints, *CreateHierarchySpawnable({ { 2, 1 }, { 3, 2 }, { 4, 0 }, { 5, 4 } }));
+        // Entity 2 still refers to the removed entity 1, so it's respawned together with entity 3 which refers to it.
+        EXPECT_EQ((AZStd::vector<uint32_t>{ 0, 1, 3 }), patch.m_updatedEntityIndices);
+        ASSERT_EQ(1, patch.m_removedEntityIds.size());
+        EXPECT_EQ(AZ::EntityId(1), patch.m_removedEntityIds[0]);
+    }
+
+    TEST_F(SpawnableEntitySourceTrackerTests, Record_EntityWithoutFingerprint_IsAlwaysUpdated)
+    {
+        Tracker tracker;
+        Tracker::EntityFingerprints partialFingerprints = m_fingerprints;
+        partialFingerprints.erase(AZ::EntityId(4));
+        tracker.Record(partialFingerprints, *CreateHierarchySpawnable(m_hierarchy));
+
+        AzFramework::SpawnablePatch patch = tracker.Record(partialFingerprints, *CreateHierarchySpawnable(m_hierarchy));
+        EXPECT_EQ((AZStd::vector<uint32_t>{ 3 }), patch.m_updatedEntityIndices);
+    }
+} // namespace UnitTest
@@ -15,6 +15,7 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/string/string_view.h>
 #include <AzCore/std/utility/expected.h>
 
 #include <Compression/CompressionInterfaceStructs.h>
@@ -51,6 +52,11 @@ namespace Archive
     //! there are no further deleted blocks afterwards
     constexpr AZ::u64 DeletedBlockOffsetSentinel = AZStd::numeric_limits<AZ::u64>::max();
 
+    //! Relative path of the shared ZStd dictionary within an archive
+    //! Files compressed with ZStd without caller supplied compression options
+    //! are compressed and decompressed with the dictionary stored at this path if the archive contains one
+    constexpr AZStd::string_view ArchiveZStdDictionaryPath = "archive/zstd_dictionary.bin";
+
     //! O3DE only runs on little endian machines
     //! Therefore the bytes are added in little endian order
     //! The Magic Identifier for the archive format is "O3AR" for O3DE Archive
@@ -52,6 +52,7 @@ namespace Archive
         ErrorOpeningArchive = 1,
         ErrorReadingHeader,
         ErrorReadingTableOfContents,
+        ErrorReadingZStdDictionary,
     };
     using ArchiveReaderErrorString = AZStd::fixed_string<512>;
 
@@ -81,6 +82,13 @@ namespace Archive
         //! Configures the maximum number of read task that can run in parallel
         //! For a value of 0 maps to a single read task
         AZ::u32 m_maxReadTasks{ 1 };
+
+        //! When set, an archive mounted by file path is memory mapped.
+        //! Uncompressed files are then copied straight out of the mapping and compressed blocks
+        //! are decompressed from the mapping without staging them in an intermediate buffer.
+        //! If the archive can't be mapped, file reads are used instead.
+        //! Archives mounted through a user supplied stream are always read through the stream
+        bool m_useMemoryMappedReads{ false };
     };
 
     //! Settings for controlling how an individual file is extracted from an archive.
@@ -11,6 +11,7 @@
 #include <AzCore/base.h>
 
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
 
 #include <Archive/Clients/ArchiveBaseAPI.h>
@@ -41,6 +42,7 @@ namespace Archive
         ErrorReadingHeader,
         ErrorReadingTableOfContents,
         ErrorWritingTableOfContents,
+        ErrorWritingZStdDictionary,
     };
     using ArchiveWriterErrorString = AZStd::fixed_string<512>;
 
@@ -81,6 +83,13 @@ namespace Archive
         //! If the value is 0, then a single compression task that will be run
         //! at a given moment
         AZ::u32 m_maxCompressTasks{ AZStd::thread::hardware_concurrency() };
+
+        //! Optional shared ZStd dictionary for the archive
+        //! When not empty, the dictionary is stored uncompressed at ArchiveZStdDictionaryPath when the archive is mounted
+        //! and it's used to compress any file added with the ZStd compression algorithm that doesn't supply its own
+        //! compression options. The ArchiveReader loads it on mount to decompress those files.
+        //! A dictionary trained on samples of the archive content substantially improves the compression ratio of small files
+        AZStd::vector<AZStd::byte> m_zstdDictionary;
     };
 
     enum class ArchiveWriterFileMode : bool
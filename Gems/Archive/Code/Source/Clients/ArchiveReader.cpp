@@ -16,6 +16,7 @@
 
 #include <Archive/ArchiveTypeIds.h>
 
+#include <Compression/CompressionZStdAPI.h>
 #include <Compression/DecompressionInterfaceAPI.h>
 
 namespace Archive
@@ -236,6 +237,14 @@ namespace Archive
             UnmountArchive();
             return false;
         }
+
+        // The header and TOC are only read once, so they're read through the stream
+        // The mapping is used for the file content reads
+        if (m_settings.m_useMemoryMappedReads && !m_mappedArchive.Open(mountPath.c_str()))
+        {
+            AZ_Warning("ArchiveReader", false, "Archive with filename %s could not be memory mapped."
+                " File reads will be used instead.", mountPath.c_str());
+        }
         return true;
     }
 
@@ -270,11 +279,36 @@ namespace Archive
 
         const bool mountResult = ReadArchiveHeader(m_archiveHeader, *m_archiveStream)
             && ReadArchiveTOC(m_archiveToc, *m_archiveStream, m_archiveHeader)
-            && BuildFilePathMap(m_archiveToc.m_tocView);
+            && BuildFilePathMap(m_archiveToc.m_tocView)
+            && ReadZStdDictionary();
 
         return mountResult;
     }
 
+    bool ArchiveReader::ReadZStdDictionary()
+    {
+        m_zstdDictionary.clear();
+        const ArchiveListFileResult dictionaryListResult = ListFileInArchive(ArchiveZStdDictionaryPath);
+        if (!dictionaryListResult)
+        {
+            return true;
+        }
+
+        m_zstdDictionary.resize_no_construct(dictionaryListResult.m_uncompressedSize);
+        ArchiveReaderFileSettings fileSettings;
+        fileSettings.m_filePathIdentifier = dictionaryListResult.m_filePathToken;
+        if (ArchiveExtractFileResult extractResult = ExtractFileFromArchive(m_zstdDictionary, fileSettings);
+            !extractResult)
+        {
+            m_settings.m_errorCallback({ ArchiveReaderErrorCode::ErrorReadingZStdDictionary, ArchiveReaderErrorString::format(
+                "The ZStd dictionary stored at %.*s could not be read from the archive: %s",
+                AZ_STRING_ARG(ArchiveZStdDictionaryPath), extractResult.m_resultOutcome.error().c_str()) });
+            m_zstdDictionary.clear();
+            return false;
+        }
+        return true;
+    }
+
     void ArchiveReader::UnmountArchive()
     {
         if (m_archiveStream != nullptr && m_archiveStream->IsOpen())
@@ -286,8 +320,10 @@ namespace Archive
             m_archiveToc = {};
             // Finally clear the archive header
             m_archiveHeader = {};
+            m_zstdDictionary.clear();
         }
 
+        m_mappedArchive.Close();
         m_archiveStream.reset();
     }
 
@@ -406,6 +442,20 @@ namespace Archive
                 " Buffer size is %zu, while %llu is required.", readOffset, fileBuffer.size(), bytesToRead));
         }
 
+        if (m_mappedArchive.IsOpen())
+        {
+            // The mapping can be read from any thread at any offset, so no lock is needed
+            AZStd::span<const AZStd::byte> mappedFileData = m_mappedArchive.GetView(readOffset, bytesToRead);
+            if (mappedFileData.size() < bytesToRead)
+            {
+                return AZStd::unexpected(ResultString::format("Attempted to read %llu bytes from the archive at offset %lld."
+                    " But only %zu bytes are available in the mapped archive.", bytesToRead, readOffset, mappedFileData.size()));
+            }
+
+            memcpy(fileBuffer.data(), mappedFileData.data(), bytesToRead);
+            return fileBuffer.first(bytesToRead);
+        }
+
         AZStd::scoped_lock archiveReadLock(m_archiveStreamMutex);
         if (AZ::IO::SizeType bytesRead = m_archiveStream->ReadAtOffset(bytesToRead, fileBuffer.data(), readOffset);
             bytesRead < bytesToRead)
@@ -553,46 +603,81 @@ namespace Archive
             }
         }
 
-        // Stores the list of compressed blocks to decompress
+        // Stores a view of each compressed block to decompress
+        // The views either point into the memory mapped archive or into the compressedBlocks buffer
+        AZStd::vector<AZStd::span<const AZStd::byte>> compressedBlockSpans;
+        compressedBlockSpans.reserve(blockRange.second - blockRange.first);
+
+        // Buffer which stores the compressed blocks read from the archive stream
+        // It isn't needed when the archive is memory mapped
         AZStd::vector<AZStd::byte> compressedBlocks;
-        compressedBlocks.resize_no_construct((blockRange.second - blockRange.first) * ArchiveBlockSizeForCompression);
+        if (!m_mappedArchive.IsOpen())
+        {
+            compressedBlocks.resize_no_construct((blockRange.second - blockRange.first) * ArchiveBlockSizeForCompression);
+        }
         AZStd::span<AZStd::byte> compressedBlockRemainingSpan = compressedBlocks;
 
         AZ::IO::SizeType fileRelativeSeekOffset = alignedFirstSeekOffset;
         for (AZ::u64 blockIndex = blockRange.first; blockIndex != blockRange.second; ++blockIndex)
         {
             const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(fileBlockLineSpan, blockCount, blockIndex);
-            // Get the next 2 MiB block (or less if in the final block) of memory to store the compressed block data
-            const auto availableBytesInCompressedBlock = AZStd::min<size_t>(compressedBlockRemainingSpan.size(),
-                ArchiveBlockSizeForCompression);
-            const AZStd::span<AZStd::byte> compressedBlockToReadInto = compressedBlockRemainingSpan.first(
-                availableBytesInCompressedBlock);
-            // Slide the compressed block remaining span view ahead by the 2 MiB that is being used for the read span
-            compressedBlockRemainingSpan = compressedBlockRemainingSpan.subspan(availableBytesInCompressedBlock);
             const AZ::u64 absoluteSeekOffset = extractFileResult.m_offset + fileRelativeSeekOffset;
-            if (AZ::IO::SizeType bytesRead = m_archiveStream->ReadAtOffset(blockCompressedSize,
-                compressedBlockToReadInto.data(), absoluteSeekOffset);
-                bytesRead != blockCompressedSize)
+            if (m_mappedArchive.IsOpen())
             {
-                return AZStd::unexpected(ResultString::format("Cannot read all of compressed block for"
-                    " block %llu. The compressed block size is %llu, but only %llu was able to be read",
-                    blockIndex, blockCompressedSize, bytesRead));
+                AZStd::span<const AZStd::byte> mappedBlock = m_mappedArchive.GetView(absoluteSeekOffset, blockCompressedSize);
+                if (mappedBlock.size() != blockCompressedSize)
+                {
+                    return AZStd::unexpected(ResultString::format("Cannot read all of compressed block for"
+                        " block %llu. The compressed block size is %llu, but only %zu bytes are available in the mapped archive",
+                        blockIndex, blockCompressedSize, mappedBlock.size()));
+                }
+                compressedBlockSpans.emplace_back(mappedBlock);
+            }
+            else
+            {
+                // Get the next 2 MiB block (or less if in the final block) of memory to store the compressed block data
+                const auto availableBytesInCompressedBlock = AZStd::min<size_t>(compressedBlockRemainingSpan.size(),
+                    ArchiveBlockSizeForCompression);
+                const AZStd::span<AZStd::byte> compressedBlockToReadInto = compressedBlockRemainingSpan.first(
+                    availableBytesInCompressedBlock);
+                // Slide the compressed block remaining span view ahead by the 2 MiB that is being used for the read span
+                compressedBlockRemainingSpan = compressedBlockRemainingSpan.subspan(availableBytesInCompressedBlock);
+                if (AZ::IO::SizeType bytesRead = m_archiveStream->ReadAtOffset(blockCompressedSize,
+                    compressedBlockToReadInto.data(), absoluteSeekOffset);
+                    bytesRead != blockCompressedSize)
+                {
+                    return AZStd::unexpected(ResultString::format("Cannot read all of compressed block for"
+                        " block %llu. The compressed block size is %llu, but only %llu was able to be read",
+                        blockIndex, blockCompressedSize, bytesRead));
+                }
+                // Downsize the 2 MiB span that was used to read the compressed data to the exact compressed size
+                compressedBlockSpans.emplace_back(compressedBlockToReadInto.first(blockCompressedSize));
             }
 
             // As the read was successful add the aligned compressed size to the fileRelativeSeekOffset
             // The value is the read offset where the next block data starts
             fileRelativeSeekOffset += AZ_SIZE_ALIGN_UP(blockCompressedSize, ArchiveDefaultBlockAlignment);
         }
-
-        // Reset the compressed block remaining to the start of the compressedBlocks vector
-        compressedBlockRemainingSpan = compressedBlocks;
         // The span below is used to slide a 2 MiB window for storing decompressed file contents
         AZStd::span<AZStd::byte> decompressionRemainingSpan = decompressionResultSpan;
 
         // Get a reference to the the caller supplied decompression options if available
-        const auto& decompressionOptions = fileSettings.m_decompressionOptions != nullptr
-            ? *fileSettings.m_decompressionOptions
-            : Compression::DecompressionOptions{};
+        // Otherwise files compressed with ZStd use the shared dictionary stored in the archive
+        // The options are selected through a pointer to avoid slicing the derived options into a DecompressionOptions copy
+        Compression::DecompressionOptions defaultDecompressionOptions;
+        CompressionZStd::DecompressionZStdOptions zstdDictionaryOptions;
+        zstdDictionaryOptions.m_dictionary = m_zstdDictionary;
+        const Compression::DecompressionOptions* decompressionOptionsPtr = &defaultDecompressionOptions;
+        if (fileSettings.m_decompressionOptions != nullptr)
+        {
+            decompressionOptionsPtr = fileSettings.m_decompressionOptions;
+        }
+        else if (extractFileResult.m_compressionAlgorithm == CompressionZStd::GetZStdCompressionAlgorithmId()
+            && !m_zstdDictionary.empty())
+        {
+            decompressionOptionsPtr = &zstdDictionaryOptions;
+        }
+        const Compression::DecompressionOptions& decompressionOptions = *decompressionOptionsPtr;
 
         // m_maxDecompressTasks has a minimum value of 1
         // This makes sure there is never a scenario where the there are blocks to decompress
@@ -617,15 +702,7 @@ namespace Archive
             for (AZ::u32 decompressTaskSlot = 0; decompressTaskSlot < decompressTaskCount; ++decompressTaskSlot,
                 ++blockIndex)
             {
-                const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(fileBlockLineSpan, blockCount, blockIndex);
-                // Downsize the 2 MiB span that was used to read the compressed data to the exact compressed size
-                const auto availableBytesInCompressedBlock = AZStd::min<size_t>(compressedBlockRemainingSpan.size(),
-                    ArchiveBlockSizeForCompression);
-                AZStd::span<const AZStd::byte> compressedDataForBlock = compressedBlockRemainingSpan
-                    .first(availableBytesInCompressedBlock)
-                    .first(blockCompressedSize);
-                // Slide the compressed block remaining span by 2 MiB
-                compressedBlockRemainingSpan = compressedBlockRemainingSpan.subspan(availableBytesInCompressedBlock);
+                AZStd::span<const AZStd::byte> compressedDataForBlock = compressedBlockSpans[blockIndex - blockRange.first];
 
                 // Get the block span for storing the decompressed block
                 // As the uncompressed size is 2 MiB for all blocks except the last
@@ -13,6 +13,7 @@
 
 #include <Clients/ArchiveTOCView.h>
 
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/Memory/Memory_fwd.h>
 #include <AzCore/RTTI/RTTIMacros.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -166,6 +167,10 @@ namespace Archive
             const ArchiveReaderFileSettings& fileSettings,
             const ArchiveExtractFileResult& extractFileResult);
 
+        //! Reads the shared ZStd dictionary stored at ArchiveZStdDictionaryPath into memory
+        //! @return true if the archive doesn't contain a dictionary or if it has been read successfully
+        bool ReadZStdDictionary();
+
 
         // Private Member variables section
 
@@ -205,6 +210,10 @@ namespace Archive
         //! GenericStream pointer which stores the open archive
         ArchiveStreamPtr m_archiveStream;
 
+        //! Read-only mapping of the mounted archive file
+        //! Only open when the archive is mounted by path with the m_useMemoryMappedReads setting
+        AZ::IO::MappedFile m_mappedArchive;
+
         //! Protects reads within the archive stream
         //! NOTE: This does restrict read jobs to be done on one thread at a time
         //! if done using the AZ::IO::GenericStream API as it maintains a single seek position
@@ -212,5 +221,9 @@ namespace Archive
 
         //! Task Executor used to decompress blocks of a file in parallel
         AZ::TaskExecutor m_taskExecutor;
+
+        //! Shared ZStd dictionary read from the archive on mount
+        //! Empty if the archive doesn't contain a dictionary
+        AZStd::vector<AZStd::byte> m_zstdDictionary;
     };
 } // namespace Archive
@@ -20,6 +20,7 @@
 #include <Archive/ArchiveTypeIds.h>
 
 #include <Compression/CompressionInterfaceAPI.h>
+#include <Compression/CompressionZStdAPI.h>
 #include <Compression/DecompressionInterfaceAPI.h>
 
 namespace Archive
@@ -397,7 +398,7 @@ namespace Archive
             UnmountArchive();
             return false;
         }
-        return true;
+        return WriteZStdDictionary();
     }
 
     bool ArchiveWriter::MountArchive(ArchiveStreamPtr archiveStream)
@@ -421,7 +422,7 @@ namespace Archive
             UnmountArchive();
             return false;
         }
-        return true;
+        return WriteZStdDictionary();
     }
 
     bool ArchiveWriter::ReadArchiveHeaderAndToc()
@@ -444,6 +445,29 @@ namespace Archive
         return mountResult;
     }
 
+    bool ArchiveWriter::WriteZStdDictionary()
+    {
+        if (m_settings.m_zstdDictionary.empty())
+        {
+            return true;
+        }
+
+        // The dictionary is needed before any file compressed with it can be decompressed
+        // so it is always stored uncompressed
+        ArchiveWriterFileSettings dictionaryFileSettings;
+        dictionaryFileSettings.m_relativeFilePath = ArchiveZStdDictionaryPath;
+        dictionaryFileSettings.m_compressionAlgorithm = Compression::Uncompressed;
+        dictionaryFileSettings.m_fileMode = ArchiveWriterFileMode::AddNewOrUpdateExisting;
+        if (ArchiveAddFileResult addFileResult = AddFileToArchive(m_settings.m_zstdDictionary, dictionaryFileSettings);
+            !addFileResult)
+        {
+            m_settings.m_errorCallback({ ArchiveWriterErrorCode::ErrorWritingZStdDictionary,
+                AZStd::move(addFileResult.m_resultOutcome.error()) });
+            return false;
+        }
+        return true;
+    }
+
     void ArchiveWriter::UnmountArchive()
     {
         if (m_archiveStream != nullptr && m_archiveStream->IsOpen())
@@ -941,9 +965,23 @@ namespace Archive
             return contentFileBlocks;
         }
 
-        const Compression::CompressionOptions& compressionOptions = fileSettings.m_compressionOptions != nullptr
-            ? *fileSettings.m_compressionOptions
-            : Compression::CompressionOptions{};
+        // Use the caller supplied compression options if available
+        // Otherwise files compressed with ZStd use the shared dictionary from the writer settings
+        // The options are selected through a pointer to avoid slicing the derived options into a CompressionOptions copy
+        Compression::CompressionOptions defaultCompressionOptions;
+        CompressionZStd::CompressionZStdOptions zstdDictionaryOptions;
+        zstdDictionaryOptions.m_dictionary = m_settings.m_zstdDictionary;
+        const Compression::CompressionOptions* compressionOptionsPtr = &defaultCompressionOptions;
+        if (fileSettings.m_compressionOptions != nullptr)
+        {
+            compressionOptionsPtr = fileSettings.m_compressionOptions;
+        }
+        else if (fileSettings.m_compressionAlgorithm == CompressionZStd::GetZStdCompressionAlgorithmId()
+            && !m_settings.m_zstdDictionary.empty())
+        {
+            compressionOptionsPtr = &zstdDictionaryOptions;
+        }
+        const Compression::CompressionOptions& compressionOptions = *compressionOptionsPtr;
 
         // Due to check earlier validating that the inputDataSpan is not empty,
         // the compressedBlockCount will be at least 1 due to rounding up to the nearest block
@@ -243,6 +243,11 @@ namespace Archive
         //! ArchiveTocFilePathIndex, ArchiveTocFileMetadata and ArchiveFilePath vector structures
         bool BuildFilePathMap(const ArchiveTableOfContents& archiveToc);
 
+        //! Stores the ArchiveWriterSettings ZStd dictionary at ArchiveZStdDictionaryPath
+        //! within the mounted archive if one has been supplied
+        //! @return true if no dictionary was supplied or it has been written successfully
+        bool WriteZStdDictionary();
+
         //! Returns an offset to seek to in the archive stream, where the content file data should
         //! be written
         //! If the fileSize can fit within a deleted file block, it offset is extract from the deleted block map
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
 
 #include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
@@ -970,4 +971,75 @@ namespace Archive::Test
             EXPECT_TRUE(AZStd::ranges::equal(requestedFileData, expectedResultData));
         }
     }
+
+    TEST_F(ArchiveReaderFixture, ExtractFileFromArchive_MemoryMappedArchive_Succeeds)
+    {
+        // Write an archive with an uncompressed and an LZ4 compressed file to disk
+        // and validate that both can be extracted when the archive is memory mapped
+        constexpr AZStd::string_view storedFileContent = "Hello World";
+        AZStd::vector<AZStd::byte> compressedFileContent;
+        // Use a file that spans more than one compressed block
+        constexpr size_t CompressedFileSize = ArchiveBlockSizeForCompression + 1024;
+        compressedFileContent.reserve(CompressedFileSize);
+        for (size_t index = 0; index < CompressedFileSize; ++index)
+        {
+            compressedFileContent.push_back(static_cast<AZStd::byte>(index % 251));
+        }
+
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_relativeFilePath = "stored.txt";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(storedFileContent)), fileSettings));
+
+            fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+            fileSettings.m_relativeFilePath = "compressed.bin";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(compressedFileContent, fileSettings));
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        auto archivePath = AZ::Test::CreateTestFile(tempDirectory, "test.o3dearchive", archiveBuffer);
+        ASSERT_TRUE(archivePath);
+
+        ArchiveReaderSettings readerSettings;
+        readerSettings.m_useMemoryMappedReads = true;
+        auto createArchiveReaderResult = CreateArchiveReader(*archivePath, readerSettings);
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        EXPECT_TRUE(archiveReader->IsMounted());
+
+        {
+            AZStd::vector<AZStd::byte> fileBuffer;
+            fileBuffer.resize_no_construct(storedFileContent.size());
+            ArchiveReaderFileSettings fileSettings;
+            fileSettings.m_filePathIdentifier = AZ::IO::PathView("stored.txt");
+            const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+                fileBuffer, fileSettings);
+            ASSERT_TRUE(archiveExtractFileResult);
+            EXPECT_TRUE(AZStd::ranges::equal(archiveExtractFileResult.m_fileSpan,
+                AZStd::as_bytes(AZStd::span(storedFileContent))));
+        }
+
+        {
+            AZStd::vector<AZStd::byte> fileBuffer;
+            fileBuffer.resize_no_construct(compressedFileContent.size());
+            ArchiveReaderFileSettings fileSettings;
+            fileSettings.m_filePathIdentifier = AZ::IO::PathView("compressed.bin");
+            const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+                fileBuffer, fileSettings);
+            ASSERT_TRUE(archiveExtractFileResult);
+            EXPECT_EQ(CompressionLZ4::GetLZ4CompressionAlgorithmId(), archiveExtractFileResult.m_compressionAlgorithm);
+            EXPECT_TRUE(AZStd::ranges::equal(archiveExtractFileResult.m_fileSpan, compressedFileContent));
+        }
+    }
 }
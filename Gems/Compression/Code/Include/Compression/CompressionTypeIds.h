@@ -34,4 +34,6 @@ namespace Compression
     inline constexpr const char* CompressionOptionsTypeId = "{037B2A25-E195-4C5D-B402-6108CE978280}";
 
     inline constexpr const char* DecompressionOptionsTypeId = "{EA85CCE4-B630-47B8-892F-3A5B1C9ECD99}";
+    inline constexpr const char* CompressionZStdOptionsTypeId = "{E1C1A4D8-6B93-41EE-BF2B-67BA7E426E32}";
+    inline constexpr const char* DecompressionZStdOptionsTypeId = "{ECF78B5E-15FB-4354-8B0E-13497842976D}";
 } // namespace Compression
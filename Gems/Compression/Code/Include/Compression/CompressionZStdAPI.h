@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/string/string_view.h>
+#include <Compression/CompressionInterfaceAPI.h>
+#include <Compression/DecompressionInterfaceAPI.h>
+
+namespace CompressionZStd
+{
+    //! Returns the CompressionAlgorithmId associated with the ZStd Compressor
+    //! @return ZStd Compression AlgorithmId
+    constexpr Compression::CompressionAlgorithmId GetZStdCompressionAlgorithmId();
+
+    //! Human readable name associated with the compression algorithm
+    constexpr AZStd::string_view GetZStdCompressionAlgorithmName()
+    {
+        return "ZStd";
+    }
+
+    constexpr Compression::CompressionAlgorithmId GetZStdCompressionAlgorithmId()
+    {
+        constexpr Compression::CompressionAlgorithmId AlgorithmId{ AZ::u32(AZStd::hash<AZStd::string_view>{}(GetZStdCompressionAlgorithmName())) };
+        return AlgorithmId;
+    }
+
+    //! Value of the AZ::IO::CompressionTag::m_code used by archives to mark files compressed as one or more ZStd frames
+    //! The tag is the four character code "ZSTD"
+    constexpr AZ::u32 GetZStdCompressionTag()
+    {
+        return AZ::u32('Z') | (AZ::u32('S') << 8) | (AZ::u32('T') << 16) | (AZ::u32('D') << 24);
+    }
+
+    //! Compression level used when no CompressionZStdOptions are supplied
+    //! Matches the zstd library default level
+    inline constexpr int DefaultZStdCompressionLevel = 3;
+
+    //! Frame size that matches the block size used by the Archive gem
+    //! Use it for the CompressionZStdOptions::m_frameSize of large files to allow them to be decompressed in parallel
+    inline constexpr AZ::u64 DefaultZStdParallelFrameSize = 2 * (1 << 20);
+
+    //! Options for the ZStd compressor
+    //! Supply an instance of this struct to the ICompressionInterface::CompressBlock function
+    //! to select the compression level and a shared dictionary
+    struct CompressionZStdOptions
+        : Compression::CompressionOptions
+    {
+        AZ_TYPE_INFO_WITH_NAME_DECL(CompressionZStdOptions);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+        ~CompressionZStdOptions() override;
+
+        //! Compression level in the range of [1, 22]. Higher levels trade compression speed for ratio.
+        //! The decompression speed is roughly the same for all levels
+        int m_compressionLevel{ DefaultZStdCompressionLevel };
+        //! Optional dictionary trained on samples of similar content
+        //! The same dictionary must be supplied to the decompressor through the DecompressionZStdOptions
+        //! The dictionary memory must outlive the CompressBlock call
+        AZStd::span<const AZStd::byte> m_dictionary;
+        //! When non-zero the uncompressed data is split into independent frames of this many bytes.
+        //! Each frame stores its uncompressed size, which allows the frames to be decompressed in parallel
+        //! and allows range reads to skip the frames before the range.
+        //! Splitting the data costs some compression ratio, so only use it for large files
+        AZ::u64 m_frameSize{};
+    };
+
+    //! Options for the ZStd decompressor
+    struct DecompressionZStdOptions
+        : Compression::DecompressionOptions
+    {
+        AZ_TYPE_INFO_WITH_NAME_DECL(DecompressionZStdOptions);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+        ~DecompressionZStdOptions() override;
+
+        //! Dictionary that was used to compress the data, if any
+        //! The dictionary memory must outlive the DecompressBlock call
+        AZStd::span<const AZStd::byte> m_dictionary;
+    };
+} // namespace CompressionZStd
+
+// Implementation for the ZStd options structs
+#include "CompressionZStdAPI.inl"
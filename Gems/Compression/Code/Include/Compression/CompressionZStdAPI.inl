@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Compression/CompressionTypeIds.h>
+
+namespace CompressionZStd
+{
+    AZ_TYPE_INFO_WITH_NAME_IMPL_INLINE(CompressionZStdOptions, "CompressionZStdOptions",
+        Compression::CompressionZStdOptionsTypeId);
+    AZ_RTTI_NO_TYPE_INFO_IMPL_INLINE(CompressionZStdOptions, Compression::CompressionOptions);
+    AZ_TYPE_INFO_WITH_NAME_IMPL_INLINE(DecompressionZStdOptions, "DecompressionZStdOptions",
+        Compression::DecompressionZStdOptionsTypeId);
+    AZ_RTTI_NO_TYPE_INFO_IMPL_INLINE(DecompressionZStdOptions, Compression::DecompressionOptions);
+
+    inline CompressionZStdOptions::~CompressionZStdOptions() = default;
+    inline DecompressionZStdOptions::~DecompressionZStdOptions() = default;
+} // namespace CompressionZStd
@@ -11,9 +11,11 @@
 #include <AzCore/Serialization/SerializeContext.h>
 
 #include <Compression/CompressionLZ4API.h>
+#include <Compression/CompressionZStdAPI.h>
 #include <Compression/CompressionTypeIds.h>
 #include <Compression/DecompressionInterfaceAPI.h>
 #include "DecompressorLZ4Impl.h"
+#include "DecompressorZStdImpl.h"
 
 #include <Clients/Streamer/DecompressorStackEntry.h>
 
@@ -51,6 +53,40 @@ namespace CompressionLZ4
     }
 }
 
+namespace CompressionZStd
+{
+    void RegisterDecompressorZStdInterface()
+    {
+        // Register the zstd decompressor with the decompression registrar
+        if (auto decompressionRegistrar = Compression::DecompressionRegistrar::Get();
+            decompressionRegistrar != nullptr)
+        {
+            auto compressionAlgorithmId = GetZStdCompressionAlgorithmId();
+            auto decompressorZStd = AZStd::make_unique<DecompressorZStd>();
+            [[maybe_unused]] auto registerOutcome = decompressionRegistrar->RegisterDecompressionInterface(
+                compressionAlgorithmId,
+                AZStd::move(decompressorZStd));
+
+            AZ_Error("Compression ZStd", bool{ registerOutcome }, "Registration of ZStd Decompressor with the DecompressionRegistrar"
+                " has failed with Id %u", compressionAlgorithmId);
+        }
+    }
+    void UnregisterDecompressorZStdInterface()
+    {
+        // Unregister the zstd decompressor using the zstd compression algorithm Id
+        if (auto decompressionRegistrar = Compression::DecompressionRegistrar::Get();
+            decompressionRegistrar != nullptr)
+        {
+            auto compressionAlgorithmId = GetZStdCompressionAlgorithmId();
+            [[maybe_unused]] bool unregisterOutcome = decompressionRegistrar->UnregisterDecompressionInterface(
+                compressionAlgorithmId);
+
+            AZ_Error("Compression ZStd", unregisterOutcome, "ZStd Decompressor with Id %u is not registered with"
+                " with DecompressionRegistrar", static_cast<AZ::u32>(compressionAlgorithmId));
+        }
+    }
+}
+
 namespace Compression
 {
     AZ_COMPONENT_IMPL(CompressionSystemComponent, "CompressionSystemComponent",
@@ -113,10 +149,12 @@ namespace Compression
     {
         CompressionRequestBus::Handler::BusConnect();
         CompressionLZ4::RegisterDecompressorLZ4Interface();
+        CompressionZStd::RegisterDecompressorZStdInterface();
     }
 
     void CompressionSystemComponent::Deactivate()
     {
+        CompressionZStd::UnregisterDecompressorZStdInterface();
         CompressionLZ4::UnregisterDecompressorLZ4Interface();
         CompressionRequestBus::Handler::BusDisconnect();
     }
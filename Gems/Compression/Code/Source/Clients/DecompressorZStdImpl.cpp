@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "DecompressorZStdImpl.h"
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Compression/CompressionZStdAPI.h>
+
+#include <zstd.h>
+
+namespace CompressionZStd
+{
+    namespace Internal
+    {
+        struct DecompressionContextDeleter
+        {
+            void operator()(ZSTD_DCtx* context) const
+            {
+                ZSTD_freeDCtx(context);
+            }
+        };
+
+        //! Decompression contexts are reused per thread as the Archive and Streamer decompress
+        //! blocks on a small set of task threads
+        ZSTD_DCtx* GetThreadDecompressionContext()
+        {
+            thread_local AZStd::unique_ptr<ZSTD_DCtx, DecompressionContextDeleter> decompressionContext{ ZSTD_createDCtx() };
+            return decompressionContext.get();
+        }
+    } // namespace Internal
+
+    // Definitions for ZStd Decompressor
+    DecompressorZStd::DecompressorZStd() = default;
+
+    DecompressorZStd::~DecompressorZStd()
+    {
+        for (DictionaryEntry& entry : m_dictionaries)
+        {
+            ZSTD_freeDDict(entry.m_dictionary);
+        }
+    }
+
+    Compression::CompressionAlgorithmId DecompressorZStd::GetCompressionAlgorithmId() const
+    {
+        return GetZStdCompressionAlgorithmId();
+    }
+
+    AZStd::string_view DecompressorZStd::GetCompressionAlgorithmName() const
+    {
+        return GetZStdCompressionAlgorithmName();
+    }
+
+    ZSTD_DDict* DecompressorZStd::FindOrCreateDictionary(AZStd::span<const AZStd::byte> dictionary) const
+    {
+        const AZ::u32 dictionaryId = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+        if (dictionaryId == 0)
+        {
+            return nullptr;
+        }
+
+        AZStd::scoped_lock lock(m_dictionaryMutex);
+        auto dictionaryIter = AZStd::find_if(m_dictionaries.begin(), m_dictionaries.end(),
+            [dictionaryId](const DictionaryEntry& entry)
+            {
+                return entry.m_dictionaryId == dictionaryId;
+            });
+        if (dictionaryIter != m_dictionaries.end())
+        {
+            return dictionaryIter->m_dictionary;
+        }
+
+        ZSTD_DDict* digestedDictionary = ZSTD_createDDict(dictionary.data(), dictionary.size());
+        if (digestedDictionary != nullptr)
+        {
+            m_dictionaries.push_back({ dictionaryId, digestedDictionary });
+        }
+        return digestedDictionary;
+    }
+
+    Compression::DecompressionResultData DecompressorZStd::DecompressBlock(
+        AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+        const Compression::DecompressionOptions& decompressionOptions) const
+    {
+        Compression::DecompressionResultData resultData;
+
+        if (decompressionBuffer.empty())
+        {
+            resultData.m_decompressionOutcome.m_resultString = Compression::DecompressionResultString(
+                "Decompression buffer is empty, uncompressed content cannot be stored in it\n");
+            // Do not return, but hold on to result string in case an error occurs in decompression
+        }
+
+        AZStd::span<const AZStd::byte> dictionary;
+        if (auto zstdOptions = azrtti_cast<const DecompressionZStdOptions*>(&decompressionOptions);
+            zstdOptions != nullptr)
+        {
+            dictionary = zstdOptions->m_dictionary;
+        }
+
+        ZSTD_DCtx* decompressionContext = Internal::GetThreadDecompressionContext();
+        if (decompressionContext == nullptr)
+        {
+            resultData.m_decompressionOutcome.m_resultString += "Unable to create ZStd decompression context";
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        size_t decompressedSize{};
+        if (dictionary.empty())
+        {
+            decompressedSize = ZSTD_decompressDCtx(decompressionContext, decompressionBuffer.data(), decompressionBuffer.size(),
+                compressedData.data(), compressedData.size());
+        }
+        else if (ZSTD_DDict* digestedDictionary = FindOrCreateDictionary(dictionary);
+            digestedDictionary != nullptr)
+        {
+            decompressedSize = ZSTD_decompress_usingDDict(decompressionContext, decompressionBuffer.data(), decompressionBuffer.size(),
+                compressedData.data(), compressedData.size(), digestedDictionary);
+        }
+        else
+        {
+            decompressedSize = ZSTD_decompress_usingDict(decompressionContext, decompressionBuffer.data(), decompressionBuffer.size(),
+                compressedData.data(), compressedData.size(), dictionary.data(), dictionary.size());
+        }
+
+        if (ZSTD_isError(decompressedSize))
+        {
+            resultData.m_decompressionOutcome.m_resultString += Compression::DecompressionResultString::format(
+                "ZStd decompression has failed with error \"%s\". Either the decompression buffer cannot fit all decompressed content,"
+                " the source stream is malformed or the wrong dictionary was supplied. Dest buffer capacity: %zu, source stream size: %zu",
+                ZSTD_getErrorName(decompressedSize), decompressionBuffer.size(), compressedData.size());
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        // Update the result buffer span to point at the beginning of the uncompressed data and
+        // the correct uncompressed size
+        resultData.m_uncompressedBuffer = decompressionBuffer.subspan(0, decompressedSize);
+        resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Complete;
+        return resultData;
+    }
+
+    Compression::DecompressionResultData DecompressorZStd::DecompressRange(
+        AZStd::span<AZStd::byte> decompressionBuffer, AZStd::span<const AZStd::byte> compressedData,
+        AZ::u64 uncompressedOffset, const Compression::DecompressionOptions& decompressionOptions) const
+    {
+        Compression::DecompressionResultData resultData;
+
+        AZStd::span<const AZStd::byte> dictionary;
+        if (auto zstdOptions = azrtti_cast<const DecompressionZStdOptions*>(&decompressionOptions);
+            zstdOptions != nullptr)
+        {
+            dictionary = zstdOptions->m_dictionary;
+        }
+
+        // Decompression contexts can also be used as decompression streams, so the thread's context is reused
+        ZSTD_DCtx* decompressionStream = Internal::GetThreadDecompressionContext();
+        if (decompressionStream == nullptr || ZSTD_isError(ZSTD_initDStream(decompressionStream)))
+        {
+            resultData.m_decompressionOutcome.m_resultString = "Unable to create ZStd decompression stream";
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        // The dictionary stays attached to the thread's context, so it's detached again once the range has been read
+        // to prevent DecompressBlock from using it for data that was compressed without it
+        struct DictionaryDetacher
+        {
+            ~DictionaryDetacher()
+            {
+                ZSTD_DCtx_refDDict(m_decompressionStream, nullptr);
+            }
+            ZSTD_DCtx* m_decompressionStream;
+        };
+        AZStd::optional<DictionaryDetacher> dictionaryDetacher;
+        if (!dictionary.empty())
+        {
+            dictionaryDetacher.emplace(DictionaryDetacher{ decompressionStream });
+            size_t attachResult;
+            if (ZSTD_DDict* digestedDictionary = FindOrCreateDictionary(dictionary);
+                digestedDictionary != nullptr)
+            {
+                attachResult = ZSTD_DCtx_refDDict(decompressionStream, digestedDictionary);
+            }
+            else
+            {
+                attachResult = ZSTD_DCtx_loadDictionary(decompressionStream, dictionary.data(), dictionary.size());
+            }
+
+            if (ZSTD_isError(attachResult))
+            {
+                resultData.m_decompressionOutcome.m_resultString = Compression::DecompressionResultString::format(
+                    "Unable to attach the dictionary to the ZStd decompression stream, error \"%s\"", ZSTD_getErrorName(attachResult));
+                resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+                return resultData;
+            }
+        }
+
+        // Skip the frames that end before the requested range without decompressing them
+        ZSTD_inBuffer input{ compressedData.data(), compressedData.size(), 0 };
+        AZ::u64 bytesToSkip = uncompressedOffset;
+        while (bytesToSkip > 0 && input.pos < input.size)
+        {
+            const AZStd::byte* frameStart = compressedData.data() + input.pos;
+            const size_t remainingSize = input.size - input.pos;
+            const unsigned long long frameContentSize = ZSTD_getFrameContentSize(frameStart, remainingSize);
+            if (frameContentSize == ZSTD_CONTENTSIZE_UNKNOWN || frameContentSize == ZSTD_CONTENTSIZE_ERROR
+                || frameContentSize > bytesToSkip)
+            {
+                break;
+            }
+            const size_t frameCompressedSize = ZSTD_findFrameCompressedSize(frameStart, remainingSize);
+            if (ZSTD_isError(frameCompressedSize))
+            {
+                break;
+            }
+            input.pos += frameCompressedSize;
+            bytesToSkip -= frameContentSize;
+        }
+
+        // Data before the requested range is decompressed into a scratch window and discarded
+        // The recommended output size is the ZStd block size, so every call makes progress on a full block
+        AZStd::vector<AZStd::byte> skipWindow;
+        if (bytesToSkip > 0)
+        {
+            skipWindow.resize_no_construct(ZSTD_DStreamOutSize());
+        }
+
+        size_t bytesWritten = 0;
+        while (bytesWritten < decompressionBuffer.size())
+        {
+            ZSTD_outBuffer output;
+            if (bytesToSkip > 0)
+            {
+                output = { skipWindow.data(), AZStd::min<size_t>(skipWindow.size(), bytesToSkip), 0 };
+            }
+            else
+            {
+                output = { decompressionBuffer.data() + bytesWritten, decompressionBuffer.size() - bytesWritten, 0 };
+            }
+
+            const size_t streamResult = ZSTD_decompressStream(decompressionStream, &output, &input);
+            if (ZSTD_isError(streamResult))
+            {
+                resultData.m_decompressionOutcome.m_resultString = Compression::DecompressionResultString::format(
+                    "ZStd stream decompression has failed with error \"%s\" after reading %zu of %zu compressed bytes",
+                    ZSTD_getErrorName(streamResult), input.pos, compressedData.size());
+                resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+                return resultData;
+            }
+
+            if (bytesToSkip > 0)
+            {
+                bytesToSkip -= output.pos;
+            }
+            else
+            {
+                bytesWritten += output.pos;
+            }
+
+            // Stop once the input has been consumed and the decompressor has no more buffered output to flush
+            if (output.pos == 0 && input.pos == input.size)
+            {
+                break;
+            }
+        }
+
+        if (bytesToSkip > 0)
+        {
+            resultData.m_decompressionOutcome.m_resultString = Compression::DecompressionResultString::format(
+                "ZStd stream ended before reaching the uncompressed offset %llu", uncompressedOffset);
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        resultData.m_uncompressedBuffer = decompressionBuffer.first(bytesWritten);
+        resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Complete;
+        return resultData;
+    }
+
+    bool DecompressorZStd::FindFrames(AZStd::vector<FrameInfo>& frames, AZStd::span<const AZStd::byte> compressedData)
+    {
+        AZ::u64 compressedOffset = 0;
+        AZ::u64 uncompressedOffset = 0;
+        while (compressedOffset < compressedData.size())
+        {
+            const AZStd::byte* frameStart = compressedData.data() + compressedOffset;
+            const size_t remainingSize = compressedData.size() - compressedOffset;
+            const size_t frameCompressedSize = ZSTD_findFrameCompressedSize(frameStart, remainingSize);
+            const unsigned long long frameContentSize = ZSTD_getFrameContentSize(frameStart, remainingSize);
+            if (ZSTD_isError(frameCompressedSize) || frameContentSize == ZSTD_CONTENTSIZE_UNKNOWN
+                || frameContentSize == ZSTD_CONTENTSIZE_ERROR)
+            {
+                return false;
+            }
+
+            if (frameContentSize > 0)
+            {
+                frames.push_back({ compressedOffset, frameCompressedSize, uncompressedOffset, frameContentSize });
+            }
+            compressedOffset += frameCompressedSize;
+            uncompressedOffset += frameContentSize;
+        }
+        return true;
+    }
+} // namespace CompressionZStd
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <Compression/DecompressionInterfaceAPI.h>
+
+struct ZSTD_DDict_s;
+
+namespace CompressionZStd
+{
+    class DecompressorZStd
+        : public Compression::IDecompressionInterface
+    {
+    public:
+        DecompressorZStd();
+        ~DecompressorZStd() override;
+        //! Retrieves the 32-bit compression algorithm ID associated with this interface
+        Compression::CompressionAlgorithmId GetCompressionAlgorithmId() const override;
+        //! Retrieves the human readable associated with the ZStd decompressor
+        AZStd::string_view GetCompressionAlgorithmName() const override;
+        //! Decompresses the ZStd frame into the decompression buffer
+        //! A DecompressionZStdOptions instance must be supplied if the data was compressed with a dictionary
+        //! @return a DecompressionResultData instance to indicate if decompression operation has succeeded
+        [[nodiscard]] Compression::DecompressionResultData DecompressBlock(
+            AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+            const Compression::DecompressionOptions& decompressionOptions = {}) const override;
+
+        //! Streams the compressed ZStd frames and only writes the uncompressed bytes in the range
+        //! [uncompressedOffset, uncompressedOffset + decompressionBuffer.size()) to the decompression buffer.
+        //! Decompression stops as soon as the range has been written, so reading the start of a large file only decompresses
+        //! the start of it and no buffer the size of the entire uncompressed content is needed.
+        //! Frames which store their uncompressed size and end before the range are skipped without being decompressed.
+        //! A DecompressionZStdOptions instance must be supplied if the data was compressed with a dictionary
+        //! @return a DecompressionResultData instance to indicate if decompression operation has succeeded
+        [[nodiscard]] Compression::DecompressionResultData DecompressRange(
+            AZStd::span<AZStd::byte> decompressionBuffer, AZStd::span<const AZStd::byte> compressedData,
+            AZ::u64 uncompressedOffset, const Compression::DecompressionOptions& decompressionOptions = {}) const;
+
+        //! Location of an independent ZStd frame in the compressed data and of its content in the uncompressed data
+        struct FrameInfo
+        {
+            AZ::u64 m_compressedOffset{};
+            AZ::u64 m_compressedSize{};
+            AZ::u64 m_uncompressedOffset{};
+            AZ::u64 m_uncompressedSize{};
+        };
+
+        //! Appends the location of every frame in the compressed data to the frames vector.
+        //! Only the frame and block headers are read, so this is cheap compared to decompressing the data.
+        //! Frames without content, such as skippable frames, are not added.
+        //! @return false if the data is malformed or if any of the frames doesn't store its uncompressed size
+        static bool FindFrames(AZStd::vector<FrameInfo>& frames, AZStd::span<const AZStd::byte> compressedData);
+
+    private:
+        //! Returns a digested dictionary for the trained dictionary, caching it by dictionary ID
+        //! Returns nullptr for raw content dictionaries that don't have a dictionary ID
+        ZSTD_DDict_s* FindOrCreateDictionary(AZStd::span<const AZStd::byte> dictionary) const;
+
+        struct DictionaryEntry
+        {
+            AZ::u32 m_dictionaryId{};
+            ZSTD_DDict_s* m_dictionary{};
+        };
+        mutable AZStd::vector<DictionaryEntry> m_dictionaries;
+        mutable AZStd::mutex m_dictionaryMutex;
+    };
+} // namespace CompressionZStd
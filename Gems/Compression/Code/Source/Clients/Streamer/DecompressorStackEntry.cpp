@@ -14,10 +14,14 @@
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/typetraits/decay.h>
 
+#include <Clients/DecompressorZStdImpl.h>
+#include <Compression/CompressionZStdAPI.h>
+
 namespace Compression
 {
     AZ_TYPE_INFO_WITH_NAME_IMPL(DecompressorRegistrarConfig, "DecompressorRegistrarConfig", "{763D7F80-0FE1-4084-A165-0CC6A2E57F05}");
@@ -28,7 +32,7 @@ namespace Compression
         const AZ::IO::HardwareInformation& hardware, AZStd::shared_ptr<AZ::IO::StreamStackEntry> parent)
     {
         auto stackEntry = AZStd::make_shared<DecompressorRegistrarEntry>(
-            m_maxNumReads, m_maxNumTasks, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+            m_maxNumReads, m_maxNumTasks, aznumeric_caster(hardware.m_maxPhysicalSectorSize), m_minParallelDecompressionSize);
         stackEntry->SetNext(AZStd::move(parent));
         return stackEntry;
     }
@@ -41,6 +45,7 @@ namespace Compression
             serializeContext->Class<DecompressorRegistrarConfig, IStreamerStackConfig>()
                 ->Field("MaxNumReads", &DecompressorRegistrarConfig::m_maxNumReads)
                 ->Field("MaxNumTasks", &DecompressorRegistrarConfig::m_maxNumTasks)
+                ->Field("MinParallelDecompressionSize", &DecompressorRegistrarConfig::m_minParallelDecompressionSize)
                 ;
         }
     }
@@ -55,8 +60,10 @@ namespace Compression
         return m_compressedData != nullptr;
     }
 
-    DecompressorRegistrarEntry::DecompressorRegistrarEntry(AZ::u32 maxNumReads, AZ::u32 maxNumTasks, AZ::u32 alignment)
+    DecompressorRegistrarEntry::DecompressorRegistrarEntry(AZ::u32 maxNumReads, AZ::u32 maxNumTasks, AZ::u32 alignment,
+        AZ::u64 minParallelDecompressionSize)
         : AZ::IO::StreamStackEntry("Compression Gem decompressor registrar")
+        , m_minParallelDecompressionSize(minParallelDecompressionSize)
         , m_maxNumReads(maxNumReads)
         , m_maxNumTasks(maxNumTasks)
         , m_alignment(alignment)
@@ -346,6 +353,22 @@ namespace Compression
                 "speed than decompressing can't keep up with file reads. Increasing the number of jobs can help hide this issue, but only "
                 "for parallel reads, while individual reads will still remain decompression bound."));
 
+            if (m_numParallelDecompressions > 0)
+            {
+                statistics.push_back(AZ::IO::Statistic::CreateInteger(
+                    m_name, "Parallel block decompressions", m_numParallelDecompressions,
+                    "The number of reads from files made of independent blocks that were large enough to have their blocks decompressed "
+                    "in parallel. Lowering the minimum parallel decompression size will increase this number."));
+                statistics.push_back(AZ::IO::Statistic::CreateFloat(
+                    m_name, "Blocks per parallel decompression (avg.)", m_blocksPerParallelDecompression.CalculateAverage(),
+                    "The average number of blocks that a parallel decompression was split into. The speed up of parallel decompression "
+                    "is limited by this number and the number of workers in the task executor."));
+                double totalParallelDecompressionTimeSec = m_parallelDecompressionDurationMicroSec.GetTotal() * usToSec;
+                statistics.push_back(AZ::IO::Statistic::CreateBytesPerSecond(
+                    m_name, "Parallel decompression speed", m_parallelBytesDecompressed.GetTotal() / totalParallelDecompressionTimeSec,
+                    "The average speed in uncompressed bytes that reads are decompressed at when their blocks are decompressed in parallel."));
+            }
+
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
             statistics.push_back(AZ::IO::Statistic::CreatePercentageRange(
                 m_name, DecompBoundName, m_decompressionBoundStat.GetAverage(), m_decompressionBoundStat.GetMinimum(),
@@ -657,7 +680,30 @@ namespace Compression
                         AZ_SIZE_ALIGN_DOWN(data->m_compressionInfo.m_offset, aznumeric_cast<size_t>(m_alignment)));
 
                     AZ::TaskDescriptor taskDescriptor{ "Decompress file", "Compression" };
-                    if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
+                    if (PrepareBlockDecompression(info, *data))
+                    {
+                        // Every block gets its own task so the decompression of a single large read is spread over the workers
+                        // of the task executor. The blocks are written directly into the output, so no temporary buffer is needed.
+                        auto finishBlocksTask = [this, &info]()
+                        {
+                            FinishBlockDecompression(m_context, info);
+                        };
+                        AZ::TaskToken finishBlocksToken = taskGraph.AddTask(
+                            AZ::TaskDescriptor{ "Decompress Gather Blocks", "Compression" }, AZStd::move(finishBlocksTask));
+                        finishBlocksToken.Precedes(finishToken);
+
+                        AZ::TaskDescriptor blockTaskDescriptor{ "Decompress block", "Compression" };
+                        for (size_t blockIndex = 0; blockIndex < info.m_blocks.size(); ++blockIndex)
+                        {
+                            auto decompressBlockTask = [this, &info, blockIndex]()
+                            {
+                                BlockDecompression(info, blockIndex);
+                            };
+                            AZ::TaskToken token = taskGraph.AddTask(blockTaskDescriptor, AZStd::move(decompressBlockTask));
+                            token.Precedes(finishBlocksToken);
+                        }
+                    }
+                    else if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
                     {
                         auto decompressTask = [this, &info]()
                         {
@@ -668,7 +714,12 @@ namespace Compression
                     }
                     else
                     {
-                        m_memoryUsage += data->m_compressionInfo.m_uncompressedSize;
+                        if (data->m_compressionInfo.m_compressionTag.m_code != CompressionZStd::GetZStdCompressionTag())
+                        {
+                            // The entire file is decompressed into a temporary buffer to extract the requested range from
+                            info.m_scratchBufferSize = data->m_compressionInfo.m_uncompressedSize;
+                            m_memoryUsage += info.m_scratchBufferSize;
+                        }
                         auto decompressTask = [this, &info]()
                         {
                             PartialDecompression(m_context, info);
@@ -718,17 +769,24 @@ namespace Compression
         size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
         size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
         m_memoryUsage -= bufferSize;
-        if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
-        {
-            m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
-        }
+        m_memoryUsage -= jobInfo.m_scratchBufferSize;
+        jobInfo.m_scratchBufferSize = 0;
 
+        auto decompressionDuration = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(endTime - jobInfo.m_jobStartTime).count();
         m_decompressionJobDelayMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
             jobInfo.m_jobStartTime - jobInfo.m_queueStartTime).count());
-        m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
-            endTime - jobInfo.m_jobStartTime).count());
+        m_decompressionDurationMicroSec.PushEntry(decompressionDuration);
         m_bytesDecompressed.PushEntry(data->m_compressionInfo.m_compressedSize);
 
+        if (!jobInfo.m_blocks.empty())
+        {
+            ++m_numParallelDecompressions;
+            m_parallelDecompressionDurationMicroSec.PushEntry(decompressionDuration);
+            m_parallelBytesDecompressed.PushEntry(data->m_readSize);
+            m_blocksPerParallelDecompression.PushEntry(jobInfo.m_blocks.size());
+            jobInfo.m_blocks.clear();
+        }
+
         AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(jobInfo.m_compressedData, bufferSize, m_alignment);
         jobInfo.m_compressedData = nullptr;
         AZ_Assert(m_numRunningTasks > 0, "About to complete a decompression job, but the internal count doesn't see a running job.");
@@ -736,6 +794,46 @@ namespace Compression
         return;
     }
 
+    bool DecompressorRegistrarEntry::PrepareBlockDecompression(
+        DecompressionInformation& info, const AZ::IO::Requests::CompressedReadData& data) const
+    {
+        // Only ZStd files can consist of independent blocks. Other formats are decompressed as a single stream.
+        const AZ::IO::CompressionInfo& compressionInfo = data.m_compressionInfo;
+        if (compressionInfo.m_compressionTag.m_code != CompressionZStd::GetZStdCompressionTag()
+            || data.m_readSize < m_minParallelDecompressionSize)
+        {
+            return false;
+        }
+
+        AZStd::span<const AZStd::byte> compressedData(
+            reinterpret_cast<const AZStd::byte*>(info.m_compressedData + info.m_alignmentOffset), compressionInfo.m_compressedSize);
+        info.m_blocks.clear();
+        if (!CompressionZStd::DecompressorZStd::FindFrames(info.m_blocks, compressedData))
+        {
+            info.m_blocks.clear();
+            return false;
+        }
+
+        // Only the blocks that overlap with the requested range need to be decompressed
+        const AZ::u64 readEnd = data.m_readOffset + data.m_readSize;
+        auto outsideRange = [&data, readEnd](const CompressionZStd::DecompressorZStd::FrameInfo& block)
+        {
+            return block.m_uncompressedOffset >= readEnd || block.m_uncompressedOffset + block.m_uncompressedSize <= data.m_readOffset;
+        };
+        info.m_blocks.erase(AZStd::remove_if(info.m_blocks.begin(), info.m_blocks.end(), outsideRange), info.m_blocks.end());
+
+        // A single block doesn't benefit from additional tasks
+        if (info.m_blocks.size() < 2)
+        {
+            info.m_blocks.clear();
+            return false;
+        }
+
+        info.m_blockStarted = false;
+        info.m_blockFailed = false;
+        return true;
+    }
+
     void DecompressorRegistrarEntry::FullDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info)
     {
         info.m_jobStartTime = AZStd::chrono::steady_clock::now();
@@ -761,7 +859,7 @@ namespace Compression
         context->WakeUpSchedulingThread();
     }
 
-    void DecompressorRegistrarEntry::PartialDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info)
+    void DecompressorRegistrarEntry::PartialDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info) const
     {
         info.m_jobStartTime = AZStd::chrono::steady_clock::now();
 
@@ -772,12 +870,81 @@ namespace Compression
         AZ::IO::CompressionInfo& compressionInfo = request->m_compressionInfo;
         AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
-        auto decompressionBuffer = AZStd::make_unique<AZStd::byte[]>(compressionInfo.m_uncompressedSize);
-        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-            compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+        bool success = false;
+        if (compressionInfo.m_compressionTag.m_code == CompressionZStd::GetZStdCompressionTag())
+        {
+            // ZStd frames can be streamed, so only the data up to the end of the requested range is decompressed
+            // and it's written straight into the output buffer instead of a temporary buffer for the entire file
+            AZStd::span<AZStd::byte> outputBuffer(reinterpret_cast<AZStd::byte*>(request->m_output), request->m_readSize);
+            AZStd::span<const AZStd::byte> compressedData(
+                reinterpret_cast<const AZStd::byte*>(info.m_compressedData + info.m_alignmentOffset), compressionInfo.m_compressedSize);
+            CompressionZStd::DecompressionZStdOptions decompressionOptions;
+            decompressionOptions.m_dictionary = compressionInfo.m_dictionary;
+            Compression::DecompressionResultData resultData = m_zstdDecompressor.DecompressRange(
+                outputBuffer, compressedData, request->m_readOffset, decompressionOptions);
+            success = resultData && resultData.GetUncompressedByteCount() == request->m_readSize;
+            AZ_Error("DecompressorRegistrarEntry", success, "Partial ZStd decompression of a file in archive %s has failed. %s",
+                compressionInfo.m_archiveFilename.GetRelativePathCStr(), resultData.m_decompressionOutcome.m_resultString.c_str());
+        }
+        else
+        {
+            auto decompressionBuffer = AZStd::make_unique<AZStd::byte[]>(compressionInfo.m_uncompressedSize);
+            success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
+                compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+
+            memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+        }
         info.m_waitRequest->SetStatus(success ? AZ::IO::IStreamerTypes::RequestStatus::Completed : AZ::IO::IStreamerTypes::RequestStatus::Failed);
 
-        memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+        context->MarkRequestAsCompleted(info.m_waitRequest);
+        context->WakeUpSchedulingThread();
+    }
+
+    void DecompressorRegistrarEntry::BlockDecompression(DecompressionInformation& info, size_t blockIndex) const
+    {
+        if (!info.m_blockStarted.exchange(true))
+        {
+            info.m_jobStartTime = AZStd::chrono::steady_clock::now();
+        }
+
+        // The read request fails as a whole, so there's no need to decompress the remaining blocks after a failure.
+        if (info.m_blockFailed)
+        {
+            return;
+        }
+
+        AZ::IO::FileRequest* compressedRequest = info.m_waitRequest->GetParent();
+        AZ_Assert(compressedRequest, "A wait request attached to DecompressorRegistrarEntry was completed but didn't have a parent compressed request.");
+        auto request = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(request, "Compressed request in DecompressorRegistrarEntry that's running block decompression didn't contain compression read data.");
+
+        // Clamp the block to the requested range and write it to its position in the output buffer
+        const CompressionZStd::DecompressorZStd::FrameInfo& block = info.m_blocks[blockIndex];
+        const AZ::u64 rangeStart = AZStd::max(block.m_uncompressedOffset, request->m_readOffset);
+        const AZ::u64 rangeEnd = AZStd::min(block.m_uncompressedOffset + block.m_uncompressedSize, request->m_readOffset + request->m_readSize);
+        AZStd::span<AZStd::byte> outputBuffer(
+            reinterpret_cast<AZStd::byte*>(request->m_output) + (rangeStart - request->m_readOffset), rangeEnd - rangeStart);
+        AZStd::span<const AZStd::byte> compressedBlock(
+            reinterpret_cast<const AZStd::byte*>(info.m_compressedData + info.m_alignmentOffset + block.m_compressedOffset),
+            block.m_compressedSize);
+
+        CompressionZStd::DecompressionZStdOptions decompressionOptions;
+        decompressionOptions.m_dictionary = request->m_compressionInfo.m_dictionary;
+        Compression::DecompressionResultData resultData = m_zstdDecompressor.DecompressRange(
+            outputBuffer, compressedBlock, rangeStart - block.m_uncompressedOffset, decompressionOptions);
+        if (!resultData || resultData.GetUncompressedByteCount() != outputBuffer.size())
+        {
+            AZ_Error("DecompressorRegistrarEntry", false, "Decompression of block %zu of a file in archive %s has failed. %s",
+                blockIndex, request->m_compressionInfo.m_archiveFilename.GetRelativePathCStr(),
+                resultData.m_decompressionOutcome.m_resultString.c_str());
+            info.m_blockFailed = true;
+        }
+    }
+
+    void DecompressorRegistrarEntry::FinishBlockDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info)
+    {
+        info.m_waitRequest->SetStatus(
+            info.m_blockFailed ? AZ::IO::IStreamerTypes::RequestStatus::Failed : AZ::IO::IStreamerTypes::RequestStatus::Completed);
 
         context->MarkRequestAsCompleted(info.m_waitRequest);
         context->WakeUpSchedulingThread();
@@ -797,6 +964,10 @@ namespace Compression
                 "operating system and may impact how stable the performance on the rest of the engine is. If there are functions that "
                 "periodically take much longer, look for excessive context switches by the operating systems and if found lowering this "
                 "value may help reduce those at the cost or streaming speeds."));
+            data.m_output.push_back(AZ::IO::Statistic::CreateByteSize(
+                m_name, "Min parallel decompression size", m_minParallelDecompressionSize,
+                "The minimum size of a read from a file made of independent blocks for the blocks to be decompressed in parallel. "
+                "These blocks are decompressed on the workers of the task executor rather than being limited to a single job."));
             data.m_output.push_back(AZ::IO::Statistic::CreateByteSize(
                 m_name, "Alignment", m_alignment,
                 "The alignment for read buffer. This allows enough memory to be reserved in the read buffer to allow for alignment to "
@@ -14,10 +14,13 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Statistics/RunningStatistic.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <Clients/DecompressorZStdImpl.h>
 
 namespace AZ::IO
 {
@@ -25,6 +28,7 @@ namespace AZ::IO
 }
 namespace AZ::IO::Requests
 {
+    struct CompressedReadData;
     struct ReadRequestData;
     struct ReportData;
 }
@@ -54,6 +58,9 @@ namespace Compression
         AZ::u32 m_maxNumReads{ 2 };
         //! Maximum number of decompression tasks that can run simultaneously.
         AZ::u32 m_maxNumTasks{ 2 };
+        //! Minimum number of bytes a read needs to request from a file made of independent blocks before the blocks are
+        //! decompressed in parallel over the workers of the task executor. Smaller reads are decompressed by a single task.
+        AZ::u64 m_minParallelDecompressionSize{ 4 * 1024 * 1024 };
     };
 
     //! Decompression Entry in the streamer stack that is used to look up registered compression interfaces
@@ -66,11 +73,13 @@ namespace Compression
     //! Finally, the lack of an upper limit also means that the duration of the decompression job
     //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
     //! the main job system from working.
+    //! Large reads from ZStd files that consist of multiple independent frames are the exception. The frames that overlap
+    //! with the requested range are decompressed in parallel by separate tasks directly into the output buffer.
     class DecompressorRegistrarEntry
         : public AZ::IO::StreamStackEntry
     {
     public:
-        DecompressorRegistrarEntry(AZ::u32 maxNumReads, AZ::u32 maxNumTasks, AZ::u32 alignment);
+        DecompressorRegistrarEntry(AZ::u32 maxNumReads, AZ::u32 maxNumTasks, AZ::u32 alignment, AZ::u64 minParallelDecompressionSize);
         ~DecompressorRegistrarEntry() override = default;
 
         void PrepareRequest(AZ::IO::FileRequest* request) override;
@@ -102,6 +111,13 @@ namespace Compression
             Buffer m_compressedData{ nullptr };
             AZ::IO::FileRequest* m_waitRequest{ nullptr };
             AZ::u32 m_alignmentOffset{ 0 };
+            //! Size of the temporary buffer that's needed to decompress the entire file for a partial read.
+            size_t m_scratchBufferSize{ 0 };
+            //! The independent blocks that overlap with the read request when they're decompressed in parallel.
+            //! Empty if a single task decompresses the file.
+            AZStd::vector<CompressionZStd::DecompressorZStd::FrameInfo> m_blocks;
+            AZStd::atomic_bool m_blockStarted{ false };
+            AZStd::atomic_bool m_blockFailed{ false };
         };
 
         bool IsIdle() const;
@@ -118,8 +134,12 @@ namespace Compression
         bool StartDecompressions();
         void FinishDecompression(AZ::IO::FileRequest* waitRequest, AZ::u32 jobSlot);
 
+        bool PrepareBlockDecompression(DecompressionInformation& info, const AZ::IO::Requests::CompressedReadData& data) const;
+
         static void FullDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
-        static void PartialDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
+        void PartialDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info) const;
+        void BlockDecompression(DecompressionInformation& info, size_t blockIndex) const;
+        static void FinishBlockDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
 
         void Report(const AZ::IO::Requests::ReportData& data) const;
 
@@ -129,11 +149,17 @@ namespace Compression
         AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_decompressionJobDelayMicroSec;
         AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_decompressionDurationMicroSec;
         AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_bytesDecompressed;
+        AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_parallelDecompressionDurationMicroSec;
+        AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_parallelBytesDecompressed;
+        AZ::IO::AverageWindow<size_t, double, AZ::IO::s_statisticsWindowSize> m_blocksPerParallelDecompression;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         AZ::Statistics::RunningStatistic m_decompressionBoundStat;
         AZ::Statistics::RunningStatistic m_readBoundStat;
 #endif
         // Task executor for decompressor
+        //! Used for partial and block reads of ZStd files, caches the digested dictionaries of the archives being read.
+        //! Declared before the task executor so it outlives the decompression jobs.
+        CompressionZStd::DecompressorZStd m_zstdDecompressor;
         AZ::TaskExecutor m_taskExecutor;
         AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
 
@@ -145,6 +171,8 @@ namespace Compression
         AZStd::unique_ptr<DecompressionInformation[]> m_processingJobs;
 
         size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
+        size_t m_numParallelDecompressions{ 0 }; //!< Number of reads that were decompressed in parallel blocks.
+        AZ::u64 m_minParallelDecompressionSize{ 0 };
         AZ::u32 m_maxNumReads{ 2 };
         AZ::u32 m_numInFlightReads{ 0 };
         AZ::u32 m_numPendingDecompression{ 0 };
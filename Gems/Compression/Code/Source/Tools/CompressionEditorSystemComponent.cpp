@@ -11,8 +11,10 @@
 #include <AzCore/Serialization/SerializeContext.h>
 
 #include <Compression/CompressionLZ4API.h>
+#include <Compression/CompressionZStdAPI.h>
 #include <Compression/CompressionTypeIds.h>
 #include "CompressorLZ4Impl.h"
+#include "CompressorZStdImpl.h"
 
 #include <Compression/CompressionInterfaceAPI.h>
 
@@ -50,6 +52,40 @@ namespace CompressionLZ4
     }
 }
 
+namespace CompressionZStd
+{
+    void RegisterCompressorZStdInterface()
+    {
+        // Register the zstd compressor with the compression registrar
+        if (auto compressionRegistrar = Compression::CompressionRegistrar::Get();
+            compressionRegistrar != nullptr)
+        {
+            auto compressionAlgorithmId = GetZStdCompressionAlgorithmId();
+            auto compressorZStd = AZStd::make_unique<CompressorZStd>();
+            [[maybe_unused]] auto registerOutcome = compressionRegistrar->RegisterCompressionInterface(
+                compressionAlgorithmId,
+                AZStd::move(compressorZStd));
+
+            AZ_Error("Compression ZStd", bool{ registerOutcome }, "Registration of ZStd Compressor with the CompressionRegistrar"
+                " has failed with Id %u", compressionAlgorithmId);
+        }
+    }
+    void UnregisterCompressorZStdInterface()
+    {
+        // Unregister the zstd compressor using the zstd compression algorithm Id
+        if (auto compressionRegistrar = Compression::CompressionRegistrar::Get();
+            compressionRegistrar != nullptr)
+        {
+            auto compressionAlgorithmId = GetZStdCompressionAlgorithmId();
+            [[maybe_unused]] bool unregisterOutcome = compressionRegistrar->UnregisterCompressionInterface(
+                compressionAlgorithmId);
+
+            AZ_Error("Compression ZStd", unregisterOutcome, "ZStd Compressor with Id %u is not registered with"
+                " with CompressionRegistrar", static_cast<AZ::u32>(compressionAlgorithmId));
+        }
+    }
+}
+
 namespace Compression
 {
     AZ_COMPONENT_IMPL(CompressionEditorSystemComponent, "CompressionEditorSystemComponent",
@@ -95,10 +131,12 @@ namespace Compression
     {
         CompressionSystemComponent::Activate();
         CompressionLZ4::RegisterCompressorLZ4Interface();
+        CompressionZStd::RegisterCompressorZStdInterface();
     }
 
     void CompressionEditorSystemComponent::Deactivate()
     {
+        CompressionZStd::UnregisterCompressorZStdInterface();
         CompressionLZ4::UnregisterCompressorLZ4Interface();
         CompressionSystemComponent::Deactivate();
     }
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CompressorZStdImpl.h"
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <Compression/CompressionZStdAPI.h>
+
+#include <zstd.h>
+#include <zdict.h>
+
+namespace CompressionZStd
+{
+    namespace Internal
+    {
+        struct CompressionContextDeleter
+        {
+            void operator()(ZSTD_CCtx* context) const
+            {
+                ZSTD_freeCCtx(context);
+            }
+        };
+
+        //! Compression contexts hold several MiB of work memory at the default level
+        //! so they are reused per thread instead of being created for each block
+        ZSTD_CCtx* GetThreadCompressionContext()
+        {
+            thread_local AZStd::unique_ptr<ZSTD_CCtx, CompressionContextDeleter> compressionContext{ ZSTD_createCCtx() };
+            return compressionContext.get();
+        }
+    } // namespace Internal
+
+    // Definitions for ZStd Compressor
+    CompressorZStd::CompressorZStd() = default;
+
+    CompressorZStd::~CompressorZStd()
+    {
+        for (DictionaryEntry& entry : m_dictionaries)
+        {
+            ZSTD_freeCDict(entry.m_dictionary);
+        }
+    }
+
+    Compression::CompressionAlgorithmId CompressorZStd::GetCompressionAlgorithmId() const
+    {
+        return GetZStdCompressionAlgorithmId();
+    }
+
+    AZStd::string_view CompressorZStd::GetCompressionAlgorithmName() const
+    {
+        return GetZStdCompressionAlgorithmName();
+    }
+
+    [[nodiscard]] size_t CompressorZStd::CompressBound(size_t uncompressedBufferSize) const
+    {
+        // Every frame adds its own header and block overhead, so reserve room for it as if the data is
+        // split into frames of the smallest frame size supported by the CompressionZStdOptions
+        const size_t frameOverhead = ZSTD_compressBound(MinFrameSize) - MinFrameSize;
+        return ZSTD_compressBound(uncompressedBufferSize) + (uncompressedBufferSize / MinFrameSize + 1) * frameOverhead;
+    }
+
+    ZSTD_CDict* CompressorZStd::FindOrCreateDictionary(AZStd::span<const AZStd::byte> dictionary, int compressionLevel) const
+    {
+        const AZ::u32 dictionaryId = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+        if (dictionaryId == 0)
+        {
+            return nullptr;
+        }
+
+        AZStd::scoped_lock lock(m_dictionaryMutex);
+        auto dictionaryIter = AZStd::find_if(m_dictionaries.begin(), m_dictionaries.end(),
+            [dictionaryId, compressionLevel](const DictionaryEntry& entry)
+            {
+                return entry.m_dictionaryId == dictionaryId && entry.m_compressionLevel == compressionLevel;
+            });
+        if (dictionaryIter != m_dictionaries.end())
+        {
+            return dictionaryIter->m_dictionary;
+        }
+
+        ZSTD_CDict* digestedDictionary = ZSTD_createCDict(dictionary.data(), dictionary.size(), compressionLevel);
+        if (digestedDictionary != nullptr)
+        {
+            m_dictionaries.push_back({ dictionaryId, compressionLevel, digestedDictionary });
+        }
+        return digestedDictionary;
+    }
+
+    Compression::CompressionResultData CompressorZStd::CompressBlock(
+        AZStd::span<AZStd::byte> compressionBuffer, const AZStd::span<const AZStd::byte>& uncompressedData,
+        const Compression::CompressionOptions& compressionOptions) const
+    {
+        Compression::CompressionResultData resultData;
+
+        int compressionLevel = DefaultZStdCompressionLevel;
+        AZStd::span<const AZStd::byte> dictionary;
+        AZ::u64 frameSize = uncompressedData.size();
+        if (auto zstdOptions = azrtti_cast<const CompressionZStdOptions*>(&compressionOptions);
+            zstdOptions != nullptr)
+        {
+            compressionLevel = AZStd::clamp(zstdOptions->m_compressionLevel, 1, ZSTD_maxCLevel());
+            dictionary = zstdOptions->m_dictionary;
+            if (zstdOptions->m_frameSize != 0)
+            {
+                frameSize = AZStd::max(zstdOptions->m_frameSize, AZ::u64{ MinFrameSize });
+            }
+        }
+
+        if (const size_t worstCaseCompressedSize = CompressBound(uncompressedData.size());
+            compressionBuffer.size() < worstCaseCompressedSize)
+        {
+            // Like the LZ4 compressor, attempt the compression anyway as the data could still fit
+            resultData.m_compressionOutcome.m_resultString = Compression::CompressionResultString::format(
+                "Output buffer capacity is less than the upper bound for worst case."
+                " Worst case size is %zu; output buffer capacity is %zu\n",
+                worstCaseCompressedSize, compressionBuffer.size());
+        }
+
+        ZSTD_CCtx* compressionContext = Internal::GetThreadCompressionContext();
+        if (compressionContext == nullptr)
+        {
+            resultData.m_compressionOutcome.m_resultString += "Unable to create ZStd compression context";
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+
+        ZSTD_CDict* digestedDictionary = dictionary.empty() ? nullptr : FindOrCreateDictionary(dictionary, compressionLevel);
+
+        // Each frame is compressed independently of the other frames and written directly after the previous frame
+        size_t compressedSize{};
+        AZStd::span<const AZStd::byte> remainingData = uncompressedData;
+        do
+        {
+            AZStd::span<const AZStd::byte> frameData = remainingData.first(AZStd::min<size_t>(remainingData.size(), frameSize));
+            AZStd::span<AZStd::byte> frameBuffer = compressionBuffer.subspan(compressedSize);
+
+            size_t frameCompressedSize{};
+            if (dictionary.empty())
+            {
+                frameCompressedSize = ZSTD_compressCCtx(compressionContext, frameBuffer.data(), frameBuffer.size(),
+                    frameData.data(), frameData.size(), compressionLevel);
+            }
+            else if (digestedDictionary != nullptr)
+            {
+                frameCompressedSize = ZSTD_compress_usingCDict(compressionContext, frameBuffer.data(), frameBuffer.size(),
+                    frameData.data(), frameData.size(), digestedDictionary);
+            }
+            else
+            {
+                // Raw content dictionaries are not cached
+                frameCompressedSize = ZSTD_compress_usingDict(compressionContext, frameBuffer.data(), frameBuffer.size(),
+                    frameData.data(), frameData.size(), dictionary.data(), dictionary.size(), compressionLevel);
+            }
+
+            if (ZSTD_isError(frameCompressedSize))
+            {
+                resultData.m_compressionOutcome.m_resultString += Compression::CompressionResultString::format(
+                    "ZStd compression has failed with error \"%s\". The source buffer size is %zu and the output buffer"
+                    " has capacity of %zu", ZSTD_getErrorName(frameCompressedSize), uncompressedData.size(), compressionBuffer.size());
+                resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+                return resultData;
+            }
+
+            compressedSize += frameCompressedSize;
+            remainingData = remainingData.subspan(frameData.size());
+        } while (!remainingData.empty());
+
+        // Update the result buffer span to point at the beginning of the compressed data and
+        // the correct compressed size
+        resultData.m_compressedBuffer = compressionBuffer.subspan(0, compressedSize);
+        resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Complete;
+        return resultData;
+    }
+
+    auto CompressorZStd::TrainDictionary(AZStd::span<const AZStd::span<const AZStd::byte>> samples,
+        size_t dictionaryCapacity) -> TrainDictionaryOutcome
+    {
+        // ZDICT expects the samples to be stored contiguously in memory
+        AZStd::vector<AZStd::byte> samplesBuffer;
+        AZStd::vector<size_t> sampleSizes;
+        sampleSizes.reserve(samples.size());
+        for (AZStd::span<const AZStd::byte> sample : samples)
+        {
+            samplesBuffer.insert(samplesBuffer.end(), sample.begin(), sample.end());
+            sampleSizes.push_back(sample.size());
+        }
+
+        AZStd::vector<AZStd::byte> dictionary;
+        dictionary.resize_no_construct(dictionaryCapacity);
+        const size_t dictionarySize = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+            samplesBuffer.data(), sampleSizes.data(), aznumeric_cast<unsigned>(sampleSizes.size()));
+        if (ZDICT_isError(dictionarySize))
+        {
+            return AZ::Failure(Compression::CompressionResultString::format(
+                "ZStd dictionary training has failed with error \"%s\". %zu samples with a total size of %zu were supplied",
+                ZDICT_getErrorName(dictionarySize), sampleSizes.size(), samplesBuffer.size()));
+        }
+
+        dictionary.resize(dictionarySize);
+        return AZ::Success(AZStd::move(dictionary));
+    }
+} // namespace CompressionZStd
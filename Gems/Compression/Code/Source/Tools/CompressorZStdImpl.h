@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Compression/CompressionInterfaceAPI.h>
+
+struct ZSTD_CDict_s;
+
+namespace CompressionZStd
+{
+    class CompressorZStd
+        : public Compression::ICompressionInterface
+    {
+    public:
+        CompressorZStd();
+        ~CompressorZStd() override;
+        //! Retrieves the 32-bit compression algorithm ID associated with this interface
+        Compression::CompressionAlgorithmId GetCompressionAlgorithmId() const override;
+        //! Retrieves the human readable associated with the ZStd compressor
+        AZStd::string_view GetCompressionAlgorithmName() const override;
+        //! Compresses the uncompressed data into the compressed buffer as a single ZStd frame
+        //! A CompressionZStdOptions instance can be supplied to select the compression level, dictionary
+        //! and to split the data into multiple independent frames
+        //! @return a CompressionResultData instance to indicate if compression operation has succeeded
+        [[nodiscard]] Compression::CompressionResultData CompressBlock(
+            AZStd::span<AZStd::byte> compressionBuffer, const AZStd::span<const AZStd::byte>& uncompressedData,
+            const Compression::CompressionOptions& compressionOptions = {}) const override;
+
+        [[nodiscard]] size_t CompressBound(size_t uncompressedBufferSize) const override;
+
+        //! Trains a dictionary on a set of samples of content that will be compressed separately.
+        //! Dictionaries substantially improve the compression ratio of small files with similar content,
+        //! such as many small assets of the same type.
+        //! @param samples Spans to the sample content. A few hundred samples with a total size around 100 times the dictionary
+        //! capacity is recommended
+        //! @param dictionaryCapacity maximum size of the dictionary. Around 100 KiB is a good default
+        //! @return The trained dictionary or an error string if training failed.
+        using TrainDictionaryOutcome = AZ::Outcome<AZStd::vector<AZStd::byte>, Compression::CompressionResultString>;
+        static TrainDictionaryOutcome TrainDictionary(AZStd::span<const AZStd::span<const AZStd::byte>> samples,
+            size_t dictionaryCapacity = 112640);
+
+        //! Smallest frame size the uncompressed data is split into when CompressionZStdOptions::m_frameSize is set
+        static constexpr size_t MinFrameSize = 64 * 1024;
+
+    private:
+        //! Returns a digested dictionary for the trained dictionary at the compression level
+        //! Digested dictionaries are cached by dictionary ID, as creating them is more expensive than compressing a small block
+        //! Returns nullptr for raw content dictionaries that don't have a dictionary ID
+        ZSTD_CDict_s* FindOrCreateDictionary(AZStd::span<const AZStd::byte> dictionary, int compressionLevel) const;
+
+        struct DictionaryEntry
+        {
+            AZ::u32 m_dictionaryId{};
+            int m_compressionLevel{};
+            ZSTD_CDict_s* m_dictionary{};
+        };
+        mutable AZStd::vector<DictionaryEntry> m_dictionaries;
+        mutable AZStd::mutex m_dictionaryMutex;
+    };
+} // namespace CompressionZStd
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/ranges/ranges_algorithm.h>
+
+#include <Compression/CompressionZStdAPI.h>
+#include <Clients/DecompressorZStdImpl.h>
+
+#include <zstd.h>
+
+namespace CompressionZStdTest
+{
+    class DecompressionZStdFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        DecompressionZStdFixture()
+        {
+            // Fill the uncompressed data with a repeating pattern that spans multiple ZStd blocks
+            constexpr size_t UncompressedSize = 300 * 1024;
+            m_uncompressedData.reserve(UncompressedSize);
+            for (size_t index = 0; index < UncompressedSize; ++index)
+            {
+                m_uncompressedData.push_back(static_cast<AZStd::byte>((index * 7) % 251));
+            }
+
+            // The decompressor is tested in isolation, so the data is compressed with the zstd library directly
+            m_compressedData.resize_no_construct(ZSTD_compressBound(m_uncompressedData.size()));
+            const size_t compressedSize = ZSTD_compress(m_compressedData.data(), m_compressedData.size(),
+                m_uncompressedData.data(), m_uncompressedData.size(), CompressionZStd::DefaultZStdCompressionLevel);
+            EXPECT_FALSE(ZSTD_isError(compressedSize));
+            m_compressedData.resize(compressedSize);
+        }
+
+    protected:
+        AZStd::vector<AZStd::byte> m_uncompressedData;
+        AZStd::vector<AZStd::byte> m_compressedData;
+        CompressionZStd::DecompressorZStd m_decompressor;
+    };
+
+    TEST_F(DecompressionZStdFixture, ZStdDecompressor_DecompressBlock_Succeeds)
+    {
+        auto compressionAlgorithmId = CompressionZStd::GetZStdCompressionAlgorithmId();
+        auto decompressorZStd = AZStd::make_unique<CompressionZStd::DecompressorZStd>();
+
+        EXPECT_EQ(compressionAlgorithmId, decompressorZStd->GetCompressionAlgorithmId());
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(m_uncompressedData.size());
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZStd->DecompressBlock(
+            decompressionBuffer, m_compressedData);
+
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_EQ(m_uncompressedData.size(), decompressionResultData.GetUncompressedByteCount());
+        EXPECT_TRUE(AZStd::ranges::equal(m_uncompressedData, decompressionResultData.m_uncompressedBuffer));
+    }
+
+    TEST_F(DecompressionZStdFixture, ZStdDecompressor_DecompressBlock_WithBufferTooSmall_Fails)
+    {
+        auto decompressorZStd = AZStd::make_unique<CompressionZStd::DecompressorZStd>();
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(m_uncompressedData.size() / 2);
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZStd->DecompressBlock(
+            decompressionBuffer, m_compressedData);
+
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+        EXPECT_EQ(0, decompressionResultData.GetUncompressedByteCount());
+    }
+
+    TEST_F(DecompressionZStdFixture, ZStdDecompressor_DecompressRange_OnlyWritesRequestedRange)
+    {
+        // Read a range which starts in the second ZStd block and ends in the third
+        constexpr size_t RangeOffset = 200 * 1024 - 17;
+        constexpr size_t RangeSize = 64 * 1024;
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(RangeSize);
+
+        Compression::DecompressionResultData decompressionResultData = m_decompressor.DecompressRange(
+            decompressionBuffer, m_compressedData, RangeOffset);
+
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_EQ(RangeSize, decompressionResultData.GetUncompressedByteCount());
+        EXPECT_TRUE(AZStd::ranges::equal(AZStd::span(m_uncompressedData).subspan(RangeOffset, RangeSize),
+            decompressionResultData.m_uncompressedBuffer));
+    }
+
+    TEST_F(DecompressionZStdFixture, ZStdDecompressor_DecompressRange_PastEndOfData_IsTruncated)
+    {
+        constexpr size_t BytesBeforeEnd = 10;
+        const size_t rangeOffset = m_uncompressedData.size() - BytesBeforeEnd;
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(BytesBeforeEnd * 2);
+
+        Compression::DecompressionResultData decompressionResultData = m_decompressor.DecompressRange(
+            decompressionBuffer, m_compressedData, rangeOffset);
+
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_EQ(BytesBeforeEnd, decompressionResultData.GetUncompressedByteCount());
+
+        // An offset past the end of the uncompressed data fails
+        decompressionResultData = m_decompressor.DecompressRange(
+            decompressionBuffer, m_compressedData, m_uncompressedData.size() + 1);
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+    }
+}
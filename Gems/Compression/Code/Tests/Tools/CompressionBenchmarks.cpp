@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <Compression/CompressionZStdAPI.h>
+#include <Clients/DecompressorLZ4Impl.h>
+#include <Clients/DecompressorZStdImpl.h>
+#include <Tools/CompressorLZ4Impl.h>
+#include <Tools/CompressorZStdImpl.h>
+
+namespace CompressionBenchmarks
+{
+    //! Upper bound of the amount of cache assets loaded, which keeps the compression setup of the benchmarks reasonable
+    constexpr size_t MaxCorpusSize = 64 * 1024 * 1024;
+    //! Matches the default block size of the Archive gem
+    constexpr size_t BlockSize = 2 * 1024 * 1024;
+
+    //! Assets from the product cache of the active project, split into archive sized blocks
+    struct AssetCorpus
+    {
+        AZStd::vector<AZStd::vector<AZStd::byte>> m_blocks;
+        size_t m_totalSize{};
+    };
+
+    static void GatherAssets(const AZ::IO::Path& folder, AssetCorpus& corpus)
+    {
+        const AZ::IO::Path filter = folder / "*";
+        AZ::IO::SystemFile::FindFiles(filter.c_str(), [&folder, &corpus](const char* fileName, bool isFile)
+        {
+            if (corpus.m_totalSize >= MaxCorpusSize)
+            {
+                return false;
+            }
+
+            const AZ::IO::Path filePath = folder / fileName;
+            if (!isFile)
+            {
+                if (AZ::IO::PathView(fileName) != "." && AZ::IO::PathView(fileName) != "..")
+                {
+                    GatherAssets(filePath, corpus);
+                }
+                return true;
+            }
+
+            auto readOutcome = AZ::Utils::ReadFile<AZStd::vector<AZStd::byte>>(filePath.Native(), MaxCorpusSize);
+            if (!readOutcome.IsSuccess())
+            {
+                return true;
+            }
+
+            AZStd::span<const AZStd::byte> fileContent = readOutcome.GetValue();
+            while (!fileContent.empty())
+            {
+                const size_t blockSize = AZStd::min(fileContent.size(), BlockSize);
+                corpus.m_blocks.emplace_back(fileContent.begin(), fileContent.begin() + blockSize);
+                corpus.m_totalSize += blockSize;
+                fileContent = fileContent.subspan(blockSize);
+            }
+            return true;
+        });
+    }
+
+    static const AssetCorpus& GetAssetCorpus()
+    {
+        static const AssetCorpus assetCorpus = []
+        {
+            AssetCorpus corpus;
+            if (const AZ::IO::Path productPath = AZ::Utils::GetProjectProductPathForPlatform().c_str();
+                !productPath.empty())
+            {
+                GatherAssets(productPath, corpus);
+            }
+            return corpus;
+        }();
+        return assetCorpus;
+    }
+
+    //! Compresses every block of the asset corpus with the supplied compressor and then measures decompression throughput.
+    //! The compression ratio is reported as a counter next to the decompression rate.
+    static void RunDecompressionBenchmark(benchmark::State& state,
+        const Compression::ICompressionInterface& compressor, const Compression::IDecompressionInterface& decompressor,
+        const Compression::CompressionOptions& compressionOptions)
+    {
+        const AssetCorpus& corpus = GetAssetCorpus();
+        if (corpus.m_blocks.empty())
+        {
+            state.SkipWithError("No assets were found in the product cache of the active project");
+            return;
+        }
+
+        AZStd::vector<AZStd::vector<AZStd::byte>> compressedBlocks;
+        compressedBlocks.reserve(corpus.m_blocks.size());
+        size_t totalCompressedSize = 0;
+        for (const AZStd::vector<AZStd::byte>& block : corpus.m_blocks)
+        {
+            AZStd::vector<AZStd::byte>& compressedBlock = compressedBlocks.emplace_back();
+            compressedBlock.resize_no_construct(compressor.CompressBound(block.size()));
+            Compression::CompressionResultData compressionResultData = compressor.CompressBlock(
+                compressedBlock, block, compressionOptions);
+            if (!compressionResultData)
+            {
+                state.SkipWithError(compressionResultData.m_compressionOutcome.m_resultString.c_str());
+                return;
+            }
+            compressedBlock.resize(compressionResultData.GetCompressedByteCount());
+            totalCompressedSize += compressedBlock.size();
+        }
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(BlockSize);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZStd::vector<AZStd::byte>& compressedBlock : compressedBlocks)
+            {
+                Compression::DecompressionResultData decompressionResultData = decompressor.DecompressBlock(
+                    decompressionBuffer, compressedBlock);
+                benchmark::DoNotOptimize(decompressionResultData.GetUncompressedByteCount());
+            }
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * corpus.m_totalSize));
+        state.counters["Ratio"] = static_cast<double>(corpus.m_totalSize) / static_cast<double>(totalCompressedSize);
+        state.counters["CompressedBytes"] = static_cast<double>(totalCompressedSize);
+    }
+
+    static void BM_DecompressLZ4(benchmark::State& state)
+    {
+        CompressionLZ4::CompressorLZ4 compressor;
+        CompressionLZ4::DecompressorLZ4 decompressor;
+        RunDecompressionBenchmark(state, compressor, decompressor, {});
+    }
+    BENCHMARK(BM_DecompressLZ4)->Unit(::benchmark::kMillisecond);
+
+    //! The compression level is supplied as the benchmark argument
+    static void BM_DecompressZStd(benchmark::State& state)
+    {
+        CompressionZStd::CompressorZStd compressor;
+        CompressionZStd::DecompressorZStd decompressor;
+        CompressionZStd::CompressionZStdOptions compressionOptions;
+        compressionOptions.m_compressionLevel = static_cast<int>(state.range(0));
+        RunDecompressionBenchmark(state, compressor, decompressor, compressionOptions);
+    }
+    BENCHMARK(BM_DecompressZStd)->Arg(1)->Arg(3)->Arg(9)->Arg(19)->Unit(::benchmark::kMillisecond);
+} // namespace CompressionBenchmarks
+
+#endif
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/ranges/ranges_algorithm.h>
+#include <AzCore/std/string/string.h>
+
+#include <Compression/CompressionZStdAPI.h>
+#include <Clients/DecompressorZStdImpl.h>
+#include <Tools/CompressorZStdImpl.h>
+
+namespace CompressionZStdTest
+{
+    class CompressionZStdFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        CompressionZStdFixture() = default;
+
+        ~CompressionZStdFixture() = default;
+
+    protected:
+        //! Creates a small json document which shares most of its content with the other documents
+        //! This mimics a set of small assets of the same type that benefit from a shared dictionary
+        static AZStd::string CreateSampleDocument(size_t index)
+        {
+            return AZStd::string::format(R"({"Type": "JsonSerialization", "Version": 1, "ClassName": "SampleAsset",)"
+                R"( "ClassData": {"Id": %zu, "Name": "Sample_%zu", "Scale": [1.0, %zu.5, 1.0], "Tags": ["small", "asset", "sample"],)"
+                R"( "Material": "materials/sample_%zu.azmaterial", "Visible": true, "LodCount": %zu}})",
+                index, index * 31, index % 7, index % 13, index % 4);
+        }
+
+        CompressionZStd::CompressorZStd m_compressor;
+        CompressionZStd::DecompressorZStd m_decompressor;
+    };
+
+    TEST_F(CompressionZStdFixture, ZStdCompressor_CompressBlock_Succeeds)
+    {
+        auto compressionAlgorithmId = CompressionZStd::GetZStdCompressionAlgorithmId();
+        EXPECT_EQ(compressionAlgorithmId, m_compressor.GetCompressionAlgorithmId());
+
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+        size_t compressBufferUpperBound = m_compressor.CompressBound(dataToCompress.size());
+        EXPECT_GT(compressBufferUpperBound, 0);
+
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(compressBufferUpperBound);
+
+        AZStd::span uncompressedData(reinterpret_cast<const AZStd::byte*>(dataToCompress.data()), dataToCompress.size());
+
+        Compression::CompressionResultData compressionResultData = m_compressor.CompressBlock(
+            compressionBuffer, uncompressedData);
+
+        ASSERT_TRUE(static_cast<bool>(compressionResultData));
+        EXPECT_GT(compressionResultData.GetCompressedByteCount(), 0);
+        EXPECT_NE(nullptr, compressionResultData.GetCompressedByteData());
+
+        // Validate the round trip through the ZStd decompressor
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(dataToCompress.size());
+        Compression::DecompressionResultData decompressionResultData = m_decompressor.DecompressBlock(
+            decompressionBuffer, compressionResultData.m_compressedBuffer);
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_TRUE(AZStd::ranges::equal(uncompressedData, decompressionResultData.m_uncompressedBuffer));
+    }
+
+    TEST_F(CompressionZStdFixture, ZStdCompressor_CompressBlock_WithBufferTooSmall_Fails)
+    {
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+        AZStd::span uncompressedData(reinterpret_cast<const AZStd::byte*>(dataToCompress.data()), dataToCompress.size());
+
+        // The compression output buffer has a size of zero, so compression should fail
+        AZStd::vector<AZStd::byte> compressionBuffer;
+
+        Compression::CompressionResultData compressionResultData = m_compressor.CompressBlock(
+            compressionBuffer, uncompressedData);
+
+        EXPECT_FALSE(static_cast<bool>(compressionResultData));
+        EXPECT_EQ(0, compressionResultData.GetCompressedByteCount());
+        EXPECT_EQ(nullptr, compressionResultData.GetCompressedByteData());
+    }
+
+    TEST_F(CompressionZStdFixture, ZStdCompressor_CompressBlock_WithHigherLevel_DoesNotIncreaseSize)
+    {
+        AZStd::string dataToCompress;
+        for (size_t index = 0; index < 256; ++index)
+        {
+            dataToCompress += CreateSampleDocument(index);
+        }
+        AZStd::span uncompressedData(reinterpret_cast<const AZStd::byte*>(dataToCompress.data()), dataToCompress.size());
+
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(m_compressor.CompressBound(dataToCompress.size()));
+
+        CompressionZStd::CompressionZStdOptions fastOptions;
+        fastOptions.m_compressionLevel = 1;
+        Compression::CompressionResultData fastResult = m_compressor.CompressBlock(compressionBuffer, uncompressedData, fastOptions);
+        ASSERT_TRUE(static_cast<bool>(fastResult));
+        const AZ::u64 fastCompressedSize = fastResult.GetCompressedByteCount();
+
+        CompressionZStd::CompressionZStdOptions strongOptions;
+        strongOptions.m_compressionLevel = 19;
+        Compression::CompressionResultData strongResult = m_compressor.CompressBlock(compressionBuffer, uncompressedData, strongOptions);
+        ASSERT_TRUE(static_cast<bool>(strongResult));
+        EXPECT_LE(strongResult.GetCompressedByteCount(), fastCompressedSize);
+    }
+
+    TEST_F(CompressionZStdFixture, ZStdCompressor_TrainedDictionary_ImprovesSmallFileRatio_AndRoundTrips)
+    {
+        AZStd::vector<AZStd::string> sampleDocuments;
+        AZStd::vector<AZStd::span<const AZStd::byte>> samples;
+        constexpr size_t SampleCount = 1000;
+        sampleDocuments.reserve(SampleCount);
+        samples.reserve(SampleCount);
+        for (size_t index = 0; index < SampleCount; ++index)
+        {
+            const AZStd::string& sampleDocument = sampleDocuments.emplace_back(CreateSampleDocument(index));
+            samples.emplace_back(reinterpret_cast<const AZStd::byte*>(sampleDocument.data()), sampleDocument.size());
+        }
+
+        auto trainOutcome = CompressionZStd::CompressorZStd::TrainDictionary(samples, 4096);
+        ASSERT_TRUE(trainOutcome.IsSuccess()) << trainOutcome.GetError().c_str();
+        const AZStd::vector<AZStd::byte>& dictionary = trainOutcome.GetValue();
+        EXPECT_FALSE(dictionary.empty());
+
+        // Compress a document which was not part of the training set
+        const AZStd::string document = CreateSampleDocument(SampleCount + 1);
+        AZStd::span uncompressedData(reinterpret_cast<const AZStd::byte*>(document.data()), document.size());
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(m_compressor.CompressBound(document.size()));
+
+        Compression::CompressionResultData noDictionaryResult = m_compressor.CompressBlock(compressionBuffer, uncompressedData);
+        ASSERT_TRUE(static_cast<bool>(noDictionaryResult));
+        const AZ::u64 noDictionaryCompressedSize = noDictionaryResult.GetCompressedByteCount();
+
+        CompressionZStd::CompressionZStdOptions compressionOptions;
+        compressionOptions.m_dictionary = dictionary;
+        Compression::CompressionResultData dictionaryResult = m_compressor.CompressBlock(
+            compressionBuffer, uncompressedData, compressionOptions);
+        ASSERT_TRUE(static_cast<bool>(dictionaryResult));
+        EXPECT_LT(dictionaryResult.GetCompressedByteCount(), noDictionaryCompressedSize);
+
+        // Decompressing without the dictionary fails
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(document.size());
+        Compression::DecompressionResultData decompressionResultData = m_decompressor.DecompressBlock(
+            decompressionBuffer, dictionaryResult.m_compressedBuffer);
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+
+        CompressionZStd::DecompressionZStdOptions decompressionOptions;
+        decompressionOptions.m_dictionary = dictionary;
+        decompressionResultData = m_decompressor.DecompressBlock(
+            decompressionBuffer, dictionaryResult.m_compressedBuffer, decompressionOptions);
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_TRUE(AZStd::ranges::equal(uncompressedData, decompressionResultData.m_uncompressedBuffer));
+    }
+
+    TEST_F(CompressionZStdFixture, ZStdDecompressor_DecompressRange_WithDictionary_Succeeds)
+    {
+        AZStd::vector<AZStd::string> sampleDocuments;
+        AZStd::vector<AZStd::span<const AZStd::byte>> samples;
+        constexpr size_t SampleCount = 1000;
+        sampleDocuments.reserve(SampleCount);
+        samples.reserve(SampleCount);
+        for (size_t index = 0; index < SampleCount; ++index)
+        {
+            const AZStd::string& sampleDocument = sampleDocuments.emplace_back(CreateSampleDocument(index));
+            samples.emplace_back(reinterpret_cast<const AZStd::byte*>(sampleDocument.data()), sampleDocument.size());
+        }
+
+        auto trainOutcome = CompressionZStd::CompressorZStd::TrainDictionary(samples, 4096);
+        ASSERT_TRUE(trainOutcome.IsSuccess()) << trainOutcome.GetError().c_str();
+        const AZStd::vector<AZStd::byte>& dictionary = trainOutcome.GetValue();
+
+        // Mimic a large file in an archive compressed with the archive's dictionary and split into independent frames
+        constexpr size_t FrameSize = CompressionZStd::CompressorZStd::MinFrameSize;
+        AZStd::string content;
+        for (size_t index = 0; content.size() < FrameSize * 3; ++index)
+        {
+            content += CreateSampleDocument(SampleCount + index);
+        }
+        AZStd::span uncompressedData(reinterpret_cast<const AZStd::byte*>(content.data()), content.size());
+
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(m_compressor.CompressBound(content.size()));
+        CompressionZStd::CompressionZStdOptions compressionOptions;
+        compressionOptions.m_dictionary = dictionary;
+        compressionOptions.m_frameSize = FrameSize;
+        Compression::CompressionResultData compressionResultData = m_compressor.CompressBlock(
+            compressionBuffer, uncompressedData, compressionOptions);
+        ASSERT_TRUE(static_cast<bool>(compressionResultData));
+
+        // The range starts in the middle of the second frame, so a frame is skipped and part of a frame is decompressed and discarded
+        constexpr size_t RangeOffset = FrameSize + 123;
+        constexpr size_t RangeSize = FrameSize;
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(RangeSize);
+
+        Compression::DecompressionResultData decompressionResultData = m_decompressor.DecompressRange(
+            decompressionBuffer, compressionResultData.m_compressedBuffer, RangeOffset);
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+
+        CompressionZStd::DecompressionZStdOptions decompressionOptions;
+        decompressionOptions.m_dictionary = dictionary;
+        decompressionResultData = m_decompressor.DecompressRange(
+            decompressionBuffer, compressionResultData.m_compressedBuffer, RangeOffset, decompressionOptions);
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_TRUE(AZStd::ranges::equal(uncompressedData.subspan(RangeOffset, RangeSize), decompressionResultData.m_uncompressedBuffer));
+
+        // The dictionary must not stay attached to the thread's decompression context after the range read
+        Compression::CompressionResultData noDictionaryResult = m_compressor.CompressBlock(compressionBuffer, uncompressedData);
+        ASSERT_TRUE(static_cast<bool>(noDictionaryResult));
+        decompressionBuffer.resize_no_construct(content.size());
+        decompressionResultData = m_decompressor.DecompressBlock(decompressionBuffer, noDictionaryResult.m_compressedBuffer);
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_TRUE(AZStd::ranges::equal(uncompressedData, decompressionResultData.m_uncompressedBuffer));
+    }
+
+    TEST_F(CompressionZStdFixture, ZStdCompressor_CompressBlock_WithFrameSize_WritesIndependentFrames)
+    {
+        constexpr size_t FrameSize = CompressionZStd::CompressorZStd::MinFrameSize;
+        AZStd::vector<AZStd::byte> uncompressedData;
+        uncompressedData.resize_no_construct(FrameSize * 3 + 100);
+        for (size_t index = 0; index < uncompressedData.size(); ++index)
+        {
+            uncompressedData[index] = static_cast<AZStd::byte>((index * 13) % 241);
+        }
+
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(m_compressor.CompressBound(uncompressedData.size()));
+        CompressionZStd::CompressionZStdOptions compressionOptions;
+        compressionOptions.m_frameSize = FrameSize;
+        Compression::CompressionResultData compressionResultData = m_compressor.CompressBlock(
+            compressionBuffer, uncompressedData, compressionOptions);
+        ASSERT_TRUE(static_cast<bool>(compressionResultData));
+
+        AZStd::vector<CompressionZStd::DecompressorZStd::FrameInfo> frames;
+        ASSERT_TRUE(CompressionZStd::DecompressorZStd::FindFrames(frames, compressionResultData.m_compressedBuffer));
+        ASSERT_EQ(4, frames.size());
+        EXPECT_EQ(0, frames[0].m_compressedOffset);
+        EXPECT_EQ(FrameSize * 3, frames[3].m_uncompressedOffset);
+        EXPECT_EQ(100, frames[3].m_uncompressedSize);
+        EXPECT_EQ(compressionResultData.GetCompressedByteCount(), frames[3].m_compressedOffset + frames[3].m_compressedSize);
+
+        // The concatenated frames decompress as a whole
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(uncompressedData.size());
+        Compression::DecompressionResultData decompressionResultData = m_decompressor.DecompressBlock(
+            decompressionBuffer, compressionResultData.m_compressedBuffer);
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_TRUE(AZStd::ranges::equal(uncompressedData, decompressionResultData.m_uncompressedBuffer));
+
+        // Each frame decompresses on its own
+        const CompressionZStd::DecompressorZStd::FrameInfo& frame = frames[2];
+        decompressionResultData = m_decompressor.DecompressBlock(decompressionBuffer,
+            compressionResultData.m_compressedBuffer.subspan(frame.m_compressedOffset, frame.m_compressedSize));
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_TRUE(AZStd::ranges::equal(AZStd::span(uncompressedData).subspan(frame.m_uncompressedOffset, frame.m_uncompressedSize),
+            decompressionResultData.m_uncompressedBuffer));
+
+        // Range reads skip to the frame that contains the offset
+        constexpr size_t RangeOffset = FrameSize * 2 + 7;
+        decompressionBuffer.resize(FrameSize);
+        decompressionResultData = m_decompressor.DecompressRange(
+            decompressionBuffer, compressionResultData.m_compressedBuffer, RangeOffset);
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_TRUE(AZStd::ranges::equal(AZStd::span(uncompressedData).subspan(RangeOffset, FrameSize),
+            decompressionResultData.m_uncompressedBuffer));
+    }
+}
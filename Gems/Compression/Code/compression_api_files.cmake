@@ -10,6 +10,8 @@ set(FILES
     Include/Compression/CompressionInterfaceAPI.inl
     Include/Compression/CompressionInterfaceStructs.h
     Include/Compression/CompressionLZ4API.h
+    Include/Compression/CompressionZStdAPI.h
+    Include/Compression/CompressionZStdAPI.inl
     Include/Compression/DecompressionInterfaceAPI.h
     Include/Compression/DecompressionInterfaceAPI.inl
 )
@@ -7,4 +7,6 @@
 set(FILES
     Tests/Tools/CompressionEditorTest.cpp
     Tests/Tools/CompressionLZ4EditorTest.cpp
+    Tests/Tools/CompressionZStdEditorTest.cpp
+    Tests/Tools/CompressionBenchmarks.cpp
 )
@@ -13,6 +13,8 @@ set(FILES
     Source/Clients/DecompressionRegistrarImpl.h
     Source/Clients/DecompressorLZ4Impl.cpp
     Source/Clients/DecompressorLZ4Impl.h
+    Source/Clients/DecompressorZStdImpl.cpp
+    Source/Clients/DecompressorZStdImpl.h
     Source/Clients/Streamer/DecompressorStackEntry.cpp
     Source/Clients/Streamer/DecompressorStackEntry.h
 )
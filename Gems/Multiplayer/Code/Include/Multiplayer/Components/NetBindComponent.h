@@ -17,6 +17,7 @@
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/PropertySnapshotCache.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/NetworkInput/IMultiplayerComponentInput.h>
@@ -87,6 +88,14 @@ namespace Multiplayer
         //! @return EntityMigration::Enabled if the entity is allowed to migrate, EntityMigration::Disabled otherwise
         EntityMigration GetAllowEntityMigration() const;
 
+        //! Sets the relevancy category used by server to client replication windows to prioritize this entity.
+        //! @param value the relevancy category of this entity
+        void SetReplicationRelevancy(ReplicationRelevancy value);
+
+        //! Retrieves the relevancy category used by server to client replication windows to prioritize this entity.
+        //! @return the relevancy category of this entity
+        ReplicationRelevancy GetReplicationRelevancy() const;
+
         //! This is a helper that validates the owning entity is in the correct role to read from a network property that matches the relicateFrom and replicateTo parameters.
         //! @param propertyName  the name of the property, for logging and debugging purposes
         //! @param replicateFrom the network entity role that the property replicates from
@@ -201,6 +210,10 @@ namespace Multiplayer
         void FillReplicationRecord(ReplicationRecord& replicationRecord) const;
         void FillTotalReplicationRecord(ReplicationRecord& replicationRecord) const;
 
+        //! Returns the cache of update data serialized for this entity during the current host frame.
+        //! @return the property snapshot cache for this entity
+        PropertySnapshotCache& GetPropertySnapshotCache();
+
     private:
         void PreInit(AZ::Entity* entity, const PrefabEntityId& prefabEntityId, NetEntityId netEntityId, NetEntityRole netEntityRole);
 
@@ -230,6 +243,7 @@ namespace Multiplayer
         ReplicationRecord m_totalRecord = NetEntityRole::InvalidRole;
         ReplicationRecord m_predictableRecord = NetEntityRole::Autonomous;
         ReplicationRecord m_localNotificationRecord = NetEntityRole::InvalidRole;
+        PropertySnapshotCache m_propertySnapshotCache;
         PrefabEntityId    m_prefabEntityId;
         AZ::Data::AssetId m_prefabAssetId;
         // It is important that this component map be ordered, as we walk it to generate serialization ordering
@@ -262,6 +276,7 @@ namespace Multiplayer
         NetEntityRole         m_netEntityRole   = NetEntityRole::InvalidRole;
         NetEntityId           m_netEntityId     = InvalidNetEntityId;
         EntityMigration       m_netEntityMigration = EntityMigration::Enabled;
+        ReplicationRelevancy  m_replicationRelevancy = ReplicationRelevancy::Normal;
 
         AzNetworking::ConnectionId m_owningConnectionId = AzNetworking::InvalidConnectionId;
 
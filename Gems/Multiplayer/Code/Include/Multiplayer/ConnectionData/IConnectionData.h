@@ -40,8 +40,20 @@ namespace Multiplayer
         virtual EntityReplicationManager& GetReplicationManager() = 0;
 
         //! Creates and manages sending updates to the remote endpoint.
+        //! This is equivalent to calling PrepareUpdate, GenerateUpdates and SendGeneratedUpdates in that order.
         virtual void Update() = 0;
 
+        //! Performs the part of the update that has to run on the main thread before updates are generated, such as activating
+        //! entities that were replicated from the remote endpoint.
+        virtual void PrepareUpdate() = 0;
+
+        //! Serializes the updates for the remote endpoint without sending them.
+        //! Only reads shared entity state, so this can run concurrently with GenerateUpdates of other connections.
+        virtual void GenerateUpdates() = 0;
+
+        //! Sends the updates serialized by GenerateUpdates to the remote endpoint, must be called on the main thread.
+        virtual void SendGeneratedUpdates() = 0;
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
@@ -40,5 +40,9 @@ namespace Multiplayer
 
         // Other systems
         MultiplayerStat_PhysicsFrameTimeUs,
+
+        // Replication stats
+        MultiplayerStat_PropertySnapshotHitRate,
+        MultiplayerStat_PropertySnapshotBytesReused,
     };
 }
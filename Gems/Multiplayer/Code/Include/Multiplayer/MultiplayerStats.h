@@ -10,6 +10,7 @@
 
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/Time/ITime.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
@@ -49,6 +50,12 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! Entity update data reused from the property snapshot cache instead of being serialized again.
+        //! These are atomic since connection updates may be generated in parallel.
+        AZStd::atomic<uint64_t> m_propertySnapshotHits = 0;
+        AZStd::atomic<uint64_t> m_propertySnapshotMisses = 0;
+        AZStd::atomic<uint64_t> m_propertySnapshotBytesReused = 0;
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
@@ -57,6 +64,8 @@ namespace Multiplayer
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
+        void RecordPropertySnapshotHit(uint32_t reusedBytes);
+        void RecordPropertySnapshotMiss();
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
@@ -68,6 +77,7 @@ namespace Multiplayer
         Metric CalculateTotalPropertyUpdateRecvMetrics() const;
         Metric CalculateTotalRpcsSentMetrics() const;
         Metric CalculateTotalRpcsRecvMetrics() const;
+        float CalculatePropertySnapshotHitRate() const;
 
         struct Events
         {
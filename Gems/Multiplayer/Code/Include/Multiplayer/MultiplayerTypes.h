@@ -68,6 +68,9 @@ namespace Multiplayer
     AZ_TYPE_SAFE_INTEGRAL(HostFrameId, uint32_t);
     static constexpr HostFrameId InvalidHostFrameId = HostFrameId{ AzPhysics::SimulatedBody::UndefinedFrameId };
 
+    //! Sequence number of an entity baseline, a snapshot of an entity's full replicated state that later updates are delta-serialized against.
+    using EntityBaselineSequence = uint16_t;
+
     using LongNetworkString = AZ::CVarFixedString;
     using ReliabilityType = AzNetworking::ReliabilityType;
 
@@ -118,6 +121,14 @@ namespace Multiplayer
         Enabled
     };
 
+    //! Relevancy category of a networked entity, controls how far from a client and at what priority it's replicated.
+    enum class ReplicationRelevancy : uint8_t
+    {
+        Low,    // Cosmetic entities, only replicated close to the client at a reduced priority
+        Normal, // Default relevancy
+        High    // Gameplay critical entities, replicated at an increased priority
+    };
+
     //! Structure for identifying a specific entity within a spawnable.
     struct PrefabEntityId
     {
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AzNetworking
+{
+    class IConnection;
+}
+
+namespace Multiplayer
+{
+    //! A snapshot of the full replicated state of an entity, the serialized total replication record followed by all property data.
+    struct EntityBaseline
+    {
+        EntityBaselineSequence m_sequence = 0;
+        AzNetworking::PacketId m_sentPacketId = AzNetworking::InvalidPacketId;
+        AZStd::vector<uint8_t> m_state;
+    };
+
+    //! @class EntityBaselineHistory
+    //! @brief Ring buffer of the most recent baselines of a replicated entity.
+    //! Publishers track the baselines they sent so that updates can be delta-serialized against the most recent acknowledged one,
+    //! subscribers track the baselines they received so that those deltas can be applied to the same baseline.
+    class EntityBaselineHistory
+    {
+    public:
+        //! Constructs a history tracking net_EntityBaselineHistorySize baselines.
+        EntityBaselineHistory();
+
+        //! Constructs a history tracking the provided number of baselines.
+        //! @param capacity the maximum number of baselines to track
+        explicit EntityBaselineHistory(uint32_t capacity);
+
+        //! Stores a baseline as the most recent one, replacing any baseline with the same sequence.
+        //! @param sequence  the sequence number of the baseline
+        //! @param state     the serialized full state of the entity
+        //! @param stateSize the size of the serialized full state in bytes
+        //! @return reference to the stored baseline
+        EntityBaseline& Store(EntityBaselineSequence sequence, const uint8_t* state, uint32_t stateSize);
+
+        //! Finds the baseline with the provided sequence.
+        //! @param sequence the sequence number of the baseline to find
+        //! @return pointer to the baseline, or nullptr if it isn't tracked
+        const EntityBaseline* Find(EntityBaselineSequence sequence) const;
+
+        //! Finds the most recent baseline sent in a packet the remote endpoint acknowledged.
+        //! @param connection the connection the baselines were sent over
+        //! @return pointer to the baseline, or nullptr if no tracked baseline was acknowledged
+        const EntityBaseline* FindMostRecentAcked(const AzNetworking::IConnection& connection) const;
+
+        //! Returns the most recently stored baseline.
+        //! @return pointer to the most recently stored baseline, or nullptr if the history is empty
+        EntityBaseline* GetMostRecent();
+
+        //! Discards the most recently stored baseline.
+        void DiscardMostRecent();
+
+        //! Discards all baselines.
+        void Clear();
+
+        //! Returns the number of baselines tracked.
+        //! @return the number of baselines tracked
+        uint32_t GetSize() const;
+
+    private:
+        // Sorted from the most to the least recently stored baseline
+        AZStd::ring_buffer<EntityBaseline> m_baselines;
+    };
+
+    //! Delta-serializes an entity's full state against a baseline using the DeltaSerializer.
+    //! Both states are compared word by word, so only the words of the quantized property data that differ are written.
+    //! @param baseline    the baseline to delta-serialize against
+    //! @param state       the serialized full state of the entity
+    //! @param stateSize   the size of the serialized full state in bytes
+    //! @param outBuffer   buffer to write the encoded delta to
+    //! @param outCapacity the capacity of outBuffer in bytes
+    //! @return the size of the encoded delta, 0 if the state can't be delta-serialized and needs to be sent in full
+    uint32_t EncodeBaselineDelta(const EntityBaseline& baseline, const uint8_t* state, uint32_t stateSize, uint8_t* outBuffer, uint32_t outCapacity);
+
+    //! Reconstructs an entity's full state by applying an encoded delta to the baseline it was created against.
+    //! @param baseline  the baseline the delta was created against
+    //! @param delta     the encoded delta
+    //! @param deltaSize the size of the encoded delta in bytes
+    //! @param outState  output vector the reconstructed full state is written to
+    //! @return true if the state was reconstructed, false if the delta was malformed
+    bool DecodeBaselineDelta(const EntityBaseline& baseline, const uint8_t* delta, uint32_t deltaSize, AZStd::vector<uint8_t>& outState);
+}
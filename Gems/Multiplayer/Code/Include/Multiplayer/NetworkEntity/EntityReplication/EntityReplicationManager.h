@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
@@ -61,6 +62,15 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates();
+
+        //! Collects the entities that need to be updated this tick and serializes their updates into packets without sending them.
+        //! This only modifies state owned by this replication manager and reads entity state, so the updates of multiple
+        //! replication managers can be generated concurrently.
+        void GenerateUpdates();
+
+        //! Sends the packets built by GenerateUpdates, followed by any deferred rpcs and entity resets.
+        //! Must be called on the main thread once GenerateUpdates has completed.
+        void SendGeneratedUpdates();
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -90,6 +100,11 @@ namespace Multiplayer
         bool HandleEntityRpcMessages(AzNetworking::IConnection* invokingConnection, NetworkEntityRpcVector& rpcVector);
         bool HandleEntityResetMessages(AzNetworking::IConnection* invokingConnection, const NetEntityIdsForReset& resetIds);
 
+        //! Returns the baselines received from the remote host for an entity.
+        //! @param netEntityId the entity to return the received baselines of
+        //! @return the received baselines, or nullptr if no baseline of the entity is known
+        const EntityBaselineHistory* GetReceivedBaselines(NetEntityId netEntityId) const;
+
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
         void SetMaxRemoteEntitiesPendingCreationCount(uint32_t maxPendingEntities);
@@ -116,13 +131,27 @@ namespace Multiplayer
 
         UpdateValidationResult ValidateUpdate(const NetworkEntityUpdateMessage& updateMessage, AzNetworking::PacketId packetId, EntityReplicator* entityReplicator);
 
+        //! Reconstructs the full update data of a baseline update and stores it as a received baseline.
+        //! @param updateMessage the update message carrying a baseline
+        //! @param outState      output vector the full update data is written to
+        //! @return false if the update is a delta against a baseline that is no longer available
+        bool ResolveBaselineUpdate(const NetworkEntityUpdateMessage& updateMessage, AZStd::vector<uint8_t>& outState);
+
         using RpcMessages = AZStd::list<NetworkEntityRpcMessage>;
         bool DispatchOrphanedRpc(NetworkEntityRpcMessage& message, EntityReplicator* entityReplicator);
 
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
+        //! An entity update packet that has been serialized but not sent yet.
+        struct PendingUpdatePacket
+        {
+            NetworkEntityUpdateVector m_entityUpdates;
+            AZStd::vector<EntityReplicator*> m_replicators;
+        };
+
+        void GenerateEntityUpdateMessages(EntityReplicatorList& replicatorList, PendingUpdatePacket& outPacket);
+        void SendEntityUpdateMessages(PendingUpdatePacket& packet);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
         void SendEntityResets();
 
@@ -191,6 +220,12 @@ namespace Multiplayer
         NetEntityIdSet m_replicatorsPendingSend;
         NetEntityIdSet m_replicatorsPendingReset;
 
+        //! Baselines received from the remote host, keyed by entity, used to reconstruct baseline delta updates
+        AZStd::unordered_map<NetEntityId, EntityBaselineHistory> m_receivedBaselines;
+
+        //! Update packets generated by GenerateUpdates waiting to be sent by SendGeneratedUpdates
+        AZStd::vector<PendingUpdatePacket> m_pendingUpdatePackets;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    //! @class PropertySnapshotCache
+    //! @brief Caches the entity update data serialized for an entity during a single host frame.
+    //! Update data starts with the serialized replication record, which describes exactly which properties follow it. Connections
+    //! that serialize an identical record for the same remote role in the same host frame receive identical property data, so the
+    //! bytes serialized for the first connection are copied for the others instead of serializing the properties again.
+    //! Connection updates may be generated in parallel, so all access is guarded by a mutex. The number of snapshots is also kept in an
+    //! atomic so that clearing an empty cache, which is what happens for most property changes, doesn't need to take the mutex.
+    class PropertySnapshotCache
+    {
+    public:
+        //! Maximum number of distinct snapshots kept per host frame.
+        static constexpr uint32_t MaxSnapshots = 4;
+
+        PropertySnapshotCache() = default;
+
+        //! Looks for update data that was serialized for an identical replication record during the provided host frame.
+        //! @param hostFrameId the host frame the update data is being generated for
+        //! @param remoteRole  the network role of the remote replicator the update data is sent to
+        //! @param buffer      buffer starting with the serialized replication record, matching property data is appended to it
+        //! @param recordSize  the number of bytes of the serialized replication record at the start of buffer
+        //! @param capacity    the total capacity of buffer in bytes
+        //! @return the total size of the update data in buffer if a snapshot was found, 0 otherwise
+        uint32_t Fetch(HostFrameId hostFrameId, NetEntityRole remoteRole, uint8_t* buffer, uint32_t recordSize, uint32_t capacity);
+
+        //! Stores serialized update data so other connections can reuse it during the same host frame.
+        //! @param hostFrameId the host frame the update data was generated for
+        //! @param remoteRole  the network role of the remote replicator the update data is sent to
+        //! @param buffer      buffer containing the serialized replication record followed by the serialized property data
+        //! @param recordSize  the number of bytes of the serialized replication record at the start of buffer
+        //! @param totalSize   the total size of the update data in buffer
+        void Store(HostFrameId hostFrameId, NetEntityRole remoteRole, const uint8_t* buffer, uint32_t recordSize, uint32_t totalSize);
+
+        //! Discards all snapshots, this must be called whenever a property of the entity changes.
+        void Clear();
+
+        //! Returns the number of snapshots currently cached.
+        //! @return the number of snapshots currently cached
+        uint32_t GetSnapshotCount() const;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(PropertySnapshotCache);
+
+        void ResetForHostFrame(HostFrameId hostFrameId);
+
+        struct Snapshot
+        {
+            NetEntityRole m_remoteRole = NetEntityRole::InvalidRole;
+            uint32_t m_recordSize = 0;
+            AZStd::vector<uint8_t> m_data;
+        };
+
+        mutable AZStd::mutex m_mutex;
+        HostFrameId m_hostFrameId = InvalidHostFrameId;
+        AZStd::vector<Snapshot> m_snapshots;
+        AZStd::atomic<uint32_t> m_snapshotCount{ 0 }; //!< Size of m_snapshots, only modified while holding m_mutex
+    };
+}
@@ -73,6 +73,28 @@ namespace Multiplayer
         //! @return the current value of PrefabEntityId
         const PrefabEntityId& GetPrefabEntityId() const;
 
+        //! Marks this message as carrying a baseline, a snapshot of the entity's full state that later updates can be delta-serialized against.
+        //! @param baselineSequence      the sequence number of the baseline carried by this message
+        //! @param deltaBaselineSequence the sequence number of the baseline Data was delta-serialized against,
+        //!                              equal to baselineSequence if Data contains the full state
+        void SetBaselineSequences(EntityBaselineSequence baselineSequence, EntityBaselineSequence deltaBaselineSequence);
+
+        //! Returns whether or not this message carries a baseline.
+        //! @return whether or not this message carries a baseline
+        bool GetHasBaseline() const;
+
+        //! Returns whether or not Data is delta-serialized against a previously received baseline.
+        //! @return whether or not Data is delta-serialized against a previously received baseline
+        bool GetIsBaselineDelta() const;
+
+        //! Gets the sequence number of the baseline carried by this message.
+        //! @return the sequence number of the baseline carried by this message
+        EntityBaselineSequence GetBaselineSequence() const;
+
+        //! Gets the sequence number of the baseline Data was delta-serialized against.
+        //! @return the sequence number of the baseline Data was delta-serialized against
+        EntityBaselineSequence GetDeltaBaselineSequence() const;
+
         //! Sets the current value for Data
         //! @param value the value to set Data to
         void SetData(const AzNetworking::PacketEncodingBuffer& value);
@@ -97,6 +119,9 @@ namespace Multiplayer
         bool           m_isDelete = false;
         bool           m_wasMigrated = false;
         bool           m_hasValidPrefabId = false;
+        bool           m_hasBaseline = false;
+        EntityBaselineSequence m_baselineSequence = 0;
+        EntityBaselineSequence m_deltaBaselineSequence = 0;
         PrefabEntityId m_prefabEntityId;
 
         // Only allocated if we actually have data
@@ -301,6 +301,16 @@ namespace Multiplayer
         return m_netEntityMigration;
     }
 
+    void NetBindComponent::SetReplicationRelevancy(ReplicationRelevancy value)
+    {
+        m_replicationRelevancy = value;
+    }
+
+    ReplicationRelevancy NetBindComponent::GetReplicationRelevancy() const
+    {
+        return m_replicationRelevancy;
+    }
+
     bool NetBindComponent::ValidatePropertyRead(const char* propertyName, NetEntityRole replicateFrom, NetEntityRole replicateTo) const
     {
         bool isValid(false);
@@ -584,6 +594,8 @@ namespace Multiplayer
 
     void NetBindComponent::MarkDirty()
     {
+        // Property values changed, so update data serialized earlier this frame can no longer be shared
+        m_propertySnapshotCache.Clear();
         if (!m_handleMarkedDirty.IsConnected())
         {
             GetNetworkEntityManager()->AddEntityMarkedDirtyHandler(m_handleMarkedDirty);
@@ -670,6 +682,11 @@ namespace Multiplayer
 
     bool NetBindComponent::SerializeStateDeltaMessage(ReplicationRecord& replicationRecord, AzNetworking::ISerializer& serializer)
     {
+        if (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
+        {
+            m_propertySnapshotCache.Clear();
+        }
+
         auto& stats = GetMultiplayer()->GetStats();
         stats.RecordEntitySerializeStart(serializer.GetSerializerMode(), GetEntityId(), GetEntity()->GetName().c_str());
 
@@ -712,6 +729,11 @@ namespace Multiplayer
         }
     }
 
+    PropertySnapshotCache& NetBindComponent::GetPropertySnapshotCache()
+    {
+        return m_propertySnapshotCache;
+    }
+
     void NetBindComponent::PreInit(AZ::Entity* entity, const PrefabEntityId& prefabEntityId, NetEntityId netEntityId, NetEntityRole netEntityRole)
     {
         AZ_Assert(entity != nullptr, "AZ::Entity is null");
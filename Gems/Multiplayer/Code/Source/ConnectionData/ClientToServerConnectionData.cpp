@@ -51,8 +51,24 @@ namespace Multiplayer
     }
 
     void ClientToServerConnectionData::Update()
+    {
+        PrepareUpdate();
+        GenerateUpdates();
+        SendGeneratedUpdates();
+    }
+
+    void ClientToServerConnectionData::PrepareUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
-        m_entityReplicationManager.SendUpdates();
+    }
+
+    void ClientToServerConnectionData::GenerateUpdates()
+    {
+        m_entityReplicationManager.GenerateUpdates();
+    }
+
+    void ClientToServerConnectionData::SendGeneratedUpdates()
+    {
+        m_entityReplicationManager.SendGeneratedUpdates();
     }
 }
@@ -31,6 +31,9 @@ namespace Multiplayer
         AzNetworking::IConnection* GetConnection() const override;
         EntityReplicationManager& GetReplicationManager() override;
         void Update() override;
+        void PrepareUpdate() override;
+        void GenerateUpdates() override;
+        void SendGeneratedUpdates() override;
         bool CanSendUpdates() const override;
         void SetCanSendUpdates(bool canSendUpdates) override;
         bool DidHandshake() const override;
@@ -72,18 +72,42 @@ namespace Multiplayer
     }
 
     void ServerToClientConnectionData::Update()
+    {
+        PrepareUpdate();
+        GenerateUpdates();
+        SendGeneratedUpdates();
+    }
+
+    void ServerToClientConnectionData::PrepareUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
+    }
+
+    void ServerToClientConnectionData::GenerateUpdates()
+    {
+        if (IsSendingUpdates())
+        {
+            m_entityReplicationManager.GenerateUpdates();
+        }
+    }
 
+    void ServerToClientConnectionData::SendGeneratedUpdates()
+    {
+        if (IsSendingUpdates())
+        {
+            m_entityReplicationManager.SendGeneratedUpdates();
+        }
+    }
+
+    bool ServerToClientConnectionData::IsSendingUpdates() const
+    {
         if (CanSendUpdates())
         {
             NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
-            if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
-            {
-                m_entityReplicationManager.SendUpdates();
-            }
+            return netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority);
         }
+        return false;
     }
 
     void ServerToClientConnectionData::OnControlledEntityRemove()
@@ -32,6 +32,9 @@ namespace Multiplayer
         AzNetworking::IConnection* GetConnection() const override;
         EntityReplicationManager& GetReplicationManager() override;
         void Update() override;
+        void PrepareUpdate() override;
+        void GenerateUpdates() override;
+        void SendGeneratedUpdates() override;
         bool CanSendUpdates() const override;
         void SetCanSendUpdates(bool canSendUpdates) override;
         bool DidHandshake() const override;
@@ -44,6 +47,7 @@ namespace Multiplayer
         void SetProviderTicket(const AZStd::string&);
 
     private:
+        bool IsSendingUpdates() const;
         void OnControlledEntityRemove();
         void OnControlledEntityMigration(const ConstNetworkEntityHandle& entityHandle, const HostId& remoteHostId);
         void OnGameplayStarted();
@@ -179,6 +179,8 @@ namespace Multiplayer
         ImGui::Text("Total networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
         ImGui::Text("Total client connections: %llu", aznumeric_cast<AZ::u64>(stats.m_clientConnectionCount));
         ImGui::Text("Total server connections: %llu", aznumeric_cast<AZ::u64>(stats.m_serverConnectionCount));
+        ImGui::Text("Property snapshot hit rate: %.1f%% (%llu bytes reused)", stats.CalculatePropertySnapshotHitRate() * 100.0f,
+            aznumeric_cast<AZ::u64>(stats.m_propertySnapshotBytesReused.load()));
         ImGui::NewLine();
 
         static ImGuiTableFlags flags = ImGuiTableFlags_BordersV
@@ -127,10 +127,23 @@ namespace Multiplayer
         m_events.m_rpcReceived.Signal(entityId, entityName, netComponentId, rpcId, totalBytes);
     }
 
+    void MultiplayerStats::RecordPropertySnapshotHit(uint32_t reusedBytes)
+    {
+        m_propertySnapshotHits.fetch_add(1, AZStd::memory_order_relaxed);
+        m_propertySnapshotBytesReused.fetch_add(reusedBytes, AZStd::memory_order_relaxed);
+    }
+
+    void MultiplayerStats::RecordPropertySnapshotMiss()
+    {
+        m_propertySnapshotMisses.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
     void MultiplayerStats::TickStats(AZ::TimeMs metricFrameTimeMs)
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_EntityCount, m_entityCount);
         SET_PERFORMANCE_STAT(MultiplayerStat_ClientConnectionCount, m_clientConnectionCount);
+        SET_PERFORMANCE_STAT(MultiplayerStat_PropertySnapshotHitRate, CalculatePropertySnapshotHitRate());
+        SET_PERFORMANCE_STAT(MultiplayerStat_PropertySnapshotBytesReused, m_propertySnapshotBytesReused.load(AZStd::memory_order_relaxed));
 
         m_totalHistoryTimeMs = metricFrameTimeMs * static_cast<AZ::TimeMs>(RingbufferSamples);
         m_recordMetricIndex = ++m_recordMetricIndex % RingbufferSamples;
@@ -248,6 +261,13 @@ namespace Multiplayer
         return result;
     }
 
+    float MultiplayerStats::CalculatePropertySnapshotHitRate() const
+    {
+        const uint64_t hits = m_propertySnapshotHits.load(AZStd::memory_order_relaxed);
+        const uint64_t total = hits + m_propertySnapshotMisses.load(AZStd::memory_order_relaxed);
+        return (total > 0) ? aznumeric_cast<float>(hits) / aznumeric_cast<float>(total) : 0.0f;
+    }
+
     void MultiplayerStats::ConnectHandlers(EventHandlers& handlers)
     {
         handlers.m_entitySerializeStart.Connect(m_events.m_entitySerializeStart);
@@ -34,6 +34,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 
@@ -129,7 +130,7 @@ namespace Multiplayer
         "How often in milliseconds to record transport metrics.");
 
     AZ_CVAR(bool, sv_multithreadedConnectionUpdates, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
-        "If true, the server will send updates to clients on different threads, which improves performance with large number of clients");
+        "If true, the server will serialize the updates for each client in parallel on the task graph, which improves performance with large number of clients");
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
     
@@ -359,6 +360,9 @@ namespace Multiplayer
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalPacketsDiscardedDueToLoad, "TotalPacketsDiscardedDueToLoad");
 
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PhysicsFrameTimeUs, "PhysicsFrameTimeUs");        
+
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PropertySnapshotHitRate, "PropertySnapshotHitRate");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PropertySnapshotBytesReused, "PropertySnapshotBytesReused");
     }
 
     void MultiplayerSystemComponent::Deactivate()
@@ -378,6 +382,7 @@ namespace Multiplayer
         AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
 
         m_networkEntityManager.Reset();
+        m_replicationInterestGrid.Clear();
 
 #if (O3DE_EDITOR_CONNECTION_LISTENER_ENABLE)
         m_editorConnectionListener.reset();
@@ -673,31 +678,52 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::UpdateConnections()
     {
-        if (sv_multithreadedConnectionUpdates && (GetAgentType() == MultiplayerAgentType::ClientServer ||
-                                                  GetAgentType() == MultiplayerAgentType::DedicatedServer))
+        const AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool isTaskGraphActive = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        if (sv_multithreadedConnectionUpdates && isTaskGraphActive &&
+            (GetAgentType() == MultiplayerAgentType::ClientServer || GetAgentType() == MultiplayerAgentType::DedicatedServer))
         {
             // Threaded update calls.
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnections");
 
-            AZ::JobCompletion jobCompletion;
+            AZStd::vector<IConnectionData*> connectionDatas;
+            connectionDatas.reserve(m_networkInterface->GetConnectionSet().GetConnectionCount());
+            auto gatherConnectionData = [&connectionDatas](IConnection& connection)
+            {
+                if (connection.GetUserData() != nullptr)
+                {
+                    connectionDatas.push_back(reinterpret_cast<IConnectionData*>(connection.GetUserData()));
+                }
+            };
+            m_networkInterface->GetConnectionSet().VisitConnections(gatherConnectionData);
 
-            auto sendNetworkUpdates = [&jobCompletion](IConnection& connection)
+            // Activating replicated entities creates and modifies entities, so this stays on the main thread
+            for (IConnectionData* connectionData : connectionDatas)
             {
-                AZ::Job* job = AZ::CreateJobFunction([&connection]()
-                    {
-                        if (connection.GetUserData() != nullptr)
-                        {
-                            IConnectionData* connectionData = static_cast<IConnectionData*>(connection.GetUserData());
-                            connectionData->Update();
-                        }
-                    }, true /*auto delete*/, nullptr);
+                connectionData->PrepareUpdate();
+            }
 
-                job->SetDependent(&jobCompletion);
-                job->Start();
-            };
+            // Each connection only modifies its own replicators while reading entity state, so their updates are serialized in parallel
+            static const AZ::TaskDescriptor generateUpdatesTaskDescriptor{ "MultiplayerSystemComponent::GenerateUpdates", "Multiplayer" };
+            AZ::TaskGraphEvent generateUpdatesEvent{ "MultiplayerSystemComponent GenerateUpdates Wait" };
+            AZ::TaskGraph generateUpdatesGraph{ "MultiplayerSystemComponent GenerateUpdates" };
+            for (IConnectionData* connectionData : connectionDatas)
+            {
+                generateUpdatesGraph.AddTask(
+                    generateUpdatesTaskDescriptor,
+                    [connectionData]()
+                    {
+                        connectionData->GenerateUpdates();
+                    });
+            }
+            generateUpdatesGraph.Submit(&generateUpdatesEvent);
+            generateUpdatesEvent.Wait();
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
-            jobCompletion.StartAndWaitForCompletion();
+            // Hand the generated packets to the network interface from the main thread, which keeps the transport single threaded
+            for (IConnectionData* connectionData : connectionDatas)
+            {
+                connectionData->SendGeneratedUpdates();
+            }
         }
         else // On clients (including the Editor) run in a single threaded mode to avoid issues in UI asset loading
         {
@@ -1865,7 +1891,7 @@ namespace Multiplayer
     {
         if (auto connectionData = reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData()))
         {
-            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection, &m_replicationInterestGrid);
             connectionData->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
             connectionData->SetControlledEntity(controlledEntity);
 
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Serialization/DeltaSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Console/IConsole.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(uint32_t, net_EntityBaselineHistorySize, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of entity baselines tracked per replicator for baseline delta serialization, must match between servers and clients");
+
+    // The maximum number of values a SerializerDelta can track, one dirty bit per value
+    static constexpr uint32_t MaxBaselineDeltaValues = 255;
+
+    //! Exposes a serialized entity state to the DeltaSerializer as a sequence of words followed by any remaining bytes.
+    class BaselineStateView
+    {
+    public:
+        BaselineStateView(uint8_t* state, uint32_t stateSize)
+            : m_state(state)
+            , m_stateSize(stateSize)
+        {
+            ;
+        }
+
+        static uint32_t GetValueCount(uint32_t stateSize)
+        {
+            return (stateSize / sizeof(uint32_t)) + (stateSize % sizeof(uint32_t));
+        }
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            // The state is only modified when applying a delta, which allows views over const baselines when creating one
+            const bool writeToObject = (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject);
+            const uint32_t wordCount = m_stateSize / sizeof(uint32_t);
+            for (uint32_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+            {
+                uint32_t word = 0;
+                memcpy(&word, m_state + wordIndex * sizeof(uint32_t), sizeof(uint32_t));
+                if (!serializer.Serialize(word, "Word"))
+                {
+                    return false;
+                }
+                if (writeToObject)
+                {
+                    memcpy(m_state + wordIndex * sizeof(uint32_t), &word, sizeof(uint32_t));
+                }
+            }
+
+            for (uint32_t byteIndex = wordCount * sizeof(uint32_t); byteIndex < m_stateSize; ++byteIndex)
+            {
+                if (!serializer.Serialize(m_state[byteIndex], "Byte"))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        uint8_t* m_state;
+        uint32_t m_stateSize;
+    };
+
+    EntityBaselineHistory::EntityBaselineHistory()
+        : EntityBaselineHistory(net_EntityBaselineHistorySize)
+    {
+        ;
+    }
+
+    EntityBaselineHistory::EntityBaselineHistory(uint32_t capacity)
+        : m_baselines(AZStd::max(capacity, 1u))
+    {
+        ;
+    }
+
+    EntityBaseline& EntityBaselineHistory::Store(EntityBaselineSequence sequence, const uint8_t* state, uint32_t stateSize)
+    {
+        auto iter = AZStd::find_if(m_baselines.begin(), m_baselines.end(),
+            [sequence](const EntityBaseline& baseline) { return baseline.m_sequence == sequence; });
+        if (iter != m_baselines.end())
+        {
+            // Sequences wrap around and restart when the publisher is reset, the previous baseline is stale
+            m_baselines.erase(iter);
+        }
+
+        EntityBaseline& baseline = m_baselines.emplace_front();
+        baseline.m_sequence = sequence;
+        baseline.m_sentPacketId = AzNetworking::InvalidPacketId;
+        baseline.m_state.assign(state, state + stateSize);
+        return baseline;
+    }
+
+    const EntityBaseline* EntityBaselineHistory::Find(EntityBaselineSequence sequence) const
+    {
+        for (const EntityBaseline& baseline : m_baselines)
+        {
+            if (baseline.m_sequence == sequence)
+            {
+                return &baseline;
+            }
+        }
+        return nullptr;
+    }
+
+    const EntityBaseline* EntityBaselineHistory::FindMostRecentAcked(const AzNetworking::IConnection& connection) const
+    {
+        for (const EntityBaseline& baseline : m_baselines)
+        {
+            if ((baseline.m_sentPacketId != AzNetworking::InvalidPacketId) && connection.WasPacketAcked(baseline.m_sentPacketId))
+            {
+                return &baseline;
+            }
+        }
+        return nullptr;
+    }
+
+    EntityBaseline* EntityBaselineHistory::GetMostRecent()
+    {
+        return m_baselines.empty() ? nullptr : &m_baselines.front();
+    }
+
+    void EntityBaselineHistory::DiscardMostRecent()
+    {
+        if (!m_baselines.empty())
+        {
+            m_baselines.pop_front();
+        }
+    }
+
+    void EntityBaselineHistory::Clear()
+    {
+        m_baselines.clear();
+    }
+
+    uint32_t EntityBaselineHistory::GetSize() const
+    {
+        return aznumeric_cast<uint32_t>(m_baselines.size());
+    }
+
+    uint32_t EncodeBaselineDelta(const EntityBaseline& baseline, const uint8_t* state, uint32_t stateSize, uint8_t* outBuffer, uint32_t outCapacity)
+    {
+        // The delta serializer requires both states to have an identical serialization footprint
+        if ((baseline.m_state.size() != stateSize) || (BaselineStateView::GetValueCount(stateSize) > MaxBaselineDeltaValues))
+        {
+            return 0;
+        }
+
+        BaselineStateView baselineView(const_cast<uint8_t*>(baseline.m_state.data()), stateSize);
+        BaselineStateView stateView(const_cast<uint8_t*>(state), stateSize);
+        AzNetworking::SerializerDelta delta;
+        AzNetworking::DeltaSerializerCreate createSerializer(delta);
+        if (!createSerializer.CreateDelta(baselineView, stateView))
+        {
+            return 0;
+        }
+
+        AzNetworking::NetworkInputSerializer deltaSerializer(outBuffer, outCapacity);
+        if (!delta.Serialize(deltaSerializer) || !deltaSerializer.IsValid())
+        {
+            return 0;
+        }
+        return deltaSerializer.GetSize();
+    }
+
+    bool DecodeBaselineDelta(const EntityBaseline& baseline, const uint8_t* delta, uint32_t deltaSize, AZStd::vector<uint8_t>& outState)
+    {
+        AzNetworking::SerializerDelta serializerDelta;
+        AzNetworking::NetworkOutputSerializer deltaSerializer(delta, deltaSize);
+        if (!serializerDelta.Serialize(deltaSerializer) || !deltaSerializer.IsValid())
+        {
+            return false;
+        }
+
+        const uint32_t stateSize = aznumeric_cast<uint32_t>(baseline.m_state.size());
+        if (serializerDelta.GetNumDirtyBits() != BaselineStateView::GetValueCount(stateSize))
+        {
+            // The delta was created against a state with a different serialization footprint
+            return false;
+        }
+
+        outState.assign(baseline.m_state.begin(), baseline.m_state.end());
+        BaselineStateView stateView(outState.data(), stateSize);
+        AzNetworking::DeltaSerializerApply applySerializer(serializerDelta);
+        return applySerializer.ApplyDelta(stateView);
+    }
+}
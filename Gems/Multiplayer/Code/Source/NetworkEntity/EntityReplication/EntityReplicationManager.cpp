@@ -23,6 +23,7 @@
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -118,38 +119,57 @@ namespace Multiplayer
 
     // Get the list of entities to update/delete, create and send update/delete messages, send RPCs, and send entity resets.
     void EntityReplicationManager::SendUpdates()
+    {
+        GenerateUpdates();
+        SendGeneratedUpdates();
+    }
+
+    void EntityReplicationManager::GenerateUpdates()
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
 
-        {
-            EntityReplicatorList toSendList = GenerateEntityUpdateList();
+        AZ_Assert(m_pendingUpdatePackets.empty(), "Generating updates while the previously generated updates haven't been sent");
+        m_pendingUpdatePackets.clear();
 
-            AZLOG
-            (
-                NET_ReplicationInfo,
-                "Sending %zd updates from %s to %s",
-                toSendList.size(),
-                GetNetworkEntityManager()->GetHostId().GetString().c_str(),
-                GetRemoteHostId().GetString().c_str()
-            );
+        EntityReplicatorList toSendList = GenerateEntityUpdateList();
 
+        AZLOG
+        (
+            NET_ReplicationInfo,
+            "Sending %zd updates from %s to %s",
+            toSendList.size(),
+            GetNetworkEntityManager()->GetHostId().GetString().c_str(),
+            GetRemoteHostId().GetString().c_str()
+        );
+
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareToGenerateUpdatePacket");
+            // Prep a replication record for send, at this point, everything needs to be sent
+            for (EntityReplicator* replicator : toSendList)
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareToGenerateUpdatePacket");
-                // Prep a replication record for send, at this point, everything needs to be sent
-                for (EntityReplicator* replicator : toSendList)
-                {
-                    replicator->PrepareToGenerateUpdatePacket();
-                }
+                replicator->PrepareToGenerateUpdatePacket();
             }
+        }
 
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - GenerateEntityUpdateMessages");
+            // While our to send list is not empty, build up another packet to send
+            do
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
-                // While our to send list is not empty, build up another packet to send
-                do
-                {
-                    SendEntityUpdateMessages(toSendList);
-                } while (!toSendList.empty());
+                GenerateEntityUpdateMessages(toSendList, m_pendingUpdatePackets.emplace_back());
+            } while (!toSendList.empty());
+        }
+    }
+
+    void EntityReplicationManager::SendGeneratedUpdates()
+    {
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
+            for (PendingUpdatePacket& packet : m_pendingUpdatePackets)
+            {
+                SendEntityUpdateMessages(packet);
             }
+            m_pendingUpdatePackets.clear();
         }
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
@@ -184,7 +204,9 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
-        uint32_t proxySendCount = 0;
+        // Proxy updates are limited, so gather them all and send the highest priority ones
+        AZStd::vector<AZStd::pair<float, EntityReplicator*>> proxyCandidates;
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -222,10 +244,11 @@ namespace Multiplayer
                         {
                             toSendList.push_back(replicator);
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else
                         {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
+                            auto replicationIter = replicationSet.find(replicator->GetEntityHandle());
+                            const float priority = (replicationIter != replicationSet.end()) ? replicationIter->second.m_priority : 0.0f;
+                            proxyCandidates.emplace_back(priority, replicator);
                         }
                     }
                 }
@@ -242,14 +265,30 @@ namespace Multiplayer
             }
         }
 
+        // Any proxies that don't make the cut remain pending and are considered again next update
+        const AZStd::size_t maxProxySendCount = m_replicationWindow->GetMaxProxyEntityReplicatorSendCount();
+        if (proxyCandidates.size() > maxProxySendCount)
+        {
+            AZStd::partial_sort(proxyCandidates.begin(), proxyCandidates.begin() + maxProxySendCount, proxyCandidates.end(),
+                [](const AZStd::pair<float, EntityReplicator*>& lhs, const AZStd::pair<float, EntityReplicator*>& rhs)
+                {
+                    return lhs.first > rhs.first;
+                });
+            proxyCandidates.resize(maxProxySendCount);
+        }
+
+        for (const auto& [priority, replicator] : proxyCandidates)
+        {
+            toSendList.push_back(replicator);
+        }
+
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
+    void EntityReplicationManager::GenerateEntityUpdateMessages(EntityReplicatorList& replicatorList, PendingUpdatePacket& outPacket)
     {
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
-        NetworkEntityUpdateVector entityUpdates;
+        NetworkEntityUpdateVector& entityUpdates = outPacket.m_entityUpdates;
         // Serialize everything
         while (!replicatorList.empty())
         {
@@ -261,15 +300,15 @@ namespace Multiplayer
             // Check if we are over our limits
             const bool payloadFull = (pendingPacketSize + nextMessageSize > m_maxPayloadSize);
             const bool capacityReached = (entityUpdates.size() >= entityUpdates.capacity());
-            const bool largeEntityDetected = (payloadFull && replicatorUpdatedList.empty());
+            const bool largeEntityDetected = (payloadFull && outPacket.m_replicators.empty());
             if (capacityReached || (payloadFull && !largeEntityDetected))
             {
                 break;
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdates.push_back(updateMessage);
-            replicatorUpdatedList.push_back(replicator);
+            entityUpdates.push_back(AZStd::move(updateMessage));
+            outPacket.m_replicators.push_back(replicator);
             replicatorList.pop_front();
 
             if (largeEntityDetected)
@@ -284,13 +323,16 @@ namespace Multiplayer
                 break;
             }
         }
+    }
 
+    void EntityReplicationManager::SendEntityUpdateMessages(PendingUpdatePacket& packet)
+    {
         if (m_replicationWindow)
         {
-            const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(entityUpdates);
+            const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(packet.m_entityUpdates);
 
             // Update the sent things with the packet id
-            for (EntityReplicator* replicator : replicatorUpdatedList)
+            for (EntityReplicator* replicator : packet.m_replicators)
             {
                 replicator->RecordSentPacketId(sentId);
             }
@@ -376,6 +418,7 @@ namespace Multiplayer
             m_replicatorsPendingReset.clear();
         }
 
+        m_receivedBaselines.clear();
         m_entityReplicatorMap.clear();
     }
 
@@ -886,6 +929,40 @@ namespace Multiplayer
         return result;
     }
 
+    const EntityBaselineHistory* EntityReplicationManager::GetReceivedBaselines(NetEntityId netEntityId) const
+    {
+        auto baselinesIter = m_receivedBaselines.find(netEntityId);
+        return (baselinesIter != m_receivedBaselines.end()) ? &baselinesIter->second : nullptr;
+    }
+
+    bool EntityReplicationManager::ResolveBaselineUpdate(const NetworkEntityUpdateMessage& updateMessage, AZStd::vector<uint8_t>& outState)
+    {
+        const AzNetworking::PacketEncodingBuffer& updateData = *updateMessage.GetData();
+        const uint32_t updateDataSize = aznumeric_cast<uint32_t>(updateData.GetSize());
+        if (updateMessage.GetIsBaselineDelta())
+        {
+            // Deltas can only be resolved against a known baseline, so they never create a history for an unknown entity
+            auto baselinesIter = m_receivedBaselines.find(updateMessage.GetEntityId());
+            if (baselinesIter == m_receivedBaselines.end())
+            {
+                return false;
+            }
+
+            const EntityBaseline* baseline = baselinesIter->second.Find(updateMessage.GetDeltaBaselineSequence());
+            if ((baseline == nullptr) || !DecodeBaselineDelta(*baseline, updateData.GetBuffer(), updateDataSize, outState))
+            {
+                return false;
+            }
+            baselinesIter->second.Store(updateMessage.GetBaselineSequence(), outState.data(), aznumeric_cast<uint32_t>(outState.size()));
+            return true;
+        }
+
+        outState.assign(updateData.GetBuffer(), updateData.GetBuffer() + updateDataSize);
+        m_receivedBaselines[updateMessage.GetEntityId()].Store(
+            updateMessage.GetBaselineSequence(), outState.data(), aznumeric_cast<uint32_t>(outState.size()));
+        return true;
+    }
+
     bool EntityReplicationManager::HandleEntityUpdateMessage
     (
         AzNetworking::IConnection* invokingConnection,
@@ -896,7 +973,28 @@ namespace Multiplayer
         if (updateMessage.GetIsDelete())
         {
             AZLOG(NET_RepDeletes, "Handling entity delete message for entity %llu.", aznumeric_cast<AZ::u64>(updateMessage.GetEntityId()));
+            m_receivedBaselines.erase(updateMessage.GetEntityId());
+        }
+
+        // Baselines are stored before validating the update, the remote host may delta against any baseline it saw acknowledged
+        // even if the update carrying it was dropped as out of date
+        AZStd::vector<uint8_t> baselineState;
+        if (updateMessage.GetHasBaseline() && !ResolveBaselineUpdate(updateMessage, baselineState))
+        {
+            AZLOG_WARN(
+                "Unable to resolve baseline %u for entity %llu from remote host %s, requesting a reset",
+                aznumeric_cast<uint32_t>(updateMessage.GetDeltaBaselineSequence()),
+                aznumeric_cast<AZ::u64>(updateMessage.GetEntityId()),
+                GetRemoteHostId().GetString().c_str());
+            // The reset is answered with a full state, so baselines received before it are never referenced again
+            m_receivedBaselines.erase(updateMessage.GetEntityId());
+            m_replicatorsPendingReset.emplace(updateMessage.GetEntityId());
+            return true;
         }
+        const uint8_t* updateData = updateMessage.GetHasBaseline() ? baselineState.data() : updateMessage.GetData()->GetBuffer();
+        const uint32_t updateDataSize = updateMessage.GetHasBaseline()
+            ? aznumeric_cast<uint32_t>(baselineState.size())
+            : aznumeric_cast<uint32_t>(updateMessage.GetData()->GetSize());
 
         // May still be nullptr
         EntityReplicator* entityReplicator = GetEntityReplicator(updateMessage.GetEntityId());
@@ -913,7 +1011,7 @@ namespace Multiplayer
             AZ_Assert(false, "Unhandled case");
         }
 
-        OutputSerializer outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+        OutputSerializer outputSerializer(updateData, updateDataSize);
 
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
@@ -941,7 +1039,7 @@ namespace Multiplayer
         bool handled = true;
 
         // This may implicitly create a replicator for us
-        if (updateMessage.GetData()->GetSize() != 0)
+        if (updateDataSize != 0)
         {
             handled = HandlePropertyChangeMessage(
                           invokingConnection,
@@ -15,6 +15,10 @@
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, net_SharePropertySnapshots, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, entity update data is serialized once per host frame and reused for every connection with the same pending record");
+    AZ_CVAR(bool, net_useBaselineDeltaSerialization, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, entity updates sent to client proxies are delta-serialized against the last acknowledged baseline to reduce update bandwidth");
 
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
@@ -203,6 +207,94 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    uint32_t PropertyPublisher::SerializeSharedEntityRecord(
+        AzNetworking::PacketEncodingBuffer& updateData, ReplicationRecord& record, NetBindComponent* netBindComponent)
+    {
+        AZ_Assert(netBindComponent, "NetBindComponent is nullptr");
+        const uint32_t capacity = static_cast<uint32_t>(updateData.GetCapacity());
+        InputSerializer inputSerializer(updateData.GetBuffer(), capacity);
+        record.ResetConsumedBits();
+        record.Serialize(inputSerializer);
+        const uint32_t recordSize = inputSerializer.GetSize();
+
+        // The serialized record describes exactly which properties follow it, so it also serves as the snapshot key
+        const HostFrameId hostFrameId = GetNetworkTime()->GetHostFrameId();
+        const NetEntityRole remoteRole = record.GetRemoteNetworkRole();
+        PropertySnapshotCache& snapshotCache = netBindComponent->GetPropertySnapshotCache();
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        const uint32_t cachedSize =
+            inputSerializer.IsValid() ? snapshotCache.Fetch(hostFrameId, remoteRole, updateData.GetBuffer(), recordSize, capacity) : 0;
+        if (cachedSize > 0)
+        {
+            stats.RecordPropertySnapshotHit(cachedSize - recordSize);
+            return cachedSize;
+        }
+
+        netBindComponent->SerializeStateDeltaMessage(record, inputSerializer);
+        if (!inputSerializer.IsValid())
+        {
+            AZLOG_ERROR("EntityReplicator: Serialization failed");
+            AZ_Assert(false, "EntityReplicator: Serialization failed");
+            return inputSerializer.GetSize();
+        }
+
+        snapshotCache.Store(hostFrameId, remoteRole, updateData.GetBuffer(), recordSize, inputSerializer.GetSize());
+        stats.RecordPropertySnapshotMiss();
+        return inputSerializer.GetSize();
+    }
+
+    bool PropertyPublisher::UsesBaselineDeltas(bool isDeleted) const
+    {
+        // Autonomous proxies only receive predictable properties when they're corrected, so their updates can't contain the full state.
+        // Deletes are cached ahead of being sent, so they never carry a baseline either.
+        return net_useBaselineDeltaSerialization && !isDeleted && (m_pendingRecord.GetRemoteNetworkRole() == NetEntityRole::Client);
+    }
+
+    void PropertyPublisher::SerializeBaselineEntityRecord(NetworkEntityUpdateMessage& updateMessage, NetBindComponent* netBindComponent)
+    {
+        // Baselines always contain the full state so that consecutive baselines share the same serialization footprint.
+        // This is identical for every client connection, so the serialized state is shared through the property snapshot cache.
+        ReplicationRecord totalRecord(m_pendingRecord.GetRemoteNetworkRole());
+        netBindComponent->FillTotalReplicationRecord(totalRecord);
+        AzNetworking::PacketEncodingBuffer& updateData = updateMessage.ModifyData();
+        const uint32_t stateSize = SerializeSharedEntityRecord(updateData, totalRecord, netBindComponent);
+
+        // The update may get regenerated if it didn't fit into the previous packet, in which case the unsent baseline is replaced
+        EntityBaselineSequence sequence = m_nextBaselineSequence;
+        if (m_baselinePendingSend)
+        {
+            sequence = m_sentBaselines.GetMostRecent()->m_sequence;
+        }
+        else
+        {
+            ++m_nextBaselineSequence;
+        }
+        const EntityBaseline& baseline = m_sentBaselines.Store(sequence, updateData.GetBuffer(), stateSize);
+        m_baselinePendingSend = true;
+
+        EntityBaselineSequence deltaBaselineSequence = sequence;
+        uint32_t updateSize = stateSize;
+        const EntityBaseline* ackedBaseline = m_remoteReplicatorEstablished ? m_sentBaselines.FindMostRecentAcked(m_connection) : nullptr;
+        if (ackedBaseline != nullptr)
+        {
+            const uint32_t deltaSize = EncodeBaselineDelta(
+                *ackedBaseline, baseline.m_state.data(), stateSize, updateData.GetBuffer(), static_cast<uint32_t>(updateData.GetCapacity()));
+            if ((deltaSize > 0) && (deltaSize < stateSize))
+            {
+                deltaBaselineSequence = ackedBaseline->m_sequence;
+                updateSize = deltaSize;
+            }
+            else if (deltaSize > 0)
+            {
+                // The delta isn't any smaller than the full state, restore the full state the delta overwrote
+                memcpy(updateData.GetBuffer(), baseline.m_state.data(), stateSize);
+            }
+        }
+
+        updateMessage.SetBaselineSequences(sequence, deltaBaselineSequence);
+        updateData.Resize(updateSize);
+    }
+
     void PropertyPublisher::FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId)
     {
         // Fill in the packet id for the last sent update
@@ -372,10 +464,22 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        InputSerializer inputSerializer(
-            updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        SerializeEntityRecord(inputSerializer, netBindComponent);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        if (UsesBaselineDeltas(isDeleted))
+        {
+            SerializeBaselineEntityRecord(updateMessage, netBindComponent);
+        }
+        else if (net_SharePropertySnapshots)
+        {
+            const uint32_t updateSize = SerializeSharedEntityRecord(updateMessage.ModifyData(), m_pendingRecord, netBindComponent);
+            updateMessage.ModifyData().Resize(updateSize);
+        }
+        else
+        {
+            InputSerializer inputSerializer(
+                updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
+            SerializeEntityRecord(inputSerializer, netBindComponent);
+            updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        }
 
         return updateMessage;
     }
@@ -410,6 +514,20 @@ namespace Multiplayer
         AZ_Assert(
             m_serializationPhase == PropertyPublisher::EntityReplicatorSerializationPhase::Prepared, "Unexpected serialization phase");
 
+        if (m_baselinePendingSend)
+        {
+            // Track the packet the baseline was sent in, so it can be used once the packet is acknowledged
+            if (sentId != AzNetworking::InvalidPacketId)
+            {
+                m_sentBaselines.GetMostRecent()->m_sentPacketId = sentId;
+            }
+            else
+            {
+                m_sentBaselines.DiscardMostRecent();
+            }
+            m_baselinePendingSend = false;
+        }
+
         switch (m_replicatorState)
         {
         case PropertyPublisher::EntityReplicatorState::Invalid:
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h>
 #include <AzCore/std/containers/ring_buffer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 
@@ -117,6 +118,19 @@ namespace Multiplayer
         //! Add/update/delete all use the same serialization path.
         bool SerializeEntityRecord(AzNetworking::ISerializer& serializer, NetBindComponent* netBindComponent);
 
+        //! Serializes the provided record into updateData like SerializeEntityRecord, but copies the property data from the entity's
+        //! property snapshot cache when another connection already serialized an identical record during this host frame.
+        //! @return the number of bytes written to updateData
+        uint32_t SerializeSharedEntityRecord(
+            AzNetworking::PacketEncodingBuffer& updateData, ReplicationRecord& record, NetBindComponent* netBindComponent);
+
+        //! Returns true if updates are delta-serialized against the most recent baseline acknowledged by the remote replicator.
+        bool UsesBaselineDeltas(bool isDeleted) const;
+
+        //! Serializes the full entity state as a new baseline into the update message. The state is delta-serialized against the
+        //! most recent acknowledged baseline if there is one, and sent in full otherwise or if the delta wouldn't be any smaller.
+        void SerializeBaselineEntityRecord(NetworkEntityUpdateMessage& updateMessage, NetBindComponent* netBindComponent);
+
         //! Phase 3, finalize with the packet id
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
         void FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId);
@@ -141,6 +155,12 @@ namespace Multiplayer
         //! True if the remote replicator has acknowledged at least one packet, which means that it exists and created the entity.
         bool m_remoteReplicatorEstablished = false;
 
+        //! List of sent baselines, used to delta-serialize updates against the most recent acknowledged baseline.
+        EntityBaselineHistory m_sentBaselines;
+        EntityBaselineSequence m_nextBaselineSequence = 0;
+        //! True if the most recent baseline was generated for the update currently being sent.
+        bool m_baselinePendingSend = false;
+
         // In the case of deletes, we need to produce our update message at the point of deletion
         // and then keep it around until it's requested. By the time the message is requested, the entity
         // is likely already deleted, so the data to serialize from it would no longer be available.
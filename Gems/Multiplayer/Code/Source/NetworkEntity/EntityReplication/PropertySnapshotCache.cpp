@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/PropertySnapshotCache.h>
+
+namespace Multiplayer
+{
+    uint32_t PropertySnapshotCache::Fetch(HostFrameId hostFrameId, NetEntityRole remoteRole, uint8_t* buffer, uint32_t recordSize, uint32_t capacity)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_hostFrameId != hostFrameId)
+        {
+            ResetForHostFrame(hostFrameId);
+            return 0;
+        }
+
+        for (const Snapshot& snapshot : m_snapshots)
+        {
+            // The serialized record determines which properties follow it, so an identical record means identical property data
+            if ((snapshot.m_remoteRole != remoteRole) || (snapshot.m_recordSize != recordSize)
+                || (memcmp(snapshot.m_data.data(), buffer, recordSize) != 0))
+            {
+                continue;
+            }
+
+            const uint32_t totalSize = aznumeric_cast<uint32_t>(snapshot.m_data.size());
+            if (totalSize > capacity)
+            {
+                return 0;
+            }
+            memcpy(buffer + recordSize, snapshot.m_data.data() + recordSize, totalSize - recordSize);
+            return totalSize;
+        }
+        return 0;
+    }
+
+    void PropertySnapshotCache::Store(HostFrameId hostFrameId, NetEntityRole remoteRole, const uint8_t* buffer, uint32_t recordSize, uint32_t totalSize)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_hostFrameId != hostFrameId)
+        {
+            ResetForHostFrame(hostFrameId);
+        }
+
+        if (m_snapshots.size() >= MaxSnapshots)
+        {
+            return;
+        }
+
+        for (const Snapshot& snapshot : m_snapshots)
+        {
+            // Another connection may have stored the same snapshot while this one was serializing
+            if ((snapshot.m_remoteRole == remoteRole) && (snapshot.m_recordSize == recordSize)
+                && (memcmp(snapshot.m_data.data(), buffer, recordSize) == 0))
+            {
+                return;
+            }
+        }
+
+        Snapshot& snapshot = m_snapshots.emplace_back();
+        snapshot.m_remoteRole = remoteRole;
+        snapshot.m_recordSize = recordSize;
+        snapshot.m_data.assign(buffer, buffer + totalSize);
+        m_snapshotCount.store(aznumeric_cast<uint32_t>(m_snapshots.size()), AZStd::memory_order_release);
+    }
+
+    void PropertySnapshotCache::Clear()
+    {
+        // Properties are usually changed many times between two updates, and only the first change after an update finds snapshots.
+        // Without snapshots there's nothing to share, so the host frame doesn't need to be reset either.
+        if (m_snapshotCount.load(AZStd::memory_order_acquire) == 0)
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        ResetForHostFrame(InvalidHostFrameId);
+    }
+
+    uint32_t PropertySnapshotCache::GetSnapshotCount() const
+    {
+        return m_snapshotCount.load(AZStd::memory_order_acquire);
+    }
+
+    void PropertySnapshotCache::ResetForHostFrame(HostFrameId hostFrameId)
+    {
+        m_hostFrameId = hostFrameId;
+        m_snapshots.clear();
+        m_snapshotCount.store(0, AZStd::memory_order_release);
+    }
+}
@@ -17,6 +17,9 @@ namespace Multiplayer
         , m_isDelete(rhs.m_isDelete)
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_hasBaseline(rhs.m_hasBaseline)
+        , m_baselineSequence(rhs.m_baselineSequence)
+        , m_deltaBaselineSequence(rhs.m_deltaBaselineSequence)
         , m_prefabEntityId(rhs.m_prefabEntityId)
         , m_data(AZStd::move(rhs.m_data))
     {
@@ -29,6 +32,9 @@ namespace Multiplayer
         , m_isDelete(rhs.m_isDelete)
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_hasBaseline(rhs.m_hasBaseline)
+        , m_baselineSequence(rhs.m_baselineSequence)
+        , m_deltaBaselineSequence(rhs.m_deltaBaselineSequence)
         , m_prefabEntityId(rhs.m_prefabEntityId)
     {
         if (rhs.m_data != nullptr)
@@ -54,6 +60,9 @@ namespace Multiplayer
         m_isDelete = rhs.m_isDelete;
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_hasBaseline = rhs.m_hasBaseline;
+        m_baselineSequence = rhs.m_baselineSequence;
+        m_deltaBaselineSequence = rhs.m_deltaBaselineSequence;
         m_prefabEntityId = rhs.m_prefabEntityId;
         m_data = AZStd::move(rhs.m_data);
         return *this;
@@ -66,6 +75,9 @@ namespace Multiplayer
         m_isDelete = rhs.m_isDelete;
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_hasBaseline = rhs.m_hasBaseline;
+        m_baselineSequence = rhs.m_baselineSequence;
+        m_deltaBaselineSequence = rhs.m_deltaBaselineSequence;
         m_prefabEntityId = rhs.m_prefabEntityId;
         if (rhs.m_data != nullptr)
         {
@@ -83,6 +95,9 @@ namespace Multiplayer
              && (m_isDelete == rhs.m_isDelete)
              && (m_wasMigrated == rhs.m_wasMigrated)
              && (m_hasValidPrefabId == rhs.m_hasValidPrefabId)
+             && (m_hasBaseline == rhs.m_hasBaseline)
+             && (m_baselineSequence == rhs.m_baselineSequence)
+             && (m_deltaBaselineSequence == rhs.m_deltaBaselineSequence)
              && (m_prefabEntityId == rhs.m_prefabEntityId));
     }
 
@@ -98,18 +113,20 @@ namespace Multiplayer
         static const uint32_t sizeOfFlags = 1;
         static const uint32_t sizeOfEntityId = sizeof(NetEntityId);
         static const uint32_t sizeOfSliceId = 6;
+        static const uint32_t sizeOfBaselineSequences = 2 * sizeof(EntityBaselineSequence);
 
         // 2-byte size header + the actual blob payload itself
         const uint32_t sizeOfBlob = static_cast<uint32_t>((m_data != nullptr) ? sizeof(PropertyIndex) + m_data->GetSize() : 0);
+        const uint32_t sizeOfBaseline = m_hasBaseline ? sizeOfBaselineSequences : 0;
 
         if (m_hasValidPrefabId)
         {
             // sliceId is transmitted
-            return sizeOfFlags + sizeOfEntityId + sizeOfSliceId + sizeOfBlob;
+            return sizeOfFlags + sizeOfEntityId + sizeOfSliceId + sizeOfBaseline + sizeOfBlob;
         }
 
         // No sliceId, remote replicator already exists so we don't need to know what type of entity this is
-        return sizeOfFlags + sizeOfEntityId + sizeOfBlob;
+        return sizeOfFlags + sizeOfEntityId + sizeOfBaseline + sizeOfBlob;
     }
 
     NetEntityRole NetworkEntityUpdateMessage::GetNetworkRole() const
@@ -148,6 +165,33 @@ namespace Multiplayer
         return m_prefabEntityId;
     }
 
+    void NetworkEntityUpdateMessage::SetBaselineSequences(EntityBaselineSequence baselineSequence, EntityBaselineSequence deltaBaselineSequence)
+    {
+        m_hasBaseline = true;
+        m_baselineSequence = baselineSequence;
+        m_deltaBaselineSequence = deltaBaselineSequence;
+    }
+
+    bool NetworkEntityUpdateMessage::GetHasBaseline() const
+    {
+        return m_hasBaseline;
+    }
+
+    bool NetworkEntityUpdateMessage::GetIsBaselineDelta() const
+    {
+        return m_hasBaseline && (m_baselineSequence != m_deltaBaselineSequence);
+    }
+
+    EntityBaselineSequence NetworkEntityUpdateMessage::GetBaselineSequence() const
+    {
+        return m_baselineSequence;
+    }
+
+    EntityBaselineSequence NetworkEntityUpdateMessage::GetDeltaBaselineSequence() const
+    {
+        return m_deltaBaselineSequence;
+    }
+
     void NetworkEntityUpdateMessage::SetData(const AzNetworking::PacketEncodingBuffer& value)
     {
         if (m_data == nullptr)
@@ -177,13 +221,15 @@ namespace Multiplayer
         serializer.Serialize(m_entityId, "EntityId");
 
         // Use the upper 4 bits for boolean flags, and the lower 4 bits for the network role
-        uint8_t networkTypeAndFlags = (m_isDelete ? 0x40 : 0x00)
+        uint8_t networkTypeAndFlags = (m_hasBaseline ? 0x80 : 0x00)
+                                    | (m_isDelete ? 0x40 : 0x00)
                                     | (m_wasMigrated ? 0x20 : 0x00)
                                     | (m_hasValidPrefabId ? 0x10 : 0x00)
                                     | static_cast<uint8_t>(m_networkRole);
 
         if (serializer.Serialize(networkTypeAndFlags, "TypeAndFlags"))
         {
+            m_hasBaseline = (networkTypeAndFlags & 0x80) == 0x80;
             m_isDelete = (networkTypeAndFlags & 0x40) == 0x40;
             m_wasMigrated = (networkTypeAndFlags & 0x20) == 0x20;
             m_hasValidPrefabId = (networkTypeAndFlags & 0x10) == 0x10;
@@ -201,6 +247,13 @@ namespace Multiplayer
             serializer.Serialize(m_prefabEntityId, "PrefabEntityId");
         }
 
+        if (m_hasBaseline)
+        {
+            // Only serialize baseline sequences if baseline delta serialization is in use
+            serializer.Serialize(m_baselineSequence, "BaselineSequence");
+            serializer.Serialize(m_deltaBaselineSequence, "DeltaBaselineSequence");
+        }
+
         // m_data should never be nullptr
         if (m_data == nullptr)
         {
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/math.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_ReplicationGridCellSize, 100.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The size of a replication interest grid cell in meters");
+
+    // Keeps cell coordinates well within the range that can be packed into a cell key
+    static constexpr float MinCellSize = 1.0f;
+    static constexpr int32_t MaxCellCoordinate = 1 << 30;
+
+    void ReplicationInterestGrid::Update(const NetworkEntityTracker& networkEntityTracker, HostFrameId hostFrameId)
+    {
+        if ((hostFrameId == m_updatedFrameId) && (hostFrameId != InvalidHostFrameId))
+        {
+            return;
+        }
+
+        const float cellSize = AZStd::max(static_cast<float>(sv_ReplicationGridCellSize), MinCellSize);
+        if (cellSize != m_cellSize)
+        {
+            // Every entity needs to be rehashed, so start from scratch
+            Clear();
+            m_cellSize = cellSize;
+        }
+        m_updatedFrameId = hostFrameId;
+
+        if ((m_syncedTracker != &networkEntityTracker)
+            || (m_syncedAddChangeDirty != networkEntityTracker.GetAddChangeDirty())
+            || (m_syncedDeleteChangeDirty != networkEntityTracker.GetDeleteChangeDirty()))
+        {
+            SyncTrackedEntities(networkEntityTracker, hostFrameId);
+        }
+        else
+        {
+            // Entities that were added before they were activated are picked up once they are active
+            for (auto iter = m_untrackedEntities.begin(); iter != m_untrackedEntities.end();)
+            {
+                AZ::Entity* entity = networkEntityTracker.GetRaw(*iter);
+                if (CanTrackEntity(entity))
+                {
+                    TrackEntity(*iter, entity);
+                    *iter = m_untrackedEntities.back();
+                    m_untrackedEntities.pop_back();
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+        }
+
+        for (NetEntityId netEntityId : m_movedEntities)
+        {
+            auto iter = m_trackedEntities.find(netEntityId);
+            if (iter == m_trackedEntities.end())
+            {
+                continue;
+            }
+
+            if (CanTrackEntity(iter->second.m_entity))
+            {
+                RefreshTrackedEntity(netEntityId, iter->second, true);
+            }
+            else
+            {
+                // Deactivated without being removed from the network entity tracker
+                UntrackEntity(netEntityId);
+                m_untrackedEntities.push_back(netEntityId);
+            }
+        }
+        m_movedEntities.clear();
+    }
+
+    bool ReplicationInterestGrid::CanTrackEntity(const AZ::Entity* entity)
+    {
+        return (entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active) && (entity->GetTransform() != nullptr);
+    }
+
+    void ReplicationInterestGrid::SyncTrackedEntities(const NetworkEntityTracker& networkEntityTracker, HostFrameId hostFrameId)
+    {
+        m_syncedTracker = &networkEntityTracker;
+        m_syncedAddChangeDirty = networkEntityTracker.GetAddChangeDirty();
+        m_syncedDeleteChangeDirty = networkEntityTracker.GetDeleteChangeDirty();
+        m_untrackedEntities.clear();
+
+        float maxHalfExtent = 0.0f;
+        for (const auto& [netEntityId, entity] : networkEntityTracker)
+        {
+            if (!CanTrackEntity(entity))
+            {
+                m_untrackedEntities.push_back(netEntityId);
+                continue;
+            }
+
+            TrackedEntity& trackedEntity = TrackEntity(netEntityId, entity);
+            trackedEntity.m_lastSyncedFrameId = hostFrameId;
+            const AZ::Vector3 halfExtents = trackedEntity.m_bounds.GetExtents() * 0.5f;
+            maxHalfExtent = AZStd::max(maxHalfExtent, AZStd::max(halfExtents.GetX(), halfExtents.GetY()));
+        }
+        m_maxHalfExtent = maxHalfExtent;
+
+        if (m_trackedEntities.size() + m_untrackedEntities.size() == networkEntityTracker.size())
+        {
+            return;
+        }
+
+        // Anything that wasn't synced was removed or deactivated since the last walk
+        for (auto iter = m_trackedEntities.begin(); iter != m_trackedEntities.end();)
+        {
+            if (iter->second.m_lastSyncedFrameId != hostFrameId)
+            {
+                RemoveFromCell(iter->second.m_cellKey, iter->first);
+                m_movedEntities.erase(iter->first);
+                iter = m_trackedEntities.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+
+    ReplicationInterestGrid::TrackedEntity& ReplicationInterestGrid::TrackEntity(NetEntityId netEntityId, AZ::Entity* entity)
+    {
+        auto [iter, inserted] = m_trackedEntities.try_emplace(netEntityId);
+        TrackedEntity& trackedEntity = iter->second;
+        if (trackedEntity.m_entity != entity)
+        {
+            trackedEntity.m_entity = entity;
+            trackedEntity.m_transformChangedHandler = AZ::TransformChangedEvent::Handler(
+                [this, netEntityId](const AZ::Transform&, const AZ::Transform&)
+                {
+                    m_movedEntities.insert(netEntityId);
+                });
+            entity->GetTransform()->BindTransformChangedEventHandler(trackedEntity.m_transformChangedHandler);
+            RefreshTrackedEntity(netEntityId, trackedEntity, !inserted);
+        }
+        return trackedEntity;
+    }
+
+    void ReplicationInterestGrid::UntrackEntity(NetEntityId netEntityId)
+    {
+        auto iter = m_trackedEntities.find(netEntityId);
+        if (iter != m_trackedEntities.end())
+        {
+            RemoveFromCell(iter->second.m_cellKey, netEntityId);
+            m_trackedEntities.erase(iter);
+        }
+    }
+
+    void ReplicationInterestGrid::RefreshTrackedEntity(NetEntityId netEntityId, TrackedEntity& trackedEntity, bool isInCell)
+    {
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        const AZ::Entity* entity = trackedEntity.m_entity;
+        AZ::Aabb bounds = entityBoundsUnion ? entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId()) : AZ::Aabb::CreateNull();
+        if (!bounds.IsValid())
+        {
+            bounds = AZ::Aabb::CreateFromPoint(entity->GetTransform()->GetWorldTranslation());
+        }
+        const AZ::Vector3 center = bounds.GetCenter();
+        const AZ::Vector3 halfExtents = bounds.GetExtents() * 0.5f;
+        m_maxHalfExtent = AZStd::max(m_maxHalfExtent, AZStd::max(halfExtents.GetX(), halfExtents.GetY()));
+        const CellKey cellKey = GetCellKey(GetCellCoordinate(center.GetX()), GetCellCoordinate(center.GetY()));
+
+        if (!isInCell)
+        {
+            AddToCell(cellKey, netEntityId);
+        }
+        else if (trackedEntity.m_cellKey != cellKey)
+        {
+            RemoveFromCell(trackedEntity.m_cellKey, netEntityId);
+            AddToCell(cellKey, netEntityId);
+        }
+        trackedEntity.m_bounds = bounds;
+        trackedEntity.m_cellKey = cellKey;
+    }
+
+    void ReplicationInterestGrid::Gather(const AZ::Vector3& center, float radius, GatheredEntities& outEntities) const
+    {
+        if (m_cells.empty())
+        {
+            return;
+        }
+
+        const float radiusSquared = radius * radius;
+        auto gatherCell = [this, &center, radiusSquared, &outEntities](const AZStd::vector<NetEntityId>& cell)
+        {
+            for (NetEntityId netEntityId : cell)
+            {
+                // Measure to the closest extent of the bounds, the same way entities gathered from the visibility system are
+                const AZ::Aabb& bounds = m_trackedEntities.find(netEntityId)->second.m_bounds;
+                const AZ::Vector3 closestPosition = bounds.GetSupport(center - bounds.GetCenter());
+                const float distanceSquared = center.GetDistanceSq(closestPosition);
+                if (distanceSquared <= radiusSquared)
+                {
+                    outEntities.push_back({ netEntityId, distanceSquared });
+                }
+            }
+        };
+
+        // Entities are hashed by the center of their bounds, so cells up to the largest half extent away can hold overlapping bounds
+        const float searchRadius = radius + m_maxHalfExtent;
+        const int32_t minCellX = GetCellCoordinate(center.GetX() - searchRadius);
+        const int32_t maxCellX = GetCellCoordinate(center.GetX() + searchRadius);
+        const int32_t minCellY = GetCellCoordinate(center.GetY() - searchRadius);
+        const int32_t maxCellY = GetCellCoordinate(center.GetY() + searchRadius);
+        const uint64_t cellsInRange = static_cast<uint64_t>(static_cast<int64_t>(maxCellX) - minCellX + 1)
+            * static_cast<uint64_t>(static_cast<int64_t>(maxCellY) - minCellY + 1);
+        if (cellsInRange > m_cells.size())
+        {
+            // The sphere covers more cells than are occupied, so it's cheaper to walk the occupied cells
+            for (const auto& [cellKey, cell] : m_cells)
+            {
+                gatherCell(cell);
+            }
+            return;
+        }
+
+        for (int32_t cellX = minCellX; cellX <= maxCellX; ++cellX)
+        {
+            for (int32_t cellY = minCellY; cellY <= maxCellY; ++cellY)
+            {
+                auto cellIter = m_cells.find(GetCellKey(cellX, cellY));
+                if (cellIter != m_cells.end())
+                {
+                    gatherCell(cellIter->second);
+                }
+            }
+        }
+    }
+
+    void ReplicationInterestGrid::Clear()
+    {
+        m_trackedEntities.clear();
+        m_cells.clear();
+        m_movedEntities.clear();
+        m_untrackedEntities.clear();
+        m_syncedTracker = nullptr;
+        m_updatedFrameId = InvalidHostFrameId;
+        m_maxHalfExtent = 0.0f;
+    }
+
+    uint32_t ReplicationInterestGrid::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_trackedEntities.size());
+    }
+
+    uint32_t ReplicationInterestGrid::GetCellCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_cells.size());
+    }
+
+    ReplicationInterestGrid::CellKey ReplicationInterestGrid::GetCellKey(int32_t cellX, int32_t cellY) const
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(cellX)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(cellY));
+    }
+
+    int32_t ReplicationInterestGrid::GetCellCoordinate(float position) const
+    {
+        const float cellCoordinate = AZStd::floor(position / m_cellSize);
+        if (AZStd::isnan(cellCoordinate))
+        {
+            // NaN can't be converted to a cell, and never passes the distance checks in Gather anyway
+            return 0;
+        }
+
+        // Infinities are clamped along with every other out of range position
+        return static_cast<int32_t>(
+            AZStd::clamp(cellCoordinate, -static_cast<float>(MaxCellCoordinate), static_cast<float>(MaxCellCoordinate)));
+    }
+
+    void ReplicationInterestGrid::AddToCell(CellKey cellKey, NetEntityId netEntityId)
+    {
+        m_cells[cellKey].push_back(netEntityId);
+    }
+
+    void ReplicationInterestGrid::RemoveFromCell(CellKey cellKey, NetEntityId netEntityId)
+    {
+        auto cellIter = m_cells.find(cellKey);
+        if (cellIter == m_cells.end())
+        {
+            return;
+        }
+
+        AZStd::vector<NetEntityId>& cell = cellIter->second;
+        auto entityIter = AZStd::find(cell.begin(), cell.end(), netEntityId);
+        if (entityIter != cell.end())
+        {
+            // Order within a cell doesn't matter, so swap the last entity into the removed slot
+            *entityIter = cell.back();
+            cell.pop_back();
+        }
+
+        if (cell.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+}
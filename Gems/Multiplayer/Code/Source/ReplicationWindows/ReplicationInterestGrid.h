@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class NetworkEntityTracker;
+
+    //! @class ReplicationInterestGrid
+    //! @brief Spatial hash of networked entity bounds, used by server to client replication windows to gather nearby entities.
+    //! The grid is shared by all replication windows on a server and is brought up to date at most once per host frame. Entities
+    //! are hashed into cells on the XY plane by the center of their world bounds. Entities without bounds are tracked as a point at
+    //! their world translation.
+    //! The grid listens to the transform changes of the tracked entities and only rehashes the entities that moved since the last
+    //! update. The network entity tracker is only walked again when entities were added to or removed from it. Changes to the
+    //! local bounds of an entity are picked up the next time it moves.
+    class ReplicationInterestGrid
+    {
+    public:
+        struct GatheredEntity
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            float m_distanceSquared = 0.0f;
+        };
+        using GatheredEntities = AZStd::vector<GatheredEntity>;
+
+        ReplicationInterestGrid() = default;
+
+        //! The tracked entities refer back to the grid, so it can't be copied or moved.
+        AZ_DISABLE_COPY_MOVE(ReplicationInterestGrid);
+
+        //! Updates the positions of the tracked entities that moved, unless the grid was already updated during the provided host frame.
+        //! @param networkEntityTracker the tracker containing all networked entities
+        //! @param hostFrameId          the current host frame
+        void Update(const NetworkEntityTracker& networkEntityTracker, HostFrameId hostFrameId);
+
+        //! Gathers all tracked entities whose bounds are within the provided sphere, measured to the closest extent of the bounds.
+        //! @param center      center of the sphere to gather entities in
+        //! @param radius      radius of the sphere to gather entities in
+        //! @param outEntities output vector the gathered entities and the squared distance of their closest extent to center are appended to
+        void Gather(const AZ::Vector3& center, float radius, GatheredEntities& outEntities) const;
+
+        //! Removes all tracked entities from the grid.
+        void Clear();
+
+        //! Returns the number of entities tracked by the grid.
+        //! @return the number of entities tracked by the grid
+        uint32_t GetEntityCount() const;
+
+        //! Returns the number of cells that currently contain entities.
+        //! @return the number of cells that currently contain entities
+        uint32_t GetCellCount() const;
+
+    private:
+        using CellKey = uint64_t;
+        CellKey GetCellKey(int32_t cellX, int32_t cellY) const;
+        int32_t GetCellCoordinate(float position) const;
+
+        void AddToCell(CellKey cellKey, NetEntityId netEntityId);
+        void RemoveFromCell(CellKey cellKey, NetEntityId netEntityId);
+
+        struct TrackedEntity
+        {
+            AZ::Entity* m_entity = nullptr;
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+            CellKey m_cellKey = 0;
+            HostFrameId m_lastSyncedFrameId = InvalidHostFrameId;
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+        };
+
+        static bool CanTrackEntity(const AZ::Entity* entity);
+
+        //! Walks all entities of the network entity tracker, starts tracking new entities and stops tracking removed ones.
+        void SyncTrackedEntities(const NetworkEntityTracker& networkEntityTracker, HostFrameId hostFrameId);
+
+        //! Starts tracking the entity, or switches to it if its net entity id was tracked for another entity.
+        TrackedEntity& TrackEntity(NetEntityId netEntityId, AZ::Entity* entity);
+
+        //! Stops tracking the entity and removes it from its cell.
+        void UntrackEntity(NetEntityId netEntityId);
+
+        //! Reads the current bounds of the entity and moves it to the cell they are centered in.
+        void RefreshTrackedEntity(NetEntityId netEntityId, TrackedEntity& trackedEntity, bool isInCell);
+
+        AZStd::unordered_map<NetEntityId, TrackedEntity> m_trackedEntities;
+        AZStd::unordered_map<CellKey, AZStd::vector<NetEntityId>> m_cells;
+        AZStd::unordered_set<NetEntityId> m_movedEntities; //!< Tracked entities whose transform changed since the last update
+        AZStd::vector<NetEntityId> m_untrackedEntities; //!< Entities in the network entity tracker that aren't active yet
+        const NetworkEntityTracker* m_syncedTracker = nullptr;
+        uint32_t m_syncedAddChangeDirty = 0;
+        uint32_t m_syncedDeleteChangeDirty = 0;
+        HostFrameId m_updatedFrameId = InvalidHostFrameId;
+        float m_cellSize = 0.0f;
+        //! Largest half extent of the tracked bounds on the XY plane, widens the cells searched by Gather. Only grows between walks of
+        //! the network entity tracker, which is safe since it only makes Gather search more cells.
+        float m_maxHalfExtent = 0.0f;
+    };
+}
@@ -7,6 +7,8 @@
  */
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
@@ -24,6 +26,34 @@ namespace Multiplayer
     AZ_CVAR(uint32_t, sv_PacketsToIntegrateQos, 1000, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of packets to accumulate before updating connection quality of service metrics");
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
+    AZ_CVAR(float, sv_ClientAwarenessHysteresis, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The fraction of the awareness radius an entity in a client's replication window can move beyond the radius before it leaves the window");
+    AZ_CVAR(bool, sv_UseReplicationInterestGrid, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, server to client replication windows gather nearby entities from the replication interest grid instead of the visibility system");
+    AZ_CVAR(uint32_t, sv_ClientBandwidthBudgetBytesPerSec, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The entity update bandwidth budget of a client connection in bytes per second, 0 disables the budget");
+
+    struct RelevancySettings
+    {
+        float m_radiusScale;   // Scales the awareness radius the entity is relevant within
+        float m_priorityScale; // Scales the rate at which the entity accumulates replication priority
+    };
+
+    static const RelevancySettings& GetRelevancySettings(ReplicationRelevancy relevancy)
+    {
+        static const RelevancySettings LowRelevancy = { 0.5f, 0.5f };
+        static const RelevancySettings NormalRelevancy = { 1.0f, 1.0f };
+        static const RelevancySettings HighRelevancy = { 1.0f, 4.0f };
+        switch (relevancy)
+        {
+        case ReplicationRelevancy::Low:
+            return LowRelevancy;
+        case ReplicationRelevancy::High:
+            return HighRelevancy;
+        default:
+            return NormalRelevancy;
+        }
+    }
 
     const char* GetConnectionStateString(bool isPoor)
     {
@@ -51,11 +81,19 @@ namespace Multiplayer
         return m_priority < rhs.m_priority;
     }
 
-    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection)
-        : m_controlledEntity(controlledEntity)
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow
+    (
+        NetworkEntityHandle controlledEntity,
+        AzNetworking::IConnection* connection,
+        ReplicationInterestGrid* interestGrid
+    )
+        : m_interestGrid(interestGrid)
+        , m_controlledEntity(controlledEntity)
         , m_connection(connection)
         , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
         , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
+        , m_lastBudgetUpdateTimeMs(AZ::GetElapsedTimeMs())
+        , m_availableBandwidthBytes(static_cast<float>(static_cast<uint32_t>(sv_ClientBandwidthBudgetBytesPerSec)))
     {
         AZ::Entity* entity = m_controlledEntity.GetEntity();
         AZ_Assert(entity, "Invalid controlled entity provided to replication window");
@@ -80,7 +118,21 @@ namespace Multiplayer
 
     uint32_t ServerToClientReplicationWindow::GetMaxProxyEntityReplicatorSendCount() const
     {
-        return m_isPoorConnection ? sv_MinEntitiesToReplicate : sv_MaxEntitiesToReplicate;
+        const uint32_t maxSendCount = m_isPoorConnection ? sv_MinEntitiesToReplicate : sv_MaxEntitiesToReplicate;
+        if ((sv_ClientBandwidthBudgetBytesPerSec == 0) || (m_averageEntityUpdateBytes <= 0.0f))
+        {
+            return maxSendCount;
+        }
+
+        if (m_availableBandwidthBytes <= 0.0f)
+        {
+            // Budget exhausted, only autonomous entities are sent until it refills
+            return 0;
+        }
+
+        // Estimate how many entity updates still fit in the remaining budget
+        const uint32_t budgetSendCount = static_cast<uint32_t>(AZStd::ceil(m_availableBandwidthBytes / m_averageEntityUpdateBytes));
+        return AZStd::min(maxSendCount, budgetSendCount);
     }
 
     bool ServerToClientReplicationWindow::IsInWindow([[maybe_unused]] const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
@@ -98,7 +150,10 @@ namespace Multiplayer
         // Move the clearQueueContainer into the ReplicationCandidateQueue to maintain the reserved memory
         ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
         m_candidateQueue.swap(clearQueue);
-        m_replicationSet.clear();
+
+        // Keep the previous set around, it determines which entities are subject to hysteresis and their accumulated priority
+        ReplicationSet previousReplicationSet;
+        previousReplicationSet.swap(m_replicationSet);
 
         NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
         if (!netBindComponent || !netBindComponent->HasController())
@@ -112,52 +167,52 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
-        if (visibilitySystem)
-        {
-            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
-                awarenessSphere,
-                [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
-                {
-                    gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                    for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                    {
-                        if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                        {
-                            gatheredEntries.push_back(visEntry);
-                        }
-                    }
-                });
-        }
+        // Entities enter the window within the awareness radius, but only leave it once they move past the hysteresis radius
+        const float enterRadius = sv_ClientAwarenessRadius;
+        const float leaveRadius = enterRadius * (1.0f + AZStd::max(static_cast<float>(sv_ClientAwarenessHysteresis), 0.0f));
+
+        m_gatheredCandidates.clear();
+        GatherCandidates(controlledEntityPosition, leaveRadius, m_gatheredCandidates);
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
         IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
 
         // Add all the neighbours
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        for (GatheredCandidate& candidate : m_gatheredCandidates)
         {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
-            if (entityHandle.GetNetBindComponent() == nullptr)
+            NetBindComponent* candidateNetBindComponent = candidate.m_entityHandle.GetNetBindComponent();
+            if (candidateNetBindComponent == nullptr)
             {
                 // Entity does not have netbinding, skip this entity
                 continue;
             }
 
+            AZ::Entity* entity = candidate.m_entityHandle.GetEntity();
             if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
             {
                 continue;
             }
 
-            // We want to find the closest extent to the player and prioritize using that distance
-            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
-                
-            AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
+            const RelevancySettings& relevancy = GetRelevancySettings(candidateNetBindComponent->GetReplicationRelevancy());
+            const bool wasInWindow = previousReplicationSet.find(candidate.m_entityHandle) != previousReplicationSet.end();
+            const float relevancyRadius = (wasInWindow ? leaveRadius : enterRadius) * relevancy.m_radiusScale;
+            if (candidate.m_distanceSquared > relevancyRadius * relevancyRadius)
+            {
+                continue;
+            }
+
+            const float priority = relevancy.m_priorityScale / AZStd::max(candidate.m_distanceSquared, 1.0f);
+            ConstNetworkEntityHandle entityHandle = candidate.m_entityHandle;
+            AddEntityToReplicationSet(entityHandle, priority, candidate.m_distanceSquared);
+        }
+
+        // Entities keep accumulating priority until they're sent, so distant entities still get sent when the send count is limited
+        for (auto& [entityHandle, replicationData] : m_replicationSet)
+        {
+            auto previousIter = previousReplicationSet.find(entityHandle);
+            if (previousIter != previousReplicationSet.end())
+            {
+                replicationData.m_priority += previousIter->second.m_priority;
+            }
         }
 
         // Add in all entities that have forced relevancy
@@ -188,6 +243,21 @@ namespace Multiplayer
         entityUpdatePacket.SetHostTimeMs(GetNetworkTime()->GetHostTimeMs());
         entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
         entityUpdatePacket.SetEntityMessages(entityUpdateVector);
+
+        // Sent entities start accumulating priority from scratch
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        uint32_t sentBytes = 0;
+        for (const NetworkEntityUpdateMessage& updateMessage : entityUpdateVector)
+        {
+            sentBytes += updateMessage.GetEstimatedSerializeSize();
+            auto iter = m_replicationSet.find(networkEntityTracker->Get(updateMessage.GetEntityId()));
+            if ((iter != m_replicationSet.end()) && (iter->second.m_netEntityRole == NetEntityRole::Client))
+            {
+                iter->second.m_priority = 0.0f;
+            }
+        }
+        ConsumeBandwidthBudget(sentBytes, aznumeric_cast<uint32_t>(entityUpdateVector.size()));
+
         return m_connection->SendUnreliablePacket(entityUpdatePacket);
     }
 
@@ -285,6 +355,53 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::GatherCandidates(const AZ::Vector3& position, float radius, GatheredCandidates& outCandidates)
+    {
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        if (m_interestGrid && sv_UseReplicationInterestGrid)
+        {
+            m_interestGrid->Update(*networkEntityTracker, GetNetworkTime()->GetHostFrameId());
+
+            ReplicationInterestGrid::GatheredEntities gatheredEntities;
+            m_interestGrid->Gather(position, radius, gatheredEntities);
+            outCandidates.reserve(gatheredEntities.size());
+            for (const ReplicationInterestGrid::GatheredEntity& gatheredEntity : gatheredEntities)
+            {
+                NetworkEntityHandle entityHandle = networkEntityTracker->Get(gatheredEntity.m_netEntityId);
+                if (entityHandle.Exists())
+                {
+                    outCandidates.push_back({ entityHandle, gatheredEntity.m_distanceSquared });
+                }
+            }
+            return;
+        }
+
+        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+        if (!visibilitySystem)
+        {
+            return;
+        }
+
+        const AZ::Sphere awarenessSphere = AZ::Sphere(position, radius);
+        visibilitySystem->GetDefaultVisibilityScene()->Enumerate(
+            awarenessSphere,
+            [&position, &outCandidates, networkEntityTracker](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                outCandidates.reserve(outCandidates.size() + nodeData.m_entries.size());
+                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                {
+                    if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                    {
+                        // We want to find the closest extent to the player and prioritize using that distance
+                        const AZ::Vector3 supportNormal = position - visEntry->m_boundingVolume.GetCenter();
+                        const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
+                        AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+                        outCandidates.push_back({ NetworkEntityHandle(entity, networkEntityTracker), position.GetDistanceSq(closestPosition) });
+                    }
+                }
+            });
+    }
+
     void ServerToClientReplicationWindow::EvaluateConnection()
     {
         const uint32_t newPacketsSent = m_connection->GetMetrics().m_packetsSent;
@@ -314,6 +431,33 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::ConsumeBandwidthBudget(uint32_t sentBytes, uint32_t sentEntityCount)
+    {
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        const float elapsedSeconds = AZ::TimeMsToSeconds(currentTimeMs - m_lastBudgetUpdateTimeMs);
+        m_lastBudgetUpdateTimeMs = currentTimeMs;
+
+        const float budgetBytesPerSec = static_cast<float>(static_cast<uint32_t>(sv_ClientBandwidthBudgetBytesPerSec));
+        if (budgetBytesPerSec <= 0.0f)
+        {
+            return;
+        }
+
+        // Refill the budget for the elapsed time, allowing bursts of up to a second worth of bandwidth
+        m_availableBandwidthBytes = AZStd::min(m_availableBandwidthBytes + budgetBytesPerSec * elapsedSeconds, budgetBytesPerSec);
+        m_availableBandwidthBytes -= static_cast<float>(sentBytes);
+
+        if (sentEntityCount > 0)
+        {
+            // Smooth the average so a single large entity doesn't stall the remaining entities
+            static constexpr float AverageSmoothing = 0.1f;
+            const float entityUpdateBytes = static_cast<float>(sentBytes) / static_cast<float>(sentEntityCount);
+            m_averageEntityUpdateBytes = (m_averageEntityUpdateBytes > 0.0f)
+                ? AZ::Lerp(m_averageEntityUpdateBytes, entityUpdateBytes, AverageSmoothing)
+                : entityUpdateBytes;
+        }
+    }
+
     void ServerToClientReplicationWindow::AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, [[maybe_unused]] float distanceSquared)
     {
         // Assumption: the entity has been checked for filtering prior to this call.
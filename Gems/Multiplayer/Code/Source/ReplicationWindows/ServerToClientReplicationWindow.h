@@ -21,6 +21,7 @@ namespace Multiplayer
 {
     class NetSystemComponent;
     class NetworkHierarchyRootComponent;
+    class ReplicationInterestGrid;
 
     class ServerToClientReplicationWindow
         : public IReplicationWindow
@@ -39,7 +40,12 @@ namespace Multiplayer
         // we sort lowest priority first, so that we can easily keep the biggest N priorities
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
-        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        //! Constructs a replication window for the client controlling the provided entity.
+        //! @param controlledEntity the entity controlled by the client
+        //! @param connection       the connection to the client
+        //! @param interestGrid     optional spatial hash shared between windows, the visibility system is used to gather entities if null
+        ServerToClientReplicationWindow(
+            NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, ReplicationInterestGrid* interestGrid = nullptr);
 
         //! IReplicationWindow interface
         //! @{
@@ -58,16 +64,27 @@ namespace Multiplayer
 
     private:
 
+        struct GatheredCandidate
+        {
+            NetworkEntityHandle m_entityHandle;
+            float m_distanceSquared = 0.0f;
+        };
+        using GatheredCandidates = AZStd::vector<GatheredCandidate>;
+
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
+        void GatherCandidates(const AZ::Vector3& position, float radius, GatheredCandidates& outCandidates);
         void EvaluateConnection();
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
+        void ConsumeBandwidthBudget(uint32_t sentBytes, uint32_t sentEntityCount);
 
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
 
         // sorted in reverse, lowest priority is the top()
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
+        GatheredCandidates m_gatheredCandidates;
+        ReplicationInterestGrid* m_interestGrid = nullptr;
 
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
@@ -81,5 +98,10 @@ namespace Multiplayer
         uint32_t m_lastCheckedSentPackets = 0;
         uint32_t m_lastCheckedLostPackets = 0;
         bool     m_isPoorConnection = true;
+
+        // Entity update bandwidth budget, refilled at sv_ClientBandwidthBudgetBytesPerSec
+        AZ::TimeMs m_lastBudgetUpdateTimeMs = AZ::Time::ZeroTimeMs;
+        float m_availableBandwidthBytes = 0.0f;
+        float m_averageEntityUpdateBytes = 0.0f;
     };
 }
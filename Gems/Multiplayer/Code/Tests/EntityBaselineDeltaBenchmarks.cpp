@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    //! Connection that reports the packets the simulated trace delivered as acknowledged.
+    class BaselineTraceConnection : public IConnection
+    {
+    public:
+        BaselineTraceConnection()
+            : IConnection(ConnectionId{ 1 }, IpAddress())
+        {
+            ;
+        }
+
+        ~BaselineTraceConnection() override = default;
+
+        void Acknowledge(PacketId packetId)
+        {
+            const uint32_t index = aznumeric_cast<uint32_t>(packetId);
+            if (index >= m_ackedPackets.size())
+            {
+                m_ackedPackets.resize(index + 1, false);
+            }
+            m_ackedPackets[index] = true;
+        }
+
+        void Reset()
+        {
+            m_ackedPackets.clear();
+        }
+
+        bool SendReliablePacket([[maybe_unused]] const IPacket& packet) override
+        {
+            return false;
+        }
+
+        PacketId SendUnreliablePacket([[maybe_unused]] const IPacket& packet) override
+        {
+            return {};
+        }
+
+        bool WasPacketAcked(PacketId packetId) const override
+        {
+            const uint32_t index = aznumeric_cast<uint32_t>(packetId);
+            return (index < m_ackedPackets.size()) && m_ackedPackets[index];
+        }
+
+        ConnectionState GetConnectionState() const override
+        {
+            return {};
+        }
+
+        ConnectionRole GetConnectionRole() const override
+        {
+            return {};
+        }
+
+        bool Disconnect([[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            return false;
+        }
+
+        void SetConnectionMtu([[maybe_unused]] uint32_t connectionMtu) override
+        {
+        }
+
+        uint32_t GetConnectionMtu() const override
+        {
+            return 0;
+        }
+
+    private:
+        AZStd::vector<bool> m_ackedPackets;
+    };
+
+    /*
+     * Replays a deterministic movement trace of 64 players to a single client and compares the bytes needed to send every player's
+     * full state each tick with the bytes needed when delta-serializing against the most recent acknowledged baseline.
+     * Packets are acknowledged a few ticks after being sent and a fraction of them is lost, so deltas are taken against older baselines.
+     */
+    class EntityBaselineDeltaBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t PlayerCount = 64;
+        static constexpr uint32_t TickCount = 600;
+        static constexpr uint32_t AckDelayTicks = 3;
+        static constexpr uint32_t PacketLossPercent = 5;
+        static constexpr uint32_t BaselineHistorySize = 16;
+        static constexpr float TickSeconds = 1.0f / 60.0f;
+
+        struct PlayerState
+        {
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_velocity = AZ::Vector3::CreateZero();
+            float m_yaw = 0.0f;
+            uint16_t m_health = 100;
+            uint8_t m_ammo = 30;
+            uint8_t m_movementState = 0;
+            bool m_idle = false;
+        };
+
+        struct TraceResult
+        {
+            uint64_t m_fullBytes = 0;
+            uint64_t m_deltaBytes = 0;
+            uint64_t m_deltaUpdates = 0;
+            bool m_valid = true;
+        };
+
+        //! Serializes a player the way its replicated properties would be, positions in centimeters and angles in 1/65536 turns.
+        static uint32_t SerializePlayer(const PlayerState& player, uint8_t* buffer, uint32_t capacity)
+        {
+            InputSerializer inputSerializer(buffer, capacity);
+            ISerializer& serializer = inputSerializer;
+            uint32_t record = 0x7F;
+            int32_t position[3] = { static_cast<int32_t>(player.m_position.GetX() * 100.0f),
+                                    static_cast<int32_t>(player.m_position.GetY() * 100.0f),
+                                    static_cast<int32_t>(player.m_position.GetZ() * 100.0f) };
+            int16_t velocity[3] = { static_cast<int16_t>(player.m_velocity.GetX() * 100.0f),
+                                    static_cast<int16_t>(player.m_velocity.GetY() * 100.0f),
+                                    static_cast<int16_t>(player.m_velocity.GetZ() * 100.0f) };
+            uint16_t yaw = static_cast<uint16_t>(player.m_yaw / AZ::Constants::TwoPi * 65535.0f);
+            uint16_t health = player.m_health;
+            uint8_t ammo = player.m_ammo;
+            uint8_t movementState = player.m_movementState;
+
+            serializer.Serialize(record, "Record");
+            serializer.Serialize(position[0], "PositionX");
+            serializer.Serialize(position[1], "PositionY");
+            serializer.Serialize(position[2], "PositionZ");
+            serializer.Serialize(velocity[0], "VelocityX");
+            serializer.Serialize(velocity[1], "VelocityY");
+            serializer.Serialize(velocity[2], "VelocityZ");
+            serializer.Serialize(yaw, "Yaw");
+            serializer.Serialize(health, "Health");
+            serializer.Serialize(ammo, "Ammo");
+            serializer.Serialize(movementState, "MovementState");
+            return inputSerializer.IsValid() ? inputSerializer.GetSize() : 0;
+        }
+
+        static void SimulatePlayer(PlayerState& player, AZ::SimpleLcgRandom& random)
+        {
+            if (player.m_idle)
+            {
+                // Idle players occasionally look around
+                if (random.GetRandom() % 20 == 0)
+                {
+                    player.m_yaw = AZStd::fmod(player.m_yaw + random.GetRandomFloat() * 0.5f, AZ::Constants::TwoPi);
+                }
+                return;
+            }
+
+            // Players change direction every so often and turn to face where they are going
+            if (random.GetRandom() % 10 == 0)
+            {
+                const float heading = random.GetRandomFloat() * AZ::Constants::TwoPi;
+                const float speed = 2.0f + random.GetRandomFloat() * 4.0f;
+                player.m_velocity = AZ::Vector3(AZStd::cos(heading) * speed, AZStd::sin(heading) * speed, 0.0f);
+                player.m_yaw = heading;
+                player.m_movementState = static_cast<uint8_t>(speed > 4.0f ? 2 : 1);
+            }
+            player.m_position += player.m_velocity * TickSeconds;
+
+            if ((random.GetRandom() % 60 == 0) && (player.m_ammo > 0))
+            {
+                --player.m_ammo;
+            }
+            if ((random.GetRandom() % 120 == 0) && (player.m_health > 10))
+            {
+                player.m_health -= 10;
+            }
+        }
+
+        static TraceResult ReplayTrace(BaselineTraceConnection& connection)
+        {
+            TraceResult result;
+            AZ::SimpleLcgRandom random(1234);
+            connection.Reset();
+
+            AZStd::vector<PlayerState> players(PlayerCount);
+            for (PlayerState& player : players)
+            {
+                player.m_position = AZ::Vector3(random.GetRandomFloat() * 200.0f, random.GetRandomFloat() * 200.0f, 0.0f);
+                player.m_idle = (random.GetRandom() % 4 == 0);
+            }
+
+            AZStd::vector<EntityBaselineHistory> sentBaselines(PlayerCount, EntityBaselineHistory(BaselineHistorySize));
+            AZStd::vector<EntityBaselineHistory> receivedBaselines(PlayerCount, EntityBaselineHistory(BaselineHistorySize));
+            AZStd::vector<bool> packetDelivered(TickCount + 1, false);
+            ByteBuffer<1024> state;
+            ByteBuffer<1024> delta;
+            AZStd::vector<uint8_t> decodedState;
+
+            for (uint32_t tick = 0; tick < TickCount; ++tick)
+            {
+                // All the player updates of a tick are sent in a single packet
+                const PacketId packetId = PacketId{ tick + 1 };
+                packetDelivered[tick + 1] = (random.GetRandom() % 100) >= PacketLossPercent;
+                if ((tick >= AckDelayTicks) && packetDelivered[tick + 1 - AckDelayTicks])
+                {
+                    connection.Acknowledge(PacketId{ tick + 1 - AckDelayTicks });
+                }
+
+                const EntityBaselineSequence sequence = static_cast<EntityBaselineSequence>(tick);
+                for (uint32_t playerIndex = 0; playerIndex < PlayerCount; ++playerIndex)
+                {
+                    SimulatePlayer(players[playerIndex], random);
+                    const uint32_t stateSize = SerializePlayer(players[playerIndex], state.GetBuffer(), aznumeric_cast<uint32_t>(state.GetCapacity()));
+
+                    uint32_t deltaSize = 0;
+                    const EntityBaseline* ackedBaseline = sentBaselines[playerIndex].FindMostRecentAcked(connection);
+                    const EntityBaselineSequence deltaSequence = ackedBaseline ? ackedBaseline->m_sequence : sequence;
+                    if (ackedBaseline != nullptr)
+                    {
+                        deltaSize = EncodeBaselineDelta(
+                            *ackedBaseline, state.GetBuffer(), stateSize, delta.GetBuffer(), aznumeric_cast<uint32_t>(delta.GetCapacity()));
+                    }
+                    const bool isDelta = (deltaSize > 0) && (deltaSize < stateSize);
+                    sentBaselines[playerIndex].Store(sequence, state.GetBuffer(), stateSize).m_sentPacketId = packetId;
+
+                    // Both schemes pay for the update header, baseline updates additionally carry two sequence numbers
+                    result.m_fullBytes += stateSize;
+                    result.m_deltaBytes += (isDelta ? deltaSize : stateSize) + 2 * sizeof(EntityBaselineSequence);
+                    result.m_deltaUpdates += isDelta ? 1 : 0;
+
+                    if (!packetDelivered[tick + 1])
+                    {
+                        continue;
+                    }
+
+                    // Reconstruct the state on the receiving end to make sure the delta is usable
+                    if (isDelta)
+                    {
+                        const EntityBaseline* receivedBaseline = receivedBaselines[playerIndex].Find(deltaSequence);
+                        if ((receivedBaseline == nullptr) || !DecodeBaselineDelta(*receivedBaseline, delta.GetBuffer(), deltaSize, decodedState)
+                            || (decodedState.size() != stateSize) || (memcmp(decodedState.data(), state.GetBuffer(), stateSize) != 0))
+                        {
+                            result.m_valid = false;
+                            return result;
+                        }
+                    }
+                    receivedBaselines[playerIndex].Store(sequence, state.GetBuffer(), stateSize);
+                }
+            }
+            return result;
+        }
+    };
+
+    BENCHMARK_DEFINE_F(EntityBaselineDeltaBenchmark, ReplayMovementTrace)(benchmark::State& state)
+    {
+        BaselineTraceConnection connection;
+        TraceResult result;
+        for ([[maybe_unused]] auto value : state)
+        {
+            result = ReplayTrace(connection);
+            if (!result.m_valid)
+            {
+                state.SkipWithError("Failed to reconstruct a player state from a baseline delta");
+                return;
+            }
+        }
+
+        const double updateCount = static_cast<double>(PlayerCount) * TickCount;
+        state.counters["FullBytesPerTick"] = benchmark::Counter(static_cast<double>(result.m_fullBytes) / TickCount);
+        state.counters["DeltaBytesPerTick"] = benchmark::Counter(static_cast<double>(result.m_deltaBytes) / TickCount);
+        state.counters["DeltaRatio"] = benchmark::Counter(static_cast<double>(result.m_deltaBytes) / static_cast<double>(result.m_fullBytes));
+        state.counters["DeltaUpdateRatio"] = benchmark::Counter(static_cast<double>(result.m_deltaUpdates) / updateCount);
+    }
+
+    BENCHMARK_REGISTER_F(EntityBaselineDeltaBenchmark, ReplayMovementTrace)
+        ->Unit(benchmark::kMillisecond)
+        ;
+}
+
+#endif
@@ -9,6 +9,7 @@
 
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Time/ITime.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzTest/AzTest.h>
@@ -157,6 +158,16 @@ namespace UnitTest
         MOCK_CONST_METHOD1(QueryApplicationType, void(AZ::ApplicationTypeQuery&));
     };
 
+    class MockEntityBoundsUnion : public AzFramework::IEntityBoundsUnion
+    {
+    public:
+        MOCK_METHOD1(RefreshEntityLocalBoundsUnion, void(AZ::EntityId));
+        MOCK_CONST_METHOD1(GetEntityLocalBoundsUnion, AZ::Aabb(AZ::EntityId));
+        MOCK_CONST_METHOD1(GetEntityWorldBoundsUnion, AZ::Aabb(AZ::EntityId));
+        MOCK_METHOD0(ProcessEntityBoundsUnionRequests, void());
+        MOCK_METHOD1(OnTransformUpdated, void(AZ::Entity*));
+    };
+
     class MockSerializer : public ISerializer
     {
     public:
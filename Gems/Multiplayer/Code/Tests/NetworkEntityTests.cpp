@@ -13,6 +13,7 @@
 #include <Source/EntityDomains/FullOwnershipEntityDomain.h>
 #include <Source/EntityDomains/NullEntityDomain.h>
 #include <Source/ReplicationWindows/NullReplicationWindow.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/Name.h>
@@ -23,7 +24,9 @@
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzTest/AzTest.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/PropertySnapshotCache.h>
 #include <Multiplayer/NetworkInput/NetworkInput.h>
 #include <Multiplayer/NetworkInput/NetworkInputArray.h>
 #include <Multiplayer/NetworkInput/NetworkInputHistory.h>
@@ -400,6 +403,21 @@ namespace Multiplayer
         EXPECT_TRUE(m_entityReplicationManager->HandleEntityUpdateMessage(m_mockConnection.get(), header, deleteMessage));
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, EntityReplicationManagerGenerateUpdatesDoesNotSendPackets)
+    {
+        // Generating updates may run on a task graph thread, so packets must only be sent once the generated updates are sent.
+        m_entityReplicationManager->SetReplicationWindow(AZStd::make_unique<NullReplicationWindow>(m_mockConnection.get()));
+
+        EXPECT_CALL(*m_mockConnection, SendUnreliablePacket(::testing::_)).Times(0);
+        EXPECT_CALL(*m_mockConnection, SendReliablePacket(::testing::_)).Times(0);
+        m_entityReplicationManager->GenerateUpdates();
+        ::testing::Mock::VerifyAndClearExpectations(m_mockConnection.get());
+
+        // An entity update packet goes out every update, even when no entity changed.
+        EXPECT_CALL(*m_mockConnection, SendUnreliablePacket(::testing::_)).Times(1);
+        m_entityReplicationManager->SendGeneratedUpdates();
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, EntityReplicatorDeleteMessageIncludesUpdatedProperties)
     {
         // When sending a delete message, the message should also contain any properties that were changed
@@ -484,6 +502,329 @@ namespace Multiplayer
         EXPECT_FALSE(m_root->m_replicator->HasChangesToPublish());
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, EntityReplicatorsWithMatchingRecordsShareUpdateData)
+    {
+        // Replicators for different connections that send the same record within a host frame should reuse the serialized data.
+        ON_CALL(*m_mockNetworkTime, GetHostFrameId()).WillByDefault(::testing::Return(HostFrameId{ 1 }));
+
+        const NetworkEntityHandle rootHandle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        EntityReplicator otherReplicator(*m_entityReplicationManager, m_mockConnection.get(), NetEntityRole::Client, rootHandle);
+        otherReplicator.Initialize(rootHandle);
+
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        const uint64_t previousHits = stats.m_propertySnapshotHits;
+
+        EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage message = m_root->m_replicator->GenerateUpdatePacket();
+        EXPECT_TRUE(otherReplicator.PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage otherMessage = otherReplicator.GenerateUpdatePacket();
+
+        EXPECT_EQ(previousHits + 1, stats.m_propertySnapshotHits);
+        ASSERT_EQ(message.GetData()->GetSize(), otherMessage.GetData()->GetSize());
+        EXPECT_EQ(0, memcmp(message.GetData()->GetBuffer(), otherMessage.GetData()->GetBuffer(), message.GetData()->GetSize()));
+
+        // Changing a property must discard the snapshots serialized with the previous value.
+        NetBindComponent* netBindComponent = m_root->m_entity->FindComponent<NetBindComponent>();
+        EXPECT_EQ(1, netBindComponent->GetPropertySnapshotCache().GetSnapshotCount());
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(1.0f, 2.0f, 3.0f));
+        EXPECT_EQ(0, netBindComponent->GetPropertySnapshotCache().GetSnapshotCount());
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, PropertySnapshotCacheClearDiscardsStoredSnapshots)
+    {
+        PropertySnapshotCache snapshotCache;
+        const uint8_t recordData[] = { 1, 2, 3, 4 };
+        const uint8_t otherRecordData[] = { 5, 6, 7, 8 };
+
+        // Clearing an empty cache is the common case for property changes and must leave it empty.
+        snapshotCache.Clear();
+        EXPECT_EQ(0, snapshotCache.GetSnapshotCount());
+
+        snapshotCache.Store(HostFrameId(1), NetEntityRole::Client, recordData, 2, sizeof(recordData));
+        snapshotCache.Store(HostFrameId(1), NetEntityRole::Client, otherRecordData, 2, sizeof(otherRecordData));
+        EXPECT_EQ(2, snapshotCache.GetSnapshotCount());
+
+        uint8_t buffer[sizeof(recordData)] = { 1, 2 };
+        EXPECT_EQ(sizeof(recordData), snapshotCache.Fetch(HostFrameId(1), NetEntityRole::Client, buffer, 2, sizeof(buffer)));
+        EXPECT_EQ(0, memcmp(recordData, buffer, sizeof(recordData)));
+
+        snapshotCache.Clear();
+        EXPECT_EQ(0, snapshotCache.GetSnapshotCount());
+        EXPECT_EQ(0, snapshotCache.Fetch(HostFrameId(1), NetEntityRole::Client, buffer, 2, sizeof(buffer)));
+        snapshotCache.Clear();
+        EXPECT_EQ(0, snapshotCache.GetSnapshotCount());
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, ReplicationInterestGridTracksEntityMovement)
+    {
+        const NetworkEntityTracker& networkEntityTracker = *m_networkEntityManager->GetNetworkEntityTracker();
+        const AZ::Vector3 farPosition(1000.0f, 0.0f, 0.0f);
+        ReplicationInterestGrid grid;
+        ReplicationInterestGrid::GatheredEntities gatheredEntities;
+
+        grid.Update(networkEntityTracker, HostFrameId{ 1 });
+        EXPECT_EQ(1, grid.GetEntityCount());
+        EXPECT_EQ(1, grid.GetCellCount());
+
+        grid.Gather(AZ::Vector3::CreateZero(), 10.0f, gatheredEntities);
+        ASSERT_EQ(1, gatheredEntities.size());
+        EXPECT_EQ(m_root->m_netId, gatheredEntities[0].m_netEntityId);
+        EXPECT_FLOAT_EQ(0.0f, gatheredEntities[0].m_distanceSquared);
+
+        gatheredEntities.clear();
+        grid.Gather(farPosition, 10.0f, gatheredEntities);
+        EXPECT_TRUE(gatheredEntities.empty());
+
+        // Moves are only picked up once per host frame
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, farPosition);
+        grid.Update(networkEntityTracker, HostFrameId{ 1 });
+        grid.Gather(farPosition, 10.0f, gatheredEntities);
+        EXPECT_TRUE(gatheredEntities.empty());
+
+        grid.Update(networkEntityTracker, HostFrameId{ 2 });
+        grid.Gather(farPosition, 10.0f, gatheredEntities);
+        ASSERT_EQ(1, gatheredEntities.size());
+        EXPECT_EQ(m_root->m_netId, gatheredEntities[0].m_netEntityId);
+        EXPECT_EQ(1, grid.GetCellCount());
+
+        gatheredEntities.clear();
+        grid.Gather(AZ::Vector3::CreateZero(), 10.0f, gatheredEntities);
+        EXPECT_TRUE(gatheredEntities.empty());
+
+        grid.Clear();
+        EXPECT_EQ(0, grid.GetEntityCount());
+        EXPECT_EQ(0, grid.GetCellCount());
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, ReplicationInterestGridMeasuresToClosestBoundsExtent)
+    {
+        const NetworkEntityTracker& networkEntityTracker = *m_networkEntityManager->GetNetworkEntityTracker();
+
+        // The center of the bounds is a few cells away, but the bounds reach close to the origin
+        const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(5.0f, -5.0f, -5.0f), AZ::Vector3(505.0f, 5.0f, 5.0f));
+        testing::NiceMock<UnitTest::MockEntityBoundsUnion> mockEntityBoundsUnion;
+        ON_CALL(mockEntityBoundsUnion, GetEntityWorldBoundsUnion(testing::_)).WillByDefault(testing::Return(bounds));
+        AZ::Interface<AzFramework::IEntityBoundsUnion>::Register(&mockEntityBoundsUnion);
+
+        ReplicationInterestGrid grid;
+        ReplicationInterestGrid::GatheredEntities gatheredEntities;
+        grid.Update(networkEntityTracker, HostFrameId{ 1 });
+        grid.Gather(AZ::Vector3::CreateZero(), 10.0f, gatheredEntities);
+        ASSERT_EQ(1, gatheredEntities.size());
+        EXPECT_EQ(m_root->m_netId, gatheredEntities[0].m_netEntityId);
+        EXPECT_FLOAT_EQ(75.0f, gatheredEntities[0].m_distanceSquared);
+
+        gatheredEntities.clear();
+        grid.Gather(AZ::Vector3(-20.0f, 0.0f, 0.0f), 10.0f, gatheredEntities);
+        EXPECT_TRUE(gatheredEntities.empty());
+
+        AZ::Interface<AzFramework::IEntityBoundsUnion>::Unregister(&mockEntityBoundsUnion);
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, ReplicationInterestGridOnlyRehashesMovedEntities)
+    {
+        const NetworkEntityTracker& networkEntityTracker = *m_networkEntityManager->GetNetworkEntityTracker();
+        const AZ::Vector3 farPosition(1000.0f, 0.0f, 0.0f);
+        testing::NiceMock<UnitTest::MockEntityBoundsUnion> mockEntityBoundsUnion;
+        ON_CALL(mockEntityBoundsUnion, GetEntityWorldBoundsUnion(testing::_)).WillByDefault(testing::Return(AZ::Aabb::CreateNull()));
+        AZ::Interface<AzFramework::IEntityBoundsUnion>::Register(&mockEntityBoundsUnion);
+
+        ReplicationInterestGrid grid;
+        ReplicationInterestGrid::GatheredEntities gatheredEntities;
+        EXPECT_CALL(mockEntityBoundsUnion, GetEntityWorldBoundsUnion(testing::_)).Times(1);
+        grid.Update(networkEntityTracker, HostFrameId{ 1 });
+        EXPECT_EQ(1, grid.GetEntityCount());
+
+        // Nothing moved and no entities were added or removed, so the bounds aren't read again
+        EXPECT_CALL(mockEntityBoundsUnion, GetEntityWorldBoundsUnion(testing::_)).Times(0);
+        grid.Update(networkEntityTracker, HostFrameId{ 2 });
+
+        EXPECT_CALL(mockEntityBoundsUnion, GetEntityWorldBoundsUnion(testing::_)).Times(1);
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, farPosition);
+        grid.Update(networkEntityTracker, HostFrameId{ 3 });
+        grid.Gather(farPosition, 10.0f, gatheredEntities);
+        ASSERT_EQ(1, gatheredEntities.size());
+        EXPECT_EQ(m_root->m_netId, gatheredEntities[0].m_netEntityId);
+
+        AZ::Interface<AzFramework::IEntityBoundsUnion>::Unregister(&mockEntityBoundsUnion);
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, ReplicationInterestGridHandlesNonFiniteBounds)
+    {
+        const NetworkEntityTracker& networkEntityTracker = *m_networkEntityManager->GetNetworkEntityTracker();
+        const float infinity = AZStd::numeric_limits<float>::infinity();
+
+        // The center of infinite bounds is NaN, which must not be cast to a cell coordinate
+        const AZ::Aabb infiniteBounds =
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(-infinity, -infinity, 0.0f), AZ::Vector3(infinity, infinity, 0.0f));
+        testing::NiceMock<UnitTest::MockEntityBoundsUnion> mockEntityBoundsUnion;
+        ON_CALL(mockEntityBoundsUnion, GetEntityWorldBoundsUnion(testing::_)).WillByDefault(testing::Return(infiniteBounds));
+        AZ::Interface<AzFramework::IEntityBoundsUnion>::Register(&mockEntityBoundsUnion);
+
+        ReplicationInterestGrid grid;
+        ReplicationInterestGrid::GatheredEntities gatheredEntities;
+        grid.Update(networkEntityTracker, HostFrameId{ 1 });
+        EXPECT_EQ(1, grid.GetEntityCount());
+        EXPECT_EQ(1, grid.GetCellCount());
+
+        // Bounds at an infinite position are clamped into the outermost cell and are never within range
+        const AZ::Aabb distantBounds = AZ::Aabb::CreateFromPoint(AZ::Vector3(infinity, 0.0f, 0.0f));
+        ON_CALL(mockEntityBoundsUnion, GetEntityWorldBoundsUnion(testing::_)).WillByDefault(testing::Return(distantBounds));
+        grid.Clear();
+        grid.Update(networkEntityTracker, HostFrameId{ 2 });
+        EXPECT_EQ(1, grid.GetCellCount());
+        grid.Gather(AZ::Vector3::CreateZero(), 10.0f, gatheredEntities);
+        EXPECT_TRUE(gatheredEntities.empty());
+
+        AZ::Interface<AzFramework::IEntityBoundsUnion>::Unregister(&mockEntityBoundsUnion);
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, EntityBaselineDeltaRoundTrip)
+    {
+        EntityBaseline baseline;
+        baseline.m_state.resize(66);
+        for (uint32_t index = 0; index < baseline.m_state.size(); ++index)
+        {
+            baseline.m_state[index] = static_cast<uint8_t>(index);
+        }
+
+        // Change a word in the middle of the state and one of the trailing bytes
+        AZStd::vector<uint8_t> state = baseline.m_state;
+        state[9] = 0xFF;
+        state[65] = 0xFE;
+
+        AzNetworking::PacketEncodingBuffer delta;
+        const uint32_t deltaSize = EncodeBaselineDelta(
+            baseline, state.data(), aznumeric_cast<uint32_t>(state.size()), delta.GetBuffer(), aznumeric_cast<uint32_t>(delta.GetCapacity()));
+        EXPECT_GT(deltaSize, 0);
+        EXPECT_LT(deltaSize, state.size());
+
+        AZStd::vector<uint8_t> decodedState;
+        EXPECT_TRUE(DecodeBaselineDelta(baseline, delta.GetBuffer(), deltaSize, decodedState));
+        EXPECT_EQ(state, decodedState);
+
+        // A baseline with a different footprint can't be used to reconstruct the state
+        EntityBaseline otherBaseline;
+        otherBaseline.m_state.resize(64);
+        EXPECT_FALSE(DecodeBaselineDelta(otherBaseline, delta.GetBuffer(), deltaSize, decodedState));
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, EntityBaselineDeltaFallsBackToFullState)
+    {
+        AzNetworking::PacketEncodingBuffer delta;
+        const uint32_t deltaCapacity = aznumeric_cast<uint32_t>(delta.GetCapacity());
+
+        EntityBaseline baseline;
+        baseline.m_state.resize(64);
+        AZStd::vector<uint8_t> state(68);
+        EXPECT_EQ(0, EncodeBaselineDelta(baseline, state.data(), aznumeric_cast<uint32_t>(state.size()), delta.GetBuffer(), deltaCapacity));
+
+        // States made up of more values than the delta serializer can track are always sent in full
+        baseline.m_state.resize(1024);
+        state.resize(1024);
+        EXPECT_EQ(0, EncodeBaselineDelta(baseline, state.data(), aznumeric_cast<uint32_t>(state.size()), delta.GetBuffer(), deltaCapacity));
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, EntityBaselineHistoryTracksAckedBaselines)
+    {
+        ON_CALL(*m_mockConnection, WasPacketAcked)
+            .WillByDefault([](AzNetworking::PacketId packetId) { return packetId == AzNetworking::PacketId{ 1 }; });
+
+        const uint8_t state[] = { 1, 2, 3, 4 };
+        EntityBaselineHistory history(2);
+        EXPECT_EQ(nullptr, history.GetMostRecent());
+        history.Store(1, state, sizeof(state)).m_sentPacketId = AzNetworking::PacketId{ 1 };
+        history.Store(2, state, sizeof(state)).m_sentPacketId = AzNetworking::PacketId{ 2 };
+        EXPECT_EQ(2, history.GetSize());
+        EXPECT_EQ(2, history.GetMostRecent()->m_sequence);
+
+        const EntityBaseline* ackedBaseline = history.FindMostRecentAcked(*m_mockConnection);
+        ASSERT_NE(nullptr, ackedBaseline);
+        EXPECT_EQ(1, ackedBaseline->m_sequence);
+
+        // Storing a known sequence replaces the existing baseline
+        history.Store(2, state, 2);
+        EXPECT_EQ(2, history.GetSize());
+        EXPECT_EQ(2, history.Find(2)->m_state.size());
+
+        // The oldest baseline is evicted once the history is full
+        history.Store(3, state, sizeof(state));
+        EXPECT_EQ(nullptr, history.Find(1));
+        EXPECT_EQ(nullptr, history.FindMostRecentAcked(*m_mockConnection));
+
+        history.DiscardMostRecent();
+        EXPECT_EQ(2, history.GetMostRecent()->m_sequence);
+        history.Clear();
+        EXPECT_EQ(0, history.GetSize());
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, EntityReplicatorSendsDeltasAgainstAckedBaseline)
+    {
+        m_console->PerformCommand("net_useBaselineDeltaSerialization true");
+        ON_CALL(*m_mockConnection, WasPacketAcked).WillByDefault(::testing::Return(true));
+
+        EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage createMessage = m_root->m_replicator->GenerateUpdatePacket();
+        m_root->m_replicator->RecordSentPacketId(AzNetworking::PacketId{ 1 });
+        EXPECT_TRUE(createMessage.GetHasBaseline());
+        EXPECT_FALSE(createMessage.GetIsBaselineDelta());
+        EXPECT_FALSE(m_root->m_replicator->HasChangesToPublish());
+
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(1.0f, 2.0f, 3.0f));
+        m_networkEntityManager->NotifyEntitiesDirtied();
+        EXPECT_TRUE(m_root->m_replicator->HasChangesToPublish());
+        EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage deltaMessage = m_root->m_replicator->GenerateUpdatePacket();
+        m_root->m_replicator->RecordSentPacketId(AzNetworking::PacketId{ 2 });
+        EXPECT_TRUE(deltaMessage.GetIsBaselineDelta());
+        EXPECT_EQ(createMessage.GetBaselineSequence(), deltaMessage.GetDeltaBaselineSequence());
+        EXPECT_NE(createMessage.GetBaselineSequence(), deltaMessage.GetBaselineSequence());
+        EXPECT_LT(deltaMessage.GetData()->GetSize(), createMessage.GetData()->GetSize());
+
+        // The delta must reconstruct a full state against the baseline the client received
+        EntityBaseline receivedBaseline;
+        receivedBaseline.m_state.assign(createMessage.GetData()->GetBuffer(), createMessage.GetData()->GetBuffer() + createMessage.GetData()->GetSize());
+        AZStd::vector<uint8_t> decodedState;
+        EXPECT_TRUE(DecodeBaselineDelta(
+            receivedBaseline, deltaMessage.GetData()->GetBuffer(), aznumeric_cast<uint32_t>(deltaMessage.GetData()->GetSize()), decodedState));
+        EXPECT_EQ(createMessage.GetData()->GetSize(), decodedState.size());
+
+        m_console->PerformCommand("net_useBaselineDeltaSerialization false");
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, EntityReplicationManagerUnresolvedDeltaDoesNotKeepBaselines)
+    {
+        m_console->PerformCommand("net_useBaselineDeltaSerialization true");
+        ON_CALL(*m_mockConnection, WasPacketAcked).WillByDefault(::testing::Return(true));
+
+        EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage createMessage = m_root->m_replicator->GenerateUpdatePacket();
+        m_root->m_replicator->RecordSentPacketId(AzNetworking::PacketId{ 1 });
+
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(1.0f, 2.0f, 3.0f));
+        m_networkEntityManager->NotifyEntitiesDirtied();
+        EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+        const NetworkEntityUpdateMessage deltaMessage = m_root->m_replicator->GenerateUpdatePacket();
+        m_root->m_replicator->RecordSentPacketId(AzNetworking::PacketId{ 2 });
+        ASSERT_TRUE(deltaMessage.GetIsBaselineDelta());
+        m_console->PerformCommand("net_useBaselineDeltaSerialization false");
+
+        // A delta for an entity without received baselines is rejected without tracking the entity
+        UdpPacketHeader header(PacketType{ 11111 }, InvalidSequenceId, SequenceId{ 1 }, InvalidSequenceId, 0xF8000FFF, SequenceRolloverCount{ 0 });
+        EXPECT_TRUE(m_entityReplicationManager->HandleEntityUpdateMessage(m_mockConnection.get(), header, deltaMessage));
+        EXPECT_EQ(nullptr, m_entityReplicationManager->GetReceivedBaselines(m_root->m_netId));
+
+        // A full baseline is stored, and a delta against a baseline that was never received discards it along with the reset
+        m_entityReplicationManager->HandleEntityUpdateMessage(m_mockConnection.get(), header, createMessage);
+        ASSERT_NE(nullptr, m_entityReplicationManager->GetReceivedBaselines(m_root->m_netId));
+
+        NetworkEntityUpdateMessage unknownDeltaMessage = deltaMessage;
+        unknownDeltaMessage.SetBaselineSequences(
+            deltaMessage.GetBaselineSequence(), static_cast<EntityBaselineSequence>(createMessage.GetBaselineSequence() + 100));
+        EXPECT_TRUE(m_entityReplicationManager->HandleEntityUpdateMessage(m_mockConnection.get(), header, unknownDeltaMessage));
+        EXPECT_EQ(nullptr, m_entityReplicationManager->GetReceivedBaselines(m_root->m_netId));
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityManagerRelevancy)
     {
         ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
@@ -46,6 +46,8 @@ set(FILES
     Include/Multiplayer/MultiplayerTypes.h
     Include/Multiplayer/NetworkEntity/IFilterEntityManager.h
     Include/Multiplayer/NetworkEntity/INetworkEntityManager.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/EntityBaselineHistory.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/PropertySnapshotCache.h
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
     Include/Multiplayer/NetworkInput/IMultiplayerComponentInput.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
@@ -82,6 +84,8 @@ set(FILES
     Source/NetworkEntity/NetworkEntityTracker.h
     Source/NetworkEntity/NetworkEntityTracker.inl
     Source/NetworkEntity/NetworkEntityUpdateMessage.cpp
+    Source/NetworkEntity/EntityReplication/EntityBaselineHistory.cpp
+    Source/NetworkEntity/EntityReplication/PropertySnapshotCache.cpp
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
     Source/NetworkInput/NetworkInput.cpp
     Source/NetworkInput/NetworkInputArray.cpp
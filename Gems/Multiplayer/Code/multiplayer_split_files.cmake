@@ -66,6 +66,8 @@ set(FILES
     Source/NetworkTime/NetworkTime.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
+    Source/ReplicationWindows/ReplicationInterestGrid.cpp
+    Source/ReplicationWindows/ReplicationInterestGrid.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.h
 )
@@ -14,6 +14,7 @@ set(FILES
     Include/Multiplayer/AutoGen/AutoComponent_Source.jinja
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
     Tests/ClientHierarchyTests.cpp
+    Tests/EntityBaselineDeltaBenchmarks.cpp
     Tests/ServerHierarchyBenchmarks.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h